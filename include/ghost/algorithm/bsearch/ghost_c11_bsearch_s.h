@@ -0,0 +1,101 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_C11_BSEARCH_S_H_INCLUDED
+#define GHOST_C11_BSEARCH_S_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Searches a sorted array with a custom callback and context with a signature
+ * matching C11 Annex K bsearch_s() for an element equal to the given key,
+ * returning a pointer to it or null if there is none.
+ *
+ * The compare function is called with the key on the left and an array element
+ * on the right. It must return a negative number, zero or a positive number if
+ * the key is less than, equal to or greater than the element respectively.
+ *
+ * If several elements equal the key, this returns the first of them.
+ *
+ * Unlike a typical bsearch(), this search is branchless: it narrows the range
+ * with conditional moves rather than branches so it doesn't suffer branch
+ * mispredictions. It performs at most ceil(log2(count))+2 comparisons. This
+ * never wraps a platform function.
+ *
+ * A constraint violation calls ghost_fatal() (rather than returning null.)
+ *
+ * @see ghost_bsearch
+ * @see ghost_gnu_bsearch_r
+ * @see ghost_bsd_bsearch_r
+ * @see ghost_win_bsearch_s
+ * @see ghost_lower_bound
+ * @see ghost_eytzinger_lower_bound
+ */
+void* ghost_c11_bsearch_s(const void* key, const void* first, rsize_t count, rsize_t element_size,
+        int (*compare)(const void* key, const void* element, void* context),
+        void* context);
+#endif
+
+/* Handle override */
+#ifndef ghost_has_ghost_c11_bsearch_s
+    #ifdef ghost_c11_bsearch_s
+        #define ghost_has_ghost_c11_bsearch_s 1
+    #endif
+#endif
+
+/* Use the internal implementation */
+#ifndef ghost_has_ghost_c11_bsearch_s
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/bsearch/ghost_impl_bsearch.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    #include "ghost/language/ghost_expect_false.h"
+    #include "ghost/language/ghost_null.h"
+    #include "ghost/debug/ghost_fatal.h"
+    #include "ghost/error/ghost_rsize_t.h"
+
+    GHOST_IMPL_FUNCTION_OPEN
+
+    ghost_impl_inline
+    void* ghost_c11_bsearch_s(const void* key, const void* first, ghost_rsize_t count, ghost_rsize_t element_size,
+            int (*user_compare)(const void* key, const void* element, void* user_context),
+            void* user_context)
+    {
+        ghost_impl_qsort_state_t state;
+
+        if (ghost_expect_false(count > GHOST_RSIZE_BOUNDS ||
+                element_size > GHOST_RSIZE_BOUNDS ||
+                (count > 0 && (key == ghost_null || first == ghost_null || user_compare == ghost_null))))
+            ghost_fatal("constraint violation");
+
+        state.element_size = element_size;
+        state.size_class = ghost_impl_qsort_size_class_any;
+        state.variant = ghost_impl_qsort_variant_gnu;
+        state.compare.gnu = user_compare;
+        state.user_context = user_context;
+        return ghost_impl_bsearch(&state, key, first, count);
+    }
+
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_c11_bsearch_s 1
+#endif
+
+#endif
@@ -0,0 +1,100 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_CDC_INIT_H_INCLUDED
+#define GHOST_CDC_INIT_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Initializes a content-defined chunker with the given minimum, average and
+ * maximum chunk sizes in bytes.
+ *
+ * Chunks are never smaller than min (except the last chunk of a stream) and
+ * never larger than max. The average is rounded down to a power of two; with
+ * FastCDC's normalized chunking the sizes cluster around it.
+ *
+ * Typical values are avg/4, avg and avg*8, for example 2 KiB, 8 KiB and
+ * 64 KiB. The bytes before min are skipped without hashing so a larger
+ * minimum makes chunking faster.
+ *
+ * The sizes must satisfy 0 < min <= avg <= max. This can also be called to
+ * reset the state to start a new stream.
+ *
+ * @see ghost_cdc_t
+ */
+void ghost_cdc_init(ghost_cdc_t* cdc, size_t min, size_t avg, size_t max);
+#endif
+
+#ifndef ghost_has_ghost_cdc_init
+    #ifdef ghost_cdc_init
+        #define ghost_has_ghost_cdc_init 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_cdc_init
+    #include "ghost/algorithm/cdc/ghost_cdc_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_cdc_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_cdc_init 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_cdc_init
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/debug/ghost_assert.h"
+    #include "ghost/language/ghost_static_cast.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    void ghost_cdc_init(ghost_cdc_t* cdc, ghost_size_t min, ghost_size_t avg, ghost_size_t max) GHOST_IMPL_DEF({
+        ghost_size_t bits = 0;
+        ghost_size_t small_bits;
+        ghost_size_t large_bits;
+        ghost_assert(0 < min && min <= avg && avg <= max, "");
+
+        while ((avg >> bits) > 1)
+            ++bits;
+
+        /* Normalized chunking (level 2): a boundary is four times harder to
+         * find before the average size and four times easier after it. The
+         * masks select the high bits of the hash since they depend on the
+         * whole 64-byte window. */
+        small_bits = bits + 2;
+        if (small_bits > 63)
+            small_bits = 63;
+        large_bits = bits < 3 ? 1 : bits - 2;
+        cdc->ghost_impl_mask_small = ~GHOST_UINT64_C(0) << (64 - small_bits);
+        cdc->ghost_impl_mask_large = ~GHOST_UINT64_C(0) << (64 - large_bits);
+
+        cdc->ghost_impl_hash = 0;
+        cdc->ghost_impl_position = 0;
+        cdc->ghost_impl_min = min;
+        cdc->ghost_impl_avg = ghost_static_cast(ghost_size_t, 1) << bits;
+        if (cdc->ghost_impl_avg < min)
+            cdc->ghost_impl_avg = min;
+        cdc->ghost_impl_max = max;
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_cdc_init 1
+#endif
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_CDC_T_H_INCLUDED
+#define GHOST_CDC_T_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * The state of a content-defined chunker.
+ *
+ * Content-defined chunking splits a stream into chunks at positions chosen by
+ * the content itself, so inserting or deleting bytes only changes the chunks
+ * around the edit; chunks after it line up again. This is used for
+ * deduplication and delta synchronization.
+ *
+ * Initialize the state with ghost_cdc_init() and then pass the stream in any
+ * number of pieces to ghost_cdc_next_boundary(). Boundaries don't depend on
+ * how the stream is split into pieces.
+ *
+ * The state is small and trivially copyable. It doesn't reference or buffer
+ * any input.
+ *
+ * @see ghost_cdc_init
+ * @see ghost_cdc_next_boundary
+ */
+typedef struct { /*unspecified*/ } ghost_cdc_t;
+#endif
+
+#ifndef ghost_has_ghost_cdc_t
+    #ifdef ghost_cdc_t
+        #define ghost_has_ghost_cdc_t 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_cdc_t
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #if !ghost_has(ghost_uint64_t)
+        #define ghost_has_ghost_cdc_t 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_cdc_t
+    #include "ghost/type/size_t/ghost_size_t.h"
+    typedef struct ghost_cdc_t {
+        /* This structure is meant to be opaque. Don't access these fields directly. */
+        ghost_uint64_t ghost_impl_hash;
+        ghost_uint64_t ghost_impl_mask_small;
+        ghost_uint64_t ghost_impl_mask_large;
+        ghost_size_t ghost_impl_position;
+        ghost_size_t ghost_impl_min;
+        ghost_size_t ghost_impl_avg;
+        ghost_size_t ghost_impl_max;
+    } ghost_cdc_t;
+    #define ghost_has_ghost_cdc_t 1
+#endif
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_CRC32C_H_INCLUDED
+#define GHOST_CRC32C_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Updates a CRC-32C (Castagnoli) checksum with the given bytes, returning the
+ * new checksum.
+ *
+ * Pass 0 as the initial crc. The checksum of data split into pieces can be
+ * computed by passing the result of each call to the next:
+ *
+ *     uint32_t crc = ghost_crc32c(0, a, a_length);
+ *     crc = ghost_crc32c(crc, b, b_length);
+ *
+ * This uses the same pre- and post-inversion as zlib's crc32() so the result
+ * is the standard CRC-32C used by iSCSI, SCTP, ext4, etc. The check value
+ * ghost_crc32c(0, "123456789", 9) is 0xE3069283.
+ *
+ * This uses the SSE4.2 crc32 instruction on x86-64 (chosen at runtime under
+ * GCC and Clang if SSE4.2 isn't enabled at compile time) or the CRC32
+ * extension on ARMv8, interleaving three streams on long buffers. Otherwise it
+ * uses portable slicing-by-8 tables.
+ *
+ * @see ghost_crc32c_combine
+ */
+uint32_t ghost_crc32c(uint32_t crc, const void* bytes, size_t length);
+#endif
+
+#ifndef ghost_has_ghost_crc32c
+    #ifdef ghost_crc32c
+        #define ghost_has_ghost_crc32c 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_crc32c
+    #include "ghost/type/uint32_t/ghost_uint32_t.h"
+    #include "ghost/type/uint32_t/ghost_uint32_c.h"
+    #if !ghost_has(ghost_uint32_t) || !ghost_has(GHOST_UINT32_C)
+        #define ghost_has_ghost_crc32c 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_crc32c
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/crc32c/ghost_impl_crc32c.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_inline
+    ghost_uint32_t ghost_crc32c(ghost_uint32_t crc, const void* bytes, ghost_size_t length) {
+        return ~ghost_impl_crc32c_update(~crc, bytes, length);
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_crc32c 1
+#endif
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_CRC32C_COMBINE_H_INCLUDED
+#define GHOST_CRC32C_COMBINE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Combines the CRC-32C checksums of two consecutive pieces of data, returning
+ * the checksum of their concatenation.
+ *
+ * crc1 is the checksum of the first piece, crc2 is the checksum of the second
+ * piece and length2 is the length in bytes of the second piece. In other
+ * words:
+ *
+ *     ghost_crc32c_combine(ghost_crc32c(0, a, a_length),
+ *             ghost_crc32c(0, b, b_length), b_length)
+ *
+ * equals the checksum of a followed by b. This lets you checksum pieces of a
+ * buffer in parallel.
+ *
+ * This takes time proportional to the logarithm of length2.
+ *
+ * @see ghost_crc32c
+ */
+uint32_t ghost_crc32c_combine(uint32_t crc1, uint32_t crc2, size_t length2);
+#endif
+
+#ifndef ghost_has_ghost_crc32c_combine
+    #ifdef ghost_crc32c_combine
+        #define ghost_has_ghost_crc32c_combine 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_crc32c_combine
+    #include "ghost/type/uint32_t/ghost_uint32_t.h"
+    #include "ghost/type/uint32_t/ghost_uint32_c.h"
+    #if !ghost_has(ghost_uint32_t) || !ghost_has(GHOST_UINT32_C)
+        #define ghost_has_ghost_crc32c_combine 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_crc32c_combine
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/crc32c/ghost_impl_crc32c.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_inline
+    ghost_uint32_t ghost_crc32c_combine(ghost_uint32_t crc1, ghost_uint32_t crc2, ghost_size_t length2) {
+        /* The inversions of the two checksums cancel out so we can shift the
+         * final checksum directly. */
+        return ghost_impl_crc32c_shift(crc1, length2) ^ crc2;
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_crc32c_combine 1
+#endif
+
+#endif
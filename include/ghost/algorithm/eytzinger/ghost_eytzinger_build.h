@@ -0,0 +1,69 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_EYTZINGER_BUILD_H_INCLUDED
+#define GHOST_EYTZINGER_BUILD_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Copies a sorted array into Eytzinger order for use with
+ * ghost_eytzinger_lower_bound().
+ *
+ * The Eytzinger layout stores an implicit binary search tree in breadth-first
+ * order: the root is at index 0 and the children of the element at index i
+ * are at 2i+1 and 2i+2. The arrays must not overlap.
+ *
+ * Building the layout takes O(n) time. It's meant for read-mostly lookup
+ * tables: rebuild it after the sorted array changes.
+ *
+ * @see ghost_eytzinger_lower_bound
+ * @see ghost_gnu_eytzinger_lower_bound_r
+ */
+void ghost_eytzinger_build(void* to, const void* from, size_t count, size_t element_size);
+#endif
+
+/* Handle override */
+#ifndef ghost_has_ghost_eytzinger_build
+    #ifdef ghost_eytzinger_build
+        #define ghost_has_ghost_eytzinger_build 1
+    #endif
+#endif
+
+/* Use the internal implementation */
+#ifndef ghost_has_ghost_eytzinger_build
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/bsearch/ghost_impl_bsearch.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+
+    GHOST_IMPL_FUNCTION_OPEN
+
+    ghost_impl_inline
+    void ghost_eytzinger_build(void* to, const void* from, ghost_size_t count, ghost_size_t element_size) {
+        ghost_impl_bsearch_eytzinger_build(to, from, count, element_size);
+    }
+
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_eytzinger_build 1
+#endif
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_EYTZINGER_LOWER_BOUND_H_INCLUDED
+#define GHOST_EYTZINGER_LOWER_BOUND_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Searches an array in Eytzinger order with a custom callback, returning the
+ * index in the array of the smallest element that is not less than the given
+ * key, or count if all elements are less than the key.
+ *
+ * The array must have been built with ghost_eytzinger_build(). The compare
+ * function is called with the key on the left and an array element on the
+ * right. It must return a negative number, zero or a positive number if the
+ * key is less than, equal to or greater than the element respectively.
+ *
+ * The Eytzinger layout stores an implicit binary search tree in breadth-first
+ * order so the first few levels of every search share the same few cache lines
+ * and the children of a node are adjacent. This search is branchless and
+ * prefetches the nodes four levels ahead which hides most of the memory
+ * latency for large arrays. It's typically much faster than a binary search
+ * over a sorted array that doesn't fit in cache, so it's a good choice for
+ * large read-mostly lookup tables.
+ *
+ * @see ghost_gnu_eytzinger_lower_bound_r
+ * @see ghost_eytzinger_build
+ * @see ghost_lower_bound
+ */
+size_t ghost_eytzinger_lower_bound(const void* key, const void* first, size_t count, size_t element_size,
+        int (*compare)(const void* key, const void* element));
+#endif
+
+/* Handle override */
+#ifndef ghost_has_ghost_eytzinger_lower_bound
+    #ifdef ghost_eytzinger_lower_bound
+        #define ghost_has_ghost_eytzinger_lower_bound 1
+    #endif
+#endif
+
+/* Use the internal implementation */
+#ifndef ghost_has_ghost_eytzinger_lower_bound
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/bsearch/ghost_impl_bsearch.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    #include "ghost/language/ghost_null.h"
+
+    GHOST_IMPL_FUNCTION_OPEN
+
+    ghost_impl_inline
+    ghost_size_t ghost_eytzinger_lower_bound(const void* key, const void* first, ghost_size_t count, ghost_size_t element_size,
+            int (*user_compare)(const void* key, const void* element))
+    {
+        ghost_impl_qsort_state_t state;
+        state.element_size = element_size;
+        state.size_class = ghost_impl_qsort_size_class_any;
+        state.variant = ghost_impl_qsort_variant_nocontext;
+        state.compare.nocontext = user_compare;
+        state.user_context = ghost_null;
+        return ghost_impl_bsearch_eytzinger_lower_bound(&state, key, first, count);
+    }
+
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_eytzinger_lower_bound 1
+#endif
+
+#endif
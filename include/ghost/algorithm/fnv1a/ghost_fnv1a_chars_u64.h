@@ -0,0 +1,147 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_FNV1A_CHARS_U64_H_INCLUDED
+#define GHOST_FNV1A_CHARS_U64_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * @def GHOST_FNV1A_CHARS_U64(...)
+ *
+ * Computes the 64-bit FNV-1a hash of the given characters as an integer
+ * constant expression.
+ *
+ * This is the same as GHOST_FNV1A_LITERAL_U64() except that the characters are
+ * given as separate arguments. This makes it an integer constant expression
+ * in C so it can be used as a case label or in an enum or static assertion:
+ *
+ *     switch (ghost_fnv1a_cstr_u64(key)) {
+ *         case GHOST_FNV1A_CHARS_U64('w','i','d','t','h'):
+ *             ...
+ *     }
+ *
+ * Between 1 and 32 characters are supported. Character arguments are
+ * hashed as unsigned char.
+ *
+ * This requires variadic macros.
+ *
+ * @see GHOST_FNV1A_LITERAL_U64
+ */
+#define GHOST_FNV1A_CHARS_U64(...)
+#endif
+
+#ifndef ghost_has_GHOST_FNV1A_CHARS_U64
+    #ifdef GHOST_FNV1A_CHARS_U64
+        #define ghost_has_GHOST_FNV1A_CHARS_U64 1
+    #endif
+#endif
+
+#ifndef ghost_has_GHOST_FNV1A_CHARS_U64
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #include "ghost/preprocessor/ghost_count_args.h"
+    #if !ghost_has(ghost_uint64_t) || !ghost_has(GHOST_UINT64_C) || !ghost_has(GHOST_COUNT_ARGS)
+        #define ghost_has_GHOST_FNV1A_CHARS_U64 0
+    #endif
+#endif
+
+#ifndef ghost_has_GHOST_FNV1A_CHARS_U64
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/preprocessor/ghost_concat.h"
+    #include "ghost/preprocessor/ghost_expand.h"
+
+    #define GHOST_IMPL_FNV1A_CHARS_U64_STEP(hash, c) \
+        ghost_static_cast(ghost_uint64_t, ((hash) ^ ghost_static_cast(ghost_uint64_t, (c) & 0xFF)) * GHOST_UINT64_C(1099511628211))
+
+    #define GHOST_IMPL_FNV1A_CHARS_U64_1(h, c1) GHOST_IMPL_FNV1A_CHARS_U64_STEP(h, c1)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_2(h, c1, c2) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_1(h, c1), c2)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_3(h, c1, c2, c3) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_2(h, c1, c2), c3)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_4(h, c1, c2, c3, c4) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_3(h, c1, c2, c3), c4)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_5(h, c1, c2, c3, c4, c5) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_4(h, c1, c2, c3, c4), c5)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_6(h, c1, c2, c3, c4, c5, c6) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_5(h, c1, c2, c3, c4, c5), c6)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_7(h, c1, c2, c3, c4, c5, c6, c7) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_6(h, c1, c2, c3, c4, c5, c6), c7)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_8(h, c1, c2, c3, c4, c5, c6, c7, c8) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_7(h, c1, c2, c3, c4, c5, c6, c7), c8)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_9(h, c1, c2, c3, c4, c5, c6, c7, c8, c9) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_8(h, c1, c2, c3, c4, c5, c6, c7, c8), c9)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_10(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_9(h, c1, c2, c3, c4, c5, c6, c7, c8, c9), c10)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_11(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_10(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10), c11)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_12(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_11(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11), c12)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_13(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_12(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12), c13)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_14(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_13(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13), c14)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_15(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_14(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14), c15)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_16(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_15(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15), c16)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_17(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_16(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16), c17)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_18(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_17(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17), c18)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_19(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_18(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18), c19)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_20(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_19(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19), c20)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_21(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_20(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20), c21)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_22(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_21(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21), c22)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_23(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_22(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22), c23)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_24(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_23(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23), c24)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_25(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_24(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24), c25)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_26(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_25(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25), c26)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_27(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_26(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26), c27)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_28(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_27(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27), c28)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_29(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_28(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28), c29)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_30(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_29(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29), c30)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_31(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30, c31) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_30(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30), c31)
+    #define GHOST_IMPL_FNV1A_CHARS_U64_32(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30, c31, c32) \
+        GHOST_IMPL_FNV1A_CHARS_U64_STEP(GHOST_IMPL_FNV1A_CHARS_U64_31(h, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30, c31), c32)
+
+    #define GHOST_FNV1A_CHARS_U64(...) \
+        GHOST_EXPAND(GHOST_CONCAT(GHOST_IMPL_FNV1A_CHARS_U64_, GHOST_COUNT_ARGS(__VA_ARGS__))( \
+                GHOST_UINT64_C(14695981039346656037), __VA_ARGS__))
+
+    #define ghost_has_GHOST_FNV1A_CHARS_U64 1
+#endif
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_FNV1A_CONSTEXPR_U64_H_INCLUDED
+#define GHOST_FNV1A_CONSTEXPR_U64_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Computes the 64-bit FNV-1a hash of the given characters at compile time
+ * (C++11 and later only.)
+ *
+ * These are constexpr overloads equivalent to ghost_fnv1a_u64() and
+ * ghost_fnv1a_cstr_u64(). When given constant arguments the result is a
+ * constant expression so it can be used as a case label:
+ *
+ *     switch (ghost_fnv1a_cstr_u64(key)) {
+ *         case ghost_fnv1a_constexpr_u64("width"):
+ *             ...
+ *     }
+ *
+ * In C++11 these are recursive so they're meant for short constant keys; in
+ * C++14 and later they're loops. Hash strings at runtime with
+ * ghost_fnv1a_u64() or ghost_fnv1a_cstr_u64() which are faster when the
+ * compiler doesn't evaluate these at compile time.
+ *
+ * @see GHOST_FNV1A_LITERAL_U64
+ * @see ghost_fnv1a_cstr_u64
+ */
+constexpr uint64_t ghost_fnv1a_constexpr_u64(const char* bytes, size_t length);
+constexpr uint64_t ghost_fnv1a_constexpr_u64(const char* string);
+#endif
+
+#ifndef ghost_has_ghost_fnv1a_constexpr_u64
+    #ifdef ghost_fnv1a_constexpr_u64
+        #define ghost_has_ghost_fnv1a_constexpr_u64 1
+    #endif
+#endif
+
+/* This requires C++11. */
+#ifndef ghost_has_ghost_fnv1a_constexpr_u64
+    #ifndef __cplusplus
+        #define ghost_has_ghost_fnv1a_constexpr_u64 0
+    #else
+        #include "ghost/language/ghost_cplusplus.h"
+        #if ghost_cplusplus < 201103L
+            #define ghost_has_ghost_fnv1a_constexpr_u64 0
+        #endif
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_fnv1a_constexpr_u64
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_uint64_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_fnv1a_constexpr_u64 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_fnv1a_constexpr_u64
+    #include "ghost/impl/ghost_impl_function_wrapper.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+
+    GHOST_IMPL_CXX_FUNCTION_OPEN
+
+    #if ghost_cplusplus >= 201402L
+        constexpr ghost_uint64_t ghost_fnv1a_constexpr_u64(const char* bytes, ghost_size_t length) {
+            ghost_uint64_t hash = GHOST_UINT64_C(14695981039346656037);
+            for (; length != 0; --length)
+                hash = static_cast<ghost_uint64_t>((hash ^ (static_cast<unsigned char>(*bytes++) & 0xFFU)) * GHOST_UINT64_C(1099511628211));
+            return hash;
+        }
+
+        constexpr ghost_uint64_t ghost_fnv1a_constexpr_u64(const char* string) {
+            ghost_uint64_t hash = GHOST_UINT64_C(14695981039346656037);
+            for (; *string != 0; ++string)
+                hash = static_cast<ghost_uint64_t>((hash ^ (static_cast<unsigned char>(*string) & 0xFFU)) * GHOST_UINT64_C(1099511628211));
+            return hash;
+        }
+    #else
+        constexpr ghost_uint64_t ghost_impl_fnv1a_constexpr_bytes_u64(const char* bytes, ghost_size_t length, ghost_uint64_t hash) {
+            return length == 0 ? hash : ghost_impl_fnv1a_constexpr_bytes_u64(bytes + 1, length - 1,
+                    static_cast<ghost_uint64_t>((hash ^ (static_cast<unsigned char>(*bytes) & 0xFFU)) * GHOST_UINT64_C(1099511628211)));
+        }
+
+        constexpr ghost_uint64_t ghost_impl_fnv1a_constexpr_cstr_u64(const char* string, ghost_uint64_t hash) {
+            return *string == 0 ? hash : ghost_impl_fnv1a_constexpr_cstr_u64(string + 1,
+                    static_cast<ghost_uint64_t>((hash ^ (static_cast<unsigned char>(*string) & 0xFFU)) * GHOST_UINT64_C(1099511628211)));
+        }
+
+        constexpr ghost_uint64_t ghost_fnv1a_constexpr_u64(const char* bytes, ghost_size_t length) {
+            return ghost_impl_fnv1a_constexpr_bytes_u64(bytes, length, GHOST_UINT64_C(14695981039346656037));
+        }
+
+        constexpr ghost_uint64_t ghost_fnv1a_constexpr_u64(const char* string) {
+            return ghost_impl_fnv1a_constexpr_cstr_u64(string, GHOST_UINT64_C(14695981039346656037));
+        }
+    #endif
+
+    GHOST_IMPL_CXX_FUNCTION_CLOSE
+
+    #define ghost_has_ghost_fnv1a_constexpr_u64 1
+#endif
+
+#endif
@@ -0,0 +1,115 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_FNV1A_LITERAL_U32_H_INCLUDED
+#define GHOST_FNV1A_LITERAL_U32_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * @def GHOST_FNV1A_LITERAL_U32(s)
+ *
+ * Computes the 32-bit FNV-1a hash of the given string literal (not including
+ * the null-terminator) as a constant.
+ *
+ * The result is the same as ghost_fnv1a_cstr_u32(s) but it's computed at
+ * compile time, so comparing a runtime hash against the hash of a literal
+ * costs nothing:
+ *
+ *     uint32_t hash = ghost_fnv1a_cstr_u32(key);
+ *     if (hash == GHOST_FNV1A_LITERAL_U32("width") && 0 == strcmp(key, "width"))
+ *         ...
+ *
+ * In C++11 this is a constant expression so it can be used as a case label.
+ * In C, indexing a string literal is not allowed in an integer constant
+ * expression so compilers fold it but it can't be used as a case label; use
+ * GHOST_FNV1A_CHARS_U32() for that instead.
+ *
+ * The argument must be a string literal (or a char array) of at most 32
+ * characters. A longer literal is a compile error. A pointer gives the wrong
+ * result.
+ *
+ * @see GHOST_FNV1A_CHARS_U32
+ * @see ghost_fnv1a_constexpr_u32
+ * @see ghost_fnv1a_cstr_u32
+ */
+#define GHOST_FNV1A_LITERAL_U32(s)
+#endif
+
+#ifndef ghost_has_GHOST_FNV1A_LITERAL_U32
+    #ifdef GHOST_FNV1A_LITERAL_U32
+        #define ghost_has_GHOST_FNV1A_LITERAL_U32 1
+    #endif
+#endif
+
+#ifndef ghost_has_GHOST_FNV1A_LITERAL_U32
+    #include "ghost/type/uint32_t/ghost_uint32_t.h"
+    #include "ghost/type/uint32_t/ghost_uint32_c.h"
+    #if !ghost_has(ghost_uint32_t) || !ghost_has(GHOST_UINT32_C)
+        #define ghost_has_GHOST_FNV1A_LITERAL_U32 0
+    #endif
+#endif
+
+#ifndef ghost_has_GHOST_FNV1A_LITERAL_U32
+    #include "ghost/language/ghost_static_cast.h"
+
+    /* Hashes character i if it's within the literal. Beyond the end this is
+     * xor with 0 and multiplication by 1. The hash argument is used only once
+     * so nesting doesn't blow up. */
+    #define GHOST_IMPL_FNV1A_LITERAL_U32_STEP(hash, s, i) \
+        ghost_static_cast(ghost_uint32_t, ((hash) ^ \
+                    ((i) < sizeof(s) - 1 ? ghost_static_cast(ghost_uint32_t, (s)[i] & 0xFF) : 0u)) * \
+                ((i) < sizeof(s) - 1 ? GHOST_UINT32_C(16777619) : 1u))
+
+    /* The sizeof() fails to compile if the literal is too long. */
+    #define GHOST_FNV1A_LITERAL_U32(s) \
+        ghost_static_cast(ghost_uint32_t, 0u * sizeof(char[sizeof(s) <= 33 ? 1 : -1]) + \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_IMPL_FNV1A_LITERAL_U32_STEP(GHOST_IMPL_FNV1A_LITERAL_U32_STEP( \
+                GHOST_UINT32_C(2166136261), \
+                s, 0), s, 1), s, 2), s, 3), \
+                s, 4), s, 5), s, 6), s, 7), \
+                s, 8), s, 9), s, 10), s, 11), \
+                s, 12), s, 13), s, 14), s, 15), \
+                s, 16), s, 17), s, 18), s, 19), \
+                s, 20), s, 21), s, 22), s, 23), \
+                s, 24), s, 25), s, 26), s, 27), \
+                s, 28), s, 29), s, 30), s, 31))
+
+    #define ghost_has_GHOST_FNV1A_LITERAL_U32 1
+#endif
+
+#endif
@@ -0,0 +1,61 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_FNV1A_U32_INIT_H_INCLUDED
+#define GHOST_FNV1A_U32_INIT_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Initializes the state of an incremental 32-bit FNV-1a hash.
+ *
+ * @see ghost_fnv1a_u32_state_t
+ */
+void ghost_fnv1a_u32_init(ghost_fnv1a_u32_state_t* state);
+#endif
+
+#ifndef ghost_has_ghost_fnv1a_u32_init
+    #ifdef ghost_fnv1a_u32_init
+        #define ghost_has_ghost_fnv1a_u32_init 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_fnv1a_u32_init
+    #include "ghost/algorithm/fnv1a/ghost_fnv1a_u32_state_t.h"
+    #include "ghost/type/uint32_t/ghost_uint32_c.h"
+    #if !ghost_has(ghost_fnv1a_u32_state_t) || !ghost_has(GHOST_UINT32_C)
+        #define ghost_has_ghost_fnv1a_u32_init 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_fnv1a_u32_init
+    #include "ghost/impl/ghost_impl_inline.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_inline
+    void ghost_fnv1a_u32_init(ghost_fnv1a_u32_state_t* state) {
+        state->ghost_impl_hash = GHOST_UINT32_C(2166136261);
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_fnv1a_u32_init 1
+#endif
+
+#endif
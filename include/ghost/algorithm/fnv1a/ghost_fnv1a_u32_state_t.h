@@ -0,0 +1,67 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_FNV1A_U32_STATE_T_H_INCLUDED
+#define GHOST_FNV1A_U32_STATE_T_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * The state of an incremental 32-bit FNV-1a hash.
+ *
+ * Initialize it with ghost_fnv1a_u32_init(), feed it bytes in any number of
+ * pieces with ghost_fnv1a_u32_update() and get the hash with
+ * ghost_fnv1a_u32_final(). The result is the same as ghost_fnv1a_u32() of
+ * all of the bytes concatenated.
+ *
+ * The state is trivially copyable so you can hash a common prefix once and
+ * copy the state for each suffix.
+ *
+ * @see ghost_fnv1a_u32_init
+ * @see ghost_fnv1a_u32_update
+ * @see ghost_fnv1a_u32_final
+ */
+typedef struct { /*unspecified*/ } ghost_fnv1a_u32_state_t;
+#endif
+
+#ifndef ghost_has_ghost_fnv1a_u32_state_t
+    #ifdef ghost_fnv1a_u32_state_t
+        #define ghost_has_ghost_fnv1a_u32_state_t 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_fnv1a_u32_state_t
+    #include "ghost/type/uint32_t/ghost_uint32_t.h"
+    #if !ghost_has(ghost_uint32_t)
+        #define ghost_has_ghost_fnv1a_u32_state_t 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_fnv1a_u32_state_t
+    typedef struct ghost_fnv1a_u32_state_t {
+        /* This structure is meant to be opaque. Don't access this field directly. */
+        ghost_uint32_t ghost_impl_hash;
+    } ghost_fnv1a_u32_state_t;
+    #define ghost_has_ghost_fnv1a_u32_state_t 1
+#endif
+
+#endif
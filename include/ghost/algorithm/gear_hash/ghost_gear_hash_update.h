@@ -0,0 +1,79 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_GEAR_HASH_UPDATE_H_INCLUDED
+#define GHOST_GEAR_HASH_UPDATE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Rolls the given bytes into a Gear hash, returning the new hash.
+ *
+ * Pass 0 as the initial hash. The hash of data split into pieces can be
+ * computed by passing the result of each call to the next so this works on
+ * input fed incrementally.
+ *
+ * The Gear hash shifts the hash left by one bit and adds a fixed random 64-bit
+ * value for each byte. It is a rolling hash over a window of the last 64
+ * bytes: once at least 64 bytes have been added, the hash no longer depends on
+ * anything before them. The high bits are the strongest; the lowest bit
+ * depends only on the last byte.
+ *
+ * This is the hash used by FastCDC and by ghost_cdc_next_boundary(). The table
+ * is Ghost's own (generated by SplitMix64) so hashes won't match other
+ * implementations, but they are stable across platforms and versions of
+ * Ghost.
+ *
+ * @see ghost_cdc_next_boundary
+ * @see ghost_rabin_karp_roll
+ */
+uint64_t ghost_gear_hash_update(uint64_t hash, const void* bytes, size_t length);
+#endif
+
+#ifndef ghost_has_ghost_gear_hash_update
+    #ifdef ghost_gear_hash_update
+        #define ghost_has_ghost_gear_hash_update 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_gear_hash_update
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_uint64_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_gear_hash_update 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_gear_hash_update
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/gear_hash/ghost_impl_gear_hash.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_inline
+    ghost_uint64_t ghost_gear_hash_update(ghost_uint64_t hash, const void* bytes, ghost_size_t length) {
+        return ghost_impl_gear_hash_update(hash, bytes, length);
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_gear_hash_update 1
+#endif
+
+#endif
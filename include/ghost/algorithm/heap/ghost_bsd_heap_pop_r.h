@@ -0,0 +1,98 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_BSD_HEAP_POP_R_H_INCLUDED
+#define GHOST_BSD_HEAP_POP_R_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Pops the greatest element off a binary max-heap with a custom callback and
+ * context with a signature matching BSD qsort_r(). The element is moved to the
+ * end of the array (at index count-1) and the first count-1 elements are left
+ * as a heap, so remove the last element from the array after calling this.
+ * This takes O(logn) comparisons.
+ *
+ * The heap has the same layout as C++ std::make_heap(): the children of the
+ * element at index i are at 2i+1 and 2i+2, and no element is greater than its
+ * parent according to the compare function. Invert the compare function for a
+ * min-heap (e.g. a priority queue of deadlines.)
+ *
+ * This never wraps a platform function. See GHOST_HEAP_DEFINE() for a heap
+ * specialized for a given element type which can also use a 4-ary layout.
+ *
+ * @see ghost_heap_pop
+ * @see ghost_gnu_heap_pop_r
+ * @see ghost_win_heap_pop_s
+ * @see ghost_c11_heap_pop_s
+ * @see ghost_bsd_heap_make_r
+ * @see ghost_bsd_heap_push_r
+ * @see ghost_bsd_heap_replace_top_r
+ * @see GHOST_HEAP_DEFINE
+ */
+void ghost_bsd_heap_pop_r(void* first, size_t count, size_t element_size,
+        void* context,
+        int (*compare)(void* context, const void* left, const void* right));
+#endif
+
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_config.h"
+
+/* Handle override */
+#ifndef ghost_has_ghost_bsd_heap_pop_r
+    #ifdef ghost_bsd_heap_pop_r
+        #define ghost_has_ghost_bsd_heap_pop_r 1
+    #endif
+#endif
+
+/* Use the internal implementation */
+#ifndef ghost_has_ghost_bsd_heap_pop_r
+    #if !GHOST_QSORT_DISABLE_INTERNAL
+        #include "ghost/impl/ghost_impl_inline.h"
+        #include "ghost/impl/algorithm/qsort/ghost_impl_qsort_internal.h"
+        #include "ghost/type/size_t/ghost_size_t.h"
+
+        GHOST_IMPL_FUNCTION_OPEN
+
+        ghost_impl_inline
+        void ghost_bsd_heap_pop_r(void* first, ghost_size_t count, ghost_size_t element_size,
+                void* user_context,
+                int (*user_compare)(void* user_context, const void* left, const void* right))
+        {
+            ghost_impl_qsort_state_t state;
+            state.element_size = element_size;
+            state.size_class = ghost_impl_qsort_resolve_size_class(first, element_size);
+            state.variant = ghost_impl_qsort_variant_bsd;
+            state.compare.bsd = user_compare;
+            state.user_context = user_context;
+            ghost_impl_qsort_heap_pop(&state, first, count);
+        }
+
+        GHOST_IMPL_FUNCTION_CLOSE
+        #define ghost_has_ghost_bsd_heap_pop_r 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_bsd_heap_pop_r
+    #define ghost_has_ghost_bsd_heap_pop_r 0
+#endif
+
+#endif
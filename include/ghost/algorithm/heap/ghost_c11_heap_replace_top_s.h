@@ -0,0 +1,114 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_C11_HEAP_REPLACE_TOP_S_H_INCLUDED
+#define GHOST_C11_HEAP_REPLACE_TOP_S_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Restores a binary max-heap with a custom callback and context with a
+ * signature matching C11 Annex K qsort_s() after its first element has been
+ * overwritten. This pops and pushes in a single operation which is cheaper
+ * than ghost_heap_pop() followed by ghost_heap_push(), for example to
+ * reschedule the element at the top of a priority queue. This takes O(logn)
+ * comparisons.
+ *
+ * The heap has the same layout as C++ std::make_heap(): the children of the
+ * element at index i are at 2i+1 and 2i+2, and no element is greater than its
+ * parent according to the compare function. Invert the compare function for a
+ * min-heap (e.g. a priority queue of deadlines.)
+ *
+ * This never wraps a platform function. See GHOST_HEAP_DEFINE() for a heap
+ * specialized for a given element type which can also use a 4-ary layout.
+ *
+ * As with ghost_c11_qsort_s(), a constraint violation calls ghost_fatal() so
+ * this always returns 0.
+ *
+ * @see ghost_heap_replace_top
+ * @see ghost_gnu_heap_replace_top_r
+ * @see ghost_bsd_heap_replace_top_r
+ * @see ghost_win_heap_replace_top_s
+ * @see ghost_c11_heap_make_s
+ * @see ghost_c11_heap_push_s
+ * @see ghost_c11_heap_pop_s
+ * @see GHOST_HEAP_DEFINE
+ */
+errno_t ghost_c11_heap_replace_top_s(void* first, rsize_t count, rsize_t element_size,
+        int (*compare)(const void* left, const void* right, void* context),
+        void* context);
+#endif
+
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_config.h"
+
+/* Handle override */
+#ifndef ghost_has_ghost_c11_heap_replace_top_s
+    #ifdef ghost_c11_heap_replace_top_s
+        #define ghost_has_ghost_c11_heap_replace_top_s 1
+    #endif
+#endif
+
+/* Use the internal implementation */
+#ifndef ghost_has_ghost_c11_heap_replace_top_s
+    #if !GHOST_QSORT_DISABLE_INTERNAL
+        #include "ghost/impl/ghost_impl_inline.h"
+        #include "ghost/impl/algorithm/qsort/ghost_impl_qsort_internal.h"
+        #include "ghost/type/size_t/ghost_size_t.h"
+        #include "ghost/language/ghost_expect_false.h"
+        #include "ghost/language/ghost_null.h"
+        #include "ghost/debug/ghost_fatal.h"
+        #include "ghost/error/ghost_errno_t.h"
+        #include "ghost/error/ghost_rsize_t.h"
+
+        GHOST_IMPL_FUNCTION_OPEN
+
+        ghost_impl_inline
+        ghost_errno_t ghost_c11_heap_replace_top_s(void* first, ghost_rsize_t count, ghost_rsize_t element_size,
+                int (*user_compare)(const void* left, const void* right, void* user_context),
+                void* user_context)
+        {
+            ghost_impl_qsort_state_t state;
+
+            if (ghost_expect_false(count > GHOST_RSIZE_BOUNDS ||
+                    element_size > GHOST_RSIZE_BOUNDS ||
+                    (count > 0 && (first == ghost_null || user_context == ghost_null))))
+                ghost_fatal("constraint violation");
+
+            state.element_size = element_size;
+            state.size_class = ghost_impl_qsort_resolve_size_class(first, element_size);
+            state.variant = ghost_impl_qsort_variant_gnu;
+            state.compare.gnu = user_compare;
+            state.user_context = user_context;
+            ghost_impl_qsort_heap_replace_top(&state, first, count);
+            return 0;
+        }
+
+        GHOST_IMPL_FUNCTION_CLOSE
+        #define ghost_has_ghost_c11_heap_replace_top_s 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_c11_heap_replace_top_s
+    #define ghost_has_ghost_c11_heap_replace_top_s 0
+#endif
+
+#endif
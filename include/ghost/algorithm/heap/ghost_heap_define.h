@@ -0,0 +1,242 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_HEAP_DEFINE_H_INCLUDED
+#define GHOST_HEAP_DEFINE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * @def GHOST_HEAP_DEFINE(name, type, less, arity)
+ *
+ * Defines max-heap functions specialized for arrays of the given element type
+ * with an inlined comparison.
+ *
+ * The generated functions have these prototypes:
+ *
+ *     static void name_make(type* first, size_t count);
+ *     static void name_push(type* first, size_t count);
+ *     static void name_pop(type* first, size_t count);
+ *     static void name_replace_top(type* first, size_t count);
+ *
+ * They behave the same as ghost_heap_make(), ghost_heap_push(),
+ * ghost_heap_pop() and ghost_heap_replace_top() respectively: the greatest
+ * element is at index 0, push adds the last element of the array to the heap
+ * formed by the elements before it, pop moves the greatest element to the end
+ * of the array, and replace_top restores the heap after the first element has
+ * been overwritten.
+ *
+ * The less argument must be the name of a function or function-like macro
+ * that takes two `const type*` and returns non-zero if the first element is
+ * less than the second. Swap the arguments for a min-heap. For example:
+ *
+ *     typedef struct {
+ *         uint64_t deadline;
+ *         void* task;
+ *     } timer_entry_t;
+ *
+ *     #define timer_later(left, right) ((left)->deadline > (right)->deadline)
+ *     GHOST_HEAP_DEFINE(timers, timer_entry_t, timer_later, 4)
+ *
+ *     timers[count++] = timer;
+ *     timers_push(timers, count);
+ *
+ * The arity is the number of children of each node. It must be a constant
+ * expression of at least 2. An arity of 2 gives the same layout as the
+ * generic heap functions such as ghost_heap_make(). An arity of 4 makes the
+ * heap half as deep and keeps the children of a node together in memory (on
+ * one cache line for small elements.) This reduces cache misses for large
+ * queues at the cost of more comparisons per level. Measure both on your
+ * workload.
+ *
+ * Elements are moved into and out of a hole rather than swapped so each level
+ * costs one element copy instead of three. Popping moves the hole all the way
+ * down to a leaf before placing the last element (Floyd's bottom-up pop)
+ * since the last element nearly always belongs near the bottom.
+ *
+ * This defines the heap functions and three helper functions prefixed with
+ * `ghost_impl_` and the given name. All of them are static so this can be
+ * used in a header file or in any number of translation units.
+ *
+ * This must be used at file scope.
+ *
+ * @see ghost_heap_make
+ * @see ghost_heap_push
+ * @see ghost_heap_pop
+ * @see ghost_heap_replace_top
+ * @see GHOST_QSORT_DEFINE
+ */
+#define GHOST_HEAP_DEFINE(name, type, less, arity)
+#endif
+
+#ifndef ghost_has_GHOST_HEAP_DEFINE
+    #ifdef GHOST_HEAP_DEFINE
+        #define ghost_has_GHOST_HEAP_DEFINE 1
+    #endif
+#endif
+
+#ifndef ghost_has_GHOST_HEAP_DEFINE
+    #include "ghost/language/ghost_maybe_unused.h"
+    #include "ghost/language/ghost_inline_opt.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    #include "ghost/debug/ghost_static_assert.h"
+
+    /*
+     * Everything is written in C89 style (no mixed declarations and code)
+     * since it's expanded into user code.
+     */
+
+    #define GHOST_IMPL_HEAP_DEFINE_FUNCTION ghost_maybe_unused static
+    #define GHOST_IMPL_HEAP_DEFINE_INLINE ghost_maybe_unused static ghost_inline_opt
+
+    /*
+     * Moves the value down from the hole at the given index until it's not less
+     * than any of its children.
+     */
+    #define GHOST_IMPL_HEAP_DEFINE_SIFT_DOWN(name, type, less, arity) \
+        GHOST_IMPL_HEAP_DEFINE_INLINE \
+        void ghost_impl_##name##_sift_down(type* ghost_impl_v_base, ghost_size_t ghost_impl_v_count, \
+                ghost_size_t ghost_impl_v_index, const type* ghost_impl_v_value) \
+        { \
+            for (;;) { \
+                ghost_size_t ghost_impl_v_child = (arity) * ghost_impl_v_index + 1; \
+                ghost_size_t ghost_impl_v_best = ghost_impl_v_child; \
+                ghost_size_t ghost_impl_v_end = ghost_impl_v_child + (arity); \
+                if (ghost_impl_v_child >= ghost_impl_v_count) \
+                    break; \
+                if (ghost_impl_v_end > ghost_impl_v_count) \
+                    ghost_impl_v_end = ghost_impl_v_count; \
+                for (++ghost_impl_v_child; ghost_impl_v_child < ghost_impl_v_end; ++ghost_impl_v_child) \
+                    if (less(ghost_impl_v_base + ghost_impl_v_best, ghost_impl_v_base + ghost_impl_v_child)) \
+                        ghost_impl_v_best = ghost_impl_v_child; \
+                if (!less(ghost_impl_v_value, ghost_impl_v_base + ghost_impl_v_best)) \
+                    break; \
+                ghost_impl_v_base[ghost_impl_v_index] = ghost_impl_v_base[ghost_impl_v_best]; \
+                ghost_impl_v_index = ghost_impl_v_best; \
+            } \
+            ghost_impl_v_base[ghost_impl_v_index] = *ghost_impl_v_value; \
+        }
+
+    /*
+     * Moves the value up from the hole at the given index until it's not
+     * greater than its parent.
+     */
+    #define GHOST_IMPL_HEAP_DEFINE_SIFT_UP(name, type, less, arity) \
+        GHOST_IMPL_HEAP_DEFINE_INLINE \
+        void ghost_impl_##name##_sift_up(type* ghost_impl_v_base, \
+                ghost_size_t ghost_impl_v_index, const type* ghost_impl_v_value) \
+        { \
+            while (ghost_impl_v_index > 0) { \
+                ghost_size_t ghost_impl_v_parent = (ghost_impl_v_index - 1) / (arity); \
+                if (!less(ghost_impl_v_base + ghost_impl_v_parent, ghost_impl_v_value)) \
+                    break; \
+                ghost_impl_v_base[ghost_impl_v_index] = ghost_impl_v_base[ghost_impl_v_parent]; \
+                ghost_impl_v_index = ghost_impl_v_parent; \
+            } \
+            ghost_impl_v_base[ghost_impl_v_index] = *ghost_impl_v_value; \
+        }
+
+    /*
+     * Moves the hole at the top of the heap down to a leaf by promoting the
+     * greatest child at each level, returning the index of the leaf. Popping
+     * then sifts the last element up from there. The last element almost
+     * always belongs near the bottom so this saves a comparison per level
+     * over a plain sift down.
+     */
+    #define GHOST_IMPL_HEAP_DEFINE_SIFT_HOLE_TO_LEAF(name, type, less, arity) \
+        GHOST_IMPL_HEAP_DEFINE_INLINE \
+        ghost_size_t ghost_impl_##name##_sift_hole_to_leaf(type* ghost_impl_v_base, ghost_size_t ghost_impl_v_count) { \
+            ghost_size_t ghost_impl_v_index = 0; \
+            for (;;) { \
+                ghost_size_t ghost_impl_v_child = (arity) * ghost_impl_v_index + 1; \
+                ghost_size_t ghost_impl_v_best = ghost_impl_v_child; \
+                ghost_size_t ghost_impl_v_end = ghost_impl_v_child + (arity); \
+                if (ghost_impl_v_child >= ghost_impl_v_count) \
+                    break; \
+                if (ghost_impl_v_end > ghost_impl_v_count) \
+                    ghost_impl_v_end = ghost_impl_v_count; \
+                for (++ghost_impl_v_child; ghost_impl_v_child < ghost_impl_v_end; ++ghost_impl_v_child) \
+                    if (less(ghost_impl_v_base + ghost_impl_v_best, ghost_impl_v_base + ghost_impl_v_child)) \
+                        ghost_impl_v_best = ghost_impl_v_child; \
+                ghost_impl_v_base[ghost_impl_v_index] = ghost_impl_v_base[ghost_impl_v_best]; \
+                ghost_impl_v_index = ghost_impl_v_best; \
+            } \
+            return ghost_impl_v_index; \
+        }
+
+    #define GHOST_IMPL_HEAP_DEFINE_OPERATIONS(name, type, less, arity) \
+        GHOST_IMPL_HEAP_DEFINE_FUNCTION \
+        void name##_make(type* ghost_impl_v_base, ghost_size_t ghost_impl_v_count) { \
+            ghost_size_t ghost_impl_v_index; \
+            type ghost_impl_v_value; \
+            if (ghost_impl_v_count <= 1) \
+                return; \
+            ghost_impl_v_index = (ghost_impl_v_count - 2) / (arity) + 1; \
+            while (ghost_impl_v_index > 0) { \
+                --ghost_impl_v_index; \
+                ghost_impl_v_value = ghost_impl_v_base[ghost_impl_v_index]; \
+                ghost_impl_##name##_sift_down(ghost_impl_v_base, ghost_impl_v_count, \
+                        ghost_impl_v_index, &ghost_impl_v_value); \
+            } \
+        } \
+        \
+        GHOST_IMPL_HEAP_DEFINE_FUNCTION \
+        void name##_push(type* ghost_impl_v_base, ghost_size_t ghost_impl_v_count) { \
+            type ghost_impl_v_value; \
+            if (ghost_impl_v_count <= 1) \
+                return; \
+            ghost_impl_v_value = ghost_impl_v_base[ghost_impl_v_count - 1]; \
+            ghost_impl_##name##_sift_up(ghost_impl_v_base, ghost_impl_v_count - 1, &ghost_impl_v_value); \
+        } \
+        \
+        GHOST_IMPL_HEAP_DEFINE_FUNCTION \
+        void name##_pop(type* ghost_impl_v_base, ghost_size_t ghost_impl_v_count) { \
+            type ghost_impl_v_value; \
+            if (ghost_impl_v_count <= 1) \
+                return; \
+            ghost_impl_v_value = ghost_impl_v_base[ghost_impl_v_count - 1]; \
+            ghost_impl_v_base[ghost_impl_v_count - 1] = ghost_impl_v_base[0]; \
+            ghost_impl_##name##_sift_up(ghost_impl_v_base, \
+                    ghost_impl_##name##_sift_hole_to_leaf(ghost_impl_v_base, ghost_impl_v_count - 1), \
+                    &ghost_impl_v_value); \
+        } \
+        \
+        GHOST_IMPL_HEAP_DEFINE_FUNCTION \
+        void name##_replace_top(type* ghost_impl_v_base, ghost_size_t ghost_impl_v_count) { \
+            type ghost_impl_v_value; \
+            if (ghost_impl_v_count <= 1) \
+                return; \
+            ghost_impl_v_value = ghost_impl_v_base[0]; \
+            ghost_impl_##name##_sift_down(ghost_impl_v_base, ghost_impl_v_count, 0, &ghost_impl_v_value); \
+        }
+
+    #define GHOST_HEAP_DEFINE(name, type, less, arity) \
+        ghost_static_assert((arity) >= 2, "GHOST_HEAP_DEFINE() arity must be at least 2"); \
+        GHOST_IMPL_HEAP_DEFINE_SIFT_DOWN(name, type, less, arity) \
+        GHOST_IMPL_HEAP_DEFINE_SIFT_UP(name, type, less, arity) \
+        GHOST_IMPL_HEAP_DEFINE_SIFT_HOLE_TO_LEAF(name, type, less, arity) \
+        GHOST_IMPL_HEAP_DEFINE_OPERATIONS(name, type, less, arity)
+
+    #define ghost_has_GHOST_HEAP_DEFINE 1
+#endif
+
+#endif
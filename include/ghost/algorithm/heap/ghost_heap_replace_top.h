@@ -0,0 +1,97 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_HEAP_REPLACE_TOP_H_INCLUDED
+#define GHOST_HEAP_REPLACE_TOP_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Restores a binary max-heap with a custom callback after its first element
+ * has been overwritten. This pops and pushes in a single operation which is
+ * cheaper than ghost_heap_pop() followed by ghost_heap_push(), for example to
+ * reschedule the element at the top of a priority queue. This takes O(logn)
+ * comparisons.
+ *
+ * The heap has the same layout as C++ std::make_heap(): the children of the
+ * element at index i are at 2i+1 and 2i+2, and no element is greater than its
+ * parent according to the compare function. Invert the compare function for a
+ * min-heap (e.g. a priority queue of deadlines.)
+ *
+ * This never wraps a platform function. See GHOST_HEAP_DEFINE() for a heap
+ * specialized for a given element type which can also use a 4-ary layout.
+ *
+ * @see ghost_gnu_heap_replace_top_r
+ * @see ghost_bsd_heap_replace_top_r
+ * @see ghost_win_heap_replace_top_s
+ * @see ghost_c11_heap_replace_top_s
+ * @see ghost_heap_make
+ * @see ghost_heap_push
+ * @see ghost_heap_pop
+ * @see GHOST_HEAP_DEFINE
+ */
+void ghost_heap_replace_top(void* first, size_t count, size_t element_size,
+        int (*compare)(const void* left, const void* right));
+#endif
+
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_config.h"
+
+/* Handle override */
+#ifndef ghost_has_ghost_heap_replace_top
+    #ifdef ghost_heap_replace_top
+        #define ghost_has_ghost_heap_replace_top 1
+    #endif
+#endif
+
+/* Use the internal implementation */
+#ifndef ghost_has_ghost_heap_replace_top
+    #if !GHOST_QSORT_DISABLE_INTERNAL
+        #include "ghost/impl/ghost_impl_inline.h"
+        #include "ghost/impl/algorithm/qsort/ghost_impl_qsort_internal.h"
+        #include "ghost/type/size_t/ghost_size_t.h"
+        #include "ghost/language/ghost_null.h"
+
+        GHOST_IMPL_FUNCTION_OPEN
+
+        ghost_impl_inline
+        void ghost_heap_replace_top(void* first, ghost_size_t count, ghost_size_t element_size,
+                int (*user_compare)(const void* left, const void* right))
+        {
+            ghost_impl_qsort_state_t state;
+            state.element_size = element_size;
+            state.size_class = ghost_impl_qsort_resolve_size_class(first, element_size);
+            state.variant = ghost_impl_qsort_variant_nocontext;
+            state.compare.nocontext = user_compare;
+            state.user_context = ghost_null;
+            ghost_impl_qsort_heap_replace_top(&state, first, count);
+        }
+
+        GHOST_IMPL_FUNCTION_CLOSE
+        #define ghost_has_ghost_heap_replace_top 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_heap_replace_top
+    #define ghost_has_ghost_heap_replace_top 0
+#endif
+
+#endif
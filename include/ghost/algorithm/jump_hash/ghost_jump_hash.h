@@ -0,0 +1,92 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_JUMP_HASH_H_INCLUDED
+#define GHOST_JUMP_HASH_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Maps a 64-bit key to one of the given number of buckets with Lamping and
+ * Veach's jump consistent hash.
+ *
+ * When the number of buckets grows from n to n+1, only about 1/(n+1) of the
+ * keys move, and they all move to the new bucket. (Compare this to modulo or
+ * ghost_knuth_hash_u64() range reduction, which move nearly all keys.) It
+ * needs no memory and takes O(log n) time.
+ *
+ * Buckets are numbered from 0 so they can only be added or removed at the
+ * end. If arbitrary nodes can leave, use ghost_rendezvous_hash() instead.
+ *
+ * The key should already be a hash (e.g. from ghost_wyhash_u64() or
+ * ghost_fnv1a_u64().) The number of buckets must be at least 1.
+ *
+ * This is the algorithm from the paper including its use of double so it
+ * gives the same results as other implementations:
+ *
+ *     https://arxiv.org/abs/1406.2294
+ *
+ * @see ghost_rendezvous_hash
+ */
+uint32_t ghost_jump_hash(uint64_t key, uint32_t buckets);
+#endif
+
+#ifndef ghost_has_ghost_jump_hash
+    #ifdef ghost_jump_hash
+        #define ghost_has_ghost_jump_hash 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_jump_hash
+    #include "ghost/type/uint32_t/ghost_uint32_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #include "ghost/type/double/ghost_double.h"
+    #if !ghost_has(ghost_uint32_t) || !ghost_has(ghost_uint64_t) || \
+            !ghost_has(GHOST_UINT64_C) || !ghost_has(ghost_double)
+        #define ghost_has_ghost_jump_hash 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_jump_hash
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/debug/ghost_assert.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    ghost_uint32_t ghost_jump_hash(ghost_uint64_t key, ghost_uint32_t buckets) GHOST_IMPL_DEF({
+        ghost_uint64_t bucket = 0;
+        ghost_uint64_t next = 0;
+        ghost_assert(buckets > 0, "");
+        while (next < buckets) {
+            bucket = next;
+            key = key * GHOST_UINT64_C(2862933555777941757) + 1;
+            next = ghost_static_cast(ghost_uint64_t, ghost_static_cast(double, bucket + 1) *
+                    (2147483648.0 / ghost_static_cast(double, (key >> 33) + 1)));
+        }
+        return ghost_static_cast(ghost_uint32_t, bucket);
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_jump_hash 1
+#endif
+
+#endif
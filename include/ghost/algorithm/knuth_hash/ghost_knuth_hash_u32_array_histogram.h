@@ -0,0 +1,81 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_KNUTH_HASH_U32_ARRAY_HISTOGRAM_H_INCLUDED
+#define GHOST_KNUTH_HASH_U32_ARRAY_HISTOGRAM_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Hashes an array of 32-bit values with ghost_knuth_hash_u32() into buckets
+ * of the given number of bits, writing the bucket of each value to out and
+ * counting the values in each bucket.
+ *
+ * This is the same as ghost_knuth_hash_u32_array() except that for each value
+ * the histogram entry at its bucket is also incremented. This computes the
+ * bucket sizes for radix partitioning in the same pass as the hashes.
+ *
+ * The histogram must have `1 << bits` entries. It is not cleared first so you
+ * can accumulate counts over several calls; zero it before the first one.
+ *
+ * @see ghost_knuth_hash_u32_array
+ */
+void ghost_knuth_hash_u32_array_histogram(const uint32_t* in, uint32_t* out, size_t count, size_t bits, size_t* histogram);
+#endif
+
+#ifndef ghost_has_ghost_knuth_hash_u32_array_histogram
+    #ifdef ghost_knuth_hash_u32_array_histogram
+        #define ghost_has_ghost_knuth_hash_u32_array_histogram 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_knuth_hash_u32_array_histogram
+    #include "ghost/type/uint32_t/ghost_uint32_t.h"
+    #include "ghost/type/uint32_t/ghost_uint32_c.h"
+    #if !ghost_has(ghost_uint32_t) || !ghost_has(GHOST_UINT32_C)
+        #define ghost_has_ghost_knuth_hash_u32_array_histogram 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_knuth_hash_u32_array_histogram
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/knuth_hash/ghost_impl_knuth_hash_array.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    #include "ghost/debug/ghost_assert.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/language/ghost_null.h"
+
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_inline
+    void ghost_knuth_hash_u32_array_histogram(const ghost_uint32_t* in, ghost_uint32_t* out,
+            ghost_size_t count, ghost_size_t bits, ghost_size_t* histogram)
+    {
+        ghost_assert(bits > 0, "");
+        ghost_assert(bits <= 32, "");
+        ghost_assert(histogram != ghost_null || count == 0, "");
+        ghost_impl_knuth_hash_u32_array(in, out, count, ghost_static_cast(unsigned, 32 - bits), histogram);
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_knuth_hash_u32_array_histogram 1
+#endif
+
+#endif
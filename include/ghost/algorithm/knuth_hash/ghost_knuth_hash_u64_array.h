@@ -0,0 +1,79 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_KNUTH_HASH_U64_ARRAY_H_INCLUDED
+#define GHOST_KNUTH_HASH_U64_ARRAY_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Hashes an array of 64-bit values with ghost_knuth_hash_u64() into buckets
+ * of the given number of bits, writing the results to out.
+ *
+ * out[i] is set to ghost_knuth_hash_u64(in[i], bits) for each i less than
+ * count. out may be the same array as in.
+ *
+ * The number of bits is checked once for the whole array and the hashes are
+ * computed with AVX2 or NEON where available. On x86-64 with GCC or Clang
+ * the AVX2 version is chosen at runtime if it isn't enabled at compile time.
+ *
+ * @see ghost_knuth_hash_u64
+ * @see ghost_knuth_hash_u64_array_histogram
+ */
+void ghost_knuth_hash_u64_array(const uint64_t* in, uint64_t* out, size_t count, size_t bits);
+#endif
+
+#ifndef ghost_has_ghost_knuth_hash_u64_array
+    #ifdef ghost_knuth_hash_u64_array
+        #define ghost_has_ghost_knuth_hash_u64_array 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_knuth_hash_u64_array
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_uint64_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_knuth_hash_u64_array 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_knuth_hash_u64_array
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/knuth_hash/ghost_impl_knuth_hash_array.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    #include "ghost/debug/ghost_assert.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/language/ghost_null.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_inline
+    void ghost_knuth_hash_u64_array(const ghost_uint64_t* in, ghost_uint64_t* out,
+            ghost_size_t count, ghost_size_t bits)
+    {
+        ghost_assert(bits > 0, "");
+        ghost_assert(bits <= 64, "");
+        ghost_impl_knuth_hash_u64_array(in, out, count, ghost_static_cast(unsigned, 64 - bits), ghost_null);
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_knuth_hash_u64_array 1
+#endif
+
+#endif
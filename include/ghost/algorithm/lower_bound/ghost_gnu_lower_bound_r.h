@@ -0,0 +1,89 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_GNU_LOWER_BOUND_R_H_INCLUDED
+#define GHOST_GNU_LOWER_BOUND_R_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Returns the index of the first element of a sorted array that is not less
+ * than the given key with a custom callback and context with a signature
+ * matching GNU (and future POSIX) qsort_r(), or count if all elements are less
+ * than the key.
+ *
+ * This is the index at which the key would be inserted to keep the array
+ * sorted, as with C++ std::lower_bound(). The compare function is called with
+ * the key on the left and an array element on the right. It must return a
+ * negative number, zero or a positive number if the key is less than, equal to
+ * or greater than the element respectively.
+ *
+ * This search is branchless: it narrows the range with conditional moves
+ * rather than branches so it doesn't suffer branch mispredictions. It always
+ * performs ceil(log2(count))+1 comparisons (or none if count is 0.)
+ *
+ * @see ghost_lower_bound
+ * @see ghost_bsd_lower_bound_r
+ * @see ghost_win_lower_bound_s
+ * @see ghost_c11_lower_bound_s
+ * @see ghost_bsearch
+ * @see ghost_eytzinger_lower_bound
+ */
+size_t ghost_gnu_lower_bound_r(const void* key, const void* first, size_t count, size_t element_size,
+        int (*compare)(const void* key, const void* element, void* context),
+        void* context);
+#endif
+
+/* Handle override */
+#ifndef ghost_has_ghost_gnu_lower_bound_r
+    #ifdef ghost_gnu_lower_bound_r
+        #define ghost_has_ghost_gnu_lower_bound_r 1
+    #endif
+#endif
+
+/* Use the internal implementation */
+#ifndef ghost_has_ghost_gnu_lower_bound_r
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/bsearch/ghost_impl_bsearch.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+
+    GHOST_IMPL_FUNCTION_OPEN
+
+    ghost_impl_inline
+    ghost_size_t ghost_gnu_lower_bound_r(const void* key, const void* first, ghost_size_t count, ghost_size_t element_size,
+            int (*user_compare)(const void* key, const void* element, void* user_context),
+            void* user_context)
+    {
+        ghost_impl_qsort_state_t state;
+        state.element_size = element_size;
+        state.size_class = ghost_impl_qsort_size_class_any;
+        state.variant = ghost_impl_qsort_variant_gnu;
+        state.compare.gnu = user_compare;
+        state.user_context = user_context;
+        return ghost_impl_bsearch_lower_bound(&state, key, first, count);
+    }
+
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_gnu_lower_bound_r 1
+#endif
+
+#endif
@@ -0,0 +1,112 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_C11_MERGE_K_S_H_INCLUDED
+#define GHOST_C11_MERGE_K_S_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Merges k sorted arrays (runs) with a custom callback and context with a
+ * signature matching C11 Annex K qsort_s() into the given output array. Each
+ * run i has counts[i] elements starting at runs[i]; the output must have room
+ * for all of them and must not overlap any run.
+ *
+ * The merge is stable: equal elements are output in run order, and in their
+ * original order within each run. The compare function must return a negative
+ * number, zero or a positive number if the left element is less than, equal to
+ * or greater than the right element respectively.
+ *
+ * Two runs are merged directly. More runs are merged with a loser tree which
+ * takes ceil(log2(k)) comparisons per element. Whenever one run wins several
+ * times in a row the merge gallops through it (as in ghost_stable_sort()),
+ * copying everything that precedes the next element of any other run in one
+ * block, so skewed or partially disjoint inputs are merged in far fewer
+ * comparisons.
+ *
+ * The tree is kept on the stack for up to 64 runs. Beyond that it's allocated
+ * with ghost_malloc(); if that fails (or isn't available), this falls back to
+ * a much slower merge that needs no memory.
+ *
+ * As with ghost_c11_qsort_s(), a constraint violation calls ghost_fatal() so
+ * this always returns 0.
+ *
+ * @see ghost_merge_k
+ * @see ghost_gnu_merge_k_r
+ * @see ghost_bsd_merge_k_r
+ * @see ghost_win_merge_k_s
+ * @see ghost_stable_sort
+ */
+errno_t ghost_c11_merge_k_s(void* out, const void* const* runs, const rsize_t* counts, rsize_t run_count,
+        rsize_t element_size,
+        int (*compare)(const void* left, const void* right, void* context),
+        void* context);
+#endif
+
+/* Handle override */
+#ifndef ghost_has_ghost_c11_merge_k_s
+    #ifdef ghost_c11_merge_k_s
+        #define ghost_has_ghost_c11_merge_k_s 1
+    #endif
+#endif
+
+/* Use the internal implementation */
+#ifndef ghost_has_ghost_c11_merge_k_s
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/merge_k/ghost_impl_merge_k.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    #include "ghost/language/ghost_expect_false.h"
+    #include "ghost/language/ghost_null.h"
+    #include "ghost/debug/ghost_fatal.h"
+    #include "ghost/error/ghost_errno_t.h"
+    #include "ghost/error/ghost_rsize_t.h"
+
+    GHOST_IMPL_FUNCTION_OPEN
+
+    ghost_impl_inline
+    ghost_errno_t ghost_c11_merge_k_s(void* out, const void* const* runs, const ghost_rsize_t* counts, ghost_rsize_t run_count,
+            ghost_rsize_t element_size,
+            int (*user_compare)(const void* left, const void* right, void* user_context),
+            void* user_context)
+    {
+        ghost_impl_qsort_state_t state;
+
+        if (ghost_expect_false(run_count > GHOST_RSIZE_BOUNDS ||
+                element_size > GHOST_RSIZE_BOUNDS ||
+                (run_count > 0 && (out == ghost_null || runs == ghost_null ||
+                    counts == ghost_null || user_compare == ghost_null))))
+            ghost_fatal("constraint violation");
+
+        state.element_size = element_size;
+        state.size_class = ghost_impl_qsort_size_class_any;
+        state.variant = ghost_impl_qsort_variant_gnu;
+        state.compare.gnu = user_compare;
+        state.user_context = user_context;
+        ghost_impl_merge_k(&state, out, runs, counts, run_count);
+        return 0;
+    }
+
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_c11_merge_k_s 1
+#endif
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_NTH_ELEMENT_H_INCLUDED
+#define GHOST_NTH_ELEMENT_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Partially sorts an array so that the element at index nth is the one that
+ * would be there if the whole array were sorted.
+ *
+ * No element before nth is greater than it and no element after it is less
+ * than it. The order of the elements on either side is otherwise
+ * unspecified. If nth is not less than count, this does nothing.
+ *
+ * This is an introselect: a quickselect that partitions exactly as Ghost's
+ * internal introsort does and then descends only into the side that contains
+ * nth, so it runs in O(n) on average. If partitioning goes too deep it falls
+ * back to a heap select so the worst case is O(nlogn).
+ *
+ * The pivot is a median of three, or a ninther for larger ranges. Elements of
+ * 4 or 8 bytes are partitioned two ways with a branchless block partition
+ * (see GHOST_QSORT_BLOCK_PARTITION.) When a pivot equals the element before
+ * its range, and for other element sizes, a three-way scan gathers all
+ * elements equal to the pivot instead. Either way, many duplicate keys don't
+ * degrade performance.
+ *
+ * This never wraps a platform function. When optimizing for size, this sorts
+ * the whole array.
+ *
+ * @see ghost_gnu_nth_element_r
+ * @see ghost_bsd_nth_element_r
+ * @see ghost_win_nth_element_s
+ * @see ghost_c11_nth_element_s
+ * @see ghost_qsort
+ * @see ghost_partial_sort
+ */
+void ghost_nth_element(void* first, size_t count, size_t element_size,
+        int (*compare)(const void* left, const void* right),
+        size_t nth);
+#endif
+
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_config.h"
+
+/* Handle override */
+#ifndef ghost_has_ghost_nth_element
+    #ifdef ghost_nth_element
+        #define ghost_has_ghost_nth_element 1
+    #endif
+#endif
+
+/* Use the internal implementation */
+#ifndef ghost_has_ghost_nth_element
+    #if !GHOST_QSORT_DISABLE_INTERNAL
+        #include "ghost/impl/ghost_impl_inline.h"
+        #include "ghost/impl/algorithm/qsort/ghost_impl_qsort_internal.h"
+        #include "ghost/type/size_t/ghost_size_t.h"
+        #include "ghost/language/ghost_null.h"
+
+        GHOST_IMPL_FUNCTION_OPEN
+
+        ghost_impl_inline
+        void ghost_nth_element(void* first, ghost_size_t count, ghost_size_t element_size,
+                int (*user_compare)(const void* left, const void* right),
+                ghost_size_t nth)
+        {
+            ghost_impl_qsort_state_t state;
+            state.element_size = element_size;
+            state.size_class = ghost_impl_qsort_resolve_size_class(first, element_size);
+            state.variant = ghost_impl_qsort_variant_nocontext;
+            state.compare.nocontext = user_compare;
+            state.user_context = ghost_null;
+            ghost_impl_qsort_nth_element(&state, first, count, nth);
+        }
+
+        GHOST_IMPL_FUNCTION_CLOSE
+        #define ghost_has_ghost_nth_element 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_nth_element
+    #define ghost_has_ghost_nth_element 0
+#endif
+
+#endif
@@ -0,0 +1,93 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_BSD_PARTIAL_SORT_R_H_INCLUDED
+#define GHOST_BSD_PARTIAL_SORT_R_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Sorts the smallest sort_count elements of an array with a custom callback
+ * and context with a signature matching BSD qsort_r() into its front.
+ *
+ * The order of the remaining elements is unspecified. If sort_count is not
+ * less than count, the whole array is sorted.
+ *
+ * This works the same way as ghost_partial_sort(). It never wraps a platform
+ * function.
+ *
+ * @see ghost_partial_sort
+ * @see ghost_gnu_partial_sort_r
+ * @see ghost_win_partial_sort_s
+ * @see ghost_c11_partial_sort_s
+ * @see ghost_bsd_qsort_r
+ * @see ghost_bsd_nth_element_r
+ */
+void ghost_bsd_partial_sort_r(void* first, size_t count, size_t element_size,
+        void* context,
+        int (*compare)(void* context, const void* left, const void* right),
+        size_t sort_count);
+#endif
+
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_config.h"
+
+/* Handle override */
+#ifndef ghost_has_ghost_bsd_partial_sort_r
+    #ifdef ghost_bsd_partial_sort_r
+        #define ghost_has_ghost_bsd_partial_sort_r 1
+    #endif
+#endif
+
+/* Use the internal implementation */
+#ifndef ghost_has_ghost_bsd_partial_sort_r
+    #if !GHOST_QSORT_DISABLE_INTERNAL
+        #include "ghost/impl/ghost_impl_inline.h"
+        #include "ghost/impl/algorithm/qsort/ghost_impl_qsort_internal.h"
+        #include "ghost/type/size_t/ghost_size_t.h"
+
+        GHOST_IMPL_FUNCTION_OPEN
+
+        ghost_impl_inline
+        void ghost_bsd_partial_sort_r(void* first, ghost_size_t count, ghost_size_t element_size,
+                void* user_context,
+                int (*user_compare)(void* user_context, const void* left, const void* right),
+                ghost_size_t sort_count)
+        {
+            ghost_impl_qsort_state_t state;
+            state.element_size = element_size;
+            state.size_class = ghost_impl_qsort_resolve_size_class(first, element_size);
+            state.variant = ghost_impl_qsort_variant_bsd;
+            state.compare.bsd = user_compare;
+            state.user_context = user_context;
+            ghost_impl_qsort_partial_sort(&state, first, count, sort_count);
+        }
+
+        GHOST_IMPL_FUNCTION_CLOSE
+        #define ghost_has_ghost_bsd_partial_sort_r 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_bsd_partial_sort_r
+    #define ghost_has_ghost_bsd_partial_sort_r 0
+#endif
+
+#endif
@@ -0,0 +1,96 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_PARTIAL_SORT_H_INCLUDED
+#define GHOST_PARTIAL_SORT_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Sorts the smallest sort_count elements of an array into its front.
+ *
+ * The order of the remaining elements is unspecified. If sort_count is not
+ * less than count, the whole array is sorted.
+ *
+ * The smallest elements are first selected with the equivalent nth_element
+ * function and then sorted with Ghost's internal qsort, so this runs in
+ * O(n + klogk) on average (where k is sort_count) and O(nlogn) in the worst
+ * case. The sort is not stable.
+ *
+ * This never wraps a platform function. When optimizing for size, this sorts
+ * the whole array.
+ *
+ * @see ghost_gnu_partial_sort_r
+ * @see ghost_bsd_partial_sort_r
+ * @see ghost_win_partial_sort_s
+ * @see ghost_c11_partial_sort_s
+ * @see ghost_qsort
+ * @see ghost_nth_element
+ */
+void ghost_partial_sort(void* first, size_t count, size_t element_size,
+        int (*compare)(const void* left, const void* right),
+        size_t sort_count);
+#endif
+
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_config.h"
+
+/* Handle override */
+#ifndef ghost_has_ghost_partial_sort
+    #ifdef ghost_partial_sort
+        #define ghost_has_ghost_partial_sort 1
+    #endif
+#endif
+
+/* Use the internal implementation */
+#ifndef ghost_has_ghost_partial_sort
+    #if !GHOST_QSORT_DISABLE_INTERNAL
+        #include "ghost/impl/ghost_impl_inline.h"
+        #include "ghost/impl/algorithm/qsort/ghost_impl_qsort_internal.h"
+        #include "ghost/type/size_t/ghost_size_t.h"
+        #include "ghost/language/ghost_null.h"
+
+        GHOST_IMPL_FUNCTION_OPEN
+
+        ghost_impl_inline
+        void ghost_partial_sort(void* first, ghost_size_t count, ghost_size_t element_size,
+                int (*user_compare)(const void* left, const void* right),
+                ghost_size_t sort_count)
+        {
+            ghost_impl_qsort_state_t state;
+            state.element_size = element_size;
+            state.size_class = ghost_impl_qsort_resolve_size_class(first, element_size);
+            state.variant = ghost_impl_qsort_variant_nocontext;
+            state.compare.nocontext = user_compare;
+            state.user_context = ghost_null;
+            ghost_impl_qsort_partial_sort(&state, first, count, sort_count);
+        }
+
+        GHOST_IMPL_FUNCTION_CLOSE
+        #define ghost_has_ghost_partial_sort 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_partial_sort
+    #define ghost_has_ghost_partial_sort 0
+#endif
+
+#endif
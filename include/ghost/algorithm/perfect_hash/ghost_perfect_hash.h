@@ -0,0 +1,117 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_PERFECT_HASH_H_INCLUDED
+#define GHOST_PERFECT_HASH_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Returns the slot of a key in a minimal perfect hash table built by
+ * tools/perfect_hash.py.
+ *
+ * A minimal perfect hash maps each of a fixed set of n keys to a distinct
+ * slot in [0, n). This uses the "hash and displace" construction (CHD): the
+ * hash selects a bucket, and the bucket's seed selects the slot. Each lookup
+ * is a few multiplications, one read of the seed table and one read of the
+ * slot table, with no probing.
+ *
+ * The hash is the 64-bit FNV-1a hash of the key (see ghost_fnv1a_u64()).
+ * Keys that are not in the set also map to some slot so you must compare the
+ * key against the one stored in the slot.
+ *
+ * You don't normally call this directly. tools/perfect_hash.py generates a
+ * header with the tables and a lookup function that calls this. See
+ * docs/perfect_hash.md.
+ *
+ * @param hash The FNV-1a hash of the key
+ * @param seeds The seed table, one per bucket
+ * @param bucket_count The number of buckets, at most 2^32
+ * @param key_count The number of keys, between 1 and 2^32
+ */
+size_t ghost_perfect_hash(uint64_t hash, const uint16_t* seeds, size_t bucket_count, size_t key_count);
+#endif
+
+#ifndef ghost_has_ghost_perfect_hash
+    #ifdef ghost_perfect_hash
+        #define ghost_has_ghost_perfect_hash 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_perfect_hash
+    #include "ghost/type/uint16_t/ghost_uint16_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    #if !ghost_has(ghost_uint16_t) || !ghost_has(ghost_uint64_t) || \
+            !ghost_has(GHOST_UINT64_C) || !ghost_has(ghost_size_t)
+        #define ghost_has_ghost_perfect_hash 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_perfect_hash
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/ghost_impl_always_inline.h"
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/debug/ghost_assert.h"
+    GHOST_IMPL_FUNCTION_OPEN
+
+    /* MurmurHash3's 64-bit finalizer. FNV-1a mixes poorly into its high bits
+     * on short keys so we run it through this before using it. */
+    ghost_impl_always_inline
+    ghost_uint64_t ghost_impl_perfect_hash_mix(ghost_uint64_t x) {
+        x ^= x >> 33;
+        x *= GHOST_UINT64_C(0xff51afd7ed558ccd);
+        x ^= x >> 33;
+        x *= GHOST_UINT64_C(0xc4ceb9fe1a85ec53);
+        x ^= x >> 33;
+        return x;
+    }
+
+    ghost_impl_inline
+    ghost_size_t ghost_perfect_hash(ghost_uint64_t hash, const ghost_uint16_t* seeds,
+            ghost_size_t bucket_count, ghost_size_t key_count)
+    {
+        ghost_uint64_t mixed;
+        ghost_uint64_t bucket;
+        ghost_uint64_t seed;
+        ghost_uint64_t slot;
+        ghost_assert(bucket_count > 0, "");
+        ghost_assert(key_count > 0, "");
+
+        /* The high half of the hash picks the bucket and the bucket's seed
+         * rehashes the full hash for the low half to pick the slot. Both are
+         * reduced to range with a multiply rather than a modulo. */
+        mixed = ghost_impl_perfect_hash_mix(hash);
+        bucket = ((mixed >> 32) * ghost_static_cast(ghost_uint64_t, bucket_count)) >> 32;
+        seed = ghost_static_cast(ghost_uint64_t, seeds[ghost_static_cast(ghost_size_t, bucket)]) + 1;
+        slot = ghost_impl_perfect_hash_mix(mixed ^ (seed * GHOST_UINT64_C(0x9E3779B97F4A7C15)));
+        slot = ((slot & GHOST_UINT64_C(0xFFFFFFFF)) * ghost_static_cast(ghost_uint64_t, key_count)) >> 32;
+        return ghost_static_cast(ghost_size_t, slot);
+    }
+
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_perfect_hash 1
+#endif
+
+#endif
@@ -0,0 +1,97 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_BSD_QSORT_PARALLEL_R_H_INCLUDED
+#define GHOST_BSD_QSORT_PARALLEL_R_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Sorts an array in parallel with a custom callback and context with a
+ * signature matching BSD qsort_r().
+ *
+ * The array is partitioned with the same algorithm as Ghost's internal qsort
+ * and independent partitions are sorted concurrently on threads created with
+ * ghost_vthread_create(). Arrays (and partitions) with
+ * GHOST_QSORT_PARALLEL_THRESHOLD or fewer elements are sorted on the calling
+ * thread. At most GHOST_QSORT_PARALLEL_THREADS threads are used, including
+ * the calling thread.
+ *
+ * Like the internal qsort, the worst case is O(nlogn). The sort is not
+ * stable.
+ *
+ * The compare function will be called concurrently from multiple threads so
+ * it must be thread-safe.
+ *
+ * This never wraps a platform qsort function. When optimizing for size, or if
+ * threads are not available, this sorts on the calling thread with the
+ * internal qsort.
+ *
+ * @see ghost_bsd_qsort_r
+ */
+void ghost_bsd_qsort_parallel_r(void* first, size_t count, size_t element_size,
+        void* context,
+        int (*compare)(void* context, const void* left, const void* right));
+#endif
+
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_config.h"
+
+/* Handle override */
+#ifndef ghost_has_ghost_bsd_qsort_parallel_r
+    #ifdef ghost_bsd_qsort_parallel_r
+        #define ghost_has_ghost_bsd_qsort_parallel_r 1
+    #endif
+#endif
+
+/* Use the internal implementation */
+#ifndef ghost_has_ghost_bsd_qsort_parallel_r
+    #if !GHOST_QSORT_DISABLE_INTERNAL
+        #include "ghost/impl/ghost_impl_inline.h"
+        #include "ghost/impl/algorithm/qsort/ghost_impl_qsort_parallel.h"
+        #include "ghost/type/size_t/ghost_size_t.h"
+
+        GHOST_IMPL_FUNCTION_OPEN
+
+        ghost_impl_inline
+        void ghost_bsd_qsort_parallel_r(void* first, ghost_size_t count, ghost_size_t element_size,
+                void* user_context,
+                int (*user_compare)(void* user_context, const void* left, const void* right))
+        {
+            ghost_impl_qsort_state_t state;
+            state.element_size = element_size;
+            state.size_class = ghost_impl_qsort_resolve_size_class(first, element_size);
+            state.variant = ghost_impl_qsort_variant_bsd;
+            state.compare.bsd = user_compare;
+            state.user_context = user_context;
+            ghost_impl_qsort_parallel(&state, first, count);
+        }
+
+        GHOST_IMPL_FUNCTION_CLOSE
+        #define ghost_has_ghost_bsd_qsort_parallel_r 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_bsd_qsort_parallel_r
+    #define ghost_has_ghost_bsd_qsort_parallel_r 0
+#endif
+
+#endif
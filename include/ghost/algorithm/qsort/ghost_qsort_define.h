@@ -0,0 +1,163 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_QSORT_DEFINE_H_INCLUDED
+#define GHOST_QSORT_DEFINE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * @def GHOST_QSORT_DEFINE(name, type, less)
+ *
+ * Defines a sort function specialized for arrays of the given element type
+ * with an inlined comparison.
+ *
+ * The generated function has this prototype:
+ *
+ *     static void name(type* first, size_t count);
+ *
+ * The less argument must be the name of a function or function-like macro
+ * that takes two `const type*` and returns non-zero if the first element
+ * should be ordered before the second. For example:
+ *
+ *     typedef struct {
+ *         uint64_t key;
+ *         uint32_t value;
+ *     } record_t;
+ *
+ *     #define record_less(left, right) ((left)->key < (right)->key)
+ *     GHOST_QSORT_DEFINE(sort_records, record_t, record_less)
+ *
+ *     sort_records(records, count);
+ *
+ * The generated function is Ghost's internal introsort (the same one used by
+ * ghost_qsort() when there is no platform qsort), expanded with a constant
+ * state: the element size is sizeof(type) and the comparison is a static
+ * function that calls less directly. Once the sort is inlined into the
+ * generated function, the compiler resolves the variant and size class
+ * switches at compile time and inlines the comparison and swaps. This is
+ * typically several times faster than qsort() and has the same block
+ * partitioning, pattern detection and sorting networks as the internal qsort.
+ *
+ * The sort is not stable. It uses O(logn) stack space and its worst case is
+ * O(nlogn). It doesn't allocate unless indirect sorting of large elements is
+ * enabled (see GHOST_QSORT_INDIRECT_THRESHOLD.)
+ *
+ * When optimizing for size, or when Ghost is not emitting function
+ * definitions in this translation unit (see GHOST_MANUAL_DEFS), the generated
+ * function calls the internal qsort without inlining it. It still avoids the
+ * function pointer indirection of the user's comparison but the internal
+ * qsort calls the generated comparison function through a function pointer.
+ *
+ * This defines the sort function, its comparison function and its state
+ * prefixed with `ghost_impl_` and the given name. All of them are static so
+ * this can be used in a header file or in any number of translation units.
+ *
+ * This must be used at file scope.
+ */
+#define GHOST_QSORT_DEFINE(name, type, less)
+#endif
+
+#ifndef ghost_has_GHOST_QSORT_DEFINE
+    #ifdef GHOST_QSORT_DEFINE
+        #define ghost_has_GHOST_QSORT_DEFINE 1
+    #endif
+#endif
+
+#ifndef ghost_has_GHOST_QSORT_DEFINE
+    #include "ghost/impl/algorithm/qsort/ghost_impl_qsort_config.h"
+    #include "ghost/impl/algorithm/qsort/ghost_impl_qsort_internal.h"
+    #include "ghost/language/ghost_alignof.h"
+    #include "ghost/language/ghost_const_cast.h"
+    #include "ghost/language/ghost_maybe_unused.h"
+    #include "ghost/language/ghost_null.h"
+    #include "ghost/language/ghost_optimize_for_size_opt.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    #include "ghost/type/uint32_t/ghost_uint32_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+
+    /*
+     * There is only one introsort: the generated function calls the always
+     * inlined body of ghost_impl_qsort_introsort() with a pointer to a static
+     * const state. Loads from a static const object with a constant
+     * initializer are folded by the compiler so the state costs nothing at
+     * runtime.
+     *
+     * The 4 and 8 size classes swap elements as integers so they must be
+     * aligned; we can only choose them at compile time if we know the
+     * alignment of the type. The 16 and 32 size classes have no alignment
+     * requirement.
+     */
+    #if ghost_has(ghost_alignof)
+        #define GHOST_IMPL_QSORT_DEFINE_SIZE_CLASS(type) \
+            ghost_static_cast(ghost_impl_qsort_size_class_t, \
+                (sizeof(type) == sizeof(ghost_uint32_t) && \
+                        ghost_alignof(type) % ghost_alignof(ghost_uint32_t) == 0) ? \
+                    ghost_impl_qsort_size_class_4 : \
+                (sizeof(type) == sizeof(ghost_uint64_t) && \
+                        ghost_alignof(type) % ghost_alignof(ghost_uint64_t) == 0) ? \
+                    ghost_impl_qsort_size_class_8 : \
+                sizeof(type) == 16 ? ghost_impl_qsort_size_class_16 : \
+                sizeof(type) == 32 ? ghost_impl_qsort_size_class_32 : \
+                ghost_impl_qsort_size_class_any)
+    #else
+        #define GHOST_IMPL_QSORT_DEFINE_SIZE_CLASS(type) \
+            ghost_static_cast(ghost_impl_qsort_size_class_t, \
+                sizeof(type) == 16 ? ghost_impl_qsort_size_class_16 : \
+                sizeof(type) == 32 ? ghost_impl_qsort_size_class_32 : \
+                ghost_impl_qsort_size_class_any)
+    #endif
+
+    #if !GHOST_OPTIMIZE_FOR_SIZE_OPT && defined(GHOST_IMPL_QSORT_INTERNAL_DEFINE_H_INCLUDED)
+        #define GHOST_IMPL_QSORT_DEFINE_SORT ghost_impl_qsort_introsort_inline
+    #else
+        #define GHOST_IMPL_QSORT_DEFINE_SORT ghost_impl_qsort_internal
+    #endif
+
+    #define GHOST_QSORT_DEFINE(name, type, less) \
+        ghost_maybe_unused static \
+        int ghost_impl_##name##_compare(const void* ghost_impl_v_left, const void* ghost_impl_v_right) { \
+            const type* ghost_impl_v_l = ghost_static_cast(const type*, ghost_impl_v_left); \
+            const type* ghost_impl_v_r = ghost_static_cast(const type*, ghost_impl_v_right); \
+            return less(ghost_impl_v_l, ghost_impl_v_r) ? -1 : less(ghost_impl_v_r, ghost_impl_v_l) ? 1 : 0; \
+        } \
+        \
+        static const ghost_impl_qsort_state_t ghost_impl_##name##_state = { \
+            sizeof(type), \
+            GHOST_IMPL_QSORT_DEFINE_SIZE_CLASS(type), \
+            ghost_impl_qsort_variant_nocontext, \
+            {&ghost_impl_##name##_compare}, \
+            ghost_null \
+        }; \
+        \
+        ghost_maybe_unused static \
+        void name(type* first, ghost_size_t count) { \
+            GHOST_IMPL_QSORT_DEFINE_SORT( \
+                    ghost_const_cast(ghost_impl_qsort_state_t*, &ghost_impl_##name##_state), \
+                    first, count); \
+        }
+
+    #define ghost_has_GHOST_QSORT_DEFINE 1
+#endif
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_RABIN_KARP_INIT_H_INCLUDED
+#define GHOST_RABIN_KARP_INIT_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Initializes a Rabin-Karp rolling hash for a window of the given number of
+ * bytes. The window starts out empty with a hash of 0.
+ *
+ * This takes O(log window) time.
+ *
+ * @see ghost_rabin_karp_t
+ */
+void ghost_rabin_karp_init(ghost_rabin_karp_t* state, size_t window);
+#endif
+
+#ifndef ghost_has_ghost_rabin_karp_init
+    #ifdef ghost_rabin_karp_init
+        #define ghost_has_ghost_rabin_karp_init 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_rabin_karp_init
+    #include "ghost/algorithm/rabin_karp/ghost_rabin_karp_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_rabin_karp_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_rabin_karp_init 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_rabin_karp_init
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/algorithm/rabin_karp/ghost_impl_rabin_karp.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    void ghost_rabin_karp_init(ghost_rabin_karp_t* state, ghost_size_t window) GHOST_IMPL_DEF({
+        ghost_uint64_t power = 1;
+        ghost_uint64_t base = GHOST_IMPL_RABIN_KARP_BASE;
+        while (window != 0) {
+            if (window & 1)
+                power *= base;
+            base *= base;
+            window >>= 1;
+        }
+        state->ghost_impl_hash = 0;
+        state->ghost_impl_power = power;
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_rabin_karp_init 1
+#endif
+
+#endif
@@ -0,0 +1,68 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_RABIN_KARP_PUSH_H_INCLUDED
+#define GHOST_RABIN_KARP_PUSH_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Adds a byte to the end of a Rabin-Karp window without removing any,
+ * returning the new hash.
+ *
+ * Use this to fill the window after ghost_rabin_karp_init(). Once the window
+ * is full, use ghost_rabin_karp_roll() instead. (Pushing more bytes than the
+ * window size gives the hash of a longer window, which is also well-defined
+ * but can't be rolled.)
+ *
+ * @see ghost_rabin_karp_t
+ */
+uint64_t ghost_rabin_karp_push(ghost_rabin_karp_t* state, unsigned char byte);
+#endif
+
+#ifndef ghost_has_ghost_rabin_karp_push
+    #ifdef ghost_rabin_karp_push
+        #define ghost_has_ghost_rabin_karp_push 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_rabin_karp_push
+    #include "ghost/algorithm/rabin_karp/ghost_rabin_karp_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_rabin_karp_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_rabin_karp_push 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_rabin_karp_push
+    #include "ghost/impl/ghost_impl_always_inline.h"
+    #include "ghost/impl/algorithm/rabin_karp/ghost_impl_rabin_karp.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_always_inline
+    ghost_uint64_t ghost_rabin_karp_push(ghost_rabin_karp_t* state, unsigned char byte) {
+        return state->ghost_impl_hash = state->ghost_impl_hash * GHOST_IMPL_RABIN_KARP_BASE + byte;
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_rabin_karp_push 1
+#endif
+
+#endif
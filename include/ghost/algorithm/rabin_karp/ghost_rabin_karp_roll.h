@@ -0,0 +1,69 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_RABIN_KARP_ROLL_H_INCLUDED
+#define GHOST_RABIN_KARP_ROLL_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Slides a full Rabin-Karp window forward by one byte, returning the new hash.
+ *
+ * The first byte of the window (the one added longest ago) must be passed as
+ * `out`; it is removed from the hash and `in` is added at the end.
+ *
+ * The result is the same as pushing the bytes of the new window into a fresh
+ * state.
+ *
+ * @see ghost_rabin_karp_t
+ */
+uint64_t ghost_rabin_karp_roll(ghost_rabin_karp_t* state, unsigned char out, unsigned char in);
+#endif
+
+#ifndef ghost_has_ghost_rabin_karp_roll
+    #ifdef ghost_rabin_karp_roll
+        #define ghost_has_ghost_rabin_karp_roll 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_rabin_karp_roll
+    #include "ghost/algorithm/rabin_karp/ghost_rabin_karp_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_rabin_karp_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_rabin_karp_roll 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_rabin_karp_roll
+    #include "ghost/impl/ghost_impl_always_inline.h"
+    #include "ghost/impl/algorithm/rabin_karp/ghost_impl_rabin_karp.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_always_inline
+    ghost_uint64_t ghost_rabin_karp_roll(ghost_rabin_karp_t* state, unsigned char out, unsigned char in) {
+        return state->ghost_impl_hash = state->ghost_impl_hash * GHOST_IMPL_RABIN_KARP_BASE + in -
+                state->ghost_impl_power * out;
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_rabin_karp_roll 1
+#endif
+
+#endif
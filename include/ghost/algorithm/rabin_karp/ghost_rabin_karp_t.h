@@ -0,0 +1,78 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_RABIN_KARP_T_H_INCLUDED
+#define GHOST_RABIN_KARP_T_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * The state of a Rabin-Karp rolling hash over a fixed-size window of bytes.
+ *
+ * The hash of a window of bytes c[0..n-1] is the polynomial
+ * c[0]*B^(n-1) + c[1]*B^(n-2) + ... + c[n-1] modulo 2^64 for a fixed odd
+ * base B. Sliding the window by one byte takes one multiplication for the new
+ * byte and one for the byte leaving the window.
+ *
+ * Initialize the state with ghost_rabin_karp_init(), fill the window with
+ * ghost_rabin_karp_push() and then slide it with ghost_rabin_karp_roll(). The
+ * state doesn't keep a copy of the window: the caller passes the byte leaving
+ * it. This means the state is small and trivially copyable, and the window
+ * can span any number of input buffers as long as the caller keeps its bytes.
+ *
+ * Equal windows always have equal hashes so this can be used for substring
+ * search (compare the bytes on a hash match.) Since the modulus is a power of
+ * two, the low bits of the hash are weak; to pick boundaries or buckets, use
+ * the high bits. For content-defined chunking, ghost_cdc_next_boundary() with
+ * the Gear hash is faster.
+ *
+ * @see ghost_rabin_karp_init
+ * @see ghost_rabin_karp_push
+ * @see ghost_rabin_karp_roll
+ */
+typedef struct { /*unspecified*/ } ghost_rabin_karp_t;
+#endif
+
+#ifndef ghost_has_ghost_rabin_karp_t
+    #ifdef ghost_rabin_karp_t
+        #define ghost_has_ghost_rabin_karp_t 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_rabin_karp_t
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #if !ghost_has(ghost_uint64_t)
+        #define ghost_has_ghost_rabin_karp_t 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_rabin_karp_t
+    typedef struct ghost_rabin_karp_t {
+        /* This structure is meant to be opaque. Don't access these fields directly. */
+        ghost_uint64_t ghost_impl_hash;
+        /* The base raised to the window size */
+        ghost_uint64_t ghost_impl_power;
+    } ghost_rabin_karp_t;
+    #define ghost_has_ghost_rabin_karp_t 1
+#endif
+
+#endif
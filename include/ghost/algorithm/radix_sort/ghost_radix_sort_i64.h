@@ -0,0 +1,76 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_RADIX_SORT_I64_H_INCLUDED
+#define GHOST_RADIX_SORT_I64_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Sorts an array of signed 64-bit integers in ascending order with an LSD radix sort.
+ *
+ * The scratch buffer must have room for count elements and must not overlap
+ * the array. Its contents are clobbered. This never allocates memory.
+ *
+ * This makes at most 8 passes over the data, one per byte of the key, plus
+ * one to build histograms. Passes in which all keys share the same byte are
+ * skipped. It runs in O(n) time and is typically several times faster than
+ * ghost_qsort() for large arrays.
+ *
+ * @see ghost_radix_sort_u32
+ * @see ghost_radix_sort_u64
+ * @see ghost_radix_sort_i32
+ * @see ghost_radix_sort_f32
+ * @see ghost_radix_sort_f64
+ * @see ghost_radix_sort_records_i64
+ */
+void ghost_radix_sort_i64(int64_t* array, int64_t* scratch, size_t count);
+#endif
+
+#ifndef ghost_has_ghost_radix_sort_i64
+    #ifdef ghost_radix_sort_i64
+        #define ghost_has_ghost_radix_sort_i64 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_radix_sort_i64
+    #include "ghost/type/int64_t/ghost_int64_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #if !ghost_has(ghost_int64_t) || !ghost_has(ghost_uint64_t)
+        #define ghost_has_ghost_radix_sort_i64 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_radix_sort_i64
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/algorithm/radix_sort/ghost_impl_radix_sort.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    void ghost_radix_sort_i64(ghost_int64_t* array, ghost_int64_t* scratch, ghost_size_t count) GHOST_IMPL_DEF({
+        ghost_impl_radix_sort_64(array, scratch, count, sizeof(ghost_int64_t), 0, GHOST_IMPL_RADIX_SORT_SIGNED);
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_radix_sort_i64 1
+#endif
+
+#endif
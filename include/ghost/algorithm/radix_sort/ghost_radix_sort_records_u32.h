@@ -0,0 +1,81 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_RADIX_SORT_RECORDS_U32_H_INCLUDED
+#define GHOST_RADIX_SORT_RECORDS_U32_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Sorts an array of records in ascending order by a unsigned key with an LSD
+ * radix sort.
+ *
+ * Each record is element_size bytes. The key is a native-endian uint32_t stored
+ * key_offset bytes from the start of each record, for example as given by
+ * offsetof(). The key does not need to be aligned. Records are moved whole so
+ * the rest of each record is carried along as payload.
+ *
+ * The scratch buffer must have room for count records and must not overlap
+ * the array. Its contents are clobbered. This never allocates memory.
+ *
+ * The sort is stable: records with equal keys keep their relative order.
+ *
+ * @see ghost_radix_sort_records_u64
+ * @see ghost_radix_sort_records_i32
+ * @see ghost_radix_sort_records_i64
+ * @see ghost_radix_sort_u32
+ */
+void ghost_radix_sort_records_u32(void* array, void* scratch, size_t count,
+        size_t element_size, size_t key_offset);
+#endif
+
+#ifndef ghost_has_ghost_radix_sort_records_u32
+    #ifdef ghost_radix_sort_records_u32
+        #define ghost_has_ghost_radix_sort_records_u32 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_radix_sort_records_u32
+    #include "ghost/type/uint32_t/ghost_uint32_t.h"
+    #if !ghost_has(ghost_uint32_t)
+        #define ghost_has_ghost_radix_sort_records_u32 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_radix_sort_records_u32
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/algorithm/radix_sort/ghost_impl_radix_sort.h"
+    #include "ghost/debug/ghost_assert.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    void ghost_radix_sort_records_u32(void* array, void* scratch, ghost_size_t count,
+            ghost_size_t element_size, ghost_size_t key_offset)
+    GHOST_IMPL_DEF({
+        ghost_assert(key_offset + sizeof(ghost_uint32_t) <= element_size, "key must be within the record");
+        ghost_impl_radix_sort_32(array, scratch, count, element_size, key_offset, GHOST_IMPL_RADIX_SORT_UNSIGNED);
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_radix_sort_records_u32 1
+#endif
+
+#endif
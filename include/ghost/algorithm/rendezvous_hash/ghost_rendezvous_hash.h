@@ -0,0 +1,89 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_RENDEZVOUS_HASH_H_INCLUDED
+#define GHOST_RENDEZVOUS_HASH_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Chooses one of the given nodes for a 64-bit key with rendezvous (highest
+ * random weight) hashing, returning its index.
+ *
+ * Each node is identified by a 64-bit hash of its name (e.g. from
+ * ghost_wyhash_u64() or ghost_fnv1a_u64()) and the key should also be a
+ * hash. Each node gets a pseudo-random score for the key and the node with
+ * the highest score wins.
+ *
+ * The choice doesn't depend on the order of the nodes. When a node is added,
+ * only the keys it wins (about 1/n of them) move to it; when a node is
+ * removed, only its keys move, spread evenly over the remaining nodes. Unlike
+ * ghost_jump_hash(), any node can be removed.
+ *
+ * This takes O(n) time (a couple of multiplications per node) and no memory.
+ * The number of nodes must be at least 1. Ties (which require equal node
+ * hashes) go to the lowest index.
+ *
+ * @see ghost_rendezvous_hash_weighted
+ * @see ghost_jump_hash
+ */
+size_t ghost_rendezvous_hash(uint64_t key, const uint64_t* nodes, size_t count);
+#endif
+
+#ifndef ghost_has_ghost_rendezvous_hash
+    #ifdef ghost_rendezvous_hash
+        #define ghost_has_ghost_rendezvous_hash 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_rendezvous_hash
+    #include "ghost/impl/algorithm/rendezvous_hash/ghost_impl_rendezvous_hash.h"
+    #if !ghost_has(ghost_impl_rendezvous_hash)
+        #define ghost_has_ghost_rendezvous_hash 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_rendezvous_hash
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    #include "ghost/debug/ghost_assert.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    ghost_size_t ghost_rendezvous_hash(ghost_uint64_t key, const ghost_uint64_t* nodes, ghost_size_t count) GHOST_IMPL_DEF({
+        ghost_size_t best = 0;
+        ghost_uint64_t best_score = 0;
+        ghost_size_t i;
+        ghost_assert(count > 0, "");
+        for (i = 0; i < count; ++i) {
+            ghost_uint64_t score = ghost_impl_rendezvous_hash_score(key, nodes[i]);
+            if (i == 0 || score > best_score) {
+                best = i;
+                best_score = score;
+            }
+        }
+        return best;
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_rendezvous_hash 1
+#endif
+
+#endif
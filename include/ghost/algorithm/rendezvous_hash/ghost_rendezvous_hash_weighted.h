@@ -0,0 +1,109 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_RENDEZVOUS_HASH_WEIGHTED_H_INCLUDED
+#define GHOST_RENDEZVOUS_HASH_WEIGHTED_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Chooses one of the given weighted nodes for a 64-bit key with weighted
+ * rendezvous hashing, returning its index.
+ *
+ * This is the same as ghost_rendezvous_hash() except that each node receives
+ * a share of the keys proportional to its weight. The score of a node is
+ * `weight / -ln(u)` where u is the node's pseudo-random score for the key
+ * scaled to (0,1). (This is the "logarithmic method" of Schindelhauer and
+ * Schomaker.) Changing a node's weight only moves keys to or from that node.
+ *
+ * Nodes with a weight of zero (or less) are never chosen. If no node has a
+ * positive weight, this returns count.
+ *
+ * This needs ghost_log_d(). Results are consistent on any platform with a
+ * correctly rounded or at least deterministic log(); in the very rare case of
+ * two scores within an ulp of each other, different libm implementations
+ * could pick different nodes.
+ *
+ * @see ghost_rendezvous_hash
+ */
+size_t ghost_rendezvous_hash_weighted(uint64_t key, const uint64_t* nodes,
+        const double* weights, size_t count);
+#endif
+
+#ifndef ghost_has_ghost_rendezvous_hash_weighted
+    #ifdef ghost_rendezvous_hash_weighted
+        #define ghost_has_ghost_rendezvous_hash_weighted 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_rendezvous_hash_weighted
+    #include "ghost/impl/algorithm/rendezvous_hash/ghost_impl_rendezvous_hash.h"
+    #include "ghost/type/double/ghost_double.h"
+    #include "ghost/math/log/ghost_log_d.h"
+    #if !ghost_has(ghost_impl_rendezvous_hash) || !ghost_has(ghost_double) || !ghost_has(ghost_log_d)
+        #define ghost_has_ghost_rendezvous_hash_weighted 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_rendezvous_hash_weighted
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    #include "ghost/impl/ghost_impl_always_inline.h"
+    GHOST_IMPL_FUNCTION_OPEN
+
+    /* Scales the top 52 bits of a score into (0,1), excluding both ends so
+     * the log is negative and finite. (k + 0.5) / 2^52 is exact in a double
+     * for any 52-bit k so it can't round up to 1. (The top 53 bits wouldn't
+     * work: 2^53 - 0.5 rounds to 2^53.) */
+    ghost_impl_always_inline
+    double ghost_impl_rendezvous_hash_weighted_unit(ghost_uint64_t score) {
+        return (ghost_static_cast(double, score >> 12) + 0.5) * (1.0 / 4503599627370496.0);
+    }
+
+    ghost_impl_function
+    ghost_size_t ghost_rendezvous_hash_weighted(ghost_uint64_t key, const ghost_uint64_t* nodes,
+            const double* weights, ghost_size_t count) GHOST_IMPL_DEF(
+    {
+        ghost_size_t best = count;
+        double best_score = 0.0;
+        ghost_size_t i;
+        for (i = 0; i < count; ++i) {
+            double score;
+            double u;
+            if (!(weights[i] > 0.0))
+                continue;
+
+            u = ghost_impl_rendezvous_hash_weighted_unit(ghost_impl_rendezvous_hash_score(key, nodes[i]));
+            score = weights[i] / -ghost_log_d(u);
+            if (best == count || score > best_score) {
+                best = i;
+                best_score = score;
+            }
+        }
+        return best;
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_rendezvous_hash_weighted 1
+#endif
+
+#endif
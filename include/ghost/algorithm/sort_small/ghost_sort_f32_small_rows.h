@@ -0,0 +1,112 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_SORT_F32_SMALL_ROWS_H_INCLUDED
+#define GHOST_SORT_F32_SMALL_ROWS_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Sorts each of row_count rows of row_length 32-bit floats in ascending order
+ * with a sorting network.
+ *
+ * The rows are contiguous: row r starts at rows + r * row_length. This is
+ * meant for sorting large numbers of tiny fixed-size arrays.
+ *
+ * Rows of up to 32 elements are transposed so that several rows are sorted
+ * at once, one per SIMD lane, using SSE2 min/max where available. Otherwise
+ * each row is sorted with ghost_sort_f32_small().
+ *
+ * NaNs are not ordered. If the array contains NaNs, the result is still a
+ * permutation of the input but it is not necessarily sorted.
+ *
+ * @see ghost_sort_f32_small
+ * @see ghost_sort_u32_small_rows
+ * @see ghost_sort_u64_small_rows
+ * @see ghost_sort_i32_small_rows
+ * @see ghost_sort_i64_small_rows
+ * @see ghost_sort_f64_small_rows
+ */
+void ghost_sort_f32_small_rows(ghost_float32_t* rows, size_t row_count, size_t row_length);
+#endif
+
+#ifndef ghost_has_ghost_sort_f32_small_rows
+    #ifdef ghost_sort_f32_small_rows
+        #define ghost_has_ghost_sort_f32_small_rows 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_sort_f32_small_rows
+    #include "ghost/algorithm/sort_small/ghost_sort_f32_small.h"
+    #if !ghost_has(ghost_sort_f32_small)
+        #define ghost_has_ghost_sort_f32_small_rows 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_sort_f32_small_rows
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/algorithm/sort_small/ghost_impl_sort_small.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    void ghost_sort_f32_small_rows(ghost_float32_t* rows, ghost_size_t row_count, ghost_size_t row_length)
+    #if !GHOST_EMIT_DEFS
+    ;
+    #else
+    {
+        ghost_size_t row = 0;
+
+        #if GHOST_IMPL_SORT_SMALL_SSE2
+        if (row_length <= GHOST_IMPL_SORT_SMALL_ROWS_MAX) {
+            /* Element e of row (row + l) is at buffer[e * 4 + l]. */
+            ghost_float32_t buffer[GHOST_IMPL_SORT_SMALL_ROWS_MAX * 4];
+            for (; row + 4 <= row_count; row += 4) {
+                ghost_float32_t* first = rows + row * row_length;
+                ghost_size_t e;
+                ghost_size_t l;
+                for (e = 0; e < row_length; ++e)
+                    for (l = 0; l < 4; ++l)
+                        buffer[e * 4 + l] = first[l * row_length + e];
+
+                GHOST_IMPL_SORT_SMALL_NETWORK(row_length, ghost_impl_v_left, ghost_impl_v_right, {
+                    __m128 x = _mm_loadu_ps(buffer + ghost_impl_v_left * 4);
+                    __m128 y = _mm_loadu_ps(buffer + ghost_impl_v_right * 4);
+                    _mm_storeu_ps(buffer + ghost_impl_v_left * 4, _mm_min_ps(y, x));
+                    _mm_storeu_ps(buffer + ghost_impl_v_right * 4, _mm_max_ps(x, y));
+                });
+
+                for (e = 0; e < row_length; ++e)
+                    for (l = 0; l < 4; ++l)
+                        first[l * row_length + e] = buffer[e * 4 + l];
+            }
+        }
+        #endif
+
+        for (; row < row_count; ++row)
+            ghost_sort_f32_small(rows + row * row_length, row_length);
+    }
+    #endif
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_sort_f32_small_rows 1
+#endif
+
+#endif
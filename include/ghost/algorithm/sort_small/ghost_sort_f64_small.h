@@ -0,0 +1,78 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_SORT_F64_SMALL_H_INCLUDED
+#define GHOST_SORT_F64_SMALL_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Sorts a small array of 64-bit floats in ascending order with a branchless
+ * sorting network.
+ *
+ * This is typically several times faster than insertion sort (and far faster
+ * than ghost_qsort()) for arrays of up to around 32 elements, especially when
+ * count is a compile-time constant. The network performs O(nlog^2n)
+ * comparisons so this should not be used for large arrays.
+ *
+ * NaNs are not ordered. If the array contains NaNs, the result is still a
+ * permutation of the input but it is not necessarily sorted.
+ *
+ * @see ghost_sort_f64_small_rows
+ * @see ghost_radix_sort_f64
+ * @see ghost_sort_u32_small
+ * @see ghost_sort_u64_small
+ * @see ghost_sort_i32_small
+ * @see ghost_sort_i64_small
+ * @see ghost_sort_f32_small
+ */
+void ghost_sort_f64_small(ghost_float64_t* array, size_t count);
+#endif
+
+#ifndef ghost_has_ghost_sort_f64_small
+    #ifdef ghost_sort_f64_small
+        #define ghost_has_ghost_sort_f64_small 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_sort_f64_small
+    #include "ghost/type/float64_t/ghost_float64_t.h"
+    #if !ghost_has(ghost_float64_t)
+        #define ghost_has_ghost_sort_f64_small 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_sort_f64_small
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/sort_small/ghost_impl_sort_small.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_inline
+    void ghost_sort_f64_small(ghost_float64_t* array, ghost_size_t count) {
+        GHOST_IMPL_SORT_SMALL_NETWORK(count, ghost_impl_v_left, ghost_impl_v_right,
+                GHOST_IMPL_SORT_SMALL_COMPARE_EXCHANGE_F64(array, ghost_impl_v_left, ghost_impl_v_right));
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_sort_f64_small 1
+#endif
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_SORT_I64_SMALL_ROWS_H_INCLUDED
+#define GHOST_SORT_I64_SMALL_ROWS_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Sorts each of row_count rows of row_length 64-bit signed integers in ascending order
+ * with a sorting network.
+ *
+ * The rows are contiguous: row r starts at rows + r * row_length. This is
+ * meant for sorting large numbers of tiny fixed-size arrays.
+ *
+ * There are no SIMD min/max instructions for 64-bit integers on most
+ * platforms so this currently sorts each row with ghost_sort_i64_small().
+ *
+ * @see ghost_sort_i64_small
+ * @see ghost_sort_u32_small_rows
+ * @see ghost_sort_u64_small_rows
+ * @see ghost_sort_i32_small_rows
+ * @see ghost_sort_f32_small_rows
+ * @see ghost_sort_f64_small_rows
+ */
+void ghost_sort_i64_small_rows(int64_t* rows, size_t row_count, size_t row_length);
+#endif
+
+#ifndef ghost_has_ghost_sort_i64_small_rows
+    #ifdef ghost_sort_i64_small_rows
+        #define ghost_has_ghost_sort_i64_small_rows 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_sort_i64_small_rows
+    #include "ghost/algorithm/sort_small/ghost_sort_i64_small.h"
+    #if !ghost_has(ghost_sort_i64_small)
+        #define ghost_has_ghost_sort_i64_small_rows 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_sort_i64_small_rows
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/algorithm/sort_small/ghost_impl_sort_small.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    void ghost_sort_i64_small_rows(ghost_int64_t* rows, ghost_size_t row_count, ghost_size_t row_length)
+    #if !GHOST_EMIT_DEFS
+    ;
+    #else
+    {
+        ghost_size_t row = 0;
+
+        for (; row < row_count; ++row)
+            ghost_sort_i64_small(rows + row * row_length, row_length);
+    }
+    #endif
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_sort_i64_small_rows 1
+#endif
+
+#endif
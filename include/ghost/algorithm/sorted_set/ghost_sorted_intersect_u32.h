@@ -0,0 +1,81 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_SORTED_INTERSECT_U32_H_INCLUDED
+#define GHOST_SORTED_INTERSECT_U32_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Writes the elements that are in both of the given sorted arrays of unsigned
+ * 32-bit integers to out, returning the number of elements written.
+ *
+ * The inputs must be sorted in ascending order without duplicates (see
+ * ghost_sorted_unique_u32().) The output must have room for the smaller of the
+ * two counts. It may be the same array as either input; otherwise it must not
+ * overlap them.
+ *
+ * If one input is much larger than the other, this finds each element of the
+ * smaller input in the larger with an exponential search (galloping) so it
+ * runs in O(m log(n/m)) time. Otherwise it merges the inputs, comparing four
+ * elements of each at once with SSE2 or NEON where available.
+ *
+ * @see ghost_sorted_union_u32
+ * @see ghost_sorted_difference_u32
+ * @see ghost_sorted_unique_u32
+ * @see ghost_sorted_intersect_u64
+ */
+size_t ghost_sorted_intersect_u32(uint32_t* out,
+        const uint32_t* a, size_t a_count,
+        const uint32_t* b, size_t b_count);
+#endif
+
+#ifndef ghost_has_ghost_sorted_intersect_u32
+    #ifdef ghost_sorted_intersect_u32
+        #define ghost_has_ghost_sorted_intersect_u32 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_sorted_intersect_u32
+    #include "ghost/type/uint32_t/ghost_uint32_t.h"
+    #if !ghost_has(ghost_uint32_t)
+        #define ghost_has_ghost_sorted_intersect_u32 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_sorted_intersect_u32
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/algorithm/sorted_set/ghost_impl_sorted_set.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    ghost_size_t ghost_sorted_intersect_u32(ghost_uint32_t* out,
+            const ghost_uint32_t* a, ghost_size_t a_count,
+            const ghost_uint32_t* b, ghost_size_t b_count)
+    GHOST_IMPL_DEF({
+        return ghost_impl_sorted_intersect_u32(out, a, a_count, b, b_count);
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_sorted_intersect_u32 1
+#endif
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_SORTED_UNIQUE_U64_H_INCLUDED
+#define GHOST_SORTED_UNIQUE_U64_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Writes the given sorted array of unsigned 64-bit integers to out without
+ * duplicates, returning the number of elements written.
+ *
+ * The output must have room for count elements and may be the same array as
+ * the input (to remove duplicates in place); otherwise it must not overlap the
+ * input. This is like C++ std::unique() for a sorted range.
+ *
+ * @see ghost_sorted_intersect_u64
+ * @see ghost_sorted_union_u64
+ * @see ghost_sorted_difference_u64
+ * @see ghost_sorted_unique_u32
+ */
+size_t ghost_sorted_unique_u64(uint64_t* out, const uint64_t* in, size_t count);
+#endif
+
+#ifndef ghost_has_ghost_sorted_unique_u64
+    #ifdef ghost_sorted_unique_u64
+        #define ghost_has_ghost_sorted_unique_u64 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_sorted_unique_u64
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #if !ghost_has(ghost_uint64_t)
+        #define ghost_has_ghost_sorted_unique_u64 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_sorted_unique_u64
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/algorithm/sorted_set/ghost_impl_sorted_set.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    ghost_size_t ghost_sorted_unique_u64(ghost_uint64_t* out, const ghost_uint64_t* in, ghost_size_t count)
+    GHOST_IMPL_DEF({
+        return ghost_impl_sorted_unique_u64(out, in, count);
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_sorted_unique_u64 1
+#endif
+
+#endif
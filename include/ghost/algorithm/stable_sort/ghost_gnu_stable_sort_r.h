@@ -0,0 +1,85 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_GNU_STABLE_SORT_R_H_INCLUDED
+#define GHOST_GNU_STABLE_SORT_R_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Sorts an array stably with a custom callback and context with a signature
+ * matching GNU (and future POSIX) qsort_r().
+ *
+ * Elements that compare equal keep their original relative order. This is a
+ * natural mergesort in the style of timsort: it detects ascending and
+ * descending runs and merges them with galloping, so it approaches O(n) on
+ * arrays that are already mostly sorted.
+ *
+ * The scratch buffer is optional. If given, it must have room for
+ * scratch_count elements and must not overlap the array. With room for
+ * count/2 elements the sort is O(nlogn). With less room (or none, in which
+ * case pass null and 0) merges that don't fit are done in place with
+ * rotations, which is slower but still stable and never allocates memory.
+ *
+ * This never wraps a platform function.
+ *
+ * @see ghost_stable_sort
+ * @see ghost_bsd_stable_sort_r
+ * @see ghost_gnu_qsort_r
+ */
+void ghost_gnu_stable_sort_r(void* first, size_t count, size_t element_size,
+        int (*compare)(const void* left, const void* right, void* context),
+        void* context, void* scratch, size_t scratch_count);
+#endif
+
+#ifndef ghost_has_ghost_gnu_stable_sort_r
+    #ifdef ghost_gnu_stable_sort_r
+        #define ghost_has_ghost_gnu_stable_sort_r 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_gnu_stable_sort_r
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/stable_sort/ghost_impl_stable_sort.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+
+    GHOST_IMPL_FUNCTION_OPEN
+
+    ghost_impl_inline
+    void ghost_gnu_stable_sort_r(void* first, ghost_size_t count, ghost_size_t element_size,
+            int (*user_compare)(const void* left, const void* right, void* user_context),
+            void* user_context, void* scratch, ghost_size_t scratch_count)
+    {
+        ghost_impl_qsort_state_t state;
+        state.element_size = element_size;
+        state.size_class = ghost_impl_qsort_resolve_size_class(first, element_size);
+        state.variant = ghost_impl_qsort_variant_gnu;
+        state.compare.gnu = user_compare;
+        state.user_context = user_context;
+        ghost_impl_stable_sort(&state, first, count, scratch, scratch_count);
+    }
+
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_gnu_stable_sort_r 1
+#endif
+
+#endif
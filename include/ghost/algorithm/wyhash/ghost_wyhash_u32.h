@@ -0,0 +1,71 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_WYHASH_U32_H_INCLUDED
+#define GHOST_WYHASH_U32_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Hashes the given bytes with the given seed using wyhash, returning a 32-bit
+ * hash.
+ *
+ * This is ghost_wyhash_u64() with the two halves of the result xored together.
+ * (It is not the separate wyhash32 algorithm.) It's still fast on 32-bit
+ * platforms but it's not as fast as it is on 64-bit platforms.
+ *
+ * @see ghost_wyhash_u64
+ * @see ghost_wyhash_z
+ * @see ghost_fnv1a_u32
+ */
+uint32_t ghost_wyhash_u32(const void* bytes, size_t length, uint32_t seed);
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u32
+    #ifdef ghost_wyhash_u32
+        #define ghost_has_ghost_wyhash_u32 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u32
+    #include "ghost/algorithm/wyhash/ghost_wyhash_u64.h"
+    #include "ghost/type/uint32_t/ghost_uint32_t.h"
+    #if !ghost_has(ghost_wyhash_u64) || !ghost_has(ghost_uint32_t)
+        #define ghost_has_ghost_wyhash_u32 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u32
+    #include "ghost/impl/ghost_impl_always_inline.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_always_inline
+    ghost_uint32_t ghost_wyhash_u32(const void* bytes, ghost_size_t length, ghost_uint32_t seed) {
+        ghost_uint64_t hash = ghost_wyhash_u64(bytes, length, seed);
+        return ghost_static_cast(ghost_uint32_t, hash ^ (hash >> 32));
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_wyhash_u32 1
+#endif
+
+#endif
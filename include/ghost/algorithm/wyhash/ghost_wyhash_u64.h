@@ -0,0 +1,91 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_WYHASH_U64_H_INCLUDED
+#define GHOST_WYHASH_U64_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Hashes the given bytes with the given seed using wyhash (final version 4.2),
+ * returning a 64-bit hash.
+ *
+ * This is a fast non-cryptographic hash. It reads 8 or 16 bytes at a time and
+ * mixes them with 64x64->128-bit multiplies so it's many times faster than
+ * ghost_fnv1a_u64() on anything but the shortest keys, and it has much better
+ * distribution. It's a good default for hash tables, checksums of trusted data
+ * and so on. It is not suitable against an adversary (unless perhaps with a
+ * secret random seed.)
+ *
+ * The bytes are read as little-endian so results are the same on all
+ * platforms, and they match the reference implementation of wyhash() with the
+ * default secret.
+ *
+ * @see ghost_wyhash_u32
+ * @see ghost_wyhash_z
+ * @see ghost_fnv1a_u64
+ */
+uint64_t ghost_wyhash_u64(const void* bytes, size_t length, uint64_t seed);
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64
+    #ifdef ghost_wyhash_u64
+        #define ghost_has_ghost_wyhash_u64 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_uint64_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_wyhash_u64 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/algorithm/wyhash/ghost_impl_wyhash.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    ghost_uint64_t ghost_wyhash_u64(const void* bytes, ghost_size_t length, ghost_uint64_t seed) GHOST_IMPL_DEF({
+        const unsigned char* p = ghost_static_cast(const unsigned char*, bytes);
+        ghost_size_t remaining = length;
+        seed ^= ghost_impl_wyhash_mix(seed ^ GHOST_IMPL_WYHASH_P0, GHOST_IMPL_WYHASH_P1);
+        if (remaining >= 48) {
+            ghost_uint64_t see1 = seed;
+            ghost_uint64_t see2 = seed;
+            do {
+                ghost_impl_wyhash_block(p, &seed, &see1, &see2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining >= 48);
+            seed ^= see1 ^ see2;
+        }
+        return ghost_impl_wyhash_finish(p, remaining, length, seed);
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_wyhash_u64 1
+#endif
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_WYHASH_U64_FINAL_H_INCLUDED
+#define GHOST_WYHASH_U64_FINAL_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Returns the wyhash of all bytes added to the given state.
+ *
+ * The state is not modified so you can keep adding bytes afterwards to get
+ * the hash of a longer input.
+ *
+ * @see ghost_wyhash_u64_state_t
+ */
+uint64_t ghost_wyhash_u64_final(const ghost_wyhash_u64_state_t* state);
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64_final
+    #ifdef ghost_wyhash_u64_final
+        #define ghost_has_ghost_wyhash_u64_final 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64_final
+    #include "ghost/algorithm/wyhash/ghost_wyhash_u64_state_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_wyhash_u64_state_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_wyhash_u64_final 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64_final
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/algorithm/wyhash/ghost_impl_wyhash.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    ghost_uint64_t ghost_wyhash_u64_final(const ghost_wyhash_u64_state_t* state) GHOST_IMPL_DEF({
+        ghost_uint64_t seed = state->ghost_impl_seed;
+        if (state->ghost_impl_length >= 48)
+            seed ^= state->ghost_impl_see1 ^ state->ghost_impl_see2;
+        return ghost_impl_wyhash_finish(state->ghost_impl_buffer + 16,
+                state->ghost_impl_pending, state->ghost_impl_length, seed);
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_wyhash_u64_final 1
+#endif
+
+#endif
@@ -0,0 +1,67 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_WYHASH_U64_INIT_H_INCLUDED
+#define GHOST_WYHASH_U64_INIT_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Initializes the state of an incremental wyhash with the given seed.
+ *
+ * @see ghost_wyhash_u64_state_t
+ */
+void ghost_wyhash_u64_init(ghost_wyhash_u64_state_t* state, uint64_t seed);
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64_init
+    #ifdef ghost_wyhash_u64_init
+        #define ghost_has_ghost_wyhash_u64_init 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64_init
+    #include "ghost/algorithm/wyhash/ghost_wyhash_u64_state_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_wyhash_u64_state_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_wyhash_u64_init 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64_init
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/algorithm/wyhash/ghost_impl_wyhash.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_inline
+    void ghost_wyhash_u64_init(ghost_wyhash_u64_state_t* state, ghost_uint64_t seed) {
+        seed ^= ghost_impl_wyhash_mix(seed ^ GHOST_IMPL_WYHASH_P0, GHOST_IMPL_WYHASH_P1);
+        state->ghost_impl_seed = seed;
+        state->ghost_impl_see1 = seed;
+        state->ghost_impl_see2 = seed;
+        state->ghost_impl_length = 0;
+        state->ghost_impl_pending = 0;
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_wyhash_u64_init 1
+#endif
+
+#endif
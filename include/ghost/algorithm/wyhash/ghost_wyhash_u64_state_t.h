@@ -0,0 +1,80 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_WYHASH_U64_STATE_T_H_INCLUDED
+#define GHOST_WYHASH_U64_STATE_T_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * The state of an incremental wyhash.
+ *
+ * Initialize it with ghost_wyhash_u64_init(), feed it bytes in any number of
+ * pieces with ghost_wyhash_u64_update() and get the hash with
+ * ghost_wyhash_u64_final(). The result is the same as ghost_wyhash_u64() of
+ * all of the bytes concatenated with the same seed.
+ *
+ * The state buffers up to 48 bytes of input (plus the last 16 bytes of the
+ * previous block, which wyhash re-reads at the end) so it's about 100 bytes.
+ * Input is hashed directly without buffering whenever possible so there's
+ * little overhead for large pieces.
+ *
+ * The state is trivially copyable so you can hash a common prefix once and
+ * copy the state for each suffix.
+ *
+ * @see ghost_wyhash_u64_init
+ * @see ghost_wyhash_u64_update
+ * @see ghost_wyhash_u64_final
+ */
+typedef struct { /*unspecified*/ } ghost_wyhash_u64_state_t;
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64_state_t
+    #ifdef ghost_wyhash_u64_state_t
+        #define ghost_has_ghost_wyhash_u64_state_t 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64_state_t
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #if !ghost_has(ghost_uint64_t)
+        #define ghost_has_ghost_wyhash_u64_state_t 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64_state_t
+    #include "ghost/type/size_t/ghost_size_t.h"
+    typedef struct ghost_wyhash_u64_state_t {
+        /* This structure is meant to be opaque. Don't access these fields directly. */
+        ghost_uint64_t ghost_impl_seed;
+        ghost_uint64_t ghost_impl_see1;
+        ghost_uint64_t ghost_impl_see2;
+        ghost_size_t ghost_impl_length;
+        ghost_size_t ghost_impl_pending;
+        /* The last 16 bytes of the previous block followed by up to 48 bytes
+         * of pending input */
+        unsigned char ghost_impl_buffer[64];
+    } ghost_wyhash_u64_state_t;
+    #define ghost_has_ghost_wyhash_u64_state_t 1
+#endif
+
+#endif
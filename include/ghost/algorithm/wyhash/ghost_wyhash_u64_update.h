@@ -0,0 +1,100 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_WYHASH_U64_UPDATE_H_INCLUDED
+#define GHOST_WYHASH_U64_UPDATE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Adds the given bytes to an incremental wyhash.
+ *
+ * @see ghost_wyhash_u64_state_t
+ */
+void ghost_wyhash_u64_update(ghost_wyhash_u64_state_t* state, const void* bytes, size_t length);
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64_update
+    #ifdef ghost_wyhash_u64_update
+        #define ghost_has_ghost_wyhash_u64_update 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64_update
+    #include "ghost/algorithm/wyhash/ghost_wyhash_u64_state_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_wyhash_u64_state_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_wyhash_u64_update 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_wyhash_u64_update
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/algorithm/wyhash/ghost_impl_wyhash.h"
+    #include "ghost/language/ghost_null.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/string/ghost_memcpy.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    void ghost_wyhash_u64_update(ghost_wyhash_u64_state_t* state, const void* bytes, ghost_size_t length) GHOST_IMPL_DEF({
+        const unsigned char* p = ghost_static_cast(const unsigned char*, bytes);
+        const unsigned char* last_block = ghost_null;
+        state->ghost_impl_length += length;
+
+        /* Top up a partial block. Blocks are hashed as soon as they're full;
+         * the one-shot hash does the same whenever at least 48 bytes remain. */
+        if (state->ghost_impl_pending != 0) {
+            ghost_size_t take = 48 - state->ghost_impl_pending;
+            if (take > length)
+                take = length;
+            ghost_memcpy(state->ghost_impl_buffer + 16 + state->ghost_impl_pending, p, take);
+            state->ghost_impl_pending += take;
+            p += take;
+            length -= take;
+            if (state->ghost_impl_pending < 48)
+                return;
+            ghost_impl_wyhash_block(state->ghost_impl_buffer + 16, &state->ghost_impl_seed,
+                    &state->ghost_impl_see1, &state->ghost_impl_see2);
+            ghost_memcpy(state->ghost_impl_buffer, state->ghost_impl_buffer + 48, 16);
+            state->ghost_impl_pending = 0;
+        }
+
+        /* Hash whole blocks in place. */
+        while (length >= 48) {
+            ghost_impl_wyhash_block(p, &state->ghost_impl_seed,
+                    &state->ghost_impl_see1, &state->ghost_impl_see2);
+            last_block = p;
+            p += 48;
+            length -= 48;
+        }
+        if (last_block != ghost_null)
+            ghost_memcpy(state->ghost_impl_buffer, last_block + 32, 16);
+
+        ghost_memcpy(state->ghost_impl_buffer + 16, p, length);
+        state->ghost_impl_pending = length;
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_wyhash_u64_update 1
+#endif
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_BLOOM_FILTER_CONTAINS_H_INCLUDED
+#define GHOST_BLOOM_FILTER_CONTAINS_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Returns true if the given 64-bit hash might have been added to the Bloom
+ * filter, or false if it definitely hasn't.
+ *
+ * @see ghost_bloom_filter_t
+ */
+bool ghost_bloom_filter_contains(const ghost_bloom_filter_t* filter, uint64_t hash);
+#endif
+
+#ifndef ghost_has_ghost_bloom_filter_contains
+    #ifdef ghost_bloom_filter_contains
+        #define ghost_has_ghost_bloom_filter_contains 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_bloom_filter_contains
+    #include "ghost/container/bloom_filter/ghost_bloom_filter_t.h"
+    #include "ghost/type/bool/ghost_bool.h"
+    #if !ghost_has(ghost_bloom_filter_t) || !ghost_has(ghost_bool)
+        #define ghost_has_ghost_bloom_filter_contains 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_bloom_filter_contains
+    #include "ghost/impl/ghost_impl_always_inline.h"
+    #include "ghost/language/ghost_static_cast.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_always_inline
+    ghost_bool ghost_bloom_filter_contains(const ghost_bloom_filter_t* filter, ghost_uint64_t hash) {
+        const ghost_uint64_t* block = GHOST_IMPL_BLOOM_FILTER_BLOCK(filter, hash);
+        ghost_uint64_t key = hash & GHOST_UINT64_C(0xFFFFFFFF);
+        ghost_uint64_t missing =
+                (~block[0] & GHOST_IMPL_BLOOM_FILTER_BIT0(key)) |
+                (~block[1] & GHOST_IMPL_BLOOM_FILTER_BIT1(key)) |
+                (~block[2] & GHOST_IMPL_BLOOM_FILTER_BIT2(key)) |
+                (~block[3] & GHOST_IMPL_BLOOM_FILTER_BIT3(key)) |
+                (~block[4] & GHOST_IMPL_BLOOM_FILTER_BIT4(key)) |
+                (~block[5] & GHOST_IMPL_BLOOM_FILTER_BIT5(key)) |
+                (~block[6] & GHOST_IMPL_BLOOM_FILTER_BIT6(key)) |
+                (~block[7] & GHOST_IMPL_BLOOM_FILTER_BIT7(key));
+        return missing == 0;
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_bloom_filter_contains 1
+#endif
+
+#endif
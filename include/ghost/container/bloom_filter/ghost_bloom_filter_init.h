@@ -0,0 +1,77 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_BLOOM_FILTER_INIT_H_INCLUDED
+#define GHOST_BLOOM_FILTER_INIT_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Initializes an empty Bloom filter in the given memory.
+ *
+ * The memory must be aligned for uint64_t (ideally to 64 bytes, the size of a
+ * block) and must remain valid for the life of the filter. Its size is
+ * rounded down to a multiple of 64 bytes; it must be at least 64 bytes and at
+ * most 2^38 bytes. The memory is cleared, so to load a saved filter,
+ * initialize it first and then copy the saved bytes over its memory.
+ *
+ * To choose a size, see the false positive rates by bits per item in the
+ * documentation of ghost_bloom_filter_t.
+ *
+ * @see ghost_bloom_filter_t
+ */
+void ghost_bloom_filter_init(ghost_bloom_filter_t* filter, void* memory, size_t bytes);
+#endif
+
+#ifndef ghost_has_ghost_bloom_filter_init
+    #ifdef ghost_bloom_filter_init
+        #define ghost_has_ghost_bloom_filter_init 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_bloom_filter_init
+    #include "ghost/container/bloom_filter/ghost_bloom_filter_t.h"
+    #if !ghost_has(ghost_bloom_filter_t)
+        #define ghost_has_ghost_bloom_filter_init 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_bloom_filter_init
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/debug/ghost_assert.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/string/ghost_memset.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    void ghost_bloom_filter_init(ghost_bloom_filter_t* filter, void* memory, ghost_size_t bytes) GHOST_IMPL_DEF({
+        ghost_assert(bytes >= 64, "");
+        filter->ghost_impl_words = ghost_static_cast(ghost_uint64_t*, memory);
+        filter->ghost_impl_blocks = bytes / 64;
+        ghost_assert(ghost_static_cast(ghost_uint64_t, filter->ghost_impl_blocks) <=
+                ghost_static_cast(ghost_uint64_t, 1) << 32, "");
+        ghost_memset(memory, 0, filter->ghost_impl_blocks * 64);
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_bloom_filter_init 1
+#endif
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_BLOOM_FILTER_MERGE_H_INCLUDED
+#define GHOST_BLOOM_FILTER_MERGE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Adds all items of the source Bloom filter to the destination filter.
+ *
+ * Both filters must have the same size. The result is the same as if all of
+ * the source's items had been added to the destination.
+ *
+ * @see ghost_bloom_filter_t
+ */
+void ghost_bloom_filter_merge(ghost_bloom_filter_t* to, const ghost_bloom_filter_t* from);
+#endif
+
+#ifndef ghost_has_ghost_bloom_filter_merge
+    #ifdef ghost_bloom_filter_merge
+        #define ghost_has_ghost_bloom_filter_merge 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_bloom_filter_merge
+    #include "ghost/container/bloom_filter/ghost_bloom_filter_t.h"
+    #if !ghost_has(ghost_bloom_filter_t)
+        #define ghost_has_ghost_bloom_filter_merge 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_bloom_filter_merge
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/debug/ghost_assert.h"
+    #include "ghost/language/ghost_restrict.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    void ghost_bloom_filter_merge(ghost_bloom_filter_t* to, const ghost_bloom_filter_t* from) GHOST_IMPL_DEF({
+        ghost_uint64_t* ghost_restrict out = to->ghost_impl_words;
+        const ghost_uint64_t* ghost_restrict in = from->ghost_impl_words;
+        ghost_size_t count = to->ghost_impl_blocks * 8;
+        ghost_size_t i;
+        ghost_assert(to->ghost_impl_blocks == from->ghost_impl_blocks, "");
+        if (out == in)
+            return;
+        for (i = 0; i < count; ++i)
+            out[i] |= in[i];
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_bloom_filter_merge 1
+#endif
+
+#endif
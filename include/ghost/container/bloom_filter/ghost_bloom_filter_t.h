@@ -0,0 +1,84 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_BLOOM_FILTER_T_H_INCLUDED
+#define GHOST_BLOOM_FILTER_T_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * A blocked Bloom filter over 64-bit hashes in caller-owned memory.
+ *
+ * A Bloom filter answers whether a hash might have been added. It never gives
+ * false negatives; false positives happen at a rate that depends on the
+ * memory per item. Each item sets eight bits within a single 64-byte block
+ * (one cache line) so adding or testing an item costs one cache miss.
+ *
+ * Approximate false positive rates by bits of memory per item:
+ *
+ *     8 bits:  ~3%
+ *     10 bits: ~1%
+ *     12 bits: ~0.4%
+ *     16 bits: ~0.1%
+ *     24 bits: ~0.01%
+ *
+ * Items are 64-bit hashes of good quality, e.g. from ghost_wyhash_u64(). Both
+ * halves of the hash are used.
+ *
+ * The filter doesn't own its memory. Filters with the same size can be merged
+ * with ghost_bloom_filter_merge(), so each thread can fill its own filter and
+ * combine them afterwards. The memory layout is the same on all platforms
+ * (apart from the byte order of the words) so a filter can be saved and
+ * loaded as raw bytes.
+ *
+ * @see ghost_bloom_filter_init
+ * @see ghost_bloom_filter_add
+ * @see ghost_bloom_filter_contains
+ * @see ghost_bloom_filter_merge
+ */
+typedef struct { /*unspecified*/ } ghost_bloom_filter_t;
+#endif
+
+#ifndef ghost_has_ghost_bloom_filter_t
+    #ifdef ghost_bloom_filter_t
+        #define ghost_has_ghost_bloom_filter_t 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_bloom_filter_t
+    #include "ghost/impl/container/bloom_filter/ghost_impl_bloom_filter.h"
+    #if !ghost_has(ghost_impl_bloom_filter)
+        #define ghost_has_ghost_bloom_filter_t 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_bloom_filter_t
+    #include "ghost/type/size_t/ghost_size_t.h"
+    typedef struct ghost_bloom_filter_t {
+        /* This structure is meant to be opaque. Don't access these fields directly. */
+        ghost_uint64_t* ghost_impl_words;
+        ghost_size_t ghost_impl_blocks;
+    } ghost_bloom_filter_t;
+    #define ghost_has_ghost_bloom_filter_t 1
+#endif
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_COUNT_MIN_ESTIMATE_H_INCLUDED
+#define GHOST_COUNT_MIN_ESTIMATE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Returns the estimated count of a 64-bit hash in a count-min sketch.
+ *
+ * The estimate is at least the true count.
+ *
+ * @see ghost_count_min_t
+ */
+uint32_t ghost_count_min_estimate(const ghost_count_min_t* cms, uint64_t hash);
+#endif
+
+#ifndef ghost_has_ghost_count_min_estimate
+    #ifdef ghost_count_min_estimate
+        #define ghost_has_ghost_count_min_estimate 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_count_min_estimate
+    #include "ghost/container/count_min/ghost_count_min_t.h"
+    #if !ghost_has(ghost_count_min_t)
+        #define ghost_has_ghost_count_min_estimate 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_count_min_estimate
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/type/uint32_t/ghost_uint32_max.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_inline
+    ghost_uint32_t ghost_count_min_estimate(const ghost_count_min_t* cms, ghost_uint64_t hash) {
+        ghost_uint32_t estimate = GHOST_UINT32_MAX;
+        ghost_size_t row;
+        for (row = 0; row < cms->ghost_impl_depth; ++row) {
+            ghost_uint32_t value = cms->ghost_impl_counters[GHOST_IMPL_COUNT_MIN_INDEX(cms, hash, row)];
+            if (value < estimate)
+                estimate = value;
+        }
+        return estimate;
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_count_min_estimate 1
+#endif
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_COUNT_MIN_INIT_H_INCLUDED
+#define GHOST_COUNT_MIN_INIT_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Initializes an empty count-min sketch with the given dimensions in the
+ * given memory.
+ *
+ * The memory must hold width * depth counters and must remain valid for the
+ * life of the sketch. It is cleared. The width must be between 1 and 2^32 and
+ * the depth must be at least 1.
+ *
+ * For an overestimate of at most epsilon * N with probability 1 - delta, use a
+ * width of e / epsilon and a depth of ln(1 / delta).
+ *
+ * @see ghost_count_min_t
+ */
+void ghost_count_min_init(ghost_count_min_t* cms, uint32_t* counters, size_t width, size_t depth);
+#endif
+
+#ifndef ghost_has_ghost_count_min_init
+    #ifdef ghost_count_min_init
+        #define ghost_has_ghost_count_min_init 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_count_min_init
+    #include "ghost/container/count_min/ghost_count_min_t.h"
+    #if !ghost_has(ghost_count_min_t)
+        #define ghost_has_ghost_count_min_init 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_count_min_init
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/debug/ghost_assert.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/string/ghost_memset.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    void ghost_count_min_init(ghost_count_min_t* cms, ghost_uint32_t* counters,
+            ghost_size_t width, ghost_size_t depth) GHOST_IMPL_DEF(
+    {
+        ghost_assert(width > 0 && depth > 0, "");
+        ghost_assert(ghost_static_cast(ghost_uint64_t, width) <= GHOST_UINT64_C(0x100000000), "");
+        cms->ghost_impl_counters = counters;
+        cms->ghost_impl_width = width;
+        cms->ghost_impl_depth = depth;
+        ghost_memset(counters, 0, width * depth * sizeof(ghost_uint32_t));
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_count_min_init 1
+#endif
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_COUNT_MIN_MERGE_H_INCLUDED
+#define GHOST_COUNT_MIN_MERGE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Adds all counts of the source count-min sketch to the destination sketch.
+ *
+ * Both sketches must have the same width and depth.
+ *
+ * @see ghost_count_min_t
+ */
+void ghost_count_min_merge(ghost_count_min_t* to, const ghost_count_min_t* from);
+#endif
+
+#ifndef ghost_has_ghost_count_min_merge
+    #ifdef ghost_count_min_merge
+        #define ghost_has_ghost_count_min_merge 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_count_min_merge
+    #include "ghost/container/count_min/ghost_count_min_t.h"
+    #if !ghost_has(ghost_count_min_t)
+        #define ghost_has_ghost_count_min_merge 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_count_min_merge
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/debug/ghost_assert.h"
+    #include "ghost/type/uint32_t/ghost_uint32_max.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_function
+    void ghost_count_min_merge(ghost_count_min_t* to, const ghost_count_min_t* from) GHOST_IMPL_DEF({
+        ghost_uint32_t* out = to->ghost_impl_counters;
+        const ghost_uint32_t* in = from->ghost_impl_counters;
+        ghost_size_t count = to->ghost_impl_width * to->ghost_impl_depth;
+        ghost_size_t i;
+        ghost_assert(to->ghost_impl_width == from->ghost_impl_width, "");
+        ghost_assert(to->ghost_impl_depth == from->ghost_impl_depth, "");
+        for (i = 0; i < count; ++i) {
+            ghost_uint32_t sum = out[i] + in[i];
+            out[i] = sum < out[i] ? GHOST_UINT32_MAX : sum;
+        }
+    })
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_count_min_merge 1
+#endif
+
+#endif
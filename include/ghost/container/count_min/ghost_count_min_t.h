@@ -0,0 +1,95 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_COUNT_MIN_T_H_INCLUDED
+#define GHOST_COUNT_MIN_T_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * A count-min sketch that estimates how often each 64-bit hash has been
+ * added, in caller-owned memory.
+ *
+ * The sketch is a table of depth rows of width 32-bit counters. Adding an item
+ * increments one counter in each row and the estimate is the smallest of
+ * them. Estimates are never too low. With N total additions, an estimate is
+ * too high by more than e*N/width with probability at most e^-depth. For
+ * example a width of 2048 and a depth of 4 (32 KiB) overestimates by at most
+ * 0.13% of all additions with 98% confidence.
+ *
+ * To find heavy hitters, use the estimate returned by ghost_count_min_add()
+ * to maintain a small min-heap of the top items (e.g. with
+ * ghost_heap_define.h.)
+ *
+ * Counters saturate at UINT32_MAX rather than wrapping.
+ *
+ * Items are 64-bit hashes of good quality, e.g. from ghost_wyhash_u64(). The
+ * columns for each row are derived from both halves of the hash.
+ *
+ * Sketches with the same dimensions can be merged with
+ * ghost_count_min_merge(), so each thread can fill its own sketch and combine
+ * them afterwards. The result is the same as adding all items to one sketch.
+ *
+ * @see ghost_count_min_init
+ * @see ghost_count_min_add
+ * @see ghost_count_min_estimate
+ * @see ghost_count_min_merge
+ */
+typedef struct { /*unspecified*/ } ghost_count_min_t;
+#endif
+
+#ifndef ghost_has_ghost_count_min_t
+    #ifdef ghost_count_min_t
+        #define ghost_has_ghost_count_min_t 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_count_min_t
+    #include "ghost/type/uint32_t/ghost_uint32_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_uint32_t) || !ghost_has(ghost_uint64_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_count_min_t 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_count_min_t
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    typedef struct ghost_count_min_t {
+        /* This structure is meant to be opaque. Don't access these fields directly. */
+        ghost_uint32_t* ghost_impl_counters;
+        ghost_size_t ghost_impl_width;
+        ghost_size_t ghost_impl_depth;
+    } ghost_count_min_t;
+
+    /* Returns the index of the hash's counter in the given row. The columns
+     * come from double hashing on the two halves of the hash, reduced to the
+     * width with a multiply-shift. */
+    #define GHOST_IMPL_COUNT_MIN_INDEX(cms, hash, row) \
+        ((row) * (cms)->ghost_impl_width + ghost_static_cast(ghost_size_t, \
+            ((((hash) + ((hash) >> 32) * ghost_static_cast(ghost_uint64_t, row)) & GHOST_UINT64_C(0xFFFFFFFF)) * \
+                ghost_static_cast(ghost_uint64_t, (cms)->ghost_impl_width)) >> 32))
+    #define ghost_has_ghost_count_min_t 1
+#endif
+
+#endif
@@ -0,0 +1,121 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_HASH_MAP_DEFINE_H_INCLUDED
+#define GHOST_HASH_MAP_DEFINE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * @def GHOST_HASH_MAP_DEFINE(name, key_type, value_type, hash, equal)
+ *
+ * Defines an open-addressing hash map type and functions specialized for the
+ * given key and value types with inlined hash and equality functions.
+ *
+ * This defines the types `name_t` and `name_entry_t` and functions with
+ * these prototypes:
+ *
+ *     typedef struct {
+ *         key_type key;
+ *         value_type value;
+ *     } name_entry_t;
+ *
+ *     static void name_init(name_t* map);
+ *     static void name_destroy(name_t* map);
+ *     static void name_clear(name_t* map);
+ *     static size_t name_count(const name_t* map);
+ *     static bool name_reserve(name_t* map, size_t count);
+ *     static name_entry_t* name_find(const name_t* map, const key_type* key);
+ *     static name_entry_t* name_insert(name_t* map, const key_type* key, bool* inserted);
+ *     static bool name_erase(name_t* map, const key_type* key);
+ *     static void name_erase_entry(name_t* map, name_entry_t* entry);
+ *     static name_entry_t* name_next(const name_t* map, size_t* cursor);
+ *
+ * name_insert() returns the existing entry if the key is present. Otherwise
+ * it adds an entry with a copy of the key and an uninitialized value, sets
+ * inserted to true (if it's not null) and returns the entry so you can store
+ * the value. It returns null if memory could not be allocated. For example:
+ *
+ *     typedef const char* path_t;
+ *     static size_t path_hash(const path_t* path) {
+ *         return ghost_fnv1a_z(*path, strlen(*path));
+ *     }
+ *     #define path_equal(left, right) (0 == strcmp(*(left), *(right)))
+ *     GHOST_HASH_MAP_DEFINE(path_cache, path_t, file_t*, path_hash, path_equal)
+ *
+ *     path_cache_entry_t* entry = path_cache_insert(&cache, &path, &inserted);
+ *     if (entry == NULL)
+ *         return ENOMEM;
+ *     if (inserted)
+ *         entry->value = open_file(path);
+ *
+ * Everything else (the hash and equal arguments, allocation, iteration and
+ * pointer invalidation) is the same as GHOST_HASH_SET_DEFINE(). Don't modify
+ * the key of an entry in the map.
+ *
+ * @see GHOST_HASH_SET_DEFINE
+ */
+#define GHOST_HASH_MAP_DEFINE(name, key_type, value_type, hash, equal)
+#endif
+
+#ifndef ghost_has_GHOST_HASH_MAP_DEFINE
+    #ifdef GHOST_HASH_MAP_DEFINE
+        #define ghost_has_GHOST_HASH_MAP_DEFINE 1
+    #endif
+#endif
+
+#ifndef ghost_has_GHOST_HASH_MAP_DEFINE
+    #include "ghost/impl/container/hash_table/ghost_impl_hash_table.h"
+    #if !ghost_has(ghost_impl_hash_table) || !ghost_has(ghost_malloc)
+        #define ghost_has_GHOST_HASH_MAP_DEFINE 0
+    #endif
+#endif
+
+#ifndef ghost_has_GHOST_HASH_MAP_DEFINE
+    #define GHOST_IMPL_HASH_MAP_KEY(entry) (&(entry)->key)
+
+    #define GHOST_HASH_MAP_DEFINE(name, key_type, value_type, hash, equal) \
+        typedef struct name##_entry_t { \
+            key_type key; \
+            value_type value; \
+        } name##_entry_t; \
+        \
+        GHOST_IMPL_HASH_TABLE_DEFINE(name, key_type, name##_entry_t, GHOST_IMPL_HASH_MAP_KEY, hash, equal) \
+        \
+        GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION \
+        name##_entry_t* name##_insert(name##_t* ghost_impl_v_map, const key_type* ghost_impl_v_key, \
+                ghost_bool* ghost_impl_v_inserted) \
+        { \
+            ghost_bool ghost_impl_v_is_new; \
+            name##_entry_t* ghost_impl_v_entry = ghost_impl_##name##_insert(ghost_impl_v_map, \
+                    ghost_impl_v_key, &ghost_impl_v_is_new); \
+            if (ghost_impl_v_entry != ghost_null && ghost_impl_v_is_new) \
+                ghost_impl_v_entry->key = *ghost_impl_v_key; \
+            if (ghost_impl_v_inserted != ghost_null) \
+                *ghost_impl_v_inserted = ghost_impl_v_entry != ghost_null && ghost_impl_v_is_new; \
+            return ghost_impl_v_entry; \
+        }
+
+    #define ghost_has_GHOST_HASH_MAP_DEFINE 1
+#endif
+
+#endif
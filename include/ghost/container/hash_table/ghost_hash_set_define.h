@@ -0,0 +1,139 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_HASH_SET_DEFINE_H_INCLUDED
+#define GHOST_HASH_SET_DEFINE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * @def GHOST_HASH_SET_DEFINE(name, key_type, hash, equal)
+ *
+ * Defines an open-addressing hash set type and functions specialized for the
+ * given key type with inlined hash and equality functions.
+ *
+ * This defines the type `name_t` and functions with these prototypes:
+ *
+ *     static void name_init(name_t* set);
+ *     static void name_destroy(name_t* set);
+ *     static void name_clear(name_t* set);
+ *     static size_t name_count(const name_t* set);
+ *     static bool name_reserve(name_t* set, size_t count);
+ *     static key_type* name_find(const name_t* set, const key_type* key);
+ *     static key_type* name_insert(name_t* set, const key_type* key, bool* inserted);
+ *     static bool name_erase(name_t* set, const key_type* key);
+ *     static void name_erase_entry(name_t* set, key_type* entry);
+ *     static key_type* name_next(const name_t* set, size_t* cursor);
+ *
+ * The hash argument must be the name of a function or function-like macro
+ * that takes a `const key_type*` and returns an integer hash of the key. The
+ * hash is mixed internally so it doesn't need to be well distributed; even
+ * the identity function is fine for integer keys. The equal argument must be
+ * the name of a function or function-like macro that takes two `const
+ * key_type*` and returns non-zero if the keys are equal. For example:
+ *
+ *     #define id_hash(id) (*(id))
+ *     #define id_equal(left, right) (*(left) == *(right))
+ *     GHOST_HASH_SET_DEFINE(id_set, uint64_t, id_hash, id_equal)
+ *
+ *     id_set_t seen;
+ *     id_set_init(&seen);
+ *     if (!id_set_insert(&seen, &id, &inserted))
+ *         abort(); // out of memory
+ *     ...
+ *     id_set_destroy(&seen);
+ *
+ * The key type is qualified with const textually so it must be a type name
+ * to which `const` can be prepended, e.g. a typedef for pointer types.
+ *
+ * A zero-initialized set is not valid; call name_init() first. It doesn't
+ * allocate; memory is allocated with ghost_malloc() on the first insertion.
+ * Call name_destroy() to free it. Keys are copied by assignment and are never
+ * destroyed so they must not own resources unless you handle that yourself.
+ *
+ * name_insert() returns the existing key if an equal one is present,
+ * otherwise it copies the key into the set and returns it. If inserted is not
+ * null it is set to true in the latter case. It returns null if memory could
+ * not be allocated (the set is unchanged in that case.) Don't modify a key in
+ * the set in a way that changes its hash or equality.
+ *
+ * Inserting may move all keys, invalidating pointers returned by earlier
+ * calls. Erasing never moves keys so you can erase the current entry while
+ * iterating with name_erase_entry(). Iterate like this:
+ *
+ *     size_t cursor = 0;
+ *     uint64_t* id;
+ *     while ((id = id_set_next(&seen, &cursor)) != NULL)
+ *         ...
+ *
+ * The set keeps an array of control bytes alongside the keys and searches 16
+ * of them at a time with SSE2, NEON or SWAR (in the style of SwissTable) so
+ * most lookups compare only the key that matches. Erasures don't leave
+ * tombstones unless the erased slot may be part of a full probe group. The
+ * maximum load factor is 7/8.
+ *
+ * This defines static functions prefixed with the given name and with
+ * `ghost_impl_` and the given name so it can be used in a header file or in
+ * any number of translation units. This must be used at file scope.
+ *
+ * @see GHOST_HASH_MAP_DEFINE
+ */
+#define GHOST_HASH_SET_DEFINE(name, key_type, hash, equal)
+#endif
+
+#ifndef ghost_has_GHOST_HASH_SET_DEFINE
+    #ifdef GHOST_HASH_SET_DEFINE
+        #define ghost_has_GHOST_HASH_SET_DEFINE 1
+    #endif
+#endif
+
+#ifndef ghost_has_GHOST_HASH_SET_DEFINE
+    #include "ghost/impl/container/hash_table/ghost_impl_hash_table.h"
+    #if !ghost_has(ghost_impl_hash_table) || !ghost_has(ghost_malloc)
+        #define ghost_has_GHOST_HASH_SET_DEFINE 0
+    #endif
+#endif
+
+#ifndef ghost_has_GHOST_HASH_SET_DEFINE
+    #define GHOST_IMPL_HASH_SET_KEY(entry) (entry)
+
+    #define GHOST_HASH_SET_DEFINE(name, key_type, hash, equal) \
+        GHOST_IMPL_HASH_TABLE_DEFINE(name, key_type, key_type, GHOST_IMPL_HASH_SET_KEY, hash, equal) \
+        \
+        GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION \
+        key_type* name##_insert(name##_t* ghost_impl_v_set, const key_type* ghost_impl_v_key, \
+                ghost_bool* ghost_impl_v_inserted) \
+        { \
+            ghost_bool ghost_impl_v_is_new; \
+            key_type* ghost_impl_v_entry = ghost_impl_##name##_insert(ghost_impl_v_set, \
+                    ghost_impl_v_key, &ghost_impl_v_is_new); \
+            if (ghost_impl_v_entry != ghost_null && ghost_impl_v_is_new) \
+                *ghost_impl_v_entry = *ghost_impl_v_key; \
+            if (ghost_impl_v_inserted != ghost_null) \
+                *ghost_impl_v_inserted = ghost_impl_v_entry != ghost_null && ghost_impl_v_is_new; \
+            return ghost_impl_v_entry; \
+        }
+
+    #define ghost_has_GHOST_HASH_SET_DEFINE 1
+#endif
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_HYPERLOGLOG_ADD_H_INCLUDED
+#define GHOST_HYPERLOGLOG_ADD_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Adds a 64-bit hash to a HyperLogLog sketch.
+ *
+ * Adding the same hash again has no effect.
+ *
+ * @see ghost_hyperloglog_t
+ */
+void ghost_hyperloglog_add(ghost_hyperloglog_t* hll, uint64_t hash);
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_add
+    #ifdef ghost_hyperloglog_add
+        #define ghost_has_ghost_hyperloglog_add 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_add
+    #include "ghost/container/hyperloglog/ghost_hyperloglog_t.h"
+    #if !ghost_has(ghost_hyperloglog_t)
+        #define ghost_has_ghost_hyperloglog_add 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_add
+    #include "ghost/impl/ghost_impl_always_inline.h"
+    #include "ghost/impl/container/hyperloglog/ghost_impl_hyperloglog.h"
+    #include "ghost/language/ghost_static_cast.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_always_inline
+    void ghost_hyperloglog_add(ghost_hyperloglog_t* hll, ghost_uint64_t hash) {
+        int precision = hll->ghost_impl_precision;
+        ghost_size_t index = ghost_static_cast(ghost_size_t, hash >> (64 - precision));
+
+        /* The rank is one more than the number of trailing zeroes in the
+         * remaining bits. A guard bit caps it at 65 - precision. */
+        ghost_uint64_t rest = hash | (GHOST_UINT64_C(1) << (64 - precision));
+        unsigned char rank = 1;
+        while ((rest & 1) == 0) {
+            rest >>= 1;
+            ++rank;
+        }
+
+        if (hll->ghost_impl_dense) {
+            if (hll->ghost_impl_registers[index] < rank)
+                hll->ghost_impl_registers[index] = rank;
+        } else {
+            ghost_impl_hyperloglog_sparse_add(hll, index, rank);
+        }
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_hyperloglog_add 1
+#endif
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_HYPERLOGLOG_ESTIMATE_H_INCLUDED
+#define GHOST_HYPERLOGLOG_ESTIMATE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Returns the estimated number of distinct hashes added to a HyperLogLog
+ * sketch.
+ *
+ * This takes time proportional to the number of registers (or to the size of
+ * a sparse sketch) so call it once after adding items rather than after each
+ * one.
+ *
+ * @see ghost_hyperloglog_t
+ */
+double ghost_hyperloglog_estimate(const ghost_hyperloglog_t* hll);
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_estimate
+    #ifdef ghost_hyperloglog_estimate
+        #define ghost_has_ghost_hyperloglog_estimate 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_estimate
+    #include "ghost/container/hyperloglog/ghost_hyperloglog_t.h"
+    #include "ghost/impl/container/hyperloglog/ghost_impl_hyperloglog.h"
+    #if !ghost_has(ghost_hyperloglog_t) || !ghost_has(ghost_double) || !ghost_has(ghost_sqrt_d)
+        #define ghost_has_ghost_hyperloglog_estimate 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_estimate
+    #include "ghost/impl/ghost_impl_inline.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_inline
+    double ghost_hyperloglog_estimate(const ghost_hyperloglog_t* hll) {
+        return ghost_impl_hyperloglog_estimate(hll);
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_hyperloglog_estimate 1
+#endif
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_HYPERLOGLOG_INIT_H_INCLUDED
+#define GHOST_HYPERLOGLOG_INIT_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Initializes an empty HyperLogLog sketch with the given precision in the
+ * given memory.
+ *
+ * The precision must be between 4 and 24. The memory must be exactly
+ * 2^precision bytes and must remain valid for the life of the sketch. It
+ * doesn't need to be cleared.
+ *
+ * @see ghost_hyperloglog_t
+ */
+void ghost_hyperloglog_init(ghost_hyperloglog_t* hll, void* memory, int precision);
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_init
+    #ifdef ghost_hyperloglog_init
+        #define ghost_has_ghost_hyperloglog_init 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_init
+    #include "ghost/container/hyperloglog/ghost_hyperloglog_t.h"
+    #if !ghost_has(ghost_hyperloglog_t)
+        #define ghost_has_ghost_hyperloglog_init 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_init
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/debug/ghost_assert.h"
+    #include "ghost/language/ghost_static_cast.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_inline
+    void ghost_hyperloglog_init(ghost_hyperloglog_t* hll, void* memory, int precision) {
+        ghost_assert(precision >= 4 && precision <= 24, "");
+        hll->ghost_impl_registers = ghost_static_cast(unsigned char*, memory);
+        hll->ghost_impl_sparse_length = 0;
+        hll->ghost_impl_precision = ghost_static_cast(unsigned char, precision);
+        hll->ghost_impl_dense = 0;
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_hyperloglog_init 1
+#endif
+
+#endif
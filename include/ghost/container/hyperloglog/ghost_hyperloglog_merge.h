@@ -0,0 +1,64 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_HYPERLOGLOG_MERGE_H_INCLUDED
+#define GHOST_HYPERLOGLOG_MERGE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Adds all items of the source HyperLogLog sketch to the destination sketch.
+ *
+ * Both sketches must have the same precision. The destination is converted to
+ * dense registers if the source is dense.
+ *
+ * @see ghost_hyperloglog_t
+ */
+void ghost_hyperloglog_merge(ghost_hyperloglog_t* to, const ghost_hyperloglog_t* from);
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_merge
+    #ifdef ghost_hyperloglog_merge
+        #define ghost_has_ghost_hyperloglog_merge 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_merge
+    #include "ghost/container/hyperloglog/ghost_hyperloglog_t.h"
+    #if !ghost_has(ghost_hyperloglog_t)
+        #define ghost_has_ghost_hyperloglog_merge 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_merge
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/impl/container/hyperloglog/ghost_impl_hyperloglog.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_inline
+    void ghost_hyperloglog_merge(ghost_hyperloglog_t* to, const ghost_hyperloglog_t* from) {
+        ghost_impl_hyperloglog_merge(to, from);
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_hyperloglog_merge 1
+#endif
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_HYPERLOGLOG_T_H_INCLUDED
+#define GHOST_HYPERLOGLOG_T_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * A HyperLogLog sketch that estimates the number of distinct 64-bit hashes
+ * added to it, in caller-owned memory.
+ *
+ * The sketch has 2^precision one-byte registers. The standard error of the
+ * estimate is about 1.04 / sqrt(2^precision), for example 0.81% with a
+ * precision of 14 (16 KiB) or 0.41% with 16 (64 KiB), regardless of the
+ * cardinality.
+ *
+ * A new sketch is sparse: its memory holds a compact sorted list of non-zero
+ * registers, which is much faster to merge and estimate while few items have
+ * been added. It is converted to dense registers in place once the list
+ * grows, so its memory never changes size.
+ *
+ * Items are 64-bit hashes of good quality, e.g. from ghost_wyhash_u64(). The
+ * top bits of the hash select a register so weak hashes give poor estimates.
+ *
+ * Sketches with the same precision can be merged with
+ * ghost_hyperloglog_merge(), so each thread can fill its own sketch and
+ * combine them afterwards. The result is the same as adding all items to one
+ * sketch.
+ *
+ * @see ghost_hyperloglog_init
+ * @see ghost_hyperloglog_add
+ * @see ghost_hyperloglog_estimate
+ * @see ghost_hyperloglog_merge
+ */
+typedef struct { /*unspecified*/ } ghost_hyperloglog_t;
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_t
+    #ifdef ghost_hyperloglog_t
+        #define ghost_has_ghost_hyperloglog_t 1
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_t
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_uint64_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_hyperloglog_t 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_hyperloglog_t
+    #include "ghost/type/size_t/ghost_size_t.h"
+    typedef struct ghost_hyperloglog_t {
+        /* This structure is meant to be opaque. Don't access these fields directly. */
+        unsigned char* ghost_impl_registers;
+        ghost_size_t ghost_impl_sparse_length;
+        unsigned char ghost_impl_precision;
+        unsigned char ghost_impl_dense;
+    } ghost_hyperloglog_t;
+    #define ghost_has_ghost_hyperloglog_t 1
+#endif
+
+#endif
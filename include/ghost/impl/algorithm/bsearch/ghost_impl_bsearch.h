@@ -0,0 +1,88 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_BSEARCH_H_INCLUDED
+#define GHOST_IMPL_BSEARCH_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Ghost's internal binary searches. These are used to implement all of the
+ * bsearch, lower_bound and Eytzinger search variants. They use the same state
+ * as the internal qsort for the compare function variants (only the element
+ * size, variant, compare function and context are used.)
+ *
+ * The compare function is always called with the key on the left, as with
+ * bsearch().
+ *
+ * The searches are branchless: each step halves the range with a conditional
+ * move rather than a branch so there are no mispredictions, and the number of
+ * comparisons depends only on the count. See:
+ *
+ *     Khuong and Morin, "Array Layouts for Comparison-Based Searching"
+ *     https://arxiv.org/abs/1509.05053
+ */
+
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_config.h"
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_internal_declare.h"
+#include "ghost/impl/ghost_impl_noinline.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+
+GHOST_IMPL_FUNCTION_OPEN
+
+/*
+ * Returns the index of the first element of the sorted array that is not less
+ * than the key, or count if all elements are less than the key.
+ */
+ghost_impl_noinline
+ghost_size_t ghost_impl_bsearch_lower_bound(ghost_impl_qsort_state_t* state,
+        const void* key, const void* base, ghost_size_t count);
+
+/*
+ * Returns a pointer to the first element of the sorted array that equals the
+ * key, or null if there is none.
+ */
+ghost_impl_noinline
+void* ghost_impl_bsearch(ghost_impl_qsort_state_t* state,
+        const void* key, const void* base, ghost_size_t count);
+
+/*
+ * Returns the index in the Eytzinger array of the smallest element that is
+ * not less than the key, or count if all elements are less than the key.
+ */
+ghost_impl_noinline
+ghost_size_t ghost_impl_bsearch_eytzinger_lower_bound(ghost_impl_qsort_state_t* state,
+        const void* key, const void* base, ghost_size_t count);
+
+/*
+ * Copies the sorted array into Eytzinger order. The arrays must not overlap.
+ */
+ghost_impl_noinline
+void ghost_impl_bsearch_eytzinger_build(void* ghost_impl_v_to, const void* from,
+        ghost_size_t count, ghost_size_t element_size);
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#if GHOST_EMIT_DEFS
+    #include "ghost/impl/algorithm/bsearch/ghost_impl_bsearch_define.h"
+#endif
+
+#endif
@@ -0,0 +1,198 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_BSEARCH_DEFINE_H_INCLUDED
+#define GHOST_IMPL_BSEARCH_DEFINE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Defines Ghost's internal binary searches.
+ */
+
+#if !GHOST_EMIT_DEFS && !GHOST_IMPL_AMALGAMATED
+    #error "This file is not supposed to be included if Ghost is not emitting function definitions."
+#endif
+
+#include "ghost/impl/algorithm/bsearch/ghost_impl_bsearch.h"
+#include "ghost/impl/ghost_impl_inline.h"
+#include "ghost/impl/ghost_impl_noinline.h"
+#include "ghost/language/ghost_null.h"
+#include "ghost/language/ghost_const_cast.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/language/ghost_unreachable.h"
+#include "ghost/string/ghost_memcpy.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+
+/*
+ * A branchless search can't speculate past a comparison like a branching
+ * search can so it waits on every load. We make up for this with prefetches.
+ *
+ * The lower bound search prefetches both elements it might compare next. The
+ * Eytzinger search prefetches the block of 16 descendants four levels below
+ * the current node; for small elements these are contiguous and fit in one or
+ * two cache lines so by the time the search gets there, they've been loaded.
+ */
+#ifndef GHOST_IMPL_BSEARCH_PREFETCH
+    #if defined(__GNUC__)
+        #define GHOST_IMPL_BSEARCH_PREFETCH(p) __builtin_prefetch(p)
+    #else
+        #define GHOST_IMPL_BSEARCH_PREFETCH(p) ((void)0)
+    #endif
+#endif
+
+GHOST_IMPL_FUNCTION_OPEN
+
+ghost_impl_inline
+int ghost_impl_bsearch_compare(ghost_impl_qsort_state_t* state, const void* key, const void* element) {
+    switch (state->variant) {
+        case ghost_impl_qsort_variant_nocontext: return state->compare.nocontext(key, element);
+        case ghost_impl_qsort_variant_gnu: return state->compare.gnu(key, element, state->user_context);
+        case ghost_impl_qsort_variant_bsd: return state->compare.bsd(state->user_context, key, element);
+        #if GHOST_WIN_QSORT_S_USE_CDECL
+        case ghost_impl_qsort_variant_windows: return state->compare.windows(state->user_context, key, element);
+        #endif
+        case ghost_impl_qsort_variant_indirect: break;
+    }
+    ghost_unreachable(0);
+}
+
+ghost_impl_noinline
+ghost_size_t ghost_impl_bsearch_lower_bound(ghost_impl_qsort_state_t* state,
+        const void* key, const void* base, ghost_size_t count)
+{
+    const char* first = ghost_static_cast(const char*, base);
+    const char* current = first;
+    ghost_size_t element_size = state->element_size;
+
+    if (count == 0)
+        return 0;
+
+    /*
+     * The range always starts at current and has count elements. If the
+     * middle element is less than the key, the answer is in the upper half
+     * (including the middle); otherwise it's in the lower half (also
+     * including the middle.) The halves overlap by one element so we always
+     * shrink by exactly count/2 and the loop runs a fixed number of times.
+     */
+    while (count > 1) {
+        ghost_size_t half = count / 2;
+        const char* middle = current + half * element_size;
+
+        /* Prefetch both possible middles of the next step. */
+        GHOST_IMPL_BSEARCH_PREFETCH(current + (half / 2) * element_size);
+        GHOST_IMPL_BSEARCH_PREFETCH(middle + (half / 2) * element_size);
+
+        current = (ghost_impl_bsearch_compare(state, key, middle) > 0) ? middle : current;
+        count -= half;
+    }
+
+    return ghost_static_cast(ghost_size_t, current - first) / element_size +
+            (ghost_impl_bsearch_compare(state, key, current) > 0);
+}
+
+ghost_impl_noinline
+void* ghost_impl_bsearch(ghost_impl_qsort_state_t* state,
+        const void* key, const void* base, ghost_size_t count)
+{
+    ghost_size_t index = ghost_impl_bsearch_lower_bound(state, key, base, count);
+    const char* element = ghost_static_cast(const char*, base) + index * state->element_size;
+    if (index == count || ghost_impl_bsearch_compare(state, key, element) != 0)
+        return ghost_null;
+    return ghost_const_cast(char*, element);
+}
+
+ghost_impl_noinline
+ghost_size_t ghost_impl_bsearch_eytzinger_lower_bound(ghost_impl_qsort_state_t* state,
+        const void* key, const void* base, ghost_size_t count)
+{
+    const char* first = ghost_static_cast(const char*, base);
+    ghost_size_t element_size = state->element_size;
+    ghost_size_t index = 0;
+
+    /*
+     * The children of index i are at 2i+1 and 2i+2. We go right if the
+     * element is less than the key.
+     */
+    while (index < count) {
+        ghost_size_t prefetch = 16 * index + 15;
+        GHOST_IMPL_BSEARCH_PREFETCH(first + (prefetch < count ? prefetch : 0) * element_size);
+        index = 2 * index + 1 +
+                ghost_static_cast(ghost_size_t, ghost_impl_bsearch_compare(state, key, first + index * element_size) > 0);
+    }
+
+    /*
+     * Every right turn at the bottom of the path passed an element that is
+     * less than the key. The answer is the node at which we last turned left,
+     * so we undo the trailing right turns and then the left turn. In 1-based
+     * indexing, a left turn appends a 0 bit and a right turn appends a 1 bit.
+     */
+    ++index;
+    while (index & 1)
+        index >>= 1;
+    index >>= 1;
+
+    /* If we never turned left, everything is less than the key. */
+    return index == 0 ? count : index - 1;
+}
+
+ghost_impl_noinline
+void ghost_impl_bsearch_eytzinger_build(void* ghost_impl_v_to, const void* from,
+        ghost_size_t count, ghost_size_t element_size)
+{
+    char* to = ghost_static_cast(char*, ghost_impl_v_to);
+    const char* next = ghost_static_cast(const char*, from);
+    ghost_size_t index = 0;
+    ghost_size_t i;
+
+    if (count == 0)
+        return;
+
+    /*
+     * We do an in-order traversal of the implicit tree, filling in the
+     * elements in sorted order. We start at the leftmost node.
+     */
+    while (2 * index + 1 < count)
+        index = 2 * index + 1;
+
+    for (i = 0; i < count; ++i) {
+        ghost_memcpy(to + index * element_size, next, element_size);
+        next += element_size;
+
+        if (2 * index + 2 < count) {
+            /* Go to the leftmost node of the right subtree. */
+            index = 2 * index + 2;
+            while (2 * index + 1 < count)
+                index = 2 * index + 1;
+        } else {
+            /* Go up until we come from a left child. */
+            while (index != 0 && (index & 1) == 0)
+                index = (index - 1) / 2;
+            if (index == 0)
+                break;
+            index = (index - 1) / 2;
+        }
+    }
+}
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#endif
@@ -0,0 +1,144 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_CRC32C_H_INCLUDED
+#define GHOST_IMPL_CRC32C_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Ghost's internal CRC-32C (Castagnoli) implementation.
+ *
+ * With hardware support (the SSE4.2 crc32 instruction on x86-64 or the ARMv8
+ * CRC32 extension on AArch64) we checksum long buffers as three interleaved
+ * streams. The instruction has a latency of three cycles but a throughput of
+ * one per cycle so this runs about three times faster than a single stream.
+ * The three CRCs are combined by shifting them over the lengths of the
+ * following streams with precomputed tables. See:
+ *
+ *     Mark Adler, crc32c.c, https://stackoverflow.com/a/17646775
+ *
+ * On x86-64 with GCC or Clang, if SSE4.2 isn't enabled at compile time we
+ * compile the hardware version anyway with a target attribute and choose it
+ * at runtime if the CPU supports it.
+ *
+ * Without hardware support we use slicing-by-8 tables, reading input as
+ * little-endian words so the result is the same on all platforms.
+ *
+ * The functions here work on the raw CRC register; the public functions
+ * handle the pre- and post-inversion.
+ */
+
+#include "ghost/impl/ghost_impl_always_inline.h"
+#include "ghost/impl/ghost_impl_noinline.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+#include "ghost/type/uint32_t/ghost_uint32_t.h"
+#include "ghost/type/uint32_t/ghost_uint32_c.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/detect/ghost_x86_64.h"
+#include "ghost/detect/ghost_cproc.h"
+
+#ifndef GHOST_IMPL_CRC32C_SSE42
+    #if GHOST_X86_64 && (defined(__SSE4_2__) || defined(__AVX__))
+        #define GHOST_IMPL_CRC32C_SSE42 1
+    #else
+        #define GHOST_IMPL_CRC32C_SSE42 0
+    #endif
+#endif
+
+#ifndef GHOST_IMPL_CRC32C_SSE42_DISPATCH
+    #if !GHOST_IMPL_CRC32C_SSE42 && GHOST_X86_64 && !GHOST_CPROC && \
+            (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+        #define GHOST_IMPL_CRC32C_SSE42_DISPATCH 1
+    #else
+        #define GHOST_IMPL_CRC32C_SSE42_DISPATCH 0
+    #endif
+#endif
+
+#ifndef GHOST_IMPL_CRC32C_ARMV8
+    #if (defined(__aarch64__) || defined(_M_ARM64)) && defined(__ARM_FEATURE_CRC32)
+        #define GHOST_IMPL_CRC32C_ARMV8 1
+    #else
+        #define GHOST_IMPL_CRC32C_ARMV8 0
+    #endif
+#endif
+
+#if GHOST_IMPL_CRC32C_SSE42 || GHOST_IMPL_CRC32C_SSE42_DISPATCH || GHOST_IMPL_CRC32C_ARMV8
+    #define GHOST_IMPL_CRC32C_HARDWARE 1
+#else
+    #define GHOST_IMPL_CRC32C_HARDWARE 0
+#endif
+
+#if GHOST_IMPL_CRC32C_SSE42_DISPATCH
+    #define GHOST_IMPL_CRC32C_TARGET __attribute__((__target__("sse4.2")))
+#else
+    #define GHOST_IMPL_CRC32C_TARGET /*nothing*/
+#endif
+
+GHOST_IMPL_FUNCTION_OPEN
+
+#if ghost_has(ghost_uint32_t) && ghost_has(GHOST_UINT32_C)
+/*
+ * Updates the CRC register with the given bytes using slicing-by-8.
+ */
+ghost_impl_noinline
+ghost_uint32_t ghost_impl_crc32c_sw(ghost_uint32_t crc, const void* bytes, ghost_size_t length);
+
+/*
+ * Returns the CRC register shifted over the given number of zero bytes. This
+ * is how CRCs of consecutive pieces are combined.
+ */
+ghost_impl_noinline
+ghost_uint32_t ghost_impl_crc32c_shift(ghost_uint32_t crc, ghost_size_t length);
+
+#if GHOST_IMPL_CRC32C_HARDWARE && ghost_has(ghost_uint64_t)
+/*
+ * Updates the CRC register with the given bytes using the CRC instructions.
+ */
+ghost_impl_noinline GHOST_IMPL_CRC32C_TARGET
+ghost_uint32_t ghost_impl_crc32c_hw(ghost_uint32_t crc, const void* bytes, ghost_size_t length);
+#endif
+
+/*
+ * Updates the CRC register with the given bytes using the fastest available
+ * implementation.
+ */
+ghost_impl_always_inline
+ghost_uint32_t ghost_impl_crc32c_update(ghost_uint32_t crc, const void* bytes, ghost_size_t length) {
+    #if GHOST_IMPL_CRC32C_SSE42_DISPATCH && ghost_has(ghost_uint64_t)
+        if (__builtin_cpu_supports("sse4.2"))
+            return ghost_impl_crc32c_hw(crc, bytes, length);
+        return ghost_impl_crc32c_sw(crc, bytes, length);
+    #elif GHOST_IMPL_CRC32C_HARDWARE && ghost_has(ghost_uint64_t)
+        return ghost_impl_crc32c_hw(crc, bytes, length);
+    #else
+        return ghost_impl_crc32c_sw(crc, bytes, length);
+    #endif
+}
+#endif
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#if GHOST_EMIT_DEFS
+    #include "ghost/impl/algorithm/crc32c/ghost_impl_crc32c_define.h"
+#endif
+
+#endif
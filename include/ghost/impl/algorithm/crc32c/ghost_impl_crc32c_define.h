@@ -0,0 +1,1258 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_CRC32C_DEFINE_H_INCLUDED
+#define GHOST_IMPL_CRC32C_DEFINE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Defines Ghost's internal CRC-32C functions.
+ *
+ * The tables were generated for the reflected polynomial 0x82F63B78. The
+ * tables are static locals of the functions that use them so they're only
+ * emitted along with those functions.
+ */
+
+#if !GHOST_EMIT_DEFS && !GHOST_IMPL_AMALGAMATED
+    #error "This file is not supposed to be included if Ghost is not emitting function definitions."
+#endif
+
+#include "ghost/impl/algorithm/crc32c/ghost_impl_crc32c.h"
+#include "ghost/language/ghost_reinterpret_cast.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/serialization/load/ghost_load_le_u32.h"
+
+#if GHOST_IMPL_CRC32C_HARDWARE
+    #include "ghost/serialization/load/ghost_load_le_u64.h"
+    #include "ghost/type/uintptr_t/ghost_uintptr_t.h"
+    #if GHOST_IMPL_CRC32C_SSE42 || GHOST_IMPL_CRC32C_SSE42_DISPATCH
+        #include <nmmintrin.h>
+        #define GHOST_IMPL_CRC32C_U8(crc, byte) _mm_crc32_u8(crc, byte)
+        #define GHOST_IMPL_CRC32C_U64(crc, word) \
+            ghost_static_cast(ghost_uint32_t, _mm_crc32_u64(crc, word))
+    #else
+        #include <arm_acle.h>
+        #define GHOST_IMPL_CRC32C_U8(crc, byte) __crc32cb(crc, byte)
+        #define GHOST_IMPL_CRC32C_U64(crc, word) __crc32cd(crc, word)
+    #endif
+#endif
+
+/* Bytes per stream in the interleaved loops. */
+#define GHOST_IMPL_CRC32C_LONG 8192
+#define GHOST_IMPL_CRC32C_SHORT 256
+
+GHOST_IMPL_FUNCTION_OPEN
+
+#if ghost_has(ghost_uint32_t) && ghost_has(GHOST_UINT32_C)
+
+ghost_impl_noinline
+ghost_uint32_t ghost_impl_crc32c_sw(ghost_uint32_t crc, const void* bytes, ghost_size_t length) {
+    static const ghost_uint32_t table[8][256] = {
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0xf26b8303), GHOST_UINT32_C(0xe13b70f7), GHOST_UINT32_C(0x1350f3f4),
+            GHOST_UINT32_C(0xc79a971f), GHOST_UINT32_C(0x35f1141c), GHOST_UINT32_C(0x26a1e7e8), GHOST_UINT32_C(0xd4ca64eb),
+            GHOST_UINT32_C(0x8ad958cf), GHOST_UINT32_C(0x78b2dbcc), GHOST_UINT32_C(0x6be22838), GHOST_UINT32_C(0x9989ab3b),
+            GHOST_UINT32_C(0x4d43cfd0), GHOST_UINT32_C(0xbf284cd3), GHOST_UINT32_C(0xac78bf27), GHOST_UINT32_C(0x5e133c24),
+            GHOST_UINT32_C(0x105ec76f), GHOST_UINT32_C(0xe235446c), GHOST_UINT32_C(0xf165b798), GHOST_UINT32_C(0x030e349b),
+            GHOST_UINT32_C(0xd7c45070), GHOST_UINT32_C(0x25afd373), GHOST_UINT32_C(0x36ff2087), GHOST_UINT32_C(0xc494a384),
+            GHOST_UINT32_C(0x9a879fa0), GHOST_UINT32_C(0x68ec1ca3), GHOST_UINT32_C(0x7bbcef57), GHOST_UINT32_C(0x89d76c54),
+            GHOST_UINT32_C(0x5d1d08bf), GHOST_UINT32_C(0xaf768bbc), GHOST_UINT32_C(0xbc267848), GHOST_UINT32_C(0x4e4dfb4b),
+            GHOST_UINT32_C(0x20bd8ede), GHOST_UINT32_C(0xd2d60ddd), GHOST_UINT32_C(0xc186fe29), GHOST_UINT32_C(0x33ed7d2a),
+            GHOST_UINT32_C(0xe72719c1), GHOST_UINT32_C(0x154c9ac2), GHOST_UINT32_C(0x061c6936), GHOST_UINT32_C(0xf477ea35),
+            GHOST_UINT32_C(0xaa64d611), GHOST_UINT32_C(0x580f5512), GHOST_UINT32_C(0x4b5fa6e6), GHOST_UINT32_C(0xb93425e5),
+            GHOST_UINT32_C(0x6dfe410e), GHOST_UINT32_C(0x9f95c20d), GHOST_UINT32_C(0x8cc531f9), GHOST_UINT32_C(0x7eaeb2fa),
+            GHOST_UINT32_C(0x30e349b1), GHOST_UINT32_C(0xc288cab2), GHOST_UINT32_C(0xd1d83946), GHOST_UINT32_C(0x23b3ba45),
+            GHOST_UINT32_C(0xf779deae), GHOST_UINT32_C(0x05125dad), GHOST_UINT32_C(0x1642ae59), GHOST_UINT32_C(0xe4292d5a),
+            GHOST_UINT32_C(0xba3a117e), GHOST_UINT32_C(0x4851927d), GHOST_UINT32_C(0x5b016189), GHOST_UINT32_C(0xa96ae28a),
+            GHOST_UINT32_C(0x7da08661), GHOST_UINT32_C(0x8fcb0562), GHOST_UINT32_C(0x9c9bf696), GHOST_UINT32_C(0x6ef07595),
+            GHOST_UINT32_C(0x417b1dbc), GHOST_UINT32_C(0xb3109ebf), GHOST_UINT32_C(0xa0406d4b), GHOST_UINT32_C(0x522bee48),
+            GHOST_UINT32_C(0x86e18aa3), GHOST_UINT32_C(0x748a09a0), GHOST_UINT32_C(0x67dafa54), GHOST_UINT32_C(0x95b17957),
+            GHOST_UINT32_C(0xcba24573), GHOST_UINT32_C(0x39c9c670), GHOST_UINT32_C(0x2a993584), GHOST_UINT32_C(0xd8f2b687),
+            GHOST_UINT32_C(0x0c38d26c), GHOST_UINT32_C(0xfe53516f), GHOST_UINT32_C(0xed03a29b), GHOST_UINT32_C(0x1f682198),
+            GHOST_UINT32_C(0x5125dad3), GHOST_UINT32_C(0xa34e59d0), GHOST_UINT32_C(0xb01eaa24), GHOST_UINT32_C(0x42752927),
+            GHOST_UINT32_C(0x96bf4dcc), GHOST_UINT32_C(0x64d4cecf), GHOST_UINT32_C(0x77843d3b), GHOST_UINT32_C(0x85efbe38),
+            GHOST_UINT32_C(0xdbfc821c), GHOST_UINT32_C(0x2997011f), GHOST_UINT32_C(0x3ac7f2eb), GHOST_UINT32_C(0xc8ac71e8),
+            GHOST_UINT32_C(0x1c661503), GHOST_UINT32_C(0xee0d9600), GHOST_UINT32_C(0xfd5d65f4), GHOST_UINT32_C(0x0f36e6f7),
+            GHOST_UINT32_C(0x61c69362), GHOST_UINT32_C(0x93ad1061), GHOST_UINT32_C(0x80fde395), GHOST_UINT32_C(0x72966096),
+            GHOST_UINT32_C(0xa65c047d), GHOST_UINT32_C(0x5437877e), GHOST_UINT32_C(0x4767748a), GHOST_UINT32_C(0xb50cf789),
+            GHOST_UINT32_C(0xeb1fcbad), GHOST_UINT32_C(0x197448ae), GHOST_UINT32_C(0x0a24bb5a), GHOST_UINT32_C(0xf84f3859),
+            GHOST_UINT32_C(0x2c855cb2), GHOST_UINT32_C(0xdeeedfb1), GHOST_UINT32_C(0xcdbe2c45), GHOST_UINT32_C(0x3fd5af46),
+            GHOST_UINT32_C(0x7198540d), GHOST_UINT32_C(0x83f3d70e), GHOST_UINT32_C(0x90a324fa), GHOST_UINT32_C(0x62c8a7f9),
+            GHOST_UINT32_C(0xb602c312), GHOST_UINT32_C(0x44694011), GHOST_UINT32_C(0x5739b3e5), GHOST_UINT32_C(0xa55230e6),
+            GHOST_UINT32_C(0xfb410cc2), GHOST_UINT32_C(0x092a8fc1), GHOST_UINT32_C(0x1a7a7c35), GHOST_UINT32_C(0xe811ff36),
+            GHOST_UINT32_C(0x3cdb9bdd), GHOST_UINT32_C(0xceb018de), GHOST_UINT32_C(0xdde0eb2a), GHOST_UINT32_C(0x2f8b6829),
+            GHOST_UINT32_C(0x82f63b78), GHOST_UINT32_C(0x709db87b), GHOST_UINT32_C(0x63cd4b8f), GHOST_UINT32_C(0x91a6c88c),
+            GHOST_UINT32_C(0x456cac67), GHOST_UINT32_C(0xb7072f64), GHOST_UINT32_C(0xa457dc90), GHOST_UINT32_C(0x563c5f93),
+            GHOST_UINT32_C(0x082f63b7), GHOST_UINT32_C(0xfa44e0b4), GHOST_UINT32_C(0xe9141340), GHOST_UINT32_C(0x1b7f9043),
+            GHOST_UINT32_C(0xcfb5f4a8), GHOST_UINT32_C(0x3dde77ab), GHOST_UINT32_C(0x2e8e845f), GHOST_UINT32_C(0xdce5075c),
+            GHOST_UINT32_C(0x92a8fc17), GHOST_UINT32_C(0x60c37f14), GHOST_UINT32_C(0x73938ce0), GHOST_UINT32_C(0x81f80fe3),
+            GHOST_UINT32_C(0x55326b08), GHOST_UINT32_C(0xa759e80b), GHOST_UINT32_C(0xb4091bff), GHOST_UINT32_C(0x466298fc),
+            GHOST_UINT32_C(0x1871a4d8), GHOST_UINT32_C(0xea1a27db), GHOST_UINT32_C(0xf94ad42f), GHOST_UINT32_C(0x0b21572c),
+            GHOST_UINT32_C(0xdfeb33c7), GHOST_UINT32_C(0x2d80b0c4), GHOST_UINT32_C(0x3ed04330), GHOST_UINT32_C(0xccbbc033),
+            GHOST_UINT32_C(0xa24bb5a6), GHOST_UINT32_C(0x502036a5), GHOST_UINT32_C(0x4370c551), GHOST_UINT32_C(0xb11b4652),
+            GHOST_UINT32_C(0x65d122b9), GHOST_UINT32_C(0x97baa1ba), GHOST_UINT32_C(0x84ea524e), GHOST_UINT32_C(0x7681d14d),
+            GHOST_UINT32_C(0x2892ed69), GHOST_UINT32_C(0xdaf96e6a), GHOST_UINT32_C(0xc9a99d9e), GHOST_UINT32_C(0x3bc21e9d),
+            GHOST_UINT32_C(0xef087a76), GHOST_UINT32_C(0x1d63f975), GHOST_UINT32_C(0x0e330a81), GHOST_UINT32_C(0xfc588982),
+            GHOST_UINT32_C(0xb21572c9), GHOST_UINT32_C(0x407ef1ca), GHOST_UINT32_C(0x532e023e), GHOST_UINT32_C(0xa145813d),
+            GHOST_UINT32_C(0x758fe5d6), GHOST_UINT32_C(0x87e466d5), GHOST_UINT32_C(0x94b49521), GHOST_UINT32_C(0x66df1622),
+            GHOST_UINT32_C(0x38cc2a06), GHOST_UINT32_C(0xcaa7a905), GHOST_UINT32_C(0xd9f75af1), GHOST_UINT32_C(0x2b9cd9f2),
+            GHOST_UINT32_C(0xff56bd19), GHOST_UINT32_C(0x0d3d3e1a), GHOST_UINT32_C(0x1e6dcdee), GHOST_UINT32_C(0xec064eed),
+            GHOST_UINT32_C(0xc38d26c4), GHOST_UINT32_C(0x31e6a5c7), GHOST_UINT32_C(0x22b65633), GHOST_UINT32_C(0xd0ddd530),
+            GHOST_UINT32_C(0x0417b1db), GHOST_UINT32_C(0xf67c32d8), GHOST_UINT32_C(0xe52cc12c), GHOST_UINT32_C(0x1747422f),
+            GHOST_UINT32_C(0x49547e0b), GHOST_UINT32_C(0xbb3ffd08), GHOST_UINT32_C(0xa86f0efc), GHOST_UINT32_C(0x5a048dff),
+            GHOST_UINT32_C(0x8ecee914), GHOST_UINT32_C(0x7ca56a17), GHOST_UINT32_C(0x6ff599e3), GHOST_UINT32_C(0x9d9e1ae0),
+            GHOST_UINT32_C(0xd3d3e1ab), GHOST_UINT32_C(0x21b862a8), GHOST_UINT32_C(0x32e8915c), GHOST_UINT32_C(0xc083125f),
+            GHOST_UINT32_C(0x144976b4), GHOST_UINT32_C(0xe622f5b7), GHOST_UINT32_C(0xf5720643), GHOST_UINT32_C(0x07198540),
+            GHOST_UINT32_C(0x590ab964), GHOST_UINT32_C(0xab613a67), GHOST_UINT32_C(0xb831c993), GHOST_UINT32_C(0x4a5a4a90),
+            GHOST_UINT32_C(0x9e902e7b), GHOST_UINT32_C(0x6cfbad78), GHOST_UINT32_C(0x7fab5e8c), GHOST_UINT32_C(0x8dc0dd8f),
+            GHOST_UINT32_C(0xe330a81a), GHOST_UINT32_C(0x115b2b19), GHOST_UINT32_C(0x020bd8ed), GHOST_UINT32_C(0xf0605bee),
+            GHOST_UINT32_C(0x24aa3f05), GHOST_UINT32_C(0xd6c1bc06), GHOST_UINT32_C(0xc5914ff2), GHOST_UINT32_C(0x37faccf1),
+            GHOST_UINT32_C(0x69e9f0d5), GHOST_UINT32_C(0x9b8273d6), GHOST_UINT32_C(0x88d28022), GHOST_UINT32_C(0x7ab90321),
+            GHOST_UINT32_C(0xae7367ca), GHOST_UINT32_C(0x5c18e4c9), GHOST_UINT32_C(0x4f48173d), GHOST_UINT32_C(0xbd23943e),
+            GHOST_UINT32_C(0xf36e6f75), GHOST_UINT32_C(0x0105ec76), GHOST_UINT32_C(0x12551f82), GHOST_UINT32_C(0xe03e9c81),
+            GHOST_UINT32_C(0x34f4f86a), GHOST_UINT32_C(0xc69f7b69), GHOST_UINT32_C(0xd5cf889d), GHOST_UINT32_C(0x27a40b9e),
+            GHOST_UINT32_C(0x79b737ba), GHOST_UINT32_C(0x8bdcb4b9), GHOST_UINT32_C(0x988c474d), GHOST_UINT32_C(0x6ae7c44e),
+            GHOST_UINT32_C(0xbe2da0a5), GHOST_UINT32_C(0x4c4623a6), GHOST_UINT32_C(0x5f16d052), GHOST_UINT32_C(0xad7d5351)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0x13a29877), GHOST_UINT32_C(0x274530ee), GHOST_UINT32_C(0x34e7a899),
+            GHOST_UINT32_C(0x4e8a61dc), GHOST_UINT32_C(0x5d28f9ab), GHOST_UINT32_C(0x69cf5132), GHOST_UINT32_C(0x7a6dc945),
+            GHOST_UINT32_C(0x9d14c3b8), GHOST_UINT32_C(0x8eb65bcf), GHOST_UINT32_C(0xba51f356), GHOST_UINT32_C(0xa9f36b21),
+            GHOST_UINT32_C(0xd39ea264), GHOST_UINT32_C(0xc03c3a13), GHOST_UINT32_C(0xf4db928a), GHOST_UINT32_C(0xe7790afd),
+            GHOST_UINT32_C(0x3fc5f181), GHOST_UINT32_C(0x2c6769f6), GHOST_UINT32_C(0x1880c16f), GHOST_UINT32_C(0x0b225918),
+            GHOST_UINT32_C(0x714f905d), GHOST_UINT32_C(0x62ed082a), GHOST_UINT32_C(0x560aa0b3), GHOST_UINT32_C(0x45a838c4),
+            GHOST_UINT32_C(0xa2d13239), GHOST_UINT32_C(0xb173aa4e), GHOST_UINT32_C(0x859402d7), GHOST_UINT32_C(0x96369aa0),
+            GHOST_UINT32_C(0xec5b53e5), GHOST_UINT32_C(0xfff9cb92), GHOST_UINT32_C(0xcb1e630b), GHOST_UINT32_C(0xd8bcfb7c),
+            GHOST_UINT32_C(0x7f8be302), GHOST_UINT32_C(0x6c297b75), GHOST_UINT32_C(0x58ced3ec), GHOST_UINT32_C(0x4b6c4b9b),
+            GHOST_UINT32_C(0x310182de), GHOST_UINT32_C(0x22a31aa9), GHOST_UINT32_C(0x1644b230), GHOST_UINT32_C(0x05e62a47),
+            GHOST_UINT32_C(0xe29f20ba), GHOST_UINT32_C(0xf13db8cd), GHOST_UINT32_C(0xc5da1054), GHOST_UINT32_C(0xd6788823),
+            GHOST_UINT32_C(0xac154166), GHOST_UINT32_C(0xbfb7d911), GHOST_UINT32_C(0x8b507188), GHOST_UINT32_C(0x98f2e9ff),
+            GHOST_UINT32_C(0x404e1283), GHOST_UINT32_C(0x53ec8af4), GHOST_UINT32_C(0x670b226d), GHOST_UINT32_C(0x74a9ba1a),
+            GHOST_UINT32_C(0x0ec4735f), GHOST_UINT32_C(0x1d66eb28), GHOST_UINT32_C(0x298143b1), GHOST_UINT32_C(0x3a23dbc6),
+            GHOST_UINT32_C(0xdd5ad13b), GHOST_UINT32_C(0xcef8494c), GHOST_UINT32_C(0xfa1fe1d5), GHOST_UINT32_C(0xe9bd79a2),
+            GHOST_UINT32_C(0x93d0b0e7), GHOST_UINT32_C(0x80722890), GHOST_UINT32_C(0xb4958009), GHOST_UINT32_C(0xa737187e),
+            GHOST_UINT32_C(0xff17c604), GHOST_UINT32_C(0xecb55e73), GHOST_UINT32_C(0xd852f6ea), GHOST_UINT32_C(0xcbf06e9d),
+            GHOST_UINT32_C(0xb19da7d8), GHOST_UINT32_C(0xa23f3faf), GHOST_UINT32_C(0x96d89736), GHOST_UINT32_C(0x857a0f41),
+            GHOST_UINT32_C(0x620305bc), GHOST_UINT32_C(0x71a19dcb), GHOST_UINT32_C(0x45463552), GHOST_UINT32_C(0x56e4ad25),
+            GHOST_UINT32_C(0x2c896460), GHOST_UINT32_C(0x3f2bfc17), GHOST_UINT32_C(0x0bcc548e), GHOST_UINT32_C(0x186eccf9),
+            GHOST_UINT32_C(0xc0d23785), GHOST_UINT32_C(0xd370aff2), GHOST_UINT32_C(0xe797076b), GHOST_UINT32_C(0xf4359f1c),
+            GHOST_UINT32_C(0x8e585659), GHOST_UINT32_C(0x9dface2e), GHOST_UINT32_C(0xa91d66b7), GHOST_UINT32_C(0xbabffec0),
+            GHOST_UINT32_C(0x5dc6f43d), GHOST_UINT32_C(0x4e646c4a), GHOST_UINT32_C(0x7a83c4d3), GHOST_UINT32_C(0x69215ca4),
+            GHOST_UINT32_C(0x134c95e1), GHOST_UINT32_C(0x00ee0d96), GHOST_UINT32_C(0x3409a50f), GHOST_UINT32_C(0x27ab3d78),
+            GHOST_UINT32_C(0x809c2506), GHOST_UINT32_C(0x933ebd71), GHOST_UINT32_C(0xa7d915e8), GHOST_UINT32_C(0xb47b8d9f),
+            GHOST_UINT32_C(0xce1644da), GHOST_UINT32_C(0xddb4dcad), GHOST_UINT32_C(0xe9537434), GHOST_UINT32_C(0xfaf1ec43),
+            GHOST_UINT32_C(0x1d88e6be), GHOST_UINT32_C(0x0e2a7ec9), GHOST_UINT32_C(0x3acdd650), GHOST_UINT32_C(0x296f4e27),
+            GHOST_UINT32_C(0x53028762), GHOST_UINT32_C(0x40a01f15), GHOST_UINT32_C(0x7447b78c), GHOST_UINT32_C(0x67e52ffb),
+            GHOST_UINT32_C(0xbf59d487), GHOST_UINT32_C(0xacfb4cf0), GHOST_UINT32_C(0x981ce469), GHOST_UINT32_C(0x8bbe7c1e),
+            GHOST_UINT32_C(0xf1d3b55b), GHOST_UINT32_C(0xe2712d2c), GHOST_UINT32_C(0xd69685b5), GHOST_UINT32_C(0xc5341dc2),
+            GHOST_UINT32_C(0x224d173f), GHOST_UINT32_C(0x31ef8f48), GHOST_UINT32_C(0x050827d1), GHOST_UINT32_C(0x16aabfa6),
+            GHOST_UINT32_C(0x6cc776e3), GHOST_UINT32_C(0x7f65ee94), GHOST_UINT32_C(0x4b82460d), GHOST_UINT32_C(0x5820de7a),
+            GHOST_UINT32_C(0xfbc3faf9), GHOST_UINT32_C(0xe861628e), GHOST_UINT32_C(0xdc86ca17), GHOST_UINT32_C(0xcf245260),
+            GHOST_UINT32_C(0xb5499b25), GHOST_UINT32_C(0xa6eb0352), GHOST_UINT32_C(0x920cabcb), GHOST_UINT32_C(0x81ae33bc),
+            GHOST_UINT32_C(0x66d73941), GHOST_UINT32_C(0x7575a136), GHOST_UINT32_C(0x419209af), GHOST_UINT32_C(0x523091d8),
+            GHOST_UINT32_C(0x285d589d), GHOST_UINT32_C(0x3bffc0ea), GHOST_UINT32_C(0x0f186873), GHOST_UINT32_C(0x1cbaf004),
+            GHOST_UINT32_C(0xc4060b78), GHOST_UINT32_C(0xd7a4930f), GHOST_UINT32_C(0xe3433b96), GHOST_UINT32_C(0xf0e1a3e1),
+            GHOST_UINT32_C(0x8a8c6aa4), GHOST_UINT32_C(0x992ef2d3), GHOST_UINT32_C(0xadc95a4a), GHOST_UINT32_C(0xbe6bc23d),
+            GHOST_UINT32_C(0x5912c8c0), GHOST_UINT32_C(0x4ab050b7), GHOST_UINT32_C(0x7e57f82e), GHOST_UINT32_C(0x6df56059),
+            GHOST_UINT32_C(0x1798a91c), GHOST_UINT32_C(0x043a316b), GHOST_UINT32_C(0x30dd99f2), GHOST_UINT32_C(0x237f0185),
+            GHOST_UINT32_C(0x844819fb), GHOST_UINT32_C(0x97ea818c), GHOST_UINT32_C(0xa30d2915), GHOST_UINT32_C(0xb0afb162),
+            GHOST_UINT32_C(0xcac27827), GHOST_UINT32_C(0xd960e050), GHOST_UINT32_C(0xed8748c9), GHOST_UINT32_C(0xfe25d0be),
+            GHOST_UINT32_C(0x195cda43), GHOST_UINT32_C(0x0afe4234), GHOST_UINT32_C(0x3e19eaad), GHOST_UINT32_C(0x2dbb72da),
+            GHOST_UINT32_C(0x57d6bb9f), GHOST_UINT32_C(0x447423e8), GHOST_UINT32_C(0x70938b71), GHOST_UINT32_C(0x63311306),
+            GHOST_UINT32_C(0xbb8de87a), GHOST_UINT32_C(0xa82f700d), GHOST_UINT32_C(0x9cc8d894), GHOST_UINT32_C(0x8f6a40e3),
+            GHOST_UINT32_C(0xf50789a6), GHOST_UINT32_C(0xe6a511d1), GHOST_UINT32_C(0xd242b948), GHOST_UINT32_C(0xc1e0213f),
+            GHOST_UINT32_C(0x26992bc2), GHOST_UINT32_C(0x353bb3b5), GHOST_UINT32_C(0x01dc1b2c), GHOST_UINT32_C(0x127e835b),
+            GHOST_UINT32_C(0x68134a1e), GHOST_UINT32_C(0x7bb1d269), GHOST_UINT32_C(0x4f567af0), GHOST_UINT32_C(0x5cf4e287),
+            GHOST_UINT32_C(0x04d43cfd), GHOST_UINT32_C(0x1776a48a), GHOST_UINT32_C(0x23910c13), GHOST_UINT32_C(0x30339464),
+            GHOST_UINT32_C(0x4a5e5d21), GHOST_UINT32_C(0x59fcc556), GHOST_UINT32_C(0x6d1b6dcf), GHOST_UINT32_C(0x7eb9f5b8),
+            GHOST_UINT32_C(0x99c0ff45), GHOST_UINT32_C(0x8a626732), GHOST_UINT32_C(0xbe85cfab), GHOST_UINT32_C(0xad2757dc),
+            GHOST_UINT32_C(0xd74a9e99), GHOST_UINT32_C(0xc4e806ee), GHOST_UINT32_C(0xf00fae77), GHOST_UINT32_C(0xe3ad3600),
+            GHOST_UINT32_C(0x3b11cd7c), GHOST_UINT32_C(0x28b3550b), GHOST_UINT32_C(0x1c54fd92), GHOST_UINT32_C(0x0ff665e5),
+            GHOST_UINT32_C(0x759baca0), GHOST_UINT32_C(0x663934d7), GHOST_UINT32_C(0x52de9c4e), GHOST_UINT32_C(0x417c0439),
+            GHOST_UINT32_C(0xa6050ec4), GHOST_UINT32_C(0xb5a796b3), GHOST_UINT32_C(0x81403e2a), GHOST_UINT32_C(0x92e2a65d),
+            GHOST_UINT32_C(0xe88f6f18), GHOST_UINT32_C(0xfb2df76f), GHOST_UINT32_C(0xcfca5ff6), GHOST_UINT32_C(0xdc68c781),
+            GHOST_UINT32_C(0x7b5fdfff), GHOST_UINT32_C(0x68fd4788), GHOST_UINT32_C(0x5c1aef11), GHOST_UINT32_C(0x4fb87766),
+            GHOST_UINT32_C(0x35d5be23), GHOST_UINT32_C(0x26772654), GHOST_UINT32_C(0x12908ecd), GHOST_UINT32_C(0x013216ba),
+            GHOST_UINT32_C(0xe64b1c47), GHOST_UINT32_C(0xf5e98430), GHOST_UINT32_C(0xc10e2ca9), GHOST_UINT32_C(0xd2acb4de),
+            GHOST_UINT32_C(0xa8c17d9b), GHOST_UINT32_C(0xbb63e5ec), GHOST_UINT32_C(0x8f844d75), GHOST_UINT32_C(0x9c26d502),
+            GHOST_UINT32_C(0x449a2e7e), GHOST_UINT32_C(0x5738b609), GHOST_UINT32_C(0x63df1e90), GHOST_UINT32_C(0x707d86e7),
+            GHOST_UINT32_C(0x0a104fa2), GHOST_UINT32_C(0x19b2d7d5), GHOST_UINT32_C(0x2d557f4c), GHOST_UINT32_C(0x3ef7e73b),
+            GHOST_UINT32_C(0xd98eedc6), GHOST_UINT32_C(0xca2c75b1), GHOST_UINT32_C(0xfecbdd28), GHOST_UINT32_C(0xed69455f),
+            GHOST_UINT32_C(0x97048c1a), GHOST_UINT32_C(0x84a6146d), GHOST_UINT32_C(0xb041bcf4), GHOST_UINT32_C(0xa3e32483)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0xa541927e), GHOST_UINT32_C(0x4f6f520d), GHOST_UINT32_C(0xea2ec073),
+            GHOST_UINT32_C(0x9edea41a), GHOST_UINT32_C(0x3b9f3664), GHOST_UINT32_C(0xd1b1f617), GHOST_UINT32_C(0x74f06469),
+            GHOST_UINT32_C(0x38513ec5), GHOST_UINT32_C(0x9d10acbb), GHOST_UINT32_C(0x773e6cc8), GHOST_UINT32_C(0xd27ffeb6),
+            GHOST_UINT32_C(0xa68f9adf), GHOST_UINT32_C(0x03ce08a1), GHOST_UINT32_C(0xe9e0c8d2), GHOST_UINT32_C(0x4ca15aac),
+            GHOST_UINT32_C(0x70a27d8a), GHOST_UINT32_C(0xd5e3eff4), GHOST_UINT32_C(0x3fcd2f87), GHOST_UINT32_C(0x9a8cbdf9),
+            GHOST_UINT32_C(0xee7cd990), GHOST_UINT32_C(0x4b3d4bee), GHOST_UINT32_C(0xa1138b9d), GHOST_UINT32_C(0x045219e3),
+            GHOST_UINT32_C(0x48f3434f), GHOST_UINT32_C(0xedb2d131), GHOST_UINT32_C(0x079c1142), GHOST_UINT32_C(0xa2dd833c),
+            GHOST_UINT32_C(0xd62de755), GHOST_UINT32_C(0x736c752b), GHOST_UINT32_C(0x9942b558), GHOST_UINT32_C(0x3c032726),
+            GHOST_UINT32_C(0xe144fb14), GHOST_UINT32_C(0x4405696a), GHOST_UINT32_C(0xae2ba919), GHOST_UINT32_C(0x0b6a3b67),
+            GHOST_UINT32_C(0x7f9a5f0e), GHOST_UINT32_C(0xdadbcd70), GHOST_UINT32_C(0x30f50d03), GHOST_UINT32_C(0x95b49f7d),
+            GHOST_UINT32_C(0xd915c5d1), GHOST_UINT32_C(0x7c5457af), GHOST_UINT32_C(0x967a97dc), GHOST_UINT32_C(0x333b05a2),
+            GHOST_UINT32_C(0x47cb61cb), GHOST_UINT32_C(0xe28af3b5), GHOST_UINT32_C(0x08a433c6), GHOST_UINT32_C(0xade5a1b8),
+            GHOST_UINT32_C(0x91e6869e), GHOST_UINT32_C(0x34a714e0), GHOST_UINT32_C(0xde89d493), GHOST_UINT32_C(0x7bc846ed),
+            GHOST_UINT32_C(0x0f382284), GHOST_UINT32_C(0xaa79b0fa), GHOST_UINT32_C(0x40577089), GHOST_UINT32_C(0xe516e2f7),
+            GHOST_UINT32_C(0xa9b7b85b), GHOST_UINT32_C(0x0cf62a25), GHOST_UINT32_C(0xe6d8ea56), GHOST_UINT32_C(0x43997828),
+            GHOST_UINT32_C(0x37691c41), GHOST_UINT32_C(0x92288e3f), GHOST_UINT32_C(0x78064e4c), GHOST_UINT32_C(0xdd47dc32),
+            GHOST_UINT32_C(0xc76580d9), GHOST_UINT32_C(0x622412a7), GHOST_UINT32_C(0x880ad2d4), GHOST_UINT32_C(0x2d4b40aa),
+            GHOST_UINT32_C(0x59bb24c3), GHOST_UINT32_C(0xfcfab6bd), GHOST_UINT32_C(0x16d476ce), GHOST_UINT32_C(0xb395e4b0),
+            GHOST_UINT32_C(0xff34be1c), GHOST_UINT32_C(0x5a752c62), GHOST_UINT32_C(0xb05bec11), GHOST_UINT32_C(0x151a7e6f),
+            GHOST_UINT32_C(0x61ea1a06), GHOST_UINT32_C(0xc4ab8878), GHOST_UINT32_C(0x2e85480b), GHOST_UINT32_C(0x8bc4da75),
+            GHOST_UINT32_C(0xb7c7fd53), GHOST_UINT32_C(0x12866f2d), GHOST_UINT32_C(0xf8a8af5e), GHOST_UINT32_C(0x5de93d20),
+            GHOST_UINT32_C(0x29195949), GHOST_UINT32_C(0x8c58cb37), GHOST_UINT32_C(0x66760b44), GHOST_UINT32_C(0xc337993a),
+            GHOST_UINT32_C(0x8f96c396), GHOST_UINT32_C(0x2ad751e8), GHOST_UINT32_C(0xc0f9919b), GHOST_UINT32_C(0x65b803e5),
+            GHOST_UINT32_C(0x1148678c), GHOST_UINT32_C(0xb409f5f2), GHOST_UINT32_C(0x5e273581), GHOST_UINT32_C(0xfb66a7ff),
+            GHOST_UINT32_C(0x26217bcd), GHOST_UINT32_C(0x8360e9b3), GHOST_UINT32_C(0x694e29c0), GHOST_UINT32_C(0xcc0fbbbe),
+            GHOST_UINT32_C(0xb8ffdfd7), GHOST_UINT32_C(0x1dbe4da9), GHOST_UINT32_C(0xf7908dda), GHOST_UINT32_C(0x52d11fa4),
+            GHOST_UINT32_C(0x1e704508), GHOST_UINT32_C(0xbb31d776), GHOST_UINT32_C(0x511f1705), GHOST_UINT32_C(0xf45e857b),
+            GHOST_UINT32_C(0x80aee112), GHOST_UINT32_C(0x25ef736c), GHOST_UINT32_C(0xcfc1b31f), GHOST_UINT32_C(0x6a802161),
+            GHOST_UINT32_C(0x56830647), GHOST_UINT32_C(0xf3c29439), GHOST_UINT32_C(0x19ec544a), GHOST_UINT32_C(0xbcadc634),
+            GHOST_UINT32_C(0xc85da25d), GHOST_UINT32_C(0x6d1c3023), GHOST_UINT32_C(0x8732f050), GHOST_UINT32_C(0x2273622e),
+            GHOST_UINT32_C(0x6ed23882), GHOST_UINT32_C(0xcb93aafc), GHOST_UINT32_C(0x21bd6a8f), GHOST_UINT32_C(0x84fcf8f1),
+            GHOST_UINT32_C(0xf00c9c98), GHOST_UINT32_C(0x554d0ee6), GHOST_UINT32_C(0xbf63ce95), GHOST_UINT32_C(0x1a225ceb),
+            GHOST_UINT32_C(0x8b277743), GHOST_UINT32_C(0x2e66e53d), GHOST_UINT32_C(0xc448254e), GHOST_UINT32_C(0x6109b730),
+            GHOST_UINT32_C(0x15f9d359), GHOST_UINT32_C(0xb0b84127), GHOST_UINT32_C(0x5a968154), GHOST_UINT32_C(0xffd7132a),
+            GHOST_UINT32_C(0xb3764986), GHOST_UINT32_C(0x1637dbf8), GHOST_UINT32_C(0xfc191b8b), GHOST_UINT32_C(0x595889f5),
+            GHOST_UINT32_C(0x2da8ed9c), GHOST_UINT32_C(0x88e97fe2), GHOST_UINT32_C(0x62c7bf91), GHOST_UINT32_C(0xc7862def),
+            GHOST_UINT32_C(0xfb850ac9), GHOST_UINT32_C(0x5ec498b7), GHOST_UINT32_C(0xb4ea58c4), GHOST_UINT32_C(0x11abcaba),
+            GHOST_UINT32_C(0x655baed3), GHOST_UINT32_C(0xc01a3cad), GHOST_UINT32_C(0x2a34fcde), GHOST_UINT32_C(0x8f756ea0),
+            GHOST_UINT32_C(0xc3d4340c), GHOST_UINT32_C(0x6695a672), GHOST_UINT32_C(0x8cbb6601), GHOST_UINT32_C(0x29faf47f),
+            GHOST_UINT32_C(0x5d0a9016), GHOST_UINT32_C(0xf84b0268), GHOST_UINT32_C(0x1265c21b), GHOST_UINT32_C(0xb7245065),
+            GHOST_UINT32_C(0x6a638c57), GHOST_UINT32_C(0xcf221e29), GHOST_UINT32_C(0x250cde5a), GHOST_UINT32_C(0x804d4c24),
+            GHOST_UINT32_C(0xf4bd284d), GHOST_UINT32_C(0x51fcba33), GHOST_UINT32_C(0xbbd27a40), GHOST_UINT32_C(0x1e93e83e),
+            GHOST_UINT32_C(0x5232b292), GHOST_UINT32_C(0xf77320ec), GHOST_UINT32_C(0x1d5de09f), GHOST_UINT32_C(0xb81c72e1),
+            GHOST_UINT32_C(0xccec1688), GHOST_UINT32_C(0x69ad84f6), GHOST_UINT32_C(0x83834485), GHOST_UINT32_C(0x26c2d6fb),
+            GHOST_UINT32_C(0x1ac1f1dd), GHOST_UINT32_C(0xbf8063a3), GHOST_UINT32_C(0x55aea3d0), GHOST_UINT32_C(0xf0ef31ae),
+            GHOST_UINT32_C(0x841f55c7), GHOST_UINT32_C(0x215ec7b9), GHOST_UINT32_C(0xcb7007ca), GHOST_UINT32_C(0x6e3195b4),
+            GHOST_UINT32_C(0x2290cf18), GHOST_UINT32_C(0x87d15d66), GHOST_UINT32_C(0x6dff9d15), GHOST_UINT32_C(0xc8be0f6b),
+            GHOST_UINT32_C(0xbc4e6b02), GHOST_UINT32_C(0x190ff97c), GHOST_UINT32_C(0xf321390f), GHOST_UINT32_C(0x5660ab71),
+            GHOST_UINT32_C(0x4c42f79a), GHOST_UINT32_C(0xe90365e4), GHOST_UINT32_C(0x032da597), GHOST_UINT32_C(0xa66c37e9),
+            GHOST_UINT32_C(0xd29c5380), GHOST_UINT32_C(0x77ddc1fe), GHOST_UINT32_C(0x9df3018d), GHOST_UINT32_C(0x38b293f3),
+            GHOST_UINT32_C(0x7413c95f), GHOST_UINT32_C(0xd1525b21), GHOST_UINT32_C(0x3b7c9b52), GHOST_UINT32_C(0x9e3d092c),
+            GHOST_UINT32_C(0xeacd6d45), GHOST_UINT32_C(0x4f8cff3b), GHOST_UINT32_C(0xa5a23f48), GHOST_UINT32_C(0x00e3ad36),
+            GHOST_UINT32_C(0x3ce08a10), GHOST_UINT32_C(0x99a1186e), GHOST_UINT32_C(0x738fd81d), GHOST_UINT32_C(0xd6ce4a63),
+            GHOST_UINT32_C(0xa23e2e0a), GHOST_UINT32_C(0x077fbc74), GHOST_UINT32_C(0xed517c07), GHOST_UINT32_C(0x4810ee79),
+            GHOST_UINT32_C(0x04b1b4d5), GHOST_UINT32_C(0xa1f026ab), GHOST_UINT32_C(0x4bdee6d8), GHOST_UINT32_C(0xee9f74a6),
+            GHOST_UINT32_C(0x9a6f10cf), GHOST_UINT32_C(0x3f2e82b1), GHOST_UINT32_C(0xd50042c2), GHOST_UINT32_C(0x7041d0bc),
+            GHOST_UINT32_C(0xad060c8e), GHOST_UINT32_C(0x08479ef0), GHOST_UINT32_C(0xe2695e83), GHOST_UINT32_C(0x4728ccfd),
+            GHOST_UINT32_C(0x33d8a894), GHOST_UINT32_C(0x96993aea), GHOST_UINT32_C(0x7cb7fa99), GHOST_UINT32_C(0xd9f668e7),
+            GHOST_UINT32_C(0x9557324b), GHOST_UINT32_C(0x3016a035), GHOST_UINT32_C(0xda386046), GHOST_UINT32_C(0x7f79f238),
+            GHOST_UINT32_C(0x0b899651), GHOST_UINT32_C(0xaec8042f), GHOST_UINT32_C(0x44e6c45c), GHOST_UINT32_C(0xe1a75622),
+            GHOST_UINT32_C(0xdda47104), GHOST_UINT32_C(0x78e5e37a), GHOST_UINT32_C(0x92cb2309), GHOST_UINT32_C(0x378ab177),
+            GHOST_UINT32_C(0x437ad51e), GHOST_UINT32_C(0xe63b4760), GHOST_UINT32_C(0x0c158713), GHOST_UINT32_C(0xa954156d),
+            GHOST_UINT32_C(0xe5f54fc1), GHOST_UINT32_C(0x40b4ddbf), GHOST_UINT32_C(0xaa9a1dcc), GHOST_UINT32_C(0x0fdb8fb2),
+            GHOST_UINT32_C(0x7b2bebdb), GHOST_UINT32_C(0xde6a79a5), GHOST_UINT32_C(0x3444b9d6), GHOST_UINT32_C(0x91052ba8)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0xdd45aab8), GHOST_UINT32_C(0xbf672381), GHOST_UINT32_C(0x62228939),
+            GHOST_UINT32_C(0x7b2231f3), GHOST_UINT32_C(0xa6679b4b), GHOST_UINT32_C(0xc4451272), GHOST_UINT32_C(0x1900b8ca),
+            GHOST_UINT32_C(0xf64463e6), GHOST_UINT32_C(0x2b01c95e), GHOST_UINT32_C(0x49234067), GHOST_UINT32_C(0x9466eadf),
+            GHOST_UINT32_C(0x8d665215), GHOST_UINT32_C(0x5023f8ad), GHOST_UINT32_C(0x32017194), GHOST_UINT32_C(0xef44db2c),
+            GHOST_UINT32_C(0xe964b13d), GHOST_UINT32_C(0x34211b85), GHOST_UINT32_C(0x560392bc), GHOST_UINT32_C(0x8b463804),
+            GHOST_UINT32_C(0x924680ce), GHOST_UINT32_C(0x4f032a76), GHOST_UINT32_C(0x2d21a34f), GHOST_UINT32_C(0xf06409f7),
+            GHOST_UINT32_C(0x1f20d2db), GHOST_UINT32_C(0xc2657863), GHOST_UINT32_C(0xa047f15a), GHOST_UINT32_C(0x7d025be2),
+            GHOST_UINT32_C(0x6402e328), GHOST_UINT32_C(0xb9474990), GHOST_UINT32_C(0xdb65c0a9), GHOST_UINT32_C(0x06206a11),
+            GHOST_UINT32_C(0xd725148b), GHOST_UINT32_C(0x0a60be33), GHOST_UINT32_C(0x6842370a), GHOST_UINT32_C(0xb5079db2),
+            GHOST_UINT32_C(0xac072578), GHOST_UINT32_C(0x71428fc0), GHOST_UINT32_C(0x136006f9), GHOST_UINT32_C(0xce25ac41),
+            GHOST_UINT32_C(0x2161776d), GHOST_UINT32_C(0xfc24ddd5), GHOST_UINT32_C(0x9e0654ec), GHOST_UINT32_C(0x4343fe54),
+            GHOST_UINT32_C(0x5a43469e), GHOST_UINT32_C(0x8706ec26), GHOST_UINT32_C(0xe524651f), GHOST_UINT32_C(0x3861cfa7),
+            GHOST_UINT32_C(0x3e41a5b6), GHOST_UINT32_C(0xe3040f0e), GHOST_UINT32_C(0x81268637), GHOST_UINT32_C(0x5c632c8f),
+            GHOST_UINT32_C(0x45639445), GHOST_UINT32_C(0x98263efd), GHOST_UINT32_C(0xfa04b7c4), GHOST_UINT32_C(0x27411d7c),
+            GHOST_UINT32_C(0xc805c650), GHOST_UINT32_C(0x15406ce8), GHOST_UINT32_C(0x7762e5d1), GHOST_UINT32_C(0xaa274f69),
+            GHOST_UINT32_C(0xb327f7a3), GHOST_UINT32_C(0x6e625d1b), GHOST_UINT32_C(0x0c40d422), GHOST_UINT32_C(0xd1057e9a),
+            GHOST_UINT32_C(0xaba65fe7), GHOST_UINT32_C(0x76e3f55f), GHOST_UINT32_C(0x14c17c66), GHOST_UINT32_C(0xc984d6de),
+            GHOST_UINT32_C(0xd0846e14), GHOST_UINT32_C(0x0dc1c4ac), GHOST_UINT32_C(0x6fe34d95), GHOST_UINT32_C(0xb2a6e72d),
+            GHOST_UINT32_C(0x5de23c01), GHOST_UINT32_C(0x80a796b9), GHOST_UINT32_C(0xe2851f80), GHOST_UINT32_C(0x3fc0b538),
+            GHOST_UINT32_C(0x26c00df2), GHOST_UINT32_C(0xfb85a74a), GHOST_UINT32_C(0x99a72e73), GHOST_UINT32_C(0x44e284cb),
+            GHOST_UINT32_C(0x42c2eeda), GHOST_UINT32_C(0x9f874462), GHOST_UINT32_C(0xfda5cd5b), GHOST_UINT32_C(0x20e067e3),
+            GHOST_UINT32_C(0x39e0df29), GHOST_UINT32_C(0xe4a57591), GHOST_UINT32_C(0x8687fca8), GHOST_UINT32_C(0x5bc25610),
+            GHOST_UINT32_C(0xb4868d3c), GHOST_UINT32_C(0x69c32784), GHOST_UINT32_C(0x0be1aebd), GHOST_UINT32_C(0xd6a40405),
+            GHOST_UINT32_C(0xcfa4bccf), GHOST_UINT32_C(0x12e11677), GHOST_UINT32_C(0x70c39f4e), GHOST_UINT32_C(0xad8635f6),
+            GHOST_UINT32_C(0x7c834b6c), GHOST_UINT32_C(0xa1c6e1d4), GHOST_UINT32_C(0xc3e468ed), GHOST_UINT32_C(0x1ea1c255),
+            GHOST_UINT32_C(0x07a17a9f), GHOST_UINT32_C(0xdae4d027), GHOST_UINT32_C(0xb8c6591e), GHOST_UINT32_C(0x6583f3a6),
+            GHOST_UINT32_C(0x8ac7288a), GHOST_UINT32_C(0x57828232), GHOST_UINT32_C(0x35a00b0b), GHOST_UINT32_C(0xe8e5a1b3),
+            GHOST_UINT32_C(0xf1e51979), GHOST_UINT32_C(0x2ca0b3c1), GHOST_UINT32_C(0x4e823af8), GHOST_UINT32_C(0x93c79040),
+            GHOST_UINT32_C(0x95e7fa51), GHOST_UINT32_C(0x48a250e9), GHOST_UINT32_C(0x2a80d9d0), GHOST_UINT32_C(0xf7c57368),
+            GHOST_UINT32_C(0xeec5cba2), GHOST_UINT32_C(0x3380611a), GHOST_UINT32_C(0x51a2e823), GHOST_UINT32_C(0x8ce7429b),
+            GHOST_UINT32_C(0x63a399b7), GHOST_UINT32_C(0xbee6330f), GHOST_UINT32_C(0xdcc4ba36), GHOST_UINT32_C(0x0181108e),
+            GHOST_UINT32_C(0x1881a844), GHOST_UINT32_C(0xc5c402fc), GHOST_UINT32_C(0xa7e68bc5), GHOST_UINT32_C(0x7aa3217d),
+            GHOST_UINT32_C(0x52a0c93f), GHOST_UINT32_C(0x8fe56387), GHOST_UINT32_C(0xedc7eabe), GHOST_UINT32_C(0x30824006),
+            GHOST_UINT32_C(0x2982f8cc), GHOST_UINT32_C(0xf4c75274), GHOST_UINT32_C(0x96e5db4d), GHOST_UINT32_C(0x4ba071f5),
+            GHOST_UINT32_C(0xa4e4aad9), GHOST_UINT32_C(0x79a10061), GHOST_UINT32_C(0x1b838958), GHOST_UINT32_C(0xc6c623e0),
+            GHOST_UINT32_C(0xdfc69b2a), GHOST_UINT32_C(0x02833192), GHOST_UINT32_C(0x60a1b8ab), GHOST_UINT32_C(0xbde41213),
+            GHOST_UINT32_C(0xbbc47802), GHOST_UINT32_C(0x6681d2ba), GHOST_UINT32_C(0x04a35b83), GHOST_UINT32_C(0xd9e6f13b),
+            GHOST_UINT32_C(0xc0e649f1), GHOST_UINT32_C(0x1da3e349), GHOST_UINT32_C(0x7f816a70), GHOST_UINT32_C(0xa2c4c0c8),
+            GHOST_UINT32_C(0x4d801be4), GHOST_UINT32_C(0x90c5b15c), GHOST_UINT32_C(0xf2e73865), GHOST_UINT32_C(0x2fa292dd),
+            GHOST_UINT32_C(0x36a22a17), GHOST_UINT32_C(0xebe780af), GHOST_UINT32_C(0x89c50996), GHOST_UINT32_C(0x5480a32e),
+            GHOST_UINT32_C(0x8585ddb4), GHOST_UINT32_C(0x58c0770c), GHOST_UINT32_C(0x3ae2fe35), GHOST_UINT32_C(0xe7a7548d),
+            GHOST_UINT32_C(0xfea7ec47), GHOST_UINT32_C(0x23e246ff), GHOST_UINT32_C(0x41c0cfc6), GHOST_UINT32_C(0x9c85657e),
+            GHOST_UINT32_C(0x73c1be52), GHOST_UINT32_C(0xae8414ea), GHOST_UINT32_C(0xcca69dd3), GHOST_UINT32_C(0x11e3376b),
+            GHOST_UINT32_C(0x08e38fa1), GHOST_UINT32_C(0xd5a62519), GHOST_UINT32_C(0xb784ac20), GHOST_UINT32_C(0x6ac10698),
+            GHOST_UINT32_C(0x6ce16c89), GHOST_UINT32_C(0xb1a4c631), GHOST_UINT32_C(0xd3864f08), GHOST_UINT32_C(0x0ec3e5b0),
+            GHOST_UINT32_C(0x17c35d7a), GHOST_UINT32_C(0xca86f7c2), GHOST_UINT32_C(0xa8a47efb), GHOST_UINT32_C(0x75e1d443),
+            GHOST_UINT32_C(0x9aa50f6f), GHOST_UINT32_C(0x47e0a5d7), GHOST_UINT32_C(0x25c22cee), GHOST_UINT32_C(0xf8878656),
+            GHOST_UINT32_C(0xe1873e9c), GHOST_UINT32_C(0x3cc29424), GHOST_UINT32_C(0x5ee01d1d), GHOST_UINT32_C(0x83a5b7a5),
+            GHOST_UINT32_C(0xf90696d8), GHOST_UINT32_C(0x24433c60), GHOST_UINT32_C(0x4661b559), GHOST_UINT32_C(0x9b241fe1),
+            GHOST_UINT32_C(0x8224a72b), GHOST_UINT32_C(0x5f610d93), GHOST_UINT32_C(0x3d4384aa), GHOST_UINT32_C(0xe0062e12),
+            GHOST_UINT32_C(0x0f42f53e), GHOST_UINT32_C(0xd2075f86), GHOST_UINT32_C(0xb025d6bf), GHOST_UINT32_C(0x6d607c07),
+            GHOST_UINT32_C(0x7460c4cd), GHOST_UINT32_C(0xa9256e75), GHOST_UINT32_C(0xcb07e74c), GHOST_UINT32_C(0x16424df4),
+            GHOST_UINT32_C(0x106227e5), GHOST_UINT32_C(0xcd278d5d), GHOST_UINT32_C(0xaf050464), GHOST_UINT32_C(0x7240aedc),
+            GHOST_UINT32_C(0x6b401616), GHOST_UINT32_C(0xb605bcae), GHOST_UINT32_C(0xd4273597), GHOST_UINT32_C(0x09629f2f),
+            GHOST_UINT32_C(0xe6264403), GHOST_UINT32_C(0x3b63eebb), GHOST_UINT32_C(0x59416782), GHOST_UINT32_C(0x8404cd3a),
+            GHOST_UINT32_C(0x9d0475f0), GHOST_UINT32_C(0x4041df48), GHOST_UINT32_C(0x22635671), GHOST_UINT32_C(0xff26fcc9),
+            GHOST_UINT32_C(0x2e238253), GHOST_UINT32_C(0xf36628eb), GHOST_UINT32_C(0x9144a1d2), GHOST_UINT32_C(0x4c010b6a),
+            GHOST_UINT32_C(0x5501b3a0), GHOST_UINT32_C(0x88441918), GHOST_UINT32_C(0xea669021), GHOST_UINT32_C(0x37233a99),
+            GHOST_UINT32_C(0xd867e1b5), GHOST_UINT32_C(0x05224b0d), GHOST_UINT32_C(0x6700c234), GHOST_UINT32_C(0xba45688c),
+            GHOST_UINT32_C(0xa345d046), GHOST_UINT32_C(0x7e007afe), GHOST_UINT32_C(0x1c22f3c7), GHOST_UINT32_C(0xc167597f),
+            GHOST_UINT32_C(0xc747336e), GHOST_UINT32_C(0x1a0299d6), GHOST_UINT32_C(0x782010ef), GHOST_UINT32_C(0xa565ba57),
+            GHOST_UINT32_C(0xbc65029d), GHOST_UINT32_C(0x6120a825), GHOST_UINT32_C(0x0302211c), GHOST_UINT32_C(0xde478ba4),
+            GHOST_UINT32_C(0x31035088), GHOST_UINT32_C(0xec46fa30), GHOST_UINT32_C(0x8e647309), GHOST_UINT32_C(0x5321d9b1),
+            GHOST_UINT32_C(0x4a21617b), GHOST_UINT32_C(0x9764cbc3), GHOST_UINT32_C(0xf54642fa), GHOST_UINT32_C(0x2803e842)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0x38116fac), GHOST_UINT32_C(0x7022df58), GHOST_UINT32_C(0x4833b0f4),
+            GHOST_UINT32_C(0xe045beb0), GHOST_UINT32_C(0xd854d11c), GHOST_UINT32_C(0x906761e8), GHOST_UINT32_C(0xa8760e44),
+            GHOST_UINT32_C(0xc5670b91), GHOST_UINT32_C(0xfd76643d), GHOST_UINT32_C(0xb545d4c9), GHOST_UINT32_C(0x8d54bb65),
+            GHOST_UINT32_C(0x2522b521), GHOST_UINT32_C(0x1d33da8d), GHOST_UINT32_C(0x55006a79), GHOST_UINT32_C(0x6d1105d5),
+            GHOST_UINT32_C(0x8f2261d3), GHOST_UINT32_C(0xb7330e7f), GHOST_UINT32_C(0xff00be8b), GHOST_UINT32_C(0xc711d127),
+            GHOST_UINT32_C(0x6f67df63), GHOST_UINT32_C(0x5776b0cf), GHOST_UINT32_C(0x1f45003b), GHOST_UINT32_C(0x27546f97),
+            GHOST_UINT32_C(0x4a456a42), GHOST_UINT32_C(0x725405ee), GHOST_UINT32_C(0x3a67b51a), GHOST_UINT32_C(0x0276dab6),
+            GHOST_UINT32_C(0xaa00d4f2), GHOST_UINT32_C(0x9211bb5e), GHOST_UINT32_C(0xda220baa), GHOST_UINT32_C(0xe2336406),
+            GHOST_UINT32_C(0x1ba8b557), GHOST_UINT32_C(0x23b9dafb), GHOST_UINT32_C(0x6b8a6a0f), GHOST_UINT32_C(0x539b05a3),
+            GHOST_UINT32_C(0xfbed0be7), GHOST_UINT32_C(0xc3fc644b), GHOST_UINT32_C(0x8bcfd4bf), GHOST_UINT32_C(0xb3debb13),
+            GHOST_UINT32_C(0xdecfbec6), GHOST_UINT32_C(0xe6ded16a), GHOST_UINT32_C(0xaeed619e), GHOST_UINT32_C(0x96fc0e32),
+            GHOST_UINT32_C(0x3e8a0076), GHOST_UINT32_C(0x069b6fda), GHOST_UINT32_C(0x4ea8df2e), GHOST_UINT32_C(0x76b9b082),
+            GHOST_UINT32_C(0x948ad484), GHOST_UINT32_C(0xac9bbb28), GHOST_UINT32_C(0xe4a80bdc), GHOST_UINT32_C(0xdcb96470),
+            GHOST_UINT32_C(0x74cf6a34), GHOST_UINT32_C(0x4cde0598), GHOST_UINT32_C(0x04edb56c), GHOST_UINT32_C(0x3cfcdac0),
+            GHOST_UINT32_C(0x51eddf15), GHOST_UINT32_C(0x69fcb0b9), GHOST_UINT32_C(0x21cf004d), GHOST_UINT32_C(0x19de6fe1),
+            GHOST_UINT32_C(0xb1a861a5), GHOST_UINT32_C(0x89b90e09), GHOST_UINT32_C(0xc18abefd), GHOST_UINT32_C(0xf99bd151),
+            GHOST_UINT32_C(0x37516aae), GHOST_UINT32_C(0x0f400502), GHOST_UINT32_C(0x4773b5f6), GHOST_UINT32_C(0x7f62da5a),
+            GHOST_UINT32_C(0xd714d41e), GHOST_UINT32_C(0xef05bbb2), GHOST_UINT32_C(0xa7360b46), GHOST_UINT32_C(0x9f2764ea),
+            GHOST_UINT32_C(0xf236613f), GHOST_UINT32_C(0xca270e93), GHOST_UINT32_C(0x8214be67), GHOST_UINT32_C(0xba05d1cb),
+            GHOST_UINT32_C(0x1273df8f), GHOST_UINT32_C(0x2a62b023), GHOST_UINT32_C(0x625100d7), GHOST_UINT32_C(0x5a406f7b),
+            GHOST_UINT32_C(0xb8730b7d), GHOST_UINT32_C(0x806264d1), GHOST_UINT32_C(0xc851d425), GHOST_UINT32_C(0xf040bb89),
+            GHOST_UINT32_C(0x5836b5cd), GHOST_UINT32_C(0x6027da61), GHOST_UINT32_C(0x28146a95), GHOST_UINT32_C(0x10050539),
+            GHOST_UINT32_C(0x7d1400ec), GHOST_UINT32_C(0x45056f40), GHOST_UINT32_C(0x0d36dfb4), GHOST_UINT32_C(0x3527b018),
+            GHOST_UINT32_C(0x9d51be5c), GHOST_UINT32_C(0xa540d1f0), GHOST_UINT32_C(0xed736104), GHOST_UINT32_C(0xd5620ea8),
+            GHOST_UINT32_C(0x2cf9dff9), GHOST_UINT32_C(0x14e8b055), GHOST_UINT32_C(0x5cdb00a1), GHOST_UINT32_C(0x64ca6f0d),
+            GHOST_UINT32_C(0xccbc6149), GHOST_UINT32_C(0xf4ad0ee5), GHOST_UINT32_C(0xbc9ebe11), GHOST_UINT32_C(0x848fd1bd),
+            GHOST_UINT32_C(0xe99ed468), GHOST_UINT32_C(0xd18fbbc4), GHOST_UINT32_C(0x99bc0b30), GHOST_UINT32_C(0xa1ad649c),
+            GHOST_UINT32_C(0x09db6ad8), GHOST_UINT32_C(0x31ca0574), GHOST_UINT32_C(0x79f9b580), GHOST_UINT32_C(0x41e8da2c),
+            GHOST_UINT32_C(0xa3dbbe2a), GHOST_UINT32_C(0x9bcad186), GHOST_UINT32_C(0xd3f96172), GHOST_UINT32_C(0xebe80ede),
+            GHOST_UINT32_C(0x439e009a), GHOST_UINT32_C(0x7b8f6f36), GHOST_UINT32_C(0x33bcdfc2), GHOST_UINT32_C(0x0badb06e),
+            GHOST_UINT32_C(0x66bcb5bb), GHOST_UINT32_C(0x5eadda17), GHOST_UINT32_C(0x169e6ae3), GHOST_UINT32_C(0x2e8f054f),
+            GHOST_UINT32_C(0x86f90b0b), GHOST_UINT32_C(0xbee864a7), GHOST_UINT32_C(0xf6dbd453), GHOST_UINT32_C(0xcecabbff),
+            GHOST_UINT32_C(0x6ea2d55c), GHOST_UINT32_C(0x56b3baf0), GHOST_UINT32_C(0x1e800a04), GHOST_UINT32_C(0x269165a8),
+            GHOST_UINT32_C(0x8ee76bec), GHOST_UINT32_C(0xb6f60440), GHOST_UINT32_C(0xfec5b4b4), GHOST_UINT32_C(0xc6d4db18),
+            GHOST_UINT32_C(0xabc5decd), GHOST_UINT32_C(0x93d4b161), GHOST_UINT32_C(0xdbe70195), GHOST_UINT32_C(0xe3f66e39),
+            GHOST_UINT32_C(0x4b80607d), GHOST_UINT32_C(0x73910fd1), GHOST_UINT32_C(0x3ba2bf25), GHOST_UINT32_C(0x03b3d089),
+            GHOST_UINT32_C(0xe180b48f), GHOST_UINT32_C(0xd991db23), GHOST_UINT32_C(0x91a26bd7), GHOST_UINT32_C(0xa9b3047b),
+            GHOST_UINT32_C(0x01c50a3f), GHOST_UINT32_C(0x39d46593), GHOST_UINT32_C(0x71e7d567), GHOST_UINT32_C(0x49f6bacb),
+            GHOST_UINT32_C(0x24e7bf1e), GHOST_UINT32_C(0x1cf6d0b2), GHOST_UINT32_C(0x54c56046), GHOST_UINT32_C(0x6cd40fea),
+            GHOST_UINT32_C(0xc4a201ae), GHOST_UINT32_C(0xfcb36e02), GHOST_UINT32_C(0xb480def6), GHOST_UINT32_C(0x8c91b15a),
+            GHOST_UINT32_C(0x750a600b), GHOST_UINT32_C(0x4d1b0fa7), GHOST_UINT32_C(0x0528bf53), GHOST_UINT32_C(0x3d39d0ff),
+            GHOST_UINT32_C(0x954fdebb), GHOST_UINT32_C(0xad5eb117), GHOST_UINT32_C(0xe56d01e3), GHOST_UINT32_C(0xdd7c6e4f),
+            GHOST_UINT32_C(0xb06d6b9a), GHOST_UINT32_C(0x887c0436), GHOST_UINT32_C(0xc04fb4c2), GHOST_UINT32_C(0xf85edb6e),
+            GHOST_UINT32_C(0x5028d52a), GHOST_UINT32_C(0x6839ba86), GHOST_UINT32_C(0x200a0a72), GHOST_UINT32_C(0x181b65de),
+            GHOST_UINT32_C(0xfa2801d8), GHOST_UINT32_C(0xc2396e74), GHOST_UINT32_C(0x8a0ade80), GHOST_UINT32_C(0xb21bb12c),
+            GHOST_UINT32_C(0x1a6dbf68), GHOST_UINT32_C(0x227cd0c4), GHOST_UINT32_C(0x6a4f6030), GHOST_UINT32_C(0x525e0f9c),
+            GHOST_UINT32_C(0x3f4f0a49), GHOST_UINT32_C(0x075e65e5), GHOST_UINT32_C(0x4f6dd511), GHOST_UINT32_C(0x777cbabd),
+            GHOST_UINT32_C(0xdf0ab4f9), GHOST_UINT32_C(0xe71bdb55), GHOST_UINT32_C(0xaf286ba1), GHOST_UINT32_C(0x9739040d),
+            GHOST_UINT32_C(0x59f3bff2), GHOST_UINT32_C(0x61e2d05e), GHOST_UINT32_C(0x29d160aa), GHOST_UINT32_C(0x11c00f06),
+            GHOST_UINT32_C(0xb9b60142), GHOST_UINT32_C(0x81a76eee), GHOST_UINT32_C(0xc994de1a), GHOST_UINT32_C(0xf185b1b6),
+            GHOST_UINT32_C(0x9c94b463), GHOST_UINT32_C(0xa485dbcf), GHOST_UINT32_C(0xecb66b3b), GHOST_UINT32_C(0xd4a70497),
+            GHOST_UINT32_C(0x7cd10ad3), GHOST_UINT32_C(0x44c0657f), GHOST_UINT32_C(0x0cf3d58b), GHOST_UINT32_C(0x34e2ba27),
+            GHOST_UINT32_C(0xd6d1de21), GHOST_UINT32_C(0xeec0b18d), GHOST_UINT32_C(0xa6f30179), GHOST_UINT32_C(0x9ee26ed5),
+            GHOST_UINT32_C(0x36946091), GHOST_UINT32_C(0x0e850f3d), GHOST_UINT32_C(0x46b6bfc9), GHOST_UINT32_C(0x7ea7d065),
+            GHOST_UINT32_C(0x13b6d5b0), GHOST_UINT32_C(0x2ba7ba1c), GHOST_UINT32_C(0x63940ae8), GHOST_UINT32_C(0x5b856544),
+            GHOST_UINT32_C(0xf3f36b00), GHOST_UINT32_C(0xcbe204ac), GHOST_UINT32_C(0x83d1b458), GHOST_UINT32_C(0xbbc0dbf4),
+            GHOST_UINT32_C(0x425b0aa5), GHOST_UINT32_C(0x7a4a6509), GHOST_UINT32_C(0x3279d5fd), GHOST_UINT32_C(0x0a68ba51),
+            GHOST_UINT32_C(0xa21eb415), GHOST_UINT32_C(0x9a0fdbb9), GHOST_UINT32_C(0xd23c6b4d), GHOST_UINT32_C(0xea2d04e1),
+            GHOST_UINT32_C(0x873c0134), GHOST_UINT32_C(0xbf2d6e98), GHOST_UINT32_C(0xf71ede6c), GHOST_UINT32_C(0xcf0fb1c0),
+            GHOST_UINT32_C(0x6779bf84), GHOST_UINT32_C(0x5f68d028), GHOST_UINT32_C(0x175b60dc), GHOST_UINT32_C(0x2f4a0f70),
+            GHOST_UINT32_C(0xcd796b76), GHOST_UINT32_C(0xf56804da), GHOST_UINT32_C(0xbd5bb42e), GHOST_UINT32_C(0x854adb82),
+            GHOST_UINT32_C(0x2d3cd5c6), GHOST_UINT32_C(0x152dba6a), GHOST_UINT32_C(0x5d1e0a9e), GHOST_UINT32_C(0x650f6532),
+            GHOST_UINT32_C(0x081e60e7), GHOST_UINT32_C(0x300f0f4b), GHOST_UINT32_C(0x783cbfbf), GHOST_UINT32_C(0x402dd013),
+            GHOST_UINT32_C(0xe85bde57), GHOST_UINT32_C(0xd04ab1fb), GHOST_UINT32_C(0x9879010f), GHOST_UINT32_C(0xa0686ea3)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0xef306b19), GHOST_UINT32_C(0xdb8ca0c3), GHOST_UINT32_C(0x34bccbda),
+            GHOST_UINT32_C(0xb2f53777), GHOST_UINT32_C(0x5dc55c6e), GHOST_UINT32_C(0x697997b4), GHOST_UINT32_C(0x8649fcad),
+            GHOST_UINT32_C(0x6006181f), GHOST_UINT32_C(0x8f367306), GHOST_UINT32_C(0xbb8ab8dc), GHOST_UINT32_C(0x54bad3c5),
+            GHOST_UINT32_C(0xd2f32f68), GHOST_UINT32_C(0x3dc34471), GHOST_UINT32_C(0x097f8fab), GHOST_UINT32_C(0xe64fe4b2),
+            GHOST_UINT32_C(0xc00c303e), GHOST_UINT32_C(0x2f3c5b27), GHOST_UINT32_C(0x1b8090fd), GHOST_UINT32_C(0xf4b0fbe4),
+            GHOST_UINT32_C(0x72f90749), GHOST_UINT32_C(0x9dc96c50), GHOST_UINT32_C(0xa975a78a), GHOST_UINT32_C(0x4645cc93),
+            GHOST_UINT32_C(0xa00a2821), GHOST_UINT32_C(0x4f3a4338), GHOST_UINT32_C(0x7b8688e2), GHOST_UINT32_C(0x94b6e3fb),
+            GHOST_UINT32_C(0x12ff1f56), GHOST_UINT32_C(0xfdcf744f), GHOST_UINT32_C(0xc973bf95), GHOST_UINT32_C(0x2643d48c),
+            GHOST_UINT32_C(0x85f4168d), GHOST_UINT32_C(0x6ac47d94), GHOST_UINT32_C(0x5e78b64e), GHOST_UINT32_C(0xb148dd57),
+            GHOST_UINT32_C(0x370121fa), GHOST_UINT32_C(0xd8314ae3), GHOST_UINT32_C(0xec8d8139), GHOST_UINT32_C(0x03bdea20),
+            GHOST_UINT32_C(0xe5f20e92), GHOST_UINT32_C(0x0ac2658b), GHOST_UINT32_C(0x3e7eae51), GHOST_UINT32_C(0xd14ec548),
+            GHOST_UINT32_C(0x570739e5), GHOST_UINT32_C(0xb83752fc), GHOST_UINT32_C(0x8c8b9926), GHOST_UINT32_C(0x63bbf23f),
+            GHOST_UINT32_C(0x45f826b3), GHOST_UINT32_C(0xaac84daa), GHOST_UINT32_C(0x9e748670), GHOST_UINT32_C(0x7144ed69),
+            GHOST_UINT32_C(0xf70d11c4), GHOST_UINT32_C(0x183d7add), GHOST_UINT32_C(0x2c81b107), GHOST_UINT32_C(0xc3b1da1e),
+            GHOST_UINT32_C(0x25fe3eac), GHOST_UINT32_C(0xcace55b5), GHOST_UINT32_C(0xfe729e6f), GHOST_UINT32_C(0x1142f576),
+            GHOST_UINT32_C(0x970b09db), GHOST_UINT32_C(0x783b62c2), GHOST_UINT32_C(0x4c87a918), GHOST_UINT32_C(0xa3b7c201),
+            GHOST_UINT32_C(0x0e045beb), GHOST_UINT32_C(0xe13430f2), GHOST_UINT32_C(0xd588fb28), GHOST_UINT32_C(0x3ab89031),
+            GHOST_UINT32_C(0xbcf16c9c), GHOST_UINT32_C(0x53c10785), GHOST_UINT32_C(0x677dcc5f), GHOST_UINT32_C(0x884da746),
+            GHOST_UINT32_C(0x6e0243f4), GHOST_UINT32_C(0x813228ed), GHOST_UINT32_C(0xb58ee337), GHOST_UINT32_C(0x5abe882e),
+            GHOST_UINT32_C(0xdcf77483), GHOST_UINT32_C(0x33c71f9a), GHOST_UINT32_C(0x077bd440), GHOST_UINT32_C(0xe84bbf59),
+            GHOST_UINT32_C(0xce086bd5), GHOST_UINT32_C(0x213800cc), GHOST_UINT32_C(0x1584cb16), GHOST_UINT32_C(0xfab4a00f),
+            GHOST_UINT32_C(0x7cfd5ca2), GHOST_UINT32_C(0x93cd37bb), GHOST_UINT32_C(0xa771fc61), GHOST_UINT32_C(0x48419778),
+            GHOST_UINT32_C(0xae0e73ca), GHOST_UINT32_C(0x413e18d3), GHOST_UINT32_C(0x7582d309), GHOST_UINT32_C(0x9ab2b810),
+            GHOST_UINT32_C(0x1cfb44bd), GHOST_UINT32_C(0xf3cb2fa4), GHOST_UINT32_C(0xc777e47e), GHOST_UINT32_C(0x28478f67),
+            GHOST_UINT32_C(0x8bf04d66), GHOST_UINT32_C(0x64c0267f), GHOST_UINT32_C(0x507ceda5), GHOST_UINT32_C(0xbf4c86bc),
+            GHOST_UINT32_C(0x39057a11), GHOST_UINT32_C(0xd6351108), GHOST_UINT32_C(0xe289dad2), GHOST_UINT32_C(0x0db9b1cb),
+            GHOST_UINT32_C(0xebf65579), GHOST_UINT32_C(0x04c63e60), GHOST_UINT32_C(0x307af5ba), GHOST_UINT32_C(0xdf4a9ea3),
+            GHOST_UINT32_C(0x5903620e), GHOST_UINT32_C(0xb6330917), GHOST_UINT32_C(0x828fc2cd), GHOST_UINT32_C(0x6dbfa9d4),
+            GHOST_UINT32_C(0x4bfc7d58), GHOST_UINT32_C(0xa4cc1641), GHOST_UINT32_C(0x9070dd9b), GHOST_UINT32_C(0x7f40b682),
+            GHOST_UINT32_C(0xf9094a2f), GHOST_UINT32_C(0x16392136), GHOST_UINT32_C(0x2285eaec), GHOST_UINT32_C(0xcdb581f5),
+            GHOST_UINT32_C(0x2bfa6547), GHOST_UINT32_C(0xc4ca0e5e), GHOST_UINT32_C(0xf076c584), GHOST_UINT32_C(0x1f46ae9d),
+            GHOST_UINT32_C(0x990f5230), GHOST_UINT32_C(0x763f3929), GHOST_UINT32_C(0x4283f2f3), GHOST_UINT32_C(0xadb399ea),
+            GHOST_UINT32_C(0x1c08b7d6), GHOST_UINT32_C(0xf338dccf), GHOST_UINT32_C(0xc7841715), GHOST_UINT32_C(0x28b47c0c),
+            GHOST_UINT32_C(0xaefd80a1), GHOST_UINT32_C(0x41cdebb8), GHOST_UINT32_C(0x75712062), GHOST_UINT32_C(0x9a414b7b),
+            GHOST_UINT32_C(0x7c0eafc9), GHOST_UINT32_C(0x933ec4d0), GHOST_UINT32_C(0xa7820f0a), GHOST_UINT32_C(0x48b26413),
+            GHOST_UINT32_C(0xcefb98be), GHOST_UINT32_C(0x21cbf3a7), GHOST_UINT32_C(0x1577387d), GHOST_UINT32_C(0xfa475364),
+            GHOST_UINT32_C(0xdc0487e8), GHOST_UINT32_C(0x3334ecf1), GHOST_UINT32_C(0x0788272b), GHOST_UINT32_C(0xe8b84c32),
+            GHOST_UINT32_C(0x6ef1b09f), GHOST_UINT32_C(0x81c1db86), GHOST_UINT32_C(0xb57d105c), GHOST_UINT32_C(0x5a4d7b45),
+            GHOST_UINT32_C(0xbc029ff7), GHOST_UINT32_C(0x5332f4ee), GHOST_UINT32_C(0x678e3f34), GHOST_UINT32_C(0x88be542d),
+            GHOST_UINT32_C(0x0ef7a880), GHOST_UINT32_C(0xe1c7c399), GHOST_UINT32_C(0xd57b0843), GHOST_UINT32_C(0x3a4b635a),
+            GHOST_UINT32_C(0x99fca15b), GHOST_UINT32_C(0x76ccca42), GHOST_UINT32_C(0x42700198), GHOST_UINT32_C(0xad406a81),
+            GHOST_UINT32_C(0x2b09962c), GHOST_UINT32_C(0xc439fd35), GHOST_UINT32_C(0xf08536ef), GHOST_UINT32_C(0x1fb55df6),
+            GHOST_UINT32_C(0xf9fab944), GHOST_UINT32_C(0x16cad25d), GHOST_UINT32_C(0x22761987), GHOST_UINT32_C(0xcd46729e),
+            GHOST_UINT32_C(0x4b0f8e33), GHOST_UINT32_C(0xa43fe52a), GHOST_UINT32_C(0x90832ef0), GHOST_UINT32_C(0x7fb345e9),
+            GHOST_UINT32_C(0x59f09165), GHOST_UINT32_C(0xb6c0fa7c), GHOST_UINT32_C(0x827c31a6), GHOST_UINT32_C(0x6d4c5abf),
+            GHOST_UINT32_C(0xeb05a612), GHOST_UINT32_C(0x0435cd0b), GHOST_UINT32_C(0x308906d1), GHOST_UINT32_C(0xdfb96dc8),
+            GHOST_UINT32_C(0x39f6897a), GHOST_UINT32_C(0xd6c6e263), GHOST_UINT32_C(0xe27a29b9), GHOST_UINT32_C(0x0d4a42a0),
+            GHOST_UINT32_C(0x8b03be0d), GHOST_UINT32_C(0x6433d514), GHOST_UINT32_C(0x508f1ece), GHOST_UINT32_C(0xbfbf75d7),
+            GHOST_UINT32_C(0x120cec3d), GHOST_UINT32_C(0xfd3c8724), GHOST_UINT32_C(0xc9804cfe), GHOST_UINT32_C(0x26b027e7),
+            GHOST_UINT32_C(0xa0f9db4a), GHOST_UINT32_C(0x4fc9b053), GHOST_UINT32_C(0x7b757b89), GHOST_UINT32_C(0x94451090),
+            GHOST_UINT32_C(0x720af422), GHOST_UINT32_C(0x9d3a9f3b), GHOST_UINT32_C(0xa98654e1), GHOST_UINT32_C(0x46b63ff8),
+            GHOST_UINT32_C(0xc0ffc355), GHOST_UINT32_C(0x2fcfa84c), GHOST_UINT32_C(0x1b736396), GHOST_UINT32_C(0xf443088f),
+            GHOST_UINT32_C(0xd200dc03), GHOST_UINT32_C(0x3d30b71a), GHOST_UINT32_C(0x098c7cc0), GHOST_UINT32_C(0xe6bc17d9),
+            GHOST_UINT32_C(0x60f5eb74), GHOST_UINT32_C(0x8fc5806d), GHOST_UINT32_C(0xbb794bb7), GHOST_UINT32_C(0x544920ae),
+            GHOST_UINT32_C(0xb206c41c), GHOST_UINT32_C(0x5d36af05), GHOST_UINT32_C(0x698a64df), GHOST_UINT32_C(0x86ba0fc6),
+            GHOST_UINT32_C(0x00f3f36b), GHOST_UINT32_C(0xefc39872), GHOST_UINT32_C(0xdb7f53a8), GHOST_UINT32_C(0x344f38b1),
+            GHOST_UINT32_C(0x97f8fab0), GHOST_UINT32_C(0x78c891a9), GHOST_UINT32_C(0x4c745a73), GHOST_UINT32_C(0xa344316a),
+            GHOST_UINT32_C(0x250dcdc7), GHOST_UINT32_C(0xca3da6de), GHOST_UINT32_C(0xfe816d04), GHOST_UINT32_C(0x11b1061d),
+            GHOST_UINT32_C(0xf7fee2af), GHOST_UINT32_C(0x18ce89b6), GHOST_UINT32_C(0x2c72426c), GHOST_UINT32_C(0xc3422975),
+            GHOST_UINT32_C(0x450bd5d8), GHOST_UINT32_C(0xaa3bbec1), GHOST_UINT32_C(0x9e87751b), GHOST_UINT32_C(0x71b71e02),
+            GHOST_UINT32_C(0x57f4ca8e), GHOST_UINT32_C(0xb8c4a197), GHOST_UINT32_C(0x8c786a4d), GHOST_UINT32_C(0x63480154),
+            GHOST_UINT32_C(0xe501fdf9), GHOST_UINT32_C(0x0a3196e0), GHOST_UINT32_C(0x3e8d5d3a), GHOST_UINT32_C(0xd1bd3623),
+            GHOST_UINT32_C(0x37f2d291), GHOST_UINT32_C(0xd8c2b988), GHOST_UINT32_C(0xec7e7252), GHOST_UINT32_C(0x034e194b),
+            GHOST_UINT32_C(0x8507e5e6), GHOST_UINT32_C(0x6a378eff), GHOST_UINT32_C(0x5e8b4525), GHOST_UINT32_C(0xb1bb2e3c)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0x68032cc8), GHOST_UINT32_C(0xd0065990), GHOST_UINT32_C(0xb8057558),
+            GHOST_UINT32_C(0xa5e0c5d1), GHOST_UINT32_C(0xcde3e919), GHOST_UINT32_C(0x75e69c41), GHOST_UINT32_C(0x1de5b089),
+            GHOST_UINT32_C(0x4e2dfd53), GHOST_UINT32_C(0x262ed19b), GHOST_UINT32_C(0x9e2ba4c3), GHOST_UINT32_C(0xf628880b),
+            GHOST_UINT32_C(0xebcd3882), GHOST_UINT32_C(0x83ce144a), GHOST_UINT32_C(0x3bcb6112), GHOST_UINT32_C(0x53c84dda),
+            GHOST_UINT32_C(0x9c5bfaa6), GHOST_UINT32_C(0xf458d66e), GHOST_UINT32_C(0x4c5da336), GHOST_UINT32_C(0x245e8ffe),
+            GHOST_UINT32_C(0x39bb3f77), GHOST_UINT32_C(0x51b813bf), GHOST_UINT32_C(0xe9bd66e7), GHOST_UINT32_C(0x81be4a2f),
+            GHOST_UINT32_C(0xd27607f5), GHOST_UINT32_C(0xba752b3d), GHOST_UINT32_C(0x02705e65), GHOST_UINT32_C(0x6a7372ad),
+            GHOST_UINT32_C(0x7796c224), GHOST_UINT32_C(0x1f95eeec), GHOST_UINT32_C(0xa7909bb4), GHOST_UINT32_C(0xcf93b77c),
+            GHOST_UINT32_C(0x3d5b83bd), GHOST_UINT32_C(0x5558af75), GHOST_UINT32_C(0xed5dda2d), GHOST_UINT32_C(0x855ef6e5),
+            GHOST_UINT32_C(0x98bb466c), GHOST_UINT32_C(0xf0b86aa4), GHOST_UINT32_C(0x48bd1ffc), GHOST_UINT32_C(0x20be3334),
+            GHOST_UINT32_C(0x73767eee), GHOST_UINT32_C(0x1b755226), GHOST_UINT32_C(0xa370277e), GHOST_UINT32_C(0xcb730bb6),
+            GHOST_UINT32_C(0xd696bb3f), GHOST_UINT32_C(0xbe9597f7), GHOST_UINT32_C(0x0690e2af), GHOST_UINT32_C(0x6e93ce67),
+            GHOST_UINT32_C(0xa100791b), GHOST_UINT32_C(0xc90355d3), GHOST_UINT32_C(0x7106208b), GHOST_UINT32_C(0x19050c43),
+            GHOST_UINT32_C(0x04e0bcca), GHOST_UINT32_C(0x6ce39002), GHOST_UINT32_C(0xd4e6e55a), GHOST_UINT32_C(0xbce5c992),
+            GHOST_UINT32_C(0xef2d8448), GHOST_UINT32_C(0x872ea880), GHOST_UINT32_C(0x3f2bddd8), GHOST_UINT32_C(0x5728f110),
+            GHOST_UINT32_C(0x4acd4199), GHOST_UINT32_C(0x22ce6d51), GHOST_UINT32_C(0x9acb1809), GHOST_UINT32_C(0xf2c834c1),
+            GHOST_UINT32_C(0x7ab7077a), GHOST_UINT32_C(0x12b42bb2), GHOST_UINT32_C(0xaab15eea), GHOST_UINT32_C(0xc2b27222),
+            GHOST_UINT32_C(0xdf57c2ab), GHOST_UINT32_C(0xb754ee63), GHOST_UINT32_C(0x0f519b3b), GHOST_UINT32_C(0x6752b7f3),
+            GHOST_UINT32_C(0x349afa29), GHOST_UINT32_C(0x5c99d6e1), GHOST_UINT32_C(0xe49ca3b9), GHOST_UINT32_C(0x8c9f8f71),
+            GHOST_UINT32_C(0x917a3ff8), GHOST_UINT32_C(0xf9791330), GHOST_UINT32_C(0x417c6668), GHOST_UINT32_C(0x297f4aa0),
+            GHOST_UINT32_C(0xe6ecfddc), GHOST_UINT32_C(0x8eefd114), GHOST_UINT32_C(0x36eaa44c), GHOST_UINT32_C(0x5ee98884),
+            GHOST_UINT32_C(0x430c380d), GHOST_UINT32_C(0x2b0f14c5), GHOST_UINT32_C(0x930a619d), GHOST_UINT32_C(0xfb094d55),
+            GHOST_UINT32_C(0xa8c1008f), GHOST_UINT32_C(0xc0c22c47), GHOST_UINT32_C(0x78c7591f), GHOST_UINT32_C(0x10c475d7),
+            GHOST_UINT32_C(0x0d21c55e), GHOST_UINT32_C(0x6522e996), GHOST_UINT32_C(0xdd279cce), GHOST_UINT32_C(0xb524b006),
+            GHOST_UINT32_C(0x47ec84c7), GHOST_UINT32_C(0x2fefa80f), GHOST_UINT32_C(0x97eadd57), GHOST_UINT32_C(0xffe9f19f),
+            GHOST_UINT32_C(0xe20c4116), GHOST_UINT32_C(0x8a0f6dde), GHOST_UINT32_C(0x320a1886), GHOST_UINT32_C(0x5a09344e),
+            GHOST_UINT32_C(0x09c17994), GHOST_UINT32_C(0x61c2555c), GHOST_UINT32_C(0xd9c72004), GHOST_UINT32_C(0xb1c40ccc),
+            GHOST_UINT32_C(0xac21bc45), GHOST_UINT32_C(0xc422908d), GHOST_UINT32_C(0x7c27e5d5), GHOST_UINT32_C(0x1424c91d),
+            GHOST_UINT32_C(0xdbb77e61), GHOST_UINT32_C(0xb3b452a9), GHOST_UINT32_C(0x0bb127f1), GHOST_UINT32_C(0x63b20b39),
+            GHOST_UINT32_C(0x7e57bbb0), GHOST_UINT32_C(0x16549778), GHOST_UINT32_C(0xae51e220), GHOST_UINT32_C(0xc652cee8),
+            GHOST_UINT32_C(0x959a8332), GHOST_UINT32_C(0xfd99affa), GHOST_UINT32_C(0x459cdaa2), GHOST_UINT32_C(0x2d9ff66a),
+            GHOST_UINT32_C(0x307a46e3), GHOST_UINT32_C(0x58796a2b), GHOST_UINT32_C(0xe07c1f73), GHOST_UINT32_C(0x887f33bb),
+            GHOST_UINT32_C(0xf56e0ef4), GHOST_UINT32_C(0x9d6d223c), GHOST_UINT32_C(0x25685764), GHOST_UINT32_C(0x4d6b7bac),
+            GHOST_UINT32_C(0x508ecb25), GHOST_UINT32_C(0x388de7ed), GHOST_UINT32_C(0x808892b5), GHOST_UINT32_C(0xe88bbe7d),
+            GHOST_UINT32_C(0xbb43f3a7), GHOST_UINT32_C(0xd340df6f), GHOST_UINT32_C(0x6b45aa37), GHOST_UINT32_C(0x034686ff),
+            GHOST_UINT32_C(0x1ea33676), GHOST_UINT32_C(0x76a01abe), GHOST_UINT32_C(0xcea56fe6), GHOST_UINT32_C(0xa6a6432e),
+            GHOST_UINT32_C(0x6935f452), GHOST_UINT32_C(0x0136d89a), GHOST_UINT32_C(0xb933adc2), GHOST_UINT32_C(0xd130810a),
+            GHOST_UINT32_C(0xccd53183), GHOST_UINT32_C(0xa4d61d4b), GHOST_UINT32_C(0x1cd36813), GHOST_UINT32_C(0x74d044db),
+            GHOST_UINT32_C(0x27180901), GHOST_UINT32_C(0x4f1b25c9), GHOST_UINT32_C(0xf71e5091), GHOST_UINT32_C(0x9f1d7c59),
+            GHOST_UINT32_C(0x82f8ccd0), GHOST_UINT32_C(0xeafbe018), GHOST_UINT32_C(0x52fe9540), GHOST_UINT32_C(0x3afdb988),
+            GHOST_UINT32_C(0xc8358d49), GHOST_UINT32_C(0xa036a181), GHOST_UINT32_C(0x1833d4d9), GHOST_UINT32_C(0x7030f811),
+            GHOST_UINT32_C(0x6dd54898), GHOST_UINT32_C(0x05d66450), GHOST_UINT32_C(0xbdd31108), GHOST_UINT32_C(0xd5d03dc0),
+            GHOST_UINT32_C(0x8618701a), GHOST_UINT32_C(0xee1b5cd2), GHOST_UINT32_C(0x561e298a), GHOST_UINT32_C(0x3e1d0542),
+            GHOST_UINT32_C(0x23f8b5cb), GHOST_UINT32_C(0x4bfb9903), GHOST_UINT32_C(0xf3feec5b), GHOST_UINT32_C(0x9bfdc093),
+            GHOST_UINT32_C(0x546e77ef), GHOST_UINT32_C(0x3c6d5b27), GHOST_UINT32_C(0x84682e7f), GHOST_UINT32_C(0xec6b02b7),
+            GHOST_UINT32_C(0xf18eb23e), GHOST_UINT32_C(0x998d9ef6), GHOST_UINT32_C(0x2188ebae), GHOST_UINT32_C(0x498bc766),
+            GHOST_UINT32_C(0x1a438abc), GHOST_UINT32_C(0x7240a674), GHOST_UINT32_C(0xca45d32c), GHOST_UINT32_C(0xa246ffe4),
+            GHOST_UINT32_C(0xbfa34f6d), GHOST_UINT32_C(0xd7a063a5), GHOST_UINT32_C(0x6fa516fd), GHOST_UINT32_C(0x07a63a35),
+            GHOST_UINT32_C(0x8fd9098e), GHOST_UINT32_C(0xe7da2546), GHOST_UINT32_C(0x5fdf501e), GHOST_UINT32_C(0x37dc7cd6),
+            GHOST_UINT32_C(0x2a39cc5f), GHOST_UINT32_C(0x423ae097), GHOST_UINT32_C(0xfa3f95cf), GHOST_UINT32_C(0x923cb907),
+            GHOST_UINT32_C(0xc1f4f4dd), GHOST_UINT32_C(0xa9f7d815), GHOST_UINT32_C(0x11f2ad4d), GHOST_UINT32_C(0x79f18185),
+            GHOST_UINT32_C(0x6414310c), GHOST_UINT32_C(0x0c171dc4), GHOST_UINT32_C(0xb412689c), GHOST_UINT32_C(0xdc114454),
+            GHOST_UINT32_C(0x1382f328), GHOST_UINT32_C(0x7b81dfe0), GHOST_UINT32_C(0xc384aab8), GHOST_UINT32_C(0xab878670),
+            GHOST_UINT32_C(0xb66236f9), GHOST_UINT32_C(0xde611a31), GHOST_UINT32_C(0x66646f69), GHOST_UINT32_C(0x0e6743a1),
+            GHOST_UINT32_C(0x5daf0e7b), GHOST_UINT32_C(0x35ac22b3), GHOST_UINT32_C(0x8da957eb), GHOST_UINT32_C(0xe5aa7b23),
+            GHOST_UINT32_C(0xf84fcbaa), GHOST_UINT32_C(0x904ce762), GHOST_UINT32_C(0x2849923a), GHOST_UINT32_C(0x404abef2),
+            GHOST_UINT32_C(0xb2828a33), GHOST_UINT32_C(0xda81a6fb), GHOST_UINT32_C(0x6284d3a3), GHOST_UINT32_C(0x0a87ff6b),
+            GHOST_UINT32_C(0x17624fe2), GHOST_UINT32_C(0x7f61632a), GHOST_UINT32_C(0xc7641672), GHOST_UINT32_C(0xaf673aba),
+            GHOST_UINT32_C(0xfcaf7760), GHOST_UINT32_C(0x94ac5ba8), GHOST_UINT32_C(0x2ca92ef0), GHOST_UINT32_C(0x44aa0238),
+            GHOST_UINT32_C(0x594fb2b1), GHOST_UINT32_C(0x314c9e79), GHOST_UINT32_C(0x8949eb21), GHOST_UINT32_C(0xe14ac7e9),
+            GHOST_UINT32_C(0x2ed97095), GHOST_UINT32_C(0x46da5c5d), GHOST_UINT32_C(0xfedf2905), GHOST_UINT32_C(0x96dc05cd),
+            GHOST_UINT32_C(0x8b39b544), GHOST_UINT32_C(0xe33a998c), GHOST_UINT32_C(0x5b3fecd4), GHOST_UINT32_C(0x333cc01c),
+            GHOST_UINT32_C(0x60f48dc6), GHOST_UINT32_C(0x08f7a10e), GHOST_UINT32_C(0xb0f2d456), GHOST_UINT32_C(0xd8f1f89e),
+            GHOST_UINT32_C(0xc5144817), GHOST_UINT32_C(0xad1764df), GHOST_UINT32_C(0x15121187), GHOST_UINT32_C(0x7d113d4f)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0x493c7d27), GHOST_UINT32_C(0x9278fa4e), GHOST_UINT32_C(0xdb448769),
+            GHOST_UINT32_C(0x211d826d), GHOST_UINT32_C(0x6821ff4a), GHOST_UINT32_C(0xb3657823), GHOST_UINT32_C(0xfa590504),
+            GHOST_UINT32_C(0x423b04da), GHOST_UINT32_C(0x0b0779fd), GHOST_UINT32_C(0xd043fe94), GHOST_UINT32_C(0x997f83b3),
+            GHOST_UINT32_C(0x632686b7), GHOST_UINT32_C(0x2a1afb90), GHOST_UINT32_C(0xf15e7cf9), GHOST_UINT32_C(0xb86201de),
+            GHOST_UINT32_C(0x847609b4), GHOST_UINT32_C(0xcd4a7493), GHOST_UINT32_C(0x160ef3fa), GHOST_UINT32_C(0x5f328edd),
+            GHOST_UINT32_C(0xa56b8bd9), GHOST_UINT32_C(0xec57f6fe), GHOST_UINT32_C(0x37137197), GHOST_UINT32_C(0x7e2f0cb0),
+            GHOST_UINT32_C(0xc64d0d6e), GHOST_UINT32_C(0x8f717049), GHOST_UINT32_C(0x5435f720), GHOST_UINT32_C(0x1d098a07),
+            GHOST_UINT32_C(0xe7508f03), GHOST_UINT32_C(0xae6cf224), GHOST_UINT32_C(0x7528754d), GHOST_UINT32_C(0x3c14086a),
+            GHOST_UINT32_C(0x0d006599), GHOST_UINT32_C(0x443c18be), GHOST_UINT32_C(0x9f789fd7), GHOST_UINT32_C(0xd644e2f0),
+            GHOST_UINT32_C(0x2c1de7f4), GHOST_UINT32_C(0x65219ad3), GHOST_UINT32_C(0xbe651dba), GHOST_UINT32_C(0xf759609d),
+            GHOST_UINT32_C(0x4f3b6143), GHOST_UINT32_C(0x06071c64), GHOST_UINT32_C(0xdd439b0d), GHOST_UINT32_C(0x947fe62a),
+            GHOST_UINT32_C(0x6e26e32e), GHOST_UINT32_C(0x271a9e09), GHOST_UINT32_C(0xfc5e1960), GHOST_UINT32_C(0xb5626447),
+            GHOST_UINT32_C(0x89766c2d), GHOST_UINT32_C(0xc04a110a), GHOST_UINT32_C(0x1b0e9663), GHOST_UINT32_C(0x5232eb44),
+            GHOST_UINT32_C(0xa86bee40), GHOST_UINT32_C(0xe1579367), GHOST_UINT32_C(0x3a13140e), GHOST_UINT32_C(0x732f6929),
+            GHOST_UINT32_C(0xcb4d68f7), GHOST_UINT32_C(0x827115d0), GHOST_UINT32_C(0x593592b9), GHOST_UINT32_C(0x1009ef9e),
+            GHOST_UINT32_C(0xea50ea9a), GHOST_UINT32_C(0xa36c97bd), GHOST_UINT32_C(0x782810d4), GHOST_UINT32_C(0x31146df3),
+            GHOST_UINT32_C(0x1a00cb32), GHOST_UINT32_C(0x533cb615), GHOST_UINT32_C(0x8878317c), GHOST_UINT32_C(0xc1444c5b),
+            GHOST_UINT32_C(0x3b1d495f), GHOST_UINT32_C(0x72213478), GHOST_UINT32_C(0xa965b311), GHOST_UINT32_C(0xe059ce36),
+            GHOST_UINT32_C(0x583bcfe8), GHOST_UINT32_C(0x1107b2cf), GHOST_UINT32_C(0xca4335a6), GHOST_UINT32_C(0x837f4881),
+            GHOST_UINT32_C(0x79264d85), GHOST_UINT32_C(0x301a30a2), GHOST_UINT32_C(0xeb5eb7cb), GHOST_UINT32_C(0xa262caec),
+            GHOST_UINT32_C(0x9e76c286), GHOST_UINT32_C(0xd74abfa1), GHOST_UINT32_C(0x0c0e38c8), GHOST_UINT32_C(0x453245ef),
+            GHOST_UINT32_C(0xbf6b40eb), GHOST_UINT32_C(0xf6573dcc), GHOST_UINT32_C(0x2d13baa5), GHOST_UINT32_C(0x642fc782),
+            GHOST_UINT32_C(0xdc4dc65c), GHOST_UINT32_C(0x9571bb7b), GHOST_UINT32_C(0x4e353c12), GHOST_UINT32_C(0x07094135),
+            GHOST_UINT32_C(0xfd504431), GHOST_UINT32_C(0xb46c3916), GHOST_UINT32_C(0x6f28be7f), GHOST_UINT32_C(0x2614c358),
+            GHOST_UINT32_C(0x1700aeab), GHOST_UINT32_C(0x5e3cd38c), GHOST_UINT32_C(0x857854e5), GHOST_UINT32_C(0xcc4429c2),
+            GHOST_UINT32_C(0x361d2cc6), GHOST_UINT32_C(0x7f2151e1), GHOST_UINT32_C(0xa465d688), GHOST_UINT32_C(0xed59abaf),
+            GHOST_UINT32_C(0x553baa71), GHOST_UINT32_C(0x1c07d756), GHOST_UINT32_C(0xc743503f), GHOST_UINT32_C(0x8e7f2d18),
+            GHOST_UINT32_C(0x7426281c), GHOST_UINT32_C(0x3d1a553b), GHOST_UINT32_C(0xe65ed252), GHOST_UINT32_C(0xaf62af75),
+            GHOST_UINT32_C(0x9376a71f), GHOST_UINT32_C(0xda4ada38), GHOST_UINT32_C(0x010e5d51), GHOST_UINT32_C(0x48322076),
+            GHOST_UINT32_C(0xb26b2572), GHOST_UINT32_C(0xfb575855), GHOST_UINT32_C(0x2013df3c), GHOST_UINT32_C(0x692fa21b),
+            GHOST_UINT32_C(0xd14da3c5), GHOST_UINT32_C(0x9871dee2), GHOST_UINT32_C(0x4335598b), GHOST_UINT32_C(0x0a0924ac),
+            GHOST_UINT32_C(0xf05021a8), GHOST_UINT32_C(0xb96c5c8f), GHOST_UINT32_C(0x6228dbe6), GHOST_UINT32_C(0x2b14a6c1),
+            GHOST_UINT32_C(0x34019664), GHOST_UINT32_C(0x7d3deb43), GHOST_UINT32_C(0xa6796c2a), GHOST_UINT32_C(0xef45110d),
+            GHOST_UINT32_C(0x151c1409), GHOST_UINT32_C(0x5c20692e), GHOST_UINT32_C(0x8764ee47), GHOST_UINT32_C(0xce589360),
+            GHOST_UINT32_C(0x763a92be), GHOST_UINT32_C(0x3f06ef99), GHOST_UINT32_C(0xe44268f0), GHOST_UINT32_C(0xad7e15d7),
+            GHOST_UINT32_C(0x572710d3), GHOST_UINT32_C(0x1e1b6df4), GHOST_UINT32_C(0xc55fea9d), GHOST_UINT32_C(0x8c6397ba),
+            GHOST_UINT32_C(0xb0779fd0), GHOST_UINT32_C(0xf94be2f7), GHOST_UINT32_C(0x220f659e), GHOST_UINT32_C(0x6b3318b9),
+            GHOST_UINT32_C(0x916a1dbd), GHOST_UINT32_C(0xd856609a), GHOST_UINT32_C(0x0312e7f3), GHOST_UINT32_C(0x4a2e9ad4),
+            GHOST_UINT32_C(0xf24c9b0a), GHOST_UINT32_C(0xbb70e62d), GHOST_UINT32_C(0x60346144), GHOST_UINT32_C(0x29081c63),
+            GHOST_UINT32_C(0xd3511967), GHOST_UINT32_C(0x9a6d6440), GHOST_UINT32_C(0x4129e329), GHOST_UINT32_C(0x08159e0e),
+            GHOST_UINT32_C(0x3901f3fd), GHOST_UINT32_C(0x703d8eda), GHOST_UINT32_C(0xab7909b3), GHOST_UINT32_C(0xe2457494),
+            GHOST_UINT32_C(0x181c7190), GHOST_UINT32_C(0x51200cb7), GHOST_UINT32_C(0x8a648bde), GHOST_UINT32_C(0xc358f6f9),
+            GHOST_UINT32_C(0x7b3af727), GHOST_UINT32_C(0x32068a00), GHOST_UINT32_C(0xe9420d69), GHOST_UINT32_C(0xa07e704e),
+            GHOST_UINT32_C(0x5a27754a), GHOST_UINT32_C(0x131b086d), GHOST_UINT32_C(0xc85f8f04), GHOST_UINT32_C(0x8163f223),
+            GHOST_UINT32_C(0xbd77fa49), GHOST_UINT32_C(0xf44b876e), GHOST_UINT32_C(0x2f0f0007), GHOST_UINT32_C(0x66337d20),
+            GHOST_UINT32_C(0x9c6a7824), GHOST_UINT32_C(0xd5560503), GHOST_UINT32_C(0x0e12826a), GHOST_UINT32_C(0x472eff4d),
+            GHOST_UINT32_C(0xff4cfe93), GHOST_UINT32_C(0xb67083b4), GHOST_UINT32_C(0x6d3404dd), GHOST_UINT32_C(0x240879fa),
+            GHOST_UINT32_C(0xde517cfe), GHOST_UINT32_C(0x976d01d9), GHOST_UINT32_C(0x4c2986b0), GHOST_UINT32_C(0x0515fb97),
+            GHOST_UINT32_C(0x2e015d56), GHOST_UINT32_C(0x673d2071), GHOST_UINT32_C(0xbc79a718), GHOST_UINT32_C(0xf545da3f),
+            GHOST_UINT32_C(0x0f1cdf3b), GHOST_UINT32_C(0x4620a21c), GHOST_UINT32_C(0x9d642575), GHOST_UINT32_C(0xd4585852),
+            GHOST_UINT32_C(0x6c3a598c), GHOST_UINT32_C(0x250624ab), GHOST_UINT32_C(0xfe42a3c2), GHOST_UINT32_C(0xb77edee5),
+            GHOST_UINT32_C(0x4d27dbe1), GHOST_UINT32_C(0x041ba6c6), GHOST_UINT32_C(0xdf5f21af), GHOST_UINT32_C(0x96635c88),
+            GHOST_UINT32_C(0xaa7754e2), GHOST_UINT32_C(0xe34b29c5), GHOST_UINT32_C(0x380faeac), GHOST_UINT32_C(0x7133d38b),
+            GHOST_UINT32_C(0x8b6ad68f), GHOST_UINT32_C(0xc256aba8), GHOST_UINT32_C(0x19122cc1), GHOST_UINT32_C(0x502e51e6),
+            GHOST_UINT32_C(0xe84c5038), GHOST_UINT32_C(0xa1702d1f), GHOST_UINT32_C(0x7a34aa76), GHOST_UINT32_C(0x3308d751),
+            GHOST_UINT32_C(0xc951d255), GHOST_UINT32_C(0x806daf72), GHOST_UINT32_C(0x5b29281b), GHOST_UINT32_C(0x1215553c),
+            GHOST_UINT32_C(0x230138cf), GHOST_UINT32_C(0x6a3d45e8), GHOST_UINT32_C(0xb179c281), GHOST_UINT32_C(0xf845bfa6),
+            GHOST_UINT32_C(0x021cbaa2), GHOST_UINT32_C(0x4b20c785), GHOST_UINT32_C(0x906440ec), GHOST_UINT32_C(0xd9583dcb),
+            GHOST_UINT32_C(0x613a3c15), GHOST_UINT32_C(0x28064132), GHOST_UINT32_C(0xf342c65b), GHOST_UINT32_C(0xba7ebb7c),
+            GHOST_UINT32_C(0x4027be78), GHOST_UINT32_C(0x091bc35f), GHOST_UINT32_C(0xd25f4436), GHOST_UINT32_C(0x9b633911),
+            GHOST_UINT32_C(0xa777317b), GHOST_UINT32_C(0xee4b4c5c), GHOST_UINT32_C(0x350fcb35), GHOST_UINT32_C(0x7c33b612),
+            GHOST_UINT32_C(0x866ab316), GHOST_UINT32_C(0xcf56ce31), GHOST_UINT32_C(0x14124958), GHOST_UINT32_C(0x5d2e347f),
+            GHOST_UINT32_C(0xe54c35a1), GHOST_UINT32_C(0xac704886), GHOST_UINT32_C(0x7734cfef), GHOST_UINT32_C(0x3e08b2c8),
+            GHOST_UINT32_C(0xc451b7cc), GHOST_UINT32_C(0x8d6dcaeb), GHOST_UINT32_C(0x56294d82), GHOST_UINT32_C(0x1f1530a5)
+        }
+    };
+    const unsigned char* p = ghost_static_cast(const unsigned char*, bytes);
+
+    while (length >= 8) {
+        ghost_uint32_t one = ghost_load_le_u32(p) ^ crc;
+        ghost_uint32_t two = ghost_load_le_u32(p + 4);
+        crc = table[7][one & 0xFF] ^
+                table[6][(one >> 8) & 0xFF] ^
+                table[5][(one >> 16) & 0xFF] ^
+                table[4][one >> 24] ^
+                table[3][two & 0xFF] ^
+                table[2][(two >> 8) & 0xFF] ^
+                table[1][(two >> 16) & 0xFF] ^
+                table[0][two >> 24];
+        p += 8;
+        length -= 8;
+    }
+    while (length-- != 0)
+        crc = (crc >> 8) ^ table[0][(crc ^ *p++) & 0xFF];
+    return crc;
+}
+
+/*
+ * Multiplies two polynomials modulo the CRC polynomial (in reflected bit
+ * order.)
+ */
+ghost_impl_always_inline
+ghost_uint32_t ghost_impl_crc32c_multiply(ghost_uint32_t a, ghost_uint32_t b) {
+    ghost_uint32_t m = GHOST_UINT32_C(0x80000000);
+    ghost_uint32_t product = 0;
+    for (;;) {
+        if (a & m) {
+            product ^= b;
+            if ((a & (m - 1)) == 0)
+                break;
+        }
+        m >>= 1;
+        b = (b & 1) ? (b >> 1) ^ GHOST_UINT32_C(0x82F63B78) : b >> 1;
+    }
+    return product;
+}
+
+ghost_impl_noinline
+ghost_uint32_t ghost_impl_crc32c_shift(ghost_uint32_t crc, ghost_size_t length) {
+    /* x^(2^k) modulo the polynomial, for k from 0 to 31 */
+    static const ghost_uint32_t powers[32] = {
+        GHOST_UINT32_C(0x40000000), GHOST_UINT32_C(0x20000000), GHOST_UINT32_C(0x08000000), GHOST_UINT32_C(0x00800000),
+        GHOST_UINT32_C(0x00008000), GHOST_UINT32_C(0x82f63b78), GHOST_UINT32_C(0x6ea2d55c), GHOST_UINT32_C(0x18b8ea18),
+        GHOST_UINT32_C(0x510ac59a), GHOST_UINT32_C(0xb82be955), GHOST_UINT32_C(0xb8fdb1e7), GHOST_UINT32_C(0x88e56f72),
+        GHOST_UINT32_C(0x74c360a4), GHOST_UINT32_C(0xe4172b16), GHOST_UINT32_C(0x0d65762a), GHOST_UINT32_C(0x35d73a62),
+        GHOST_UINT32_C(0x28461564), GHOST_UINT32_C(0xbf455269), GHOST_UINT32_C(0xe2ea32dc), GHOST_UINT32_C(0xfe7740e6),
+        GHOST_UINT32_C(0xf946610b), GHOST_UINT32_C(0x3c204f8f), GHOST_UINT32_C(0x538586e3), GHOST_UINT32_C(0x59726915),
+        GHOST_UINT32_C(0x734d5309), GHOST_UINT32_C(0xbc1ac763), GHOST_UINT32_C(0x7d0722cc), GHOST_UINT32_C(0xd289cabe),
+        GHOST_UINT32_C(0xe94ca9bc), GHOST_UINT32_C(0x05b74f3f), GHOST_UINT32_C(0xa51e1f42), GHOST_UINT32_C(0x40000000)
+    };
+    /* Shifting over n bytes multiplies by x^(8n). We multiply by the
+     * powers x^(2^k) for each bit k of 8n. For this polynomial x^(2^32) is
+     * x^(2^1) so the powers cycle back to index 1 after index 31. */
+    unsigned k = 3;
+    while (length != 0) {
+        if (length & 1)
+            crc = ghost_impl_crc32c_multiply(powers[k], crc);
+        length >>= 1;
+        if (++k == 32)
+            k = 1;
+    }
+    return crc;
+}
+
+#if GHOST_IMPL_CRC32C_HARDWARE && ghost_has(ghost_uint64_t)
+/*
+ * Shifts the CRC register over LONG or SHORT zero bytes using the given table.
+ */
+ghost_impl_always_inline
+ghost_uint32_t ghost_impl_crc32c_shift_table(const ghost_uint32_t table[4][256], ghost_uint32_t crc) {
+    return table[0][crc & 0xFF] ^
+            table[1][(crc >> 8) & 0xFF] ^
+            table[2][(crc >> 16) & 0xFF] ^
+            table[3][crc >> 24];
+}
+
+ghost_impl_noinline GHOST_IMPL_CRC32C_TARGET
+ghost_uint32_t ghost_impl_crc32c_hw(ghost_uint32_t crc, const void* bytes, ghost_size_t length) {
+    static const ghost_uint32_t long_shift[4][256] = {
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0xe040e0ac), GHOST_UINT32_C(0xc56db7a9), GHOST_UINT32_C(0x252d5705),
+            GHOST_UINT32_C(0x8f3719a3), GHOST_UINT32_C(0x6f77f90f), GHOST_UINT32_C(0x4a5aae0a), GHOST_UINT32_C(0xaa1a4ea6),
+            GHOST_UINT32_C(0x1b8245b7), GHOST_UINT32_C(0xfbc2a51b), GHOST_UINT32_C(0xdeeff21e), GHOST_UINT32_C(0x3eaf12b2),
+            GHOST_UINT32_C(0x94b55c14), GHOST_UINT32_C(0x74f5bcb8), GHOST_UINT32_C(0x51d8ebbd), GHOST_UINT32_C(0xb1980b11),
+            GHOST_UINT32_C(0x37048b6e), GHOST_UINT32_C(0xd7446bc2), GHOST_UINT32_C(0xf2693cc7), GHOST_UINT32_C(0x1229dc6b),
+            GHOST_UINT32_C(0xb83392cd), GHOST_UINT32_C(0x58737261), GHOST_UINT32_C(0x7d5e2564), GHOST_UINT32_C(0x9d1ec5c8),
+            GHOST_UINT32_C(0x2c86ced9), GHOST_UINT32_C(0xccc62e75), GHOST_UINT32_C(0xe9eb7970), GHOST_UINT32_C(0x09ab99dc),
+            GHOST_UINT32_C(0xa3b1d77a), GHOST_UINT32_C(0x43f137d6), GHOST_UINT32_C(0x66dc60d3), GHOST_UINT32_C(0x869c807f),
+            GHOST_UINT32_C(0x6e0916dc), GHOST_UINT32_C(0x8e49f670), GHOST_UINT32_C(0xab64a175), GHOST_UINT32_C(0x4b2441d9),
+            GHOST_UINT32_C(0xe13e0f7f), GHOST_UINT32_C(0x017eefd3), GHOST_UINT32_C(0x2453b8d6), GHOST_UINT32_C(0xc413587a),
+            GHOST_UINT32_C(0x758b536b), GHOST_UINT32_C(0x95cbb3c7), GHOST_UINT32_C(0xb0e6e4c2), GHOST_UINT32_C(0x50a6046e),
+            GHOST_UINT32_C(0xfabc4ac8), GHOST_UINT32_C(0x1afcaa64), GHOST_UINT32_C(0x3fd1fd61), GHOST_UINT32_C(0xdf911dcd),
+            GHOST_UINT32_C(0x590d9db2), GHOST_UINT32_C(0xb94d7d1e), GHOST_UINT32_C(0x9c602a1b), GHOST_UINT32_C(0x7c20cab7),
+            GHOST_UINT32_C(0xd63a8411), GHOST_UINT32_C(0x367a64bd), GHOST_UINT32_C(0x135733b8), GHOST_UINT32_C(0xf317d314),
+            GHOST_UINT32_C(0x428fd805), GHOST_UINT32_C(0xa2cf38a9), GHOST_UINT32_C(0x87e26fac), GHOST_UINT32_C(0x67a28f00),
+            GHOST_UINT32_C(0xcdb8c1a6), GHOST_UINT32_C(0x2df8210a), GHOST_UINT32_C(0x08d5760f), GHOST_UINT32_C(0xe89596a3),
+            GHOST_UINT32_C(0xdc122db8), GHOST_UINT32_C(0x3c52cd14), GHOST_UINT32_C(0x197f9a11), GHOST_UINT32_C(0xf93f7abd),
+            GHOST_UINT32_C(0x5325341b), GHOST_UINT32_C(0xb365d4b7), GHOST_UINT32_C(0x964883b2), GHOST_UINT32_C(0x7608631e),
+            GHOST_UINT32_C(0xc790680f), GHOST_UINT32_C(0x27d088a3), GHOST_UINT32_C(0x02fddfa6), GHOST_UINT32_C(0xe2bd3f0a),
+            GHOST_UINT32_C(0x48a771ac), GHOST_UINT32_C(0xa8e79100), GHOST_UINT32_C(0x8dcac605), GHOST_UINT32_C(0x6d8a26a9),
+            GHOST_UINT32_C(0xeb16a6d6), GHOST_UINT32_C(0x0b56467a), GHOST_UINT32_C(0x2e7b117f), GHOST_UINT32_C(0xce3bf1d3),
+            GHOST_UINT32_C(0x6421bf75), GHOST_UINT32_C(0x84615fd9), GHOST_UINT32_C(0xa14c08dc), GHOST_UINT32_C(0x410ce870),
+            GHOST_UINT32_C(0xf094e361), GHOST_UINT32_C(0x10d403cd), GHOST_UINT32_C(0x35f954c8), GHOST_UINT32_C(0xd5b9b464),
+            GHOST_UINT32_C(0x7fa3fac2), GHOST_UINT32_C(0x9fe31a6e), GHOST_UINT32_C(0xbace4d6b), GHOST_UINT32_C(0x5a8eadc7),
+            GHOST_UINT32_C(0xb21b3b64), GHOST_UINT32_C(0x525bdbc8), GHOST_UINT32_C(0x77768ccd), GHOST_UINT32_C(0x97366c61),
+            GHOST_UINT32_C(0x3d2c22c7), GHOST_UINT32_C(0xdd6cc26b), GHOST_UINT32_C(0xf841956e), GHOST_UINT32_C(0x180175c2),
+            GHOST_UINT32_C(0xa9997ed3), GHOST_UINT32_C(0x49d99e7f), GHOST_UINT32_C(0x6cf4c97a), GHOST_UINT32_C(0x8cb429d6),
+            GHOST_UINT32_C(0x26ae6770), GHOST_UINT32_C(0xc6ee87dc), GHOST_UINT32_C(0xe3c3d0d9), GHOST_UINT32_C(0x03833075),
+            GHOST_UINT32_C(0x851fb00a), GHOST_UINT32_C(0x655f50a6), GHOST_UINT32_C(0x407207a3), GHOST_UINT32_C(0xa032e70f),
+            GHOST_UINT32_C(0x0a28a9a9), GHOST_UINT32_C(0xea684905), GHOST_UINT32_C(0xcf451e00), GHOST_UINT32_C(0x2f05feac),
+            GHOST_UINT32_C(0x9e9df5bd), GHOST_UINT32_C(0x7edd1511), GHOST_UINT32_C(0x5bf04214), GHOST_UINT32_C(0xbbb0a2b8),
+            GHOST_UINT32_C(0x11aaec1e), GHOST_UINT32_C(0xf1ea0cb2), GHOST_UINT32_C(0xd4c75bb7), GHOST_UINT32_C(0x3487bb1b),
+            GHOST_UINT32_C(0xbdc82d81), GHOST_UINT32_C(0x5d88cd2d), GHOST_UINT32_C(0x78a59a28), GHOST_UINT32_C(0x98e57a84),
+            GHOST_UINT32_C(0x32ff3422), GHOST_UINT32_C(0xd2bfd48e), GHOST_UINT32_C(0xf792838b), GHOST_UINT32_C(0x17d26327),
+            GHOST_UINT32_C(0xa64a6836), GHOST_UINT32_C(0x460a889a), GHOST_UINT32_C(0x6327df9f), GHOST_UINT32_C(0x83673f33),
+            GHOST_UINT32_C(0x297d7195), GHOST_UINT32_C(0xc93d9139), GHOST_UINT32_C(0xec10c63c), GHOST_UINT32_C(0x0c502690),
+            GHOST_UINT32_C(0x8acca6ef), GHOST_UINT32_C(0x6a8c4643), GHOST_UINT32_C(0x4fa11146), GHOST_UINT32_C(0xafe1f1ea),
+            GHOST_UINT32_C(0x05fbbf4c), GHOST_UINT32_C(0xe5bb5fe0), GHOST_UINT32_C(0xc09608e5), GHOST_UINT32_C(0x20d6e849),
+            GHOST_UINT32_C(0x914ee358), GHOST_UINT32_C(0x710e03f4), GHOST_UINT32_C(0x542354f1), GHOST_UINT32_C(0xb463b45d),
+            GHOST_UINT32_C(0x1e79fafb), GHOST_UINT32_C(0xfe391a57), GHOST_UINT32_C(0xdb144d52), GHOST_UINT32_C(0x3b54adfe),
+            GHOST_UINT32_C(0xd3c13b5d), GHOST_UINT32_C(0x3381dbf1), GHOST_UINT32_C(0x16ac8cf4), GHOST_UINT32_C(0xf6ec6c58),
+            GHOST_UINT32_C(0x5cf622fe), GHOST_UINT32_C(0xbcb6c252), GHOST_UINT32_C(0x999b9557), GHOST_UINT32_C(0x79db75fb),
+            GHOST_UINT32_C(0xc8437eea), GHOST_UINT32_C(0x28039e46), GHOST_UINT32_C(0x0d2ec943), GHOST_UINT32_C(0xed6e29ef),
+            GHOST_UINT32_C(0x47746749), GHOST_UINT32_C(0xa73487e5), GHOST_UINT32_C(0x8219d0e0), GHOST_UINT32_C(0x6259304c),
+            GHOST_UINT32_C(0xe4c5b033), GHOST_UINT32_C(0x0485509f), GHOST_UINT32_C(0x21a8079a), GHOST_UINT32_C(0xc1e8e736),
+            GHOST_UINT32_C(0x6bf2a990), GHOST_UINT32_C(0x8bb2493c), GHOST_UINT32_C(0xae9f1e39), GHOST_UINT32_C(0x4edffe95),
+            GHOST_UINT32_C(0xff47f584), GHOST_UINT32_C(0x1f071528), GHOST_UINT32_C(0x3a2a422d), GHOST_UINT32_C(0xda6aa281),
+            GHOST_UINT32_C(0x7070ec27), GHOST_UINT32_C(0x90300c8b), GHOST_UINT32_C(0xb51d5b8e), GHOST_UINT32_C(0x555dbb22),
+            GHOST_UINT32_C(0x61da0039), GHOST_UINT32_C(0x819ae095), GHOST_UINT32_C(0xa4b7b790), GHOST_UINT32_C(0x44f7573c),
+            GHOST_UINT32_C(0xeeed199a), GHOST_UINT32_C(0x0eadf936), GHOST_UINT32_C(0x2b80ae33), GHOST_UINT32_C(0xcbc04e9f),
+            GHOST_UINT32_C(0x7a58458e), GHOST_UINT32_C(0x9a18a522), GHOST_UINT32_C(0xbf35f227), GHOST_UINT32_C(0x5f75128b),
+            GHOST_UINT32_C(0xf56f5c2d), GHOST_UINT32_C(0x152fbc81), GHOST_UINT32_C(0x3002eb84), GHOST_UINT32_C(0xd0420b28),
+            GHOST_UINT32_C(0x56de8b57), GHOST_UINT32_C(0xb69e6bfb), GHOST_UINT32_C(0x93b33cfe), GHOST_UINT32_C(0x73f3dc52),
+            GHOST_UINT32_C(0xd9e992f4), GHOST_UINT32_C(0x39a97258), GHOST_UINT32_C(0x1c84255d), GHOST_UINT32_C(0xfcc4c5f1),
+            GHOST_UINT32_C(0x4d5ccee0), GHOST_UINT32_C(0xad1c2e4c), GHOST_UINT32_C(0x88317949), GHOST_UINT32_C(0x687199e5),
+            GHOST_UINT32_C(0xc26bd743), GHOST_UINT32_C(0x222b37ef), GHOST_UINT32_C(0x070660ea), GHOST_UINT32_C(0xe7468046),
+            GHOST_UINT32_C(0x0fd316e5), GHOST_UINT32_C(0xef93f649), GHOST_UINT32_C(0xcabea14c), GHOST_UINT32_C(0x2afe41e0),
+            GHOST_UINT32_C(0x80e40f46), GHOST_UINT32_C(0x60a4efea), GHOST_UINT32_C(0x4589b8ef), GHOST_UINT32_C(0xa5c95843),
+            GHOST_UINT32_C(0x14515352), GHOST_UINT32_C(0xf411b3fe), GHOST_UINT32_C(0xd13ce4fb), GHOST_UINT32_C(0x317c0457),
+            GHOST_UINT32_C(0x9b664af1), GHOST_UINT32_C(0x7b26aa5d), GHOST_UINT32_C(0x5e0bfd58), GHOST_UINT32_C(0xbe4b1df4),
+            GHOST_UINT32_C(0x38d79d8b), GHOST_UINT32_C(0xd8977d27), GHOST_UINT32_C(0xfdba2a22), GHOST_UINT32_C(0x1dfaca8e),
+            GHOST_UINT32_C(0xb7e08428), GHOST_UINT32_C(0x57a06484), GHOST_UINT32_C(0x728d3381), GHOST_UINT32_C(0x92cdd32d),
+            GHOST_UINT32_C(0x2355d83c), GHOST_UINT32_C(0xc3153890), GHOST_UINT32_C(0xe6386f95), GHOST_UINT32_C(0x06788f39),
+            GHOST_UINT32_C(0xac62c19f), GHOST_UINT32_C(0x4c222133), GHOST_UINT32_C(0x690f7636), GHOST_UINT32_C(0x894f969a)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0x7e7c2df3), GHOST_UINT32_C(0xfcf85be6), GHOST_UINT32_C(0x82847615),
+            GHOST_UINT32_C(0xfc1cc13d), GHOST_UINT32_C(0x8260ecce), GHOST_UINT32_C(0x00e49adb), GHOST_UINT32_C(0x7e98b728),
+            GHOST_UINT32_C(0xfdd5f48b), GHOST_UINT32_C(0x83a9d978), GHOST_UINT32_C(0x012daf6d), GHOST_UINT32_C(0x7f51829e),
+            GHOST_UINT32_C(0x01c935b6), GHOST_UINT32_C(0x7fb51845), GHOST_UINT32_C(0xfd316e50), GHOST_UINT32_C(0x834d43a3),
+            GHOST_UINT32_C(0xfe479fe7), GHOST_UINT32_C(0x803bb214), GHOST_UINT32_C(0x02bfc401), GHOST_UINT32_C(0x7cc3e9f2),
+            GHOST_UINT32_C(0x025b5eda), GHOST_UINT32_C(0x7c277329), GHOST_UINT32_C(0xfea3053c), GHOST_UINT32_C(0x80df28cf),
+            GHOST_UINT32_C(0x03926b6c), GHOST_UINT32_C(0x7dee469f), GHOST_UINT32_C(0xff6a308a), GHOST_UINT32_C(0x81161d79),
+            GHOST_UINT32_C(0xff8eaa51), GHOST_UINT32_C(0x81f287a2), GHOST_UINT32_C(0x0376f1b7), GHOST_UINT32_C(0x7d0adc44),
+            GHOST_UINT32_C(0xf963493f), GHOST_UINT32_C(0x871f64cc), GHOST_UINT32_C(0x059b12d9), GHOST_UINT32_C(0x7be73f2a),
+            GHOST_UINT32_C(0x057f8802), GHOST_UINT32_C(0x7b03a5f1), GHOST_UINT32_C(0xf987d3e4), GHOST_UINT32_C(0x87fbfe17),
+            GHOST_UINT32_C(0x04b6bdb4), GHOST_UINT32_C(0x7aca9047), GHOST_UINT32_C(0xf84ee652), GHOST_UINT32_C(0x8632cba1),
+            GHOST_UINT32_C(0xf8aa7c89), GHOST_UINT32_C(0x86d6517a), GHOST_UINT32_C(0x0452276f), GHOST_UINT32_C(0x7a2e0a9c),
+            GHOST_UINT32_C(0x0724d6d8), GHOST_UINT32_C(0x7958fb2b), GHOST_UINT32_C(0xfbdc8d3e), GHOST_UINT32_C(0x85a0a0cd),
+            GHOST_UINT32_C(0xfb3817e5), GHOST_UINT32_C(0x85443a16), GHOST_UINT32_C(0x07c04c03), GHOST_UINT32_C(0x79bc61f0),
+            GHOST_UINT32_C(0xfaf12253), GHOST_UINT32_C(0x848d0fa0), GHOST_UINT32_C(0x060979b5), GHOST_UINT32_C(0x78755446),
+            GHOST_UINT32_C(0x06ede36e), GHOST_UINT32_C(0x7891ce9d), GHOST_UINT32_C(0xfa15b888), GHOST_UINT32_C(0x8469957b),
+            GHOST_UINT32_C(0xf72ae48f), GHOST_UINT32_C(0x8956c97c), GHOST_UINT32_C(0x0bd2bf69), GHOST_UINT32_C(0x75ae929a),
+            GHOST_UINT32_C(0x0b3625b2), GHOST_UINT32_C(0x754a0841), GHOST_UINT32_C(0xf7ce7e54), GHOST_UINT32_C(0x89b253a7),
+            GHOST_UINT32_C(0x0aff1004), GHOST_UINT32_C(0x74833df7), GHOST_UINT32_C(0xf6074be2), GHOST_UINT32_C(0x887b6611),
+            GHOST_UINT32_C(0xf6e3d139), GHOST_UINT32_C(0x889ffcca), GHOST_UINT32_C(0x0a1b8adf), GHOST_UINT32_C(0x7467a72c),
+            GHOST_UINT32_C(0x096d7b68), GHOST_UINT32_C(0x7711569b), GHOST_UINT32_C(0xf595208e), GHOST_UINT32_C(0x8be90d7d),
+            GHOST_UINT32_C(0xf571ba55), GHOST_UINT32_C(0x8b0d97a6), GHOST_UINT32_C(0x0989e1b3), GHOST_UINT32_C(0x77f5cc40),
+            GHOST_UINT32_C(0xf4b88fe3), GHOST_UINT32_C(0x8ac4a210), GHOST_UINT32_C(0x0840d405), GHOST_UINT32_C(0x763cf9f6),
+            GHOST_UINT32_C(0x08a44ede), GHOST_UINT32_C(0x76d8632d), GHOST_UINT32_C(0xf45c1538), GHOST_UINT32_C(0x8a2038cb),
+            GHOST_UINT32_C(0x0e49adb0), GHOST_UINT32_C(0x70358043), GHOST_UINT32_C(0xf2b1f656), GHOST_UINT32_C(0x8ccddba5),
+            GHOST_UINT32_C(0xf2556c8d), GHOST_UINT32_C(0x8c29417e), GHOST_UINT32_C(0x0ead376b), GHOST_UINT32_C(0x70d11a98),
+            GHOST_UINT32_C(0xf39c593b), GHOST_UINT32_C(0x8de074c8), GHOST_UINT32_C(0x0f6402dd), GHOST_UINT32_C(0x71182f2e),
+            GHOST_UINT32_C(0x0f809806), GHOST_UINT32_C(0x71fcb5f5), GHOST_UINT32_C(0xf378c3e0), GHOST_UINT32_C(0x8d04ee13),
+            GHOST_UINT32_C(0xf00e3257), GHOST_UINT32_C(0x8e721fa4), GHOST_UINT32_C(0x0cf669b1), GHOST_UINT32_C(0x728a4442),
+            GHOST_UINT32_C(0x0c12f36a), GHOST_UINT32_C(0x726ede99), GHOST_UINT32_C(0xf0eaa88c), GHOST_UINT32_C(0x8e96857f),
+            GHOST_UINT32_C(0x0ddbc6dc), GHOST_UINT32_C(0x73a7eb2f), GHOST_UINT32_C(0xf1239d3a), GHOST_UINT32_C(0x8f5fb0c9),
+            GHOST_UINT32_C(0xf1c707e1), GHOST_UINT32_C(0x8fbb2a12), GHOST_UINT32_C(0x0d3f5c07), GHOST_UINT32_C(0x734371f4),
+            GHOST_UINT32_C(0xebb9bfef), GHOST_UINT32_C(0x95c5921c), GHOST_UINT32_C(0x1741e409), GHOST_UINT32_C(0x693dc9fa),
+            GHOST_UINT32_C(0x17a57ed2), GHOST_UINT32_C(0x69d95321), GHOST_UINT32_C(0xeb5d2534), GHOST_UINT32_C(0x952108c7),
+            GHOST_UINT32_C(0x166c4b64), GHOST_UINT32_C(0x68106697), GHOST_UINT32_C(0xea941082), GHOST_UINT32_C(0x94e83d71),
+            GHOST_UINT32_C(0xea708a59), GHOST_UINT32_C(0x940ca7aa), GHOST_UINT32_C(0x1688d1bf), GHOST_UINT32_C(0x68f4fc4c),
+            GHOST_UINT32_C(0x15fe2008), GHOST_UINT32_C(0x6b820dfb), GHOST_UINT32_C(0xe9067bee), GHOST_UINT32_C(0x977a561d),
+            GHOST_UINT32_C(0xe9e2e135), GHOST_UINT32_C(0x979eccc6), GHOST_UINT32_C(0x151abad3), GHOST_UINT32_C(0x6b669720),
+            GHOST_UINT32_C(0xe82bd483), GHOST_UINT32_C(0x9657f970), GHOST_UINT32_C(0x14d38f65), GHOST_UINT32_C(0x6aafa296),
+            GHOST_UINT32_C(0x143715be), GHOST_UINT32_C(0x6a4b384d), GHOST_UINT32_C(0xe8cf4e58), GHOST_UINT32_C(0x96b363ab),
+            GHOST_UINT32_C(0x12daf6d0), GHOST_UINT32_C(0x6ca6db23), GHOST_UINT32_C(0xee22ad36), GHOST_UINT32_C(0x905e80c5),
+            GHOST_UINT32_C(0xeec637ed), GHOST_UINT32_C(0x90ba1a1e), GHOST_UINT32_C(0x123e6c0b), GHOST_UINT32_C(0x6c4241f8),
+            GHOST_UINT32_C(0xef0f025b), GHOST_UINT32_C(0x91732fa8), GHOST_UINT32_C(0x13f759bd), GHOST_UINT32_C(0x6d8b744e),
+            GHOST_UINT32_C(0x1313c366), GHOST_UINT32_C(0x6d6fee95), GHOST_UINT32_C(0xefeb9880), GHOST_UINT32_C(0x9197b573),
+            GHOST_UINT32_C(0xec9d6937), GHOST_UINT32_C(0x92e144c4), GHOST_UINT32_C(0x106532d1), GHOST_UINT32_C(0x6e191f22),
+            GHOST_UINT32_C(0x1081a80a), GHOST_UINT32_C(0x6efd85f9), GHOST_UINT32_C(0xec79f3ec), GHOST_UINT32_C(0x9205de1f),
+            GHOST_UINT32_C(0x11489dbc), GHOST_UINT32_C(0x6f34b04f), GHOST_UINT32_C(0xedb0c65a), GHOST_UINT32_C(0x93cceba9),
+            GHOST_UINT32_C(0xed545c81), GHOST_UINT32_C(0x93287172), GHOST_UINT32_C(0x11ac0767), GHOST_UINT32_C(0x6fd02a94),
+            GHOST_UINT32_C(0x1c935b60), GHOST_UINT32_C(0x62ef7693), GHOST_UINT32_C(0xe06b0086), GHOST_UINT32_C(0x9e172d75),
+            GHOST_UINT32_C(0xe08f9a5d), GHOST_UINT32_C(0x9ef3b7ae), GHOST_UINT32_C(0x1c77c1bb), GHOST_UINT32_C(0x620bec48),
+            GHOST_UINT32_C(0xe146afeb), GHOST_UINT32_C(0x9f3a8218), GHOST_UINT32_C(0x1dbef40d), GHOST_UINT32_C(0x63c2d9fe),
+            GHOST_UINT32_C(0x1d5a6ed6), GHOST_UINT32_C(0x63264325), GHOST_UINT32_C(0xe1a23530), GHOST_UINT32_C(0x9fde18c3),
+            GHOST_UINT32_C(0xe2d4c487), GHOST_UINT32_C(0x9ca8e974), GHOST_UINT32_C(0x1e2c9f61), GHOST_UINT32_C(0x6050b292),
+            GHOST_UINT32_C(0x1ec805ba), GHOST_UINT32_C(0x60b42849), GHOST_UINT32_C(0xe2305e5c), GHOST_UINT32_C(0x9c4c73af),
+            GHOST_UINT32_C(0x1f01300c), GHOST_UINT32_C(0x617d1dff), GHOST_UINT32_C(0xe3f96bea), GHOST_UINT32_C(0x9d854619),
+            GHOST_UINT32_C(0xe31df131), GHOST_UINT32_C(0x9d61dcc2), GHOST_UINT32_C(0x1fe5aad7), GHOST_UINT32_C(0x61998724),
+            GHOST_UINT32_C(0xe5f0125f), GHOST_UINT32_C(0x9b8c3fac), GHOST_UINT32_C(0x190849b9), GHOST_UINT32_C(0x6774644a),
+            GHOST_UINT32_C(0x19ecd362), GHOST_UINT32_C(0x6790fe91), GHOST_UINT32_C(0xe5148884), GHOST_UINT32_C(0x9b68a577),
+            GHOST_UINT32_C(0x1825e6d4), GHOST_UINT32_C(0x6659cb27), GHOST_UINT32_C(0xe4ddbd32), GHOST_UINT32_C(0x9aa190c1),
+            GHOST_UINT32_C(0xe43927e9), GHOST_UINT32_C(0x9a450a1a), GHOST_UINT32_C(0x18c17c0f), GHOST_UINT32_C(0x66bd51fc),
+            GHOST_UINT32_C(0x1bb78db8), GHOST_UINT32_C(0x65cba04b), GHOST_UINT32_C(0xe74fd65e), GHOST_UINT32_C(0x9933fbad),
+            GHOST_UINT32_C(0xe7ab4c85), GHOST_UINT32_C(0x99d76176), GHOST_UINT32_C(0x1b531763), GHOST_UINT32_C(0x652f3a90),
+            GHOST_UINT32_C(0xe6627933), GHOST_UINT32_C(0x981e54c0), GHOST_UINT32_C(0x1a9a22d5), GHOST_UINT32_C(0x64e60f26),
+            GHOST_UINT32_C(0x1a7eb80e), GHOST_UINT32_C(0x640295fd), GHOST_UINT32_C(0xe686e3e8), GHOST_UINT32_C(0x98face1b)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0xd29f092f), GHOST_UINT32_C(0xa0d264af), GHOST_UINT32_C(0x724d6d80),
+            GHOST_UINT32_C(0x4448bfaf), GHOST_UINT32_C(0x96d7b680), GHOST_UINT32_C(0xe49adb00), GHOST_UINT32_C(0x3605d22f),
+            GHOST_UINT32_C(0x88917f5e), GHOST_UINT32_C(0x5a0e7671), GHOST_UINT32_C(0x28431bf1), GHOST_UINT32_C(0xfadc12de),
+            GHOST_UINT32_C(0xccd9c0f1), GHOST_UINT32_C(0x1e46c9de), GHOST_UINT32_C(0x6c0ba45e), GHOST_UINT32_C(0xbe94ad71),
+            GHOST_UINT32_C(0x14ce884d), GHOST_UINT32_C(0xc6518162), GHOST_UINT32_C(0xb41cece2), GHOST_UINT32_C(0x6683e5cd),
+            GHOST_UINT32_C(0x508637e2), GHOST_UINT32_C(0x82193ecd), GHOST_UINT32_C(0xf054534d), GHOST_UINT32_C(0x22cb5a62),
+            GHOST_UINT32_C(0x9c5ff713), GHOST_UINT32_C(0x4ec0fe3c), GHOST_UINT32_C(0x3c8d93bc), GHOST_UINT32_C(0xee129a93),
+            GHOST_UINT32_C(0xd81748bc), GHOST_UINT32_C(0x0a884193), GHOST_UINT32_C(0x78c52c13), GHOST_UINT32_C(0xaa5a253c),
+            GHOST_UINT32_C(0x299d109a), GHOST_UINT32_C(0xfb0219b5), GHOST_UINT32_C(0x894f7435), GHOST_UINT32_C(0x5bd07d1a),
+            GHOST_UINT32_C(0x6dd5af35), GHOST_UINT32_C(0xbf4aa61a), GHOST_UINT32_C(0xcd07cb9a), GHOST_UINT32_C(0x1f98c2b5),
+            GHOST_UINT32_C(0xa10c6fc4), GHOST_UINT32_C(0x739366eb), GHOST_UINT32_C(0x01de0b6b), GHOST_UINT32_C(0xd3410244),
+            GHOST_UINT32_C(0xe544d06b), GHOST_UINT32_C(0x37dbd944), GHOST_UINT32_C(0x4596b4c4), GHOST_UINT32_C(0x9709bdeb),
+            GHOST_UINT32_C(0x3d5398d7), GHOST_UINT32_C(0xefcc91f8), GHOST_UINT32_C(0x9d81fc78), GHOST_UINT32_C(0x4f1ef557),
+            GHOST_UINT32_C(0x791b2778), GHOST_UINT32_C(0xab842e57), GHOST_UINT32_C(0xd9c943d7), GHOST_UINT32_C(0x0b564af8),
+            GHOST_UINT32_C(0xb5c2e789), GHOST_UINT32_C(0x675deea6), GHOST_UINT32_C(0x15108326), GHOST_UINT32_C(0xc78f8a09),
+            GHOST_UINT32_C(0xf18a5826), GHOST_UINT32_C(0x23155109), GHOST_UINT32_C(0x51583c89), GHOST_UINT32_C(0x83c735a6),
+            GHOST_UINT32_C(0x533a2134), GHOST_UINT32_C(0x81a5281b), GHOST_UINT32_C(0xf3e8459b), GHOST_UINT32_C(0x21774cb4),
+            GHOST_UINT32_C(0x17729e9b), GHOST_UINT32_C(0xc5ed97b4), GHOST_UINT32_C(0xb7a0fa34), GHOST_UINT32_C(0x653ff31b),
+            GHOST_UINT32_C(0xdbab5e6a), GHOST_UINT32_C(0x09345745), GHOST_UINT32_C(0x7b793ac5), GHOST_UINT32_C(0xa9e633ea),
+            GHOST_UINT32_C(0x9fe3e1c5), GHOST_UINT32_C(0x4d7ce8ea), GHOST_UINT32_C(0x3f31856a), GHOST_UINT32_C(0xedae8c45),
+            GHOST_UINT32_C(0x47f4a979), GHOST_UINT32_C(0x956ba056), GHOST_UINT32_C(0xe726cdd6), GHOST_UINT32_C(0x35b9c4f9),
+            GHOST_UINT32_C(0x03bc16d6), GHOST_UINT32_C(0xd1231ff9), GHOST_UINT32_C(0xa36e7279), GHOST_UINT32_C(0x71f17b56),
+            GHOST_UINT32_C(0xcf65d627), GHOST_UINT32_C(0x1dfadf08), GHOST_UINT32_C(0x6fb7b288), GHOST_UINT32_C(0xbd28bba7),
+            GHOST_UINT32_C(0x8b2d6988), GHOST_UINT32_C(0x59b260a7), GHOST_UINT32_C(0x2bff0d27), GHOST_UINT32_C(0xf9600408),
+            GHOST_UINT32_C(0x7aa731ae), GHOST_UINT32_C(0xa8383881), GHOST_UINT32_C(0xda755501), GHOST_UINT32_C(0x08ea5c2e),
+            GHOST_UINT32_C(0x3eef8e01), GHOST_UINT32_C(0xec70872e), GHOST_UINT32_C(0x9e3deaae), GHOST_UINT32_C(0x4ca2e381),
+            GHOST_UINT32_C(0xf2364ef0), GHOST_UINT32_C(0x20a947df), GHOST_UINT32_C(0x52e42a5f), GHOST_UINT32_C(0x807b2370),
+            GHOST_UINT32_C(0xb67ef15f), GHOST_UINT32_C(0x64e1f870), GHOST_UINT32_C(0x16ac95f0), GHOST_UINT32_C(0xc4339cdf),
+            GHOST_UINT32_C(0x6e69b9e3), GHOST_UINT32_C(0xbcf6b0cc), GHOST_UINT32_C(0xcebbdd4c), GHOST_UINT32_C(0x1c24d463),
+            GHOST_UINT32_C(0x2a21064c), GHOST_UINT32_C(0xf8be0f63), GHOST_UINT32_C(0x8af362e3), GHOST_UINT32_C(0x586c6bcc),
+            GHOST_UINT32_C(0xe6f8c6bd), GHOST_UINT32_C(0x3467cf92), GHOST_UINT32_C(0x462aa212), GHOST_UINT32_C(0x94b5ab3d),
+            GHOST_UINT32_C(0xa2b07912), GHOST_UINT32_C(0x702f703d), GHOST_UINT32_C(0x02621dbd), GHOST_UINT32_C(0xd0fd1492),
+            GHOST_UINT32_C(0xa6744268), GHOST_UINT32_C(0x74eb4b47), GHOST_UINT32_C(0x06a626c7), GHOST_UINT32_C(0xd4392fe8),
+            GHOST_UINT32_C(0xe23cfdc7), GHOST_UINT32_C(0x30a3f4e8), GHOST_UINT32_C(0x42ee9968), GHOST_UINT32_C(0x90719047),
+            GHOST_UINT32_C(0x2ee53d36), GHOST_UINT32_C(0xfc7a3419), GHOST_UINT32_C(0x8e375999), GHOST_UINT32_C(0x5ca850b6),
+            GHOST_UINT32_C(0x6aad8299), GHOST_UINT32_C(0xb8328bb6), GHOST_UINT32_C(0xca7fe636), GHOST_UINT32_C(0x18e0ef19),
+            GHOST_UINT32_C(0xb2baca25), GHOST_UINT32_C(0x6025c30a), GHOST_UINT32_C(0x1268ae8a), GHOST_UINT32_C(0xc0f7a7a5),
+            GHOST_UINT32_C(0xf6f2758a), GHOST_UINT32_C(0x246d7ca5), GHOST_UINT32_C(0x56201125), GHOST_UINT32_C(0x84bf180a),
+            GHOST_UINT32_C(0x3a2bb57b), GHOST_UINT32_C(0xe8b4bc54), GHOST_UINT32_C(0x9af9d1d4), GHOST_UINT32_C(0x4866d8fb),
+            GHOST_UINT32_C(0x7e630ad4), GHOST_UINT32_C(0xacfc03fb), GHOST_UINT32_C(0xdeb16e7b), GHOST_UINT32_C(0x0c2e6754),
+            GHOST_UINT32_C(0x8fe952f2), GHOST_UINT32_C(0x5d765bdd), GHOST_UINT32_C(0x2f3b365d), GHOST_UINT32_C(0xfda43f72),
+            GHOST_UINT32_C(0xcba1ed5d), GHOST_UINT32_C(0x193ee472), GHOST_UINT32_C(0x6b7389f2), GHOST_UINT32_C(0xb9ec80dd),
+            GHOST_UINT32_C(0x07782dac), GHOST_UINT32_C(0xd5e72483), GHOST_UINT32_C(0xa7aa4903), GHOST_UINT32_C(0x7535402c),
+            GHOST_UINT32_C(0x43309203), GHOST_UINT32_C(0x91af9b2c), GHOST_UINT32_C(0xe3e2f6ac), GHOST_UINT32_C(0x317dff83),
+            GHOST_UINT32_C(0x9b27dabf), GHOST_UINT32_C(0x49b8d390), GHOST_UINT32_C(0x3bf5be10), GHOST_UINT32_C(0xe96ab73f),
+            GHOST_UINT32_C(0xdf6f6510), GHOST_UINT32_C(0x0df06c3f), GHOST_UINT32_C(0x7fbd01bf), GHOST_UINT32_C(0xad220890),
+            GHOST_UINT32_C(0x13b6a5e1), GHOST_UINT32_C(0xc129acce), GHOST_UINT32_C(0xb364c14e), GHOST_UINT32_C(0x61fbc861),
+            GHOST_UINT32_C(0x57fe1a4e), GHOST_UINT32_C(0x85611361), GHOST_UINT32_C(0xf72c7ee1), GHOST_UINT32_C(0x25b377ce),
+            GHOST_UINT32_C(0xf54e635c), GHOST_UINT32_C(0x27d16a73), GHOST_UINT32_C(0x559c07f3), GHOST_UINT32_C(0x87030edc),
+            GHOST_UINT32_C(0xb106dcf3), GHOST_UINT32_C(0x6399d5dc), GHOST_UINT32_C(0x11d4b85c), GHOST_UINT32_C(0xc34bb173),
+            GHOST_UINT32_C(0x7ddf1c02), GHOST_UINT32_C(0xaf40152d), GHOST_UINT32_C(0xdd0d78ad), GHOST_UINT32_C(0x0f927182),
+            GHOST_UINT32_C(0x3997a3ad), GHOST_UINT32_C(0xeb08aa82), GHOST_UINT32_C(0x9945c702), GHOST_UINT32_C(0x4bdace2d),
+            GHOST_UINT32_C(0xe180eb11), GHOST_UINT32_C(0x331fe23e), GHOST_UINT32_C(0x41528fbe), GHOST_UINT32_C(0x93cd8691),
+            GHOST_UINT32_C(0xa5c854be), GHOST_UINT32_C(0x77575d91), GHOST_UINT32_C(0x051a3011), GHOST_UINT32_C(0xd785393e),
+            GHOST_UINT32_C(0x6911944f), GHOST_UINT32_C(0xbb8e9d60), GHOST_UINT32_C(0xc9c3f0e0), GHOST_UINT32_C(0x1b5cf9cf),
+            GHOST_UINT32_C(0x2d592be0), GHOST_UINT32_C(0xffc622cf), GHOST_UINT32_C(0x8d8b4f4f), GHOST_UINT32_C(0x5f144660),
+            GHOST_UINT32_C(0xdcd373c6), GHOST_UINT32_C(0x0e4c7ae9), GHOST_UINT32_C(0x7c011769), GHOST_UINT32_C(0xae9e1e46),
+            GHOST_UINT32_C(0x989bcc69), GHOST_UINT32_C(0x4a04c546), GHOST_UINT32_C(0x3849a8c6), GHOST_UINT32_C(0xead6a1e9),
+            GHOST_UINT32_C(0x54420c98), GHOST_UINT32_C(0x86dd05b7), GHOST_UINT32_C(0xf4906837), GHOST_UINT32_C(0x260f6118),
+            GHOST_UINT32_C(0x100ab337), GHOST_UINT32_C(0xc295ba18), GHOST_UINT32_C(0xb0d8d798), GHOST_UINT32_C(0x6247deb7),
+            GHOST_UINT32_C(0xc81dfb8b), GHOST_UINT32_C(0x1a82f2a4), GHOST_UINT32_C(0x68cf9f24), GHOST_UINT32_C(0xba50960b),
+            GHOST_UINT32_C(0x8c554424), GHOST_UINT32_C(0x5eca4d0b), GHOST_UINT32_C(0x2c87208b), GHOST_UINT32_C(0xfe1829a4),
+            GHOST_UINT32_C(0x408c84d5), GHOST_UINT32_C(0x92138dfa), GHOST_UINT32_C(0xe05ee07a), GHOST_UINT32_C(0x32c1e955),
+            GHOST_UINT32_C(0x04c43b7a), GHOST_UINT32_C(0xd65b3255), GHOST_UINT32_C(0xa4165fd5), GHOST_UINT32_C(0x768956fa)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0x4904f221), GHOST_UINT32_C(0x9209e442), GHOST_UINT32_C(0xdb0d1663),
+            GHOST_UINT32_C(0x21ffbe75), GHOST_UINT32_C(0x68fb4c54), GHOST_UINT32_C(0xb3f65a37), GHOST_UINT32_C(0xfaf2a816),
+            GHOST_UINT32_C(0x43ff7cea), GHOST_UINT32_C(0x0afb8ecb), GHOST_UINT32_C(0xd1f698a8), GHOST_UINT32_C(0x98f26a89),
+            GHOST_UINT32_C(0x6200c29f), GHOST_UINT32_C(0x2b0430be), GHOST_UINT32_C(0xf00926dd), GHOST_UINT32_C(0xb90dd4fc),
+            GHOST_UINT32_C(0x87fef9d4), GHOST_UINT32_C(0xcefa0bf5), GHOST_UINT32_C(0x15f71d96), GHOST_UINT32_C(0x5cf3efb7),
+            GHOST_UINT32_C(0xa60147a1), GHOST_UINT32_C(0xef05b580), GHOST_UINT32_C(0x3408a3e3), GHOST_UINT32_C(0x7d0c51c2),
+            GHOST_UINT32_C(0xc401853e), GHOST_UINT32_C(0x8d05771f), GHOST_UINT32_C(0x5608617c), GHOST_UINT32_C(0x1f0c935d),
+            GHOST_UINT32_C(0xe5fe3b4b), GHOST_UINT32_C(0xacfac96a), GHOST_UINT32_C(0x77f7df09), GHOST_UINT32_C(0x3ef32d28),
+            GHOST_UINT32_C(0x0a118559), GHOST_UINT32_C(0x43157778), GHOST_UINT32_C(0x9818611b), GHOST_UINT32_C(0xd11c933a),
+            GHOST_UINT32_C(0x2bee3b2c), GHOST_UINT32_C(0x62eac90d), GHOST_UINT32_C(0xb9e7df6e), GHOST_UINT32_C(0xf0e32d4f),
+            GHOST_UINT32_C(0x49eef9b3), GHOST_UINT32_C(0x00ea0b92), GHOST_UINT32_C(0xdbe71df1), GHOST_UINT32_C(0x92e3efd0),
+            GHOST_UINT32_C(0x681147c6), GHOST_UINT32_C(0x2115b5e7), GHOST_UINT32_C(0xfa18a384), GHOST_UINT32_C(0xb31c51a5),
+            GHOST_UINT32_C(0x8def7c8d), GHOST_UINT32_C(0xc4eb8eac), GHOST_UINT32_C(0x1fe698cf), GHOST_UINT32_C(0x56e26aee),
+            GHOST_UINT32_C(0xac10c2f8), GHOST_UINT32_C(0xe51430d9), GHOST_UINT32_C(0x3e1926ba), GHOST_UINT32_C(0x771dd49b),
+            GHOST_UINT32_C(0xce100067), GHOST_UINT32_C(0x8714f246), GHOST_UINT32_C(0x5c19e425), GHOST_UINT32_C(0x151d1604),
+            GHOST_UINT32_C(0xefefbe12), GHOST_UINT32_C(0xa6eb4c33), GHOST_UINT32_C(0x7de65a50), GHOST_UINT32_C(0x34e2a871),
+            GHOST_UINT32_C(0x14230ab2), GHOST_UINT32_C(0x5d27f893), GHOST_UINT32_C(0x862aeef0), GHOST_UINT32_C(0xcf2e1cd1),
+            GHOST_UINT32_C(0x35dcb4c7), GHOST_UINT32_C(0x7cd846e6), GHOST_UINT32_C(0xa7d55085), GHOST_UINT32_C(0xeed1a2a4),
+            GHOST_UINT32_C(0x57dc7658), GHOST_UINT32_C(0x1ed88479), GHOST_UINT32_C(0xc5d5921a), GHOST_UINT32_C(0x8cd1603b),
+            GHOST_UINT32_C(0x7623c82d), GHOST_UINT32_C(0x3f273a0c), GHOST_UINT32_C(0xe42a2c6f), GHOST_UINT32_C(0xad2ede4e),
+            GHOST_UINT32_C(0x93ddf366), GHOST_UINT32_C(0xdad90147), GHOST_UINT32_C(0x01d41724), GHOST_UINT32_C(0x48d0e505),
+            GHOST_UINT32_C(0xb2224d13), GHOST_UINT32_C(0xfb26bf32), GHOST_UINT32_C(0x202ba951), GHOST_UINT32_C(0x692f5b70),
+            GHOST_UINT32_C(0xd0228f8c), GHOST_UINT32_C(0x99267dad), GHOST_UINT32_C(0x422b6bce), GHOST_UINT32_C(0x0b2f99ef),
+            GHOST_UINT32_C(0xf1dd31f9), GHOST_UINT32_C(0xb8d9c3d8), GHOST_UINT32_C(0x63d4d5bb), GHOST_UINT32_C(0x2ad0279a),
+            GHOST_UINT32_C(0x1e328feb), GHOST_UINT32_C(0x57367dca), GHOST_UINT32_C(0x8c3b6ba9), GHOST_UINT32_C(0xc53f9988),
+            GHOST_UINT32_C(0x3fcd319e), GHOST_UINT32_C(0x76c9c3bf), GHOST_UINT32_C(0xadc4d5dc), GHOST_UINT32_C(0xe4c027fd),
+            GHOST_UINT32_C(0x5dcdf301), GHOST_UINT32_C(0x14c90120), GHOST_UINT32_C(0xcfc41743), GHOST_UINT32_C(0x86c0e562),
+            GHOST_UINT32_C(0x7c324d74), GHOST_UINT32_C(0x3536bf55), GHOST_UINT32_C(0xee3ba936), GHOST_UINT32_C(0xa73f5b17),
+            GHOST_UINT32_C(0x99cc763f), GHOST_UINT32_C(0xd0c8841e), GHOST_UINT32_C(0x0bc5927d), GHOST_UINT32_C(0x42c1605c),
+            GHOST_UINT32_C(0xb833c84a), GHOST_UINT32_C(0xf1373a6b), GHOST_UINT32_C(0x2a3a2c08), GHOST_UINT32_C(0x633ede29),
+            GHOST_UINT32_C(0xda330ad5), GHOST_UINT32_C(0x9337f8f4), GHOST_UINT32_C(0x483aee97), GHOST_UINT32_C(0x013e1cb6),
+            GHOST_UINT32_C(0xfbccb4a0), GHOST_UINT32_C(0xb2c84681), GHOST_UINT32_C(0x69c550e2), GHOST_UINT32_C(0x20c1a2c3),
+            GHOST_UINT32_C(0x28461564), GHOST_UINT32_C(0x6142e745), GHOST_UINT32_C(0xba4ff126), GHOST_UINT32_C(0xf34b0307),
+            GHOST_UINT32_C(0x09b9ab11), GHOST_UINT32_C(0x40bd5930), GHOST_UINT32_C(0x9bb04f53), GHOST_UINT32_C(0xd2b4bd72),
+            GHOST_UINT32_C(0x6bb9698e), GHOST_UINT32_C(0x22bd9baf), GHOST_UINT32_C(0xf9b08dcc), GHOST_UINT32_C(0xb0b47fed),
+            GHOST_UINT32_C(0x4a46d7fb), GHOST_UINT32_C(0x034225da), GHOST_UINT32_C(0xd84f33b9), GHOST_UINT32_C(0x914bc198),
+            GHOST_UINT32_C(0xafb8ecb0), GHOST_UINT32_C(0xe6bc1e91), GHOST_UINT32_C(0x3db108f2), GHOST_UINT32_C(0x74b5fad3),
+            GHOST_UINT32_C(0x8e4752c5), GHOST_UINT32_C(0xc743a0e4), GHOST_UINT32_C(0x1c4eb687), GHOST_UINT32_C(0x554a44a6),
+            GHOST_UINT32_C(0xec47905a), GHOST_UINT32_C(0xa543627b), GHOST_UINT32_C(0x7e4e7418), GHOST_UINT32_C(0x374a8639),
+            GHOST_UINT32_C(0xcdb82e2f), GHOST_UINT32_C(0x84bcdc0e), GHOST_UINT32_C(0x5fb1ca6d), GHOST_UINT32_C(0x16b5384c),
+            GHOST_UINT32_C(0x2257903d), GHOST_UINT32_C(0x6b53621c), GHOST_UINT32_C(0xb05e747f), GHOST_UINT32_C(0xf95a865e),
+            GHOST_UINT32_C(0x03a82e48), GHOST_UINT32_C(0x4aacdc69), GHOST_UINT32_C(0x91a1ca0a), GHOST_UINT32_C(0xd8a5382b),
+            GHOST_UINT32_C(0x61a8ecd7), GHOST_UINT32_C(0x28ac1ef6), GHOST_UINT32_C(0xf3a10895), GHOST_UINT32_C(0xbaa5fab4),
+            GHOST_UINT32_C(0x405752a2), GHOST_UINT32_C(0x0953a083), GHOST_UINT32_C(0xd25eb6e0), GHOST_UINT32_C(0x9b5a44c1),
+            GHOST_UINT32_C(0xa5a969e9), GHOST_UINT32_C(0xecad9bc8), GHOST_UINT32_C(0x37a08dab), GHOST_UINT32_C(0x7ea47f8a),
+            GHOST_UINT32_C(0x8456d79c), GHOST_UINT32_C(0xcd5225bd), GHOST_UINT32_C(0x165f33de), GHOST_UINT32_C(0x5f5bc1ff),
+            GHOST_UINT32_C(0xe6561503), GHOST_UINT32_C(0xaf52e722), GHOST_UINT32_C(0x745ff141), GHOST_UINT32_C(0x3d5b0360),
+            GHOST_UINT32_C(0xc7a9ab76), GHOST_UINT32_C(0x8ead5957), GHOST_UINT32_C(0x55a04f34), GHOST_UINT32_C(0x1ca4bd15),
+            GHOST_UINT32_C(0x3c651fd6), GHOST_UINT32_C(0x7561edf7), GHOST_UINT32_C(0xae6cfb94), GHOST_UINT32_C(0xe76809b5),
+            GHOST_UINT32_C(0x1d9aa1a3), GHOST_UINT32_C(0x549e5382), GHOST_UINT32_C(0x8f9345e1), GHOST_UINT32_C(0xc697b7c0),
+            GHOST_UINT32_C(0x7f9a633c), GHOST_UINT32_C(0x369e911d), GHOST_UINT32_C(0xed93877e), GHOST_UINT32_C(0xa497755f),
+            GHOST_UINT32_C(0x5e65dd49), GHOST_UINT32_C(0x17612f68), GHOST_UINT32_C(0xcc6c390b), GHOST_UINT32_C(0x8568cb2a),
+            GHOST_UINT32_C(0xbb9be602), GHOST_UINT32_C(0xf29f1423), GHOST_UINT32_C(0x29920240), GHOST_UINT32_C(0x6096f061),
+            GHOST_UINT32_C(0x9a645877), GHOST_UINT32_C(0xd360aa56), GHOST_UINT32_C(0x086dbc35), GHOST_UINT32_C(0x41694e14),
+            GHOST_UINT32_C(0xf8649ae8), GHOST_UINT32_C(0xb16068c9), GHOST_UINT32_C(0x6a6d7eaa), GHOST_UINT32_C(0x23698c8b),
+            GHOST_UINT32_C(0xd99b249d), GHOST_UINT32_C(0x909fd6bc), GHOST_UINT32_C(0x4b92c0df), GHOST_UINT32_C(0x029632fe),
+            GHOST_UINT32_C(0x36749a8f), GHOST_UINT32_C(0x7f7068ae), GHOST_UINT32_C(0xa47d7ecd), GHOST_UINT32_C(0xed798cec),
+            GHOST_UINT32_C(0x178b24fa), GHOST_UINT32_C(0x5e8fd6db), GHOST_UINT32_C(0x8582c0b8), GHOST_UINT32_C(0xcc863299),
+            GHOST_UINT32_C(0x758be665), GHOST_UINT32_C(0x3c8f1444), GHOST_UINT32_C(0xe7820227), GHOST_UINT32_C(0xae86f006),
+            GHOST_UINT32_C(0x54745810), GHOST_UINT32_C(0x1d70aa31), GHOST_UINT32_C(0xc67dbc52), GHOST_UINT32_C(0x8f794e73),
+            GHOST_UINT32_C(0xb18a635b), GHOST_UINT32_C(0xf88e917a), GHOST_UINT32_C(0x23838719), GHOST_UINT32_C(0x6a877538),
+            GHOST_UINT32_C(0x9075dd2e), GHOST_UINT32_C(0xd9712f0f), GHOST_UINT32_C(0x027c396c), GHOST_UINT32_C(0x4b78cb4d),
+            GHOST_UINT32_C(0xf2751fb1), GHOST_UINT32_C(0xbb71ed90), GHOST_UINT32_C(0x607cfbf3), GHOST_UINT32_C(0x297809d2),
+            GHOST_UINT32_C(0xd38aa1c4), GHOST_UINT32_C(0x9a8e53e5), GHOST_UINT32_C(0x41834586), GHOST_UINT32_C(0x0887b7a7)
+        }
+    };
+    static const ghost_uint32_t short_shift[4][256] = {
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0xdcb17aa4), GHOST_UINT32_C(0xbc8e83b9), GHOST_UINT32_C(0x603ff91d),
+            GHOST_UINT32_C(0x7cf17183), GHOST_UINT32_C(0xa0400b27), GHOST_UINT32_C(0xc07ff23a), GHOST_UINT32_C(0x1cce889e),
+            GHOST_UINT32_C(0xf9e2e306), GHOST_UINT32_C(0x255399a2), GHOST_UINT32_C(0x456c60bf), GHOST_UINT32_C(0x99dd1a1b),
+            GHOST_UINT32_C(0x85139285), GHOST_UINT32_C(0x59a2e821), GHOST_UINT32_C(0x399d113c), GHOST_UINT32_C(0xe52c6b98),
+            GHOST_UINT32_C(0xf629b0fd), GHOST_UINT32_C(0x2a98ca59), GHOST_UINT32_C(0x4aa73344), GHOST_UINT32_C(0x961649e0),
+            GHOST_UINT32_C(0x8ad8c17e), GHOST_UINT32_C(0x5669bbda), GHOST_UINT32_C(0x365642c7), GHOST_UINT32_C(0xeae73863),
+            GHOST_UINT32_C(0x0fcb53fb), GHOST_UINT32_C(0xd37a295f), GHOST_UINT32_C(0xb345d042), GHOST_UINT32_C(0x6ff4aae6),
+            GHOST_UINT32_C(0x733a2278), GHOST_UINT32_C(0xaf8b58dc), GHOST_UINT32_C(0xcfb4a1c1), GHOST_UINT32_C(0x1305db65),
+            GHOST_UINT32_C(0xe9bf170b), GHOST_UINT32_C(0x350e6daf), GHOST_UINT32_C(0x553194b2), GHOST_UINT32_C(0x8980ee16),
+            GHOST_UINT32_C(0x954e6688), GHOST_UINT32_C(0x49ff1c2c), GHOST_UINT32_C(0x29c0e531), GHOST_UINT32_C(0xf5719f95),
+            GHOST_UINT32_C(0x105df40d), GHOST_UINT32_C(0xccec8ea9), GHOST_UINT32_C(0xacd377b4), GHOST_UINT32_C(0x70620d10),
+            GHOST_UINT32_C(0x6cac858e), GHOST_UINT32_C(0xb01dff2a), GHOST_UINT32_C(0xd0220637), GHOST_UINT32_C(0x0c937c93),
+            GHOST_UINT32_C(0x1f96a7f6), GHOST_UINT32_C(0xc327dd52), GHOST_UINT32_C(0xa318244f), GHOST_UINT32_C(0x7fa95eeb),
+            GHOST_UINT32_C(0x6367d675), GHOST_UINT32_C(0xbfd6acd1), GHOST_UINT32_C(0xdfe955cc), GHOST_UINT32_C(0x03582f68),
+            GHOST_UINT32_C(0xe67444f0), GHOST_UINT32_C(0x3ac53e54), GHOST_UINT32_C(0x5afac749), GHOST_UINT32_C(0x864bbded),
+            GHOST_UINT32_C(0x9a853573), GHOST_UINT32_C(0x46344fd7), GHOST_UINT32_C(0x260bb6ca), GHOST_UINT32_C(0xfabacc6e),
+            GHOST_UINT32_C(0xd69258e7), GHOST_UINT32_C(0x0a232243), GHOST_UINT32_C(0x6a1cdb5e), GHOST_UINT32_C(0xb6ada1fa),
+            GHOST_UINT32_C(0xaa632964), GHOST_UINT32_C(0x76d253c0), GHOST_UINT32_C(0x16edaadd), GHOST_UINT32_C(0xca5cd079),
+            GHOST_UINT32_C(0x2f70bbe1), GHOST_UINT32_C(0xf3c1c145), GHOST_UINT32_C(0x93fe3858), GHOST_UINT32_C(0x4f4f42fc),
+            GHOST_UINT32_C(0x5381ca62), GHOST_UINT32_C(0x8f30b0c6), GHOST_UINT32_C(0xef0f49db), GHOST_UINT32_C(0x33be337f),
+            GHOST_UINT32_C(0x20bbe81a), GHOST_UINT32_C(0xfc0a92be), GHOST_UINT32_C(0x9c356ba3), GHOST_UINT32_C(0x40841107),
+            GHOST_UINT32_C(0x5c4a9999), GHOST_UINT32_C(0x80fbe33d), GHOST_UINT32_C(0xe0c41a20), GHOST_UINT32_C(0x3c756084),
+            GHOST_UINT32_C(0xd9590b1c), GHOST_UINT32_C(0x05e871b8), GHOST_UINT32_C(0x65d788a5), GHOST_UINT32_C(0xb966f201),
+            GHOST_UINT32_C(0xa5a87a9f), GHOST_UINT32_C(0x7919003b), GHOST_UINT32_C(0x1926f926), GHOST_UINT32_C(0xc5978382),
+            GHOST_UINT32_C(0x3f2d4fec), GHOST_UINT32_C(0xe39c3548), GHOST_UINT32_C(0x83a3cc55), GHOST_UINT32_C(0x5f12b6f1),
+            GHOST_UINT32_C(0x43dc3e6f), GHOST_UINT32_C(0x9f6d44cb), GHOST_UINT32_C(0xff52bdd6), GHOST_UINT32_C(0x23e3c772),
+            GHOST_UINT32_C(0xc6cfacea), GHOST_UINT32_C(0x1a7ed64e), GHOST_UINT32_C(0x7a412f53), GHOST_UINT32_C(0xa6f055f7),
+            GHOST_UINT32_C(0xba3edd69), GHOST_UINT32_C(0x668fa7cd), GHOST_UINT32_C(0x06b05ed0), GHOST_UINT32_C(0xda012474),
+            GHOST_UINT32_C(0xc904ff11), GHOST_UINT32_C(0x15b585b5), GHOST_UINT32_C(0x758a7ca8), GHOST_UINT32_C(0xa93b060c),
+            GHOST_UINT32_C(0xb5f58e92), GHOST_UINT32_C(0x6944f436), GHOST_UINT32_C(0x097b0d2b), GHOST_UINT32_C(0xd5ca778f),
+            GHOST_UINT32_C(0x30e61c17), GHOST_UINT32_C(0xec5766b3), GHOST_UINT32_C(0x8c689fae), GHOST_UINT32_C(0x50d9e50a),
+            GHOST_UINT32_C(0x4c176d94), GHOST_UINT32_C(0x90a61730), GHOST_UINT32_C(0xf099ee2d), GHOST_UINT32_C(0x2c289489),
+            GHOST_UINT32_C(0xa8c8c73f), GHOST_UINT32_C(0x7479bd9b), GHOST_UINT32_C(0x14464486), GHOST_UINT32_C(0xc8f73e22),
+            GHOST_UINT32_C(0xd439b6bc), GHOST_UINT32_C(0x0888cc18), GHOST_UINT32_C(0x68b73505), GHOST_UINT32_C(0xb4064fa1),
+            GHOST_UINT32_C(0x512a2439), GHOST_UINT32_C(0x8d9b5e9d), GHOST_UINT32_C(0xeda4a780), GHOST_UINT32_C(0x3115dd24),
+            GHOST_UINT32_C(0x2ddb55ba), GHOST_UINT32_C(0xf16a2f1e), GHOST_UINT32_C(0x9155d603), GHOST_UINT32_C(0x4de4aca7),
+            GHOST_UINT32_C(0x5ee177c2), GHOST_UINT32_C(0x82500d66), GHOST_UINT32_C(0xe26ff47b), GHOST_UINT32_C(0x3ede8edf),
+            GHOST_UINT32_C(0x22100641), GHOST_UINT32_C(0xfea17ce5), GHOST_UINT32_C(0x9e9e85f8), GHOST_UINT32_C(0x422fff5c),
+            GHOST_UINT32_C(0xa70394c4), GHOST_UINT32_C(0x7bb2ee60), GHOST_UINT32_C(0x1b8d177d), GHOST_UINT32_C(0xc73c6dd9),
+            GHOST_UINT32_C(0xdbf2e547), GHOST_UINT32_C(0x07439fe3), GHOST_UINT32_C(0x677c66fe), GHOST_UINT32_C(0xbbcd1c5a),
+            GHOST_UINT32_C(0x4177d034), GHOST_UINT32_C(0x9dc6aa90), GHOST_UINT32_C(0xfdf9538d), GHOST_UINT32_C(0x21482929),
+            GHOST_UINT32_C(0x3d86a1b7), GHOST_UINT32_C(0xe137db13), GHOST_UINT32_C(0x8108220e), GHOST_UINT32_C(0x5db958aa),
+            GHOST_UINT32_C(0xb8953332), GHOST_UINT32_C(0x64244996), GHOST_UINT32_C(0x041bb08b), GHOST_UINT32_C(0xd8aaca2f),
+            GHOST_UINT32_C(0xc46442b1), GHOST_UINT32_C(0x18d53815), GHOST_UINT32_C(0x78eac108), GHOST_UINT32_C(0xa45bbbac),
+            GHOST_UINT32_C(0xb75e60c9), GHOST_UINT32_C(0x6bef1a6d), GHOST_UINT32_C(0x0bd0e370), GHOST_UINT32_C(0xd76199d4),
+            GHOST_UINT32_C(0xcbaf114a), GHOST_UINT32_C(0x171e6bee), GHOST_UINT32_C(0x772192f3), GHOST_UINT32_C(0xab90e857),
+            GHOST_UINT32_C(0x4ebc83cf), GHOST_UINT32_C(0x920df96b), GHOST_UINT32_C(0xf2320076), GHOST_UINT32_C(0x2e837ad2),
+            GHOST_UINT32_C(0x324df24c), GHOST_UINT32_C(0xeefc88e8), GHOST_UINT32_C(0x8ec371f5), GHOST_UINT32_C(0x52720b51),
+            GHOST_UINT32_C(0x7e5a9fd8), GHOST_UINT32_C(0xa2ebe57c), GHOST_UINT32_C(0xc2d41c61), GHOST_UINT32_C(0x1e6566c5),
+            GHOST_UINT32_C(0x02abee5b), GHOST_UINT32_C(0xde1a94ff), GHOST_UINT32_C(0xbe256de2), GHOST_UINT32_C(0x62941746),
+            GHOST_UINT32_C(0x87b87cde), GHOST_UINT32_C(0x5b09067a), GHOST_UINT32_C(0x3b36ff67), GHOST_UINT32_C(0xe78785c3),
+            GHOST_UINT32_C(0xfb490d5d), GHOST_UINT32_C(0x27f877f9), GHOST_UINT32_C(0x47c78ee4), GHOST_UINT32_C(0x9b76f440),
+            GHOST_UINT32_C(0x88732f25), GHOST_UINT32_C(0x54c25581), GHOST_UINT32_C(0x34fdac9c), GHOST_UINT32_C(0xe84cd638),
+            GHOST_UINT32_C(0xf4825ea6), GHOST_UINT32_C(0x28332402), GHOST_UINT32_C(0x480cdd1f), GHOST_UINT32_C(0x94bda7bb),
+            GHOST_UINT32_C(0x7191cc23), GHOST_UINT32_C(0xad20b687), GHOST_UINT32_C(0xcd1f4f9a), GHOST_UINT32_C(0x11ae353e),
+            GHOST_UINT32_C(0x0d60bda0), GHOST_UINT32_C(0xd1d1c704), GHOST_UINT32_C(0xb1ee3e19), GHOST_UINT32_C(0x6d5f44bd),
+            GHOST_UINT32_C(0x97e588d3), GHOST_UINT32_C(0x4b54f277), GHOST_UINT32_C(0x2b6b0b6a), GHOST_UINT32_C(0xf7da71ce),
+            GHOST_UINT32_C(0xeb14f950), GHOST_UINT32_C(0x37a583f4), GHOST_UINT32_C(0x579a7ae9), GHOST_UINT32_C(0x8b2b004d),
+            GHOST_UINT32_C(0x6e076bd5), GHOST_UINT32_C(0xb2b61171), GHOST_UINT32_C(0xd289e86c), GHOST_UINT32_C(0x0e3892c8),
+            GHOST_UINT32_C(0x12f61a56), GHOST_UINT32_C(0xce4760f2), GHOST_UINT32_C(0xae7899ef), GHOST_UINT32_C(0x72c9e34b),
+            GHOST_UINT32_C(0x61cc382e), GHOST_UINT32_C(0xbd7d428a), GHOST_UINT32_C(0xdd42bb97), GHOST_UINT32_C(0x01f3c133),
+            GHOST_UINT32_C(0x1d3d49ad), GHOST_UINT32_C(0xc18c3309), GHOST_UINT32_C(0xa1b3ca14), GHOST_UINT32_C(0x7d02b0b0),
+            GHOST_UINT32_C(0x982edb28), GHOST_UINT32_C(0x449fa18c), GHOST_UINT32_C(0x24a05891), GHOST_UINT32_C(0xf8112235),
+            GHOST_UINT32_C(0xe4dfaaab), GHOST_UINT32_C(0x386ed00f), GHOST_UINT32_C(0x58512912), GHOST_UINT32_C(0x84e053b6)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0x547df88f), GHOST_UINT32_C(0xa8fbf11e), GHOST_UINT32_C(0xfc860991),
+            GHOST_UINT32_C(0x541b94cd), GHOST_UINT32_C(0x00666c42), GHOST_UINT32_C(0xfce065d3), GHOST_UINT32_C(0xa89d9d5c),
+            GHOST_UINT32_C(0xa837299a), GHOST_UINT32_C(0xfc4ad115), GHOST_UINT32_C(0x00ccd884), GHOST_UINT32_C(0x54b1200b),
+            GHOST_UINT32_C(0xfc2cbd57), GHOST_UINT32_C(0xa85145d8), GHOST_UINT32_C(0x54d74c49), GHOST_UINT32_C(0x00aab4c6),
+            GHOST_UINT32_C(0x558225c5), GHOST_UINT32_C(0x01ffdd4a), GHOST_UINT32_C(0xfd79d4db), GHOST_UINT32_C(0xa9042c54),
+            GHOST_UINT32_C(0x0199b108), GHOST_UINT32_C(0x55e44987), GHOST_UINT32_C(0xa9624016), GHOST_UINT32_C(0xfd1fb899),
+            GHOST_UINT32_C(0xfdb50c5f), GHOST_UINT32_C(0xa9c8f4d0), GHOST_UINT32_C(0x554efd41), GHOST_UINT32_C(0x013305ce),
+            GHOST_UINT32_C(0xa9ae9892), GHOST_UINT32_C(0xfdd3601d), GHOST_UINT32_C(0x0155698c), GHOST_UINT32_C(0x55289103),
+            GHOST_UINT32_C(0xab044b8a), GHOST_UINT32_C(0xff79b305), GHOST_UINT32_C(0x03ffba94), GHOST_UINT32_C(0x5782421b),
+            GHOST_UINT32_C(0xff1fdf47), GHOST_UINT32_C(0xab6227c8), GHOST_UINT32_C(0x57e42e59), GHOST_UINT32_C(0x0399d6d6),
+            GHOST_UINT32_C(0x03336210), GHOST_UINT32_C(0x574e9a9f), GHOST_UINT32_C(0xabc8930e), GHOST_UINT32_C(0xffb56b81),
+            GHOST_UINT32_C(0x5728f6dd), GHOST_UINT32_C(0x03550e52), GHOST_UINT32_C(0xffd307c3), GHOST_UINT32_C(0xabaeff4c),
+            GHOST_UINT32_C(0xfe866e4f), GHOST_UINT32_C(0xaafb96c0), GHOST_UINT32_C(0x567d9f51), GHOST_UINT32_C(0x020067de),
+            GHOST_UINT32_C(0xaa9dfa82), GHOST_UINT32_C(0xfee0020d), GHOST_UINT32_C(0x02660b9c), GHOST_UINT32_C(0x561bf313),
+            GHOST_UINT32_C(0x56b147d5), GHOST_UINT32_C(0x02ccbf5a), GHOST_UINT32_C(0xfe4ab6cb), GHOST_UINT32_C(0xaa374e44),
+            GHOST_UINT32_C(0x02aad318), GHOST_UINT32_C(0x56d72b97), GHOST_UINT32_C(0xaa512206), GHOST_UINT32_C(0xfe2cda89),
+            GHOST_UINT32_C(0x53e4e1e5), GHOST_UINT32_C(0x0799196a), GHOST_UINT32_C(0xfb1f10fb), GHOST_UINT32_C(0xaf62e874),
+            GHOST_UINT32_C(0x07ff7528), GHOST_UINT32_C(0x53828da7), GHOST_UINT32_C(0xaf048436), GHOST_UINT32_C(0xfb797cb9),
+            GHOST_UINT32_C(0xfbd3c87f), GHOST_UINT32_C(0xafae30f0), GHOST_UINT32_C(0x53283961), GHOST_UINT32_C(0x0755c1ee),
+            GHOST_UINT32_C(0xafc85cb2), GHOST_UINT32_C(0xfbb5a43d), GHOST_UINT32_C(0x0733adac), GHOST_UINT32_C(0x534e5523),
+            GHOST_UINT32_C(0x0666c420), GHOST_UINT32_C(0x521b3caf), GHOST_UINT32_C(0xae9d353e), GHOST_UINT32_C(0xfae0cdb1),
+            GHOST_UINT32_C(0x527d50ed), GHOST_UINT32_C(0x0600a862), GHOST_UINT32_C(0xfa86a1f3), GHOST_UINT32_C(0xaefb597c),
+            GHOST_UINT32_C(0xae51edba), GHOST_UINT32_C(0xfa2c1535), GHOST_UINT32_C(0x06aa1ca4), GHOST_UINT32_C(0x52d7e42b),
+            GHOST_UINT32_C(0xfa4a7977), GHOST_UINT32_C(0xae3781f8), GHOST_UINT32_C(0x52b18869), GHOST_UINT32_C(0x06cc70e6),
+            GHOST_UINT32_C(0xf8e0aa6f), GHOST_UINT32_C(0xac9d52e0), GHOST_UINT32_C(0x501b5b71), GHOST_UINT32_C(0x0466a3fe),
+            GHOST_UINT32_C(0xacfb3ea2), GHOST_UINT32_C(0xf886c62d), GHOST_UINT32_C(0x0400cfbc), GHOST_UINT32_C(0x507d3733),
+            GHOST_UINT32_C(0x50d783f5), GHOST_UINT32_C(0x04aa7b7a), GHOST_UINT32_C(0xf82c72eb), GHOST_UINT32_C(0xac518a64),
+            GHOST_UINT32_C(0x04cc1738), GHOST_UINT32_C(0x50b1efb7), GHOST_UINT32_C(0xac37e626), GHOST_UINT32_C(0xf84a1ea9),
+            GHOST_UINT32_C(0xad628faa), GHOST_UINT32_C(0xf91f7725), GHOST_UINT32_C(0x05997eb4), GHOST_UINT32_C(0x51e4863b),
+            GHOST_UINT32_C(0xf9791b67), GHOST_UINT32_C(0xad04e3e8), GHOST_UINT32_C(0x5182ea79), GHOST_UINT32_C(0x05ff12f6),
+            GHOST_UINT32_C(0x0555a630), GHOST_UINT32_C(0x51285ebf), GHOST_UINT32_C(0xadae572e), GHOST_UINT32_C(0xf9d3afa1),
+            GHOST_UINT32_C(0x514e32fd), GHOST_UINT32_C(0x0533ca72), GHOST_UINT32_C(0xf9b5c3e3), GHOST_UINT32_C(0xadc83b6c),
+            GHOST_UINT32_C(0xa7c9c3ca), GHOST_UINT32_C(0xf3b43b45), GHOST_UINT32_C(0x0f3232d4), GHOST_UINT32_C(0x5b4fca5b),
+            GHOST_UINT32_C(0xf3d25707), GHOST_UINT32_C(0xa7afaf88), GHOST_UINT32_C(0x5b29a619), GHOST_UINT32_C(0x0f545e96),
+            GHOST_UINT32_C(0x0ffeea50), GHOST_UINT32_C(0x5b8312df), GHOST_UINT32_C(0xa7051b4e), GHOST_UINT32_C(0xf378e3c1),
+            GHOST_UINT32_C(0x5be57e9d), GHOST_UINT32_C(0x0f988612), GHOST_UINT32_C(0xf31e8f83), GHOST_UINT32_C(0xa763770c),
+            GHOST_UINT32_C(0xf24be60f), GHOST_UINT32_C(0xa6361e80), GHOST_UINT32_C(0x5ab01711), GHOST_UINT32_C(0x0ecdef9e),
+            GHOST_UINT32_C(0xa65072c2), GHOST_UINT32_C(0xf22d8a4d), GHOST_UINT32_C(0x0eab83dc), GHOST_UINT32_C(0x5ad67b53),
+            GHOST_UINT32_C(0x5a7ccf95), GHOST_UINT32_C(0x0e01371a), GHOST_UINT32_C(0xf2873e8b), GHOST_UINT32_C(0xa6fac604),
+            GHOST_UINT32_C(0x0e675b58), GHOST_UINT32_C(0x5a1aa3d7), GHOST_UINT32_C(0xa69caa46), GHOST_UINT32_C(0xf2e152c9),
+            GHOST_UINT32_C(0x0ccd8840), GHOST_UINT32_C(0x58b070cf), GHOST_UINT32_C(0xa436795e), GHOST_UINT32_C(0xf04b81d1),
+            GHOST_UINT32_C(0x58d61c8d), GHOST_UINT32_C(0x0cabe402), GHOST_UINT32_C(0xf02ded93), GHOST_UINT32_C(0xa450151c),
+            GHOST_UINT32_C(0xa4faa1da), GHOST_UINT32_C(0xf0875955), GHOST_UINT32_C(0x0c0150c4), GHOST_UINT32_C(0x587ca84b),
+            GHOST_UINT32_C(0xf0e13517), GHOST_UINT32_C(0xa49ccd98), GHOST_UINT32_C(0x581ac409), GHOST_UINT32_C(0x0c673c86),
+            GHOST_UINT32_C(0x594fad85), GHOST_UINT32_C(0x0d32550a), GHOST_UINT32_C(0xf1b45c9b), GHOST_UINT32_C(0xa5c9a414),
+            GHOST_UINT32_C(0x0d543948), GHOST_UINT32_C(0x5929c1c7), GHOST_UINT32_C(0xa5afc856), GHOST_UINT32_C(0xf1d230d9),
+            GHOST_UINT32_C(0xf178841f), GHOST_UINT32_C(0xa5057c90), GHOST_UINT32_C(0x59837501), GHOST_UINT32_C(0x0dfe8d8e),
+            GHOST_UINT32_C(0xa56310d2), GHOST_UINT32_C(0xf11ee85d), GHOST_UINT32_C(0x0d98e1cc), GHOST_UINT32_C(0x59e51943),
+            GHOST_UINT32_C(0xf42d222f), GHOST_UINT32_C(0xa050daa0), GHOST_UINT32_C(0x5cd6d331), GHOST_UINT32_C(0x08ab2bbe),
+            GHOST_UINT32_C(0xa036b6e2), GHOST_UINT32_C(0xf44b4e6d), GHOST_UINT32_C(0x08cd47fc), GHOST_UINT32_C(0x5cb0bf73),
+            GHOST_UINT32_C(0x5c1a0bb5), GHOST_UINT32_C(0x0867f33a), GHOST_UINT32_C(0xf4e1faab), GHOST_UINT32_C(0xa09c0224),
+            GHOST_UINT32_C(0x08019f78), GHOST_UINT32_C(0x5c7c67f7), GHOST_UINT32_C(0xa0fa6e66), GHOST_UINT32_C(0xf48796e9),
+            GHOST_UINT32_C(0xa1af07ea), GHOST_UINT32_C(0xf5d2ff65), GHOST_UINT32_C(0x0954f6f4), GHOST_UINT32_C(0x5d290e7b),
+            GHOST_UINT32_C(0xf5b49327), GHOST_UINT32_C(0xa1c96ba8), GHOST_UINT32_C(0x5d4f6239), GHOST_UINT32_C(0x09329ab6),
+            GHOST_UINT32_C(0x09982e70), GHOST_UINT32_C(0x5de5d6ff), GHOST_UINT32_C(0xa163df6e), GHOST_UINT32_C(0xf51e27e1),
+            GHOST_UINT32_C(0x5d83babd), GHOST_UINT32_C(0x09fe4232), GHOST_UINT32_C(0xf5784ba3), GHOST_UINT32_C(0xa105b32c),
+            GHOST_UINT32_C(0x5f2969a5), GHOST_UINT32_C(0x0b54912a), GHOST_UINT32_C(0xf7d298bb), GHOST_UINT32_C(0xa3af6034),
+            GHOST_UINT32_C(0x0b32fd68), GHOST_UINT32_C(0x5f4f05e7), GHOST_UINT32_C(0xa3c90c76), GHOST_UINT32_C(0xf7b4f4f9),
+            GHOST_UINT32_C(0xf71e403f), GHOST_UINT32_C(0xa363b8b0), GHOST_UINT32_C(0x5fe5b121), GHOST_UINT32_C(0x0b9849ae),
+            GHOST_UINT32_C(0xa305d4f2), GHOST_UINT32_C(0xf7782c7d), GHOST_UINT32_C(0x0bfe25ec), GHOST_UINT32_C(0x5f83dd63),
+            GHOST_UINT32_C(0x0aab4c60), GHOST_UINT32_C(0x5ed6b4ef), GHOST_UINT32_C(0xa250bd7e), GHOST_UINT32_C(0xf62d45f1),
+            GHOST_UINT32_C(0x5eb0d8ad), GHOST_UINT32_C(0x0acd2022), GHOST_UINT32_C(0xf64b29b3), GHOST_UINT32_C(0xa236d13c),
+            GHOST_UINT32_C(0xa29c65fa), GHOST_UINT32_C(0xf6e19d75), GHOST_UINT32_C(0x0a6794e4), GHOST_UINT32_C(0x5e1a6c6b),
+            GHOST_UINT32_C(0xf687f137), GHOST_UINT32_C(0xa2fa09b8), GHOST_UINT32_C(0x5e7c0029), GHOST_UINT32_C(0x0a01f8a6)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0x4a7ff165), GHOST_UINT32_C(0x94ffe2ca), GHOST_UINT32_C(0xde8013af),
+            GHOST_UINT32_C(0x2c13b365), GHOST_UINT32_C(0x666c4200), GHOST_UINT32_C(0xb8ec51af), GHOST_UINT32_C(0xf293a0ca),
+            GHOST_UINT32_C(0x582766ca), GHOST_UINT32_C(0x125897af), GHOST_UINT32_C(0xccd88400), GHOST_UINT32_C(0x86a77565),
+            GHOST_UINT32_C(0x7434d5af), GHOST_UINT32_C(0x3e4b24ca), GHOST_UINT32_C(0xe0cb3765), GHOST_UINT32_C(0xaab4c600),
+            GHOST_UINT32_C(0xb04ecd94), GHOST_UINT32_C(0xfa313cf1), GHOST_UINT32_C(0x24b12f5e), GHOST_UINT32_C(0x6ecede3b),
+            GHOST_UINT32_C(0x9c5d7ef1), GHOST_UINT32_C(0xd6228f94), GHOST_UINT32_C(0x08a29c3b), GHOST_UINT32_C(0x42dd6d5e),
+            GHOST_UINT32_C(0xe869ab5e), GHOST_UINT32_C(0xa2165a3b), GHOST_UINT32_C(0x7c964994), GHOST_UINT32_C(0x36e9b8f1),
+            GHOST_UINT32_C(0xc47a183b), GHOST_UINT32_C(0x8e05e95e), GHOST_UINT32_C(0x5085faf1), GHOST_UINT32_C(0x1afa0b94),
+            GHOST_UINT32_C(0x6571edd9), GHOST_UINT32_C(0x2f0e1cbc), GHOST_UINT32_C(0xf18e0f13), GHOST_UINT32_C(0xbbf1fe76),
+            GHOST_UINT32_C(0x49625ebc), GHOST_UINT32_C(0x031dafd9), GHOST_UINT32_C(0xdd9dbc76), GHOST_UINT32_C(0x97e24d13),
+            GHOST_UINT32_C(0x3d568b13), GHOST_UINT32_C(0x77297a76), GHOST_UINT32_C(0xa9a969d9), GHOST_UINT32_C(0xe3d698bc),
+            GHOST_UINT32_C(0x11453876), GHOST_UINT32_C(0x5b3ac913), GHOST_UINT32_C(0x85badabc), GHOST_UINT32_C(0xcfc52bd9),
+            GHOST_UINT32_C(0xd53f204d), GHOST_UINT32_C(0x9f40d128), GHOST_UINT32_C(0x41c0c287), GHOST_UINT32_C(0x0bbf33e2),
+            GHOST_UINT32_C(0xf92c9328), GHOST_UINT32_C(0xb353624d), GHOST_UINT32_C(0x6dd371e2), GHOST_UINT32_C(0x27ac8087),
+            GHOST_UINT32_C(0x8d184687), GHOST_UINT32_C(0xc767b7e2), GHOST_UINT32_C(0x19e7a44d), GHOST_UINT32_C(0x53985528),
+            GHOST_UINT32_C(0xa10bf5e2), GHOST_UINT32_C(0xeb740487), GHOST_UINT32_C(0x35f41728), GHOST_UINT32_C(0x7f8be64d),
+            GHOST_UINT32_C(0xcae3dbb2), GHOST_UINT32_C(0x809c2ad7), GHOST_UINT32_C(0x5e1c3978), GHOST_UINT32_C(0x1463c81d),
+            GHOST_UINT32_C(0xe6f068d7), GHOST_UINT32_C(0xac8f99b2), GHOST_UINT32_C(0x720f8a1d), GHOST_UINT32_C(0x38707b78),
+            GHOST_UINT32_C(0x92c4bd78), GHOST_UINT32_C(0xd8bb4c1d), GHOST_UINT32_C(0x063b5fb2), GHOST_UINT32_C(0x4c44aed7),
+            GHOST_UINT32_C(0xbed70e1d), GHOST_UINT32_C(0xf4a8ff78), GHOST_UINT32_C(0x2a28ecd7), GHOST_UINT32_C(0x60571db2),
+            GHOST_UINT32_C(0x7aad1626), GHOST_UINT32_C(0x30d2e743), GHOST_UINT32_C(0xee52f4ec), GHOST_UINT32_C(0xa42d0589),
+            GHOST_UINT32_C(0x56bea543), GHOST_UINT32_C(0x1cc15426), GHOST_UINT32_C(0xc2414789), GHOST_UINT32_C(0x883eb6ec),
+            GHOST_UINT32_C(0x228a70ec), GHOST_UINT32_C(0x68f58189), GHOST_UINT32_C(0xb6759226), GHOST_UINT32_C(0xfc0a6343),
+            GHOST_UINT32_C(0x0e99c389), GHOST_UINT32_C(0x44e632ec), GHOST_UINT32_C(0x9a662143), GHOST_UINT32_C(0xd019d026),
+            GHOST_UINT32_C(0xaf92366b), GHOST_UINT32_C(0xe5edc70e), GHOST_UINT32_C(0x3b6dd4a1), GHOST_UINT32_C(0x711225c4),
+            GHOST_UINT32_C(0x8381850e), GHOST_UINT32_C(0xc9fe746b), GHOST_UINT32_C(0x177e67c4), GHOST_UINT32_C(0x5d0196a1),
+            GHOST_UINT32_C(0xf7b550a1), GHOST_UINT32_C(0xbdcaa1c4), GHOST_UINT32_C(0x634ab26b), GHOST_UINT32_C(0x2935430e),
+            GHOST_UINT32_C(0xdba6e3c4), GHOST_UINT32_C(0x91d912a1), GHOST_UINT32_C(0x4f59010e), GHOST_UINT32_C(0x0526f06b),
+            GHOST_UINT32_C(0x1fdcfbff), GHOST_UINT32_C(0x55a30a9a), GHOST_UINT32_C(0x8b231935), GHOST_UINT32_C(0xc15ce850),
+            GHOST_UINT32_C(0x33cf489a), GHOST_UINT32_C(0x79b0b9ff), GHOST_UINT32_C(0xa730aa50), GHOST_UINT32_C(0xed4f5b35),
+            GHOST_UINT32_C(0x47fb9d35), GHOST_UINT32_C(0x0d846c50), GHOST_UINT32_C(0xd3047fff), GHOST_UINT32_C(0x997b8e9a),
+            GHOST_UINT32_C(0x6be82e50), GHOST_UINT32_C(0x2197df35), GHOST_UINT32_C(0xff17cc9a), GHOST_UINT32_C(0xb5683dff),
+            GHOST_UINT32_C(0x902bc195), GHOST_UINT32_C(0xda5430f0), GHOST_UINT32_C(0x04d4235f), GHOST_UINT32_C(0x4eabd23a),
+            GHOST_UINT32_C(0xbc3872f0), GHOST_UINT32_C(0xf6478395), GHOST_UINT32_C(0x28c7903a), GHOST_UINT32_C(0x62b8615f),
+            GHOST_UINT32_C(0xc80ca75f), GHOST_UINT32_C(0x8273563a), GHOST_UINT32_C(0x5cf34595), GHOST_UINT32_C(0x168cb4f0),
+            GHOST_UINT32_C(0xe41f143a), GHOST_UINT32_C(0xae60e55f), GHOST_UINT32_C(0x70e0f6f0), GHOST_UINT32_C(0x3a9f0795),
+            GHOST_UINT32_C(0x20650c01), GHOST_UINT32_C(0x6a1afd64), GHOST_UINT32_C(0xb49aeecb), GHOST_UINT32_C(0xfee51fae),
+            GHOST_UINT32_C(0x0c76bf64), GHOST_UINT32_C(0x46094e01), GHOST_UINT32_C(0x98895dae), GHOST_UINT32_C(0xd2f6accb),
+            GHOST_UINT32_C(0x78426acb), GHOST_UINT32_C(0x323d9bae), GHOST_UINT32_C(0xecbd8801), GHOST_UINT32_C(0xa6c27964),
+            GHOST_UINT32_C(0x5451d9ae), GHOST_UINT32_C(0x1e2e28cb), GHOST_UINT32_C(0xc0ae3b64), GHOST_UINT32_C(0x8ad1ca01),
+            GHOST_UINT32_C(0xf55a2c4c), GHOST_UINT32_C(0xbf25dd29), GHOST_UINT32_C(0x61a5ce86), GHOST_UINT32_C(0x2bda3fe3),
+            GHOST_UINT32_C(0xd9499f29), GHOST_UINT32_C(0x93366e4c), GHOST_UINT32_C(0x4db67de3), GHOST_UINT32_C(0x07c98c86),
+            GHOST_UINT32_C(0xad7d4a86), GHOST_UINT32_C(0xe702bbe3), GHOST_UINT32_C(0x3982a84c), GHOST_UINT32_C(0x73fd5929),
+            GHOST_UINT32_C(0x816ef9e3), GHOST_UINT32_C(0xcb110886), GHOST_UINT32_C(0x15911b29), GHOST_UINT32_C(0x5feeea4c),
+            GHOST_UINT32_C(0x4514e1d8), GHOST_UINT32_C(0x0f6b10bd), GHOST_UINT32_C(0xd1eb0312), GHOST_UINT32_C(0x9b94f277),
+            GHOST_UINT32_C(0x690752bd), GHOST_UINT32_C(0x2378a3d8), GHOST_UINT32_C(0xfdf8b077), GHOST_UINT32_C(0xb7874112),
+            GHOST_UINT32_C(0x1d338712), GHOST_UINT32_C(0x574c7677), GHOST_UINT32_C(0x89cc65d8), GHOST_UINT32_C(0xc3b394bd),
+            GHOST_UINT32_C(0x31203477), GHOST_UINT32_C(0x7b5fc512), GHOST_UINT32_C(0xa5dfd6bd), GHOST_UINT32_C(0xefa027d8),
+            GHOST_UINT32_C(0x5ac81a27), GHOST_UINT32_C(0x10b7eb42), GHOST_UINT32_C(0xce37f8ed), GHOST_UINT32_C(0x84480988),
+            GHOST_UINT32_C(0x76dba942), GHOST_UINT32_C(0x3ca45827), GHOST_UINT32_C(0xe2244b88), GHOST_UINT32_C(0xa85bbaed),
+            GHOST_UINT32_C(0x02ef7ced), GHOST_UINT32_C(0x48908d88), GHOST_UINT32_C(0x96109e27), GHOST_UINT32_C(0xdc6f6f42),
+            GHOST_UINT32_C(0x2efccf88), GHOST_UINT32_C(0x64833eed), GHOST_UINT32_C(0xba032d42), GHOST_UINT32_C(0xf07cdc27),
+            GHOST_UINT32_C(0xea86d7b3), GHOST_UINT32_C(0xa0f926d6), GHOST_UINT32_C(0x7e793579), GHOST_UINT32_C(0x3406c41c),
+            GHOST_UINT32_C(0xc69564d6), GHOST_UINT32_C(0x8cea95b3), GHOST_UINT32_C(0x526a861c), GHOST_UINT32_C(0x18157779),
+            GHOST_UINT32_C(0xb2a1b179), GHOST_UINT32_C(0xf8de401c), GHOST_UINT32_C(0x265e53b3), GHOST_UINT32_C(0x6c21a2d6),
+            GHOST_UINT32_C(0x9eb2021c), GHOST_UINT32_C(0xd4cdf379), GHOST_UINT32_C(0x0a4de0d6), GHOST_UINT32_C(0x403211b3),
+            GHOST_UINT32_C(0x3fb9f7fe), GHOST_UINT32_C(0x75c6069b), GHOST_UINT32_C(0xab461534), GHOST_UINT32_C(0xe139e451),
+            GHOST_UINT32_C(0x13aa449b), GHOST_UINT32_C(0x59d5b5fe), GHOST_UINT32_C(0x8755a651), GHOST_UINT32_C(0xcd2a5734),
+            GHOST_UINT32_C(0x679e9134), GHOST_UINT32_C(0x2de16051), GHOST_UINT32_C(0xf36173fe), GHOST_UINT32_C(0xb91e829b),
+            GHOST_UINT32_C(0x4b8d2251), GHOST_UINT32_C(0x01f2d334), GHOST_UINT32_C(0xdf72c09b), GHOST_UINT32_C(0x950d31fe),
+            GHOST_UINT32_C(0x8ff73a6a), GHOST_UINT32_C(0xc588cb0f), GHOST_UINT32_C(0x1b08d8a0), GHOST_UINT32_C(0x517729c5),
+            GHOST_UINT32_C(0xa3e4890f), GHOST_UINT32_C(0xe99b786a), GHOST_UINT32_C(0x371b6bc5), GHOST_UINT32_C(0x7d649aa0),
+            GHOST_UINT32_C(0xd7d05ca0), GHOST_UINT32_C(0x9dafadc5), GHOST_UINT32_C(0x432fbe6a), GHOST_UINT32_C(0x09504f0f),
+            GHOST_UINT32_C(0xfbc3efc5), GHOST_UINT32_C(0xb1bc1ea0), GHOST_UINT32_C(0x6f3c0d0f), GHOST_UINT32_C(0x2543fc6a)
+        },
+        {
+            GHOST_UINT32_C(0x00000000), GHOST_UINT32_C(0x25bbf5db), GHOST_UINT32_C(0x4b77ebb6), GHOST_UINT32_C(0x6ecc1e6d),
+            GHOST_UINT32_C(0x96efd76c), GHOST_UINT32_C(0xb35422b7), GHOST_UINT32_C(0xdd983cda), GHOST_UINT32_C(0xf823c901),
+            GHOST_UINT32_C(0x2833d829), GHOST_UINT32_C(0x0d882df2), GHOST_UINT32_C(0x6344339f), GHOST_UINT32_C(0x46ffc644),
+            GHOST_UINT32_C(0xbedc0f45), GHOST_UINT32_C(0x9b67fa9e), GHOST_UINT32_C(0xf5abe4f3), GHOST_UINT32_C(0xd0101128),
+            GHOST_UINT32_C(0x5067b052), GHOST_UINT32_C(0x75dc4589), GHOST_UINT32_C(0x1b105be4), GHOST_UINT32_C(0x3eabae3f),
+            GHOST_UINT32_C(0xc688673e), GHOST_UINT32_C(0xe33392e5), GHOST_UINT32_C(0x8dff8c88), GHOST_UINT32_C(0xa8447953),
+            GHOST_UINT32_C(0x7854687b), GHOST_UINT32_C(0x5def9da0), GHOST_UINT32_C(0x332383cd), GHOST_UINT32_C(0x16987616),
+            GHOST_UINT32_C(0xeebbbf17), GHOST_UINT32_C(0xcb004acc), GHOST_UINT32_C(0xa5cc54a1), GHOST_UINT32_C(0x8077a17a),
+            GHOST_UINT32_C(0xa0cf60a4), GHOST_UINT32_C(0x8574957f), GHOST_UINT32_C(0xebb88b12), GHOST_UINT32_C(0xce037ec9),
+            GHOST_UINT32_C(0x3620b7c8), GHOST_UINT32_C(0x139b4213), GHOST_UINT32_C(0x7d575c7e), GHOST_UINT32_C(0x58eca9a5),
+            GHOST_UINT32_C(0x88fcb88d), GHOST_UINT32_C(0xad474d56), GHOST_UINT32_C(0xc38b533b), GHOST_UINT32_C(0xe630a6e0),
+            GHOST_UINT32_C(0x1e136fe1), GHOST_UINT32_C(0x3ba89a3a), GHOST_UINT32_C(0x55648457), GHOST_UINT32_C(0x70df718c),
+            GHOST_UINT32_C(0xf0a8d0f6), GHOST_UINT32_C(0xd513252d), GHOST_UINT32_C(0xbbdf3b40), GHOST_UINT32_C(0x9e64ce9b),
+            GHOST_UINT32_C(0x6647079a), GHOST_UINT32_C(0x43fcf241), GHOST_UINT32_C(0x2d30ec2c), GHOST_UINT32_C(0x088b19f7),
+            GHOST_UINT32_C(0xd89b08df), GHOST_UINT32_C(0xfd20fd04), GHOST_UINT32_C(0x93ece369), GHOST_UINT32_C(0xb65716b2),
+            GHOST_UINT32_C(0x4e74dfb3), GHOST_UINT32_C(0x6bcf2a68), GHOST_UINT32_C(0x05033405), GHOST_UINT32_C(0x20b8c1de),
+            GHOST_UINT32_C(0x4472b7b9), GHOST_UINT32_C(0x61c94262), GHOST_UINT32_C(0x0f055c0f), GHOST_UINT32_C(0x2abea9d4),
+            GHOST_UINT32_C(0xd29d60d5), GHOST_UINT32_C(0xf726950e), GHOST_UINT32_C(0x99ea8b63), GHOST_UINT32_C(0xbc517eb8),
+            GHOST_UINT32_C(0x6c416f90), GHOST_UINT32_C(0x49fa9a4b), GHOST_UINT32_C(0x27368426), GHOST_UINT32_C(0x028d71fd),
+            GHOST_UINT32_C(0xfaaeb8fc), GHOST_UINT32_C(0xdf154d27), GHOST_UINT32_C(0xb1d9534a), GHOST_UINT32_C(0x9462a691),
+            GHOST_UINT32_C(0x141507eb), GHOST_UINT32_C(0x31aef230), GHOST_UINT32_C(0x5f62ec5d), GHOST_UINT32_C(0x7ad91986),
+            GHOST_UINT32_C(0x82fad087), GHOST_UINT32_C(0xa741255c), GHOST_UINT32_C(0xc98d3b31), GHOST_UINT32_C(0xec36ceea),
+            GHOST_UINT32_C(0x3c26dfc2), GHOST_UINT32_C(0x199d2a19), GHOST_UINT32_C(0x77513474), GHOST_UINT32_C(0x52eac1af),
+            GHOST_UINT32_C(0xaac908ae), GHOST_UINT32_C(0x8f72fd75), GHOST_UINT32_C(0xe1bee318), GHOST_UINT32_C(0xc40516c3),
+            GHOST_UINT32_C(0xe4bdd71d), GHOST_UINT32_C(0xc10622c6), GHOST_UINT32_C(0xafca3cab), GHOST_UINT32_C(0x8a71c970),
+            GHOST_UINT32_C(0x72520071), GHOST_UINT32_C(0x57e9f5aa), GHOST_UINT32_C(0x3925ebc7), GHOST_UINT32_C(0x1c9e1e1c),
+            GHOST_UINT32_C(0xcc8e0f34), GHOST_UINT32_C(0xe935faef), GHOST_UINT32_C(0x87f9e482), GHOST_UINT32_C(0xa2421159),
+            GHOST_UINT32_C(0x5a61d858), GHOST_UINT32_C(0x7fda2d83), GHOST_UINT32_C(0x111633ee), GHOST_UINT32_C(0x34adc635),
+            GHOST_UINT32_C(0xb4da674f), GHOST_UINT32_C(0x91619294), GHOST_UINT32_C(0xffad8cf9), GHOST_UINT32_C(0xda167922),
+            GHOST_UINT32_C(0x2235b023), GHOST_UINT32_C(0x078e45f8), GHOST_UINT32_C(0x69425b95), GHOST_UINT32_C(0x4cf9ae4e),
+            GHOST_UINT32_C(0x9ce9bf66), GHOST_UINT32_C(0xb9524abd), GHOST_UINT32_C(0xd79e54d0), GHOST_UINT32_C(0xf225a10b),
+            GHOST_UINT32_C(0x0a06680a), GHOST_UINT32_C(0x2fbd9dd1), GHOST_UINT32_C(0x417183bc), GHOST_UINT32_C(0x64ca7667),
+            GHOST_UINT32_C(0x88e56f72), GHOST_UINT32_C(0xad5e9aa9), GHOST_UINT32_C(0xc39284c4), GHOST_UINT32_C(0xe629711f),
+            GHOST_UINT32_C(0x1e0ab81e), GHOST_UINT32_C(0x3bb14dc5), GHOST_UINT32_C(0x557d53a8), GHOST_UINT32_C(0x70c6a673),
+            GHOST_UINT32_C(0xa0d6b75b), GHOST_UINT32_C(0x856d4280), GHOST_UINT32_C(0xeba15ced), GHOST_UINT32_C(0xce1aa936),
+            GHOST_UINT32_C(0x36396037), GHOST_UINT32_C(0x138295ec), GHOST_UINT32_C(0x7d4e8b81), GHOST_UINT32_C(0x58f57e5a),
+            GHOST_UINT32_C(0xd882df20), GHOST_UINT32_C(0xfd392afb), GHOST_UINT32_C(0x93f53496), GHOST_UINT32_C(0xb64ec14d),
+            GHOST_UINT32_C(0x4e6d084c), GHOST_UINT32_C(0x6bd6fd97), GHOST_UINT32_C(0x051ae3fa), GHOST_UINT32_C(0x20a11621),
+            GHOST_UINT32_C(0xf0b10709), GHOST_UINT32_C(0xd50af2d2), GHOST_UINT32_C(0xbbc6ecbf), GHOST_UINT32_C(0x9e7d1964),
+            GHOST_UINT32_C(0x665ed065), GHOST_UINT32_C(0x43e525be), GHOST_UINT32_C(0x2d293bd3), GHOST_UINT32_C(0x0892ce08),
+            GHOST_UINT32_C(0x282a0fd6), GHOST_UINT32_C(0x0d91fa0d), GHOST_UINT32_C(0x635de460), GHOST_UINT32_C(0x46e611bb),
+            GHOST_UINT32_C(0xbec5d8ba), GHOST_UINT32_C(0x9b7e2d61), GHOST_UINT32_C(0xf5b2330c), GHOST_UINT32_C(0xd009c6d7),
+            GHOST_UINT32_C(0x0019d7ff), GHOST_UINT32_C(0x25a22224), GHOST_UINT32_C(0x4b6e3c49), GHOST_UINT32_C(0x6ed5c992),
+            GHOST_UINT32_C(0x96f60093), GHOST_UINT32_C(0xb34df548), GHOST_UINT32_C(0xdd81eb25), GHOST_UINT32_C(0xf83a1efe),
+            GHOST_UINT32_C(0x784dbf84), GHOST_UINT32_C(0x5df64a5f), GHOST_UINT32_C(0x333a5432), GHOST_UINT32_C(0x1681a1e9),
+            GHOST_UINT32_C(0xeea268e8), GHOST_UINT32_C(0xcb199d33), GHOST_UINT32_C(0xa5d5835e), GHOST_UINT32_C(0x806e7685),
+            GHOST_UINT32_C(0x507e67ad), GHOST_UINT32_C(0x75c59276), GHOST_UINT32_C(0x1b098c1b), GHOST_UINT32_C(0x3eb279c0),
+            GHOST_UINT32_C(0xc691b0c1), GHOST_UINT32_C(0xe32a451a), GHOST_UINT32_C(0x8de65b77), GHOST_UINT32_C(0xa85daeac),
+            GHOST_UINT32_C(0xcc97d8cb), GHOST_UINT32_C(0xe92c2d10), GHOST_UINT32_C(0x87e0337d), GHOST_UINT32_C(0xa25bc6a6),
+            GHOST_UINT32_C(0x5a780fa7), GHOST_UINT32_C(0x7fc3fa7c), GHOST_UINT32_C(0x110fe411), GHOST_UINT32_C(0x34b411ca),
+            GHOST_UINT32_C(0xe4a400e2), GHOST_UINT32_C(0xc11ff539), GHOST_UINT32_C(0xafd3eb54), GHOST_UINT32_C(0x8a681e8f),
+            GHOST_UINT32_C(0x724bd78e), GHOST_UINT32_C(0x57f02255), GHOST_UINT32_C(0x393c3c38), GHOST_UINT32_C(0x1c87c9e3),
+            GHOST_UINT32_C(0x9cf06899), GHOST_UINT32_C(0xb94b9d42), GHOST_UINT32_C(0xd787832f), GHOST_UINT32_C(0xf23c76f4),
+            GHOST_UINT32_C(0x0a1fbff5), GHOST_UINT32_C(0x2fa44a2e), GHOST_UINT32_C(0x41685443), GHOST_UINT32_C(0x64d3a198),
+            GHOST_UINT32_C(0xb4c3b0b0), GHOST_UINT32_C(0x9178456b), GHOST_UINT32_C(0xffb45b06), GHOST_UINT32_C(0xda0faedd),
+            GHOST_UINT32_C(0x222c67dc), GHOST_UINT32_C(0x07979207), GHOST_UINT32_C(0x695b8c6a), GHOST_UINT32_C(0x4ce079b1),
+            GHOST_UINT32_C(0x6c58b86f), GHOST_UINT32_C(0x49e34db4), GHOST_UINT32_C(0x272f53d9), GHOST_UINT32_C(0x0294a602),
+            GHOST_UINT32_C(0xfab76f03), GHOST_UINT32_C(0xdf0c9ad8), GHOST_UINT32_C(0xb1c084b5), GHOST_UINT32_C(0x947b716e),
+            GHOST_UINT32_C(0x446b6046), GHOST_UINT32_C(0x61d0959d), GHOST_UINT32_C(0x0f1c8bf0), GHOST_UINT32_C(0x2aa77e2b),
+            GHOST_UINT32_C(0xd284b72a), GHOST_UINT32_C(0xf73f42f1), GHOST_UINT32_C(0x99f35c9c), GHOST_UINT32_C(0xbc48a947),
+            GHOST_UINT32_C(0x3c3f083d), GHOST_UINT32_C(0x1984fde6), GHOST_UINT32_C(0x7748e38b), GHOST_UINT32_C(0x52f31650),
+            GHOST_UINT32_C(0xaad0df51), GHOST_UINT32_C(0x8f6b2a8a), GHOST_UINT32_C(0xe1a734e7), GHOST_UINT32_C(0xc41cc13c),
+            GHOST_UINT32_C(0x140cd014), GHOST_UINT32_C(0x31b725cf), GHOST_UINT32_C(0x5f7b3ba2), GHOST_UINT32_C(0x7ac0ce79),
+            GHOST_UINT32_C(0x82e30778), GHOST_UINT32_C(0xa758f2a3), GHOST_UINT32_C(0xc994ecce), GHOST_UINT32_C(0xec2f1915)
+        }
+    };
+    const unsigned char* p = ghost_static_cast(const unsigned char*, bytes);
+
+    /* Align to a word */
+    while (length != 0 && (ghost_reinterpret_cast(ghost_uintptr_t, p) & 7) != 0) {
+        crc = GHOST_IMPL_CRC32C_U8(crc, *p++);
+        --length;
+    }
+
+    /* Three interleaved streams of LONG bytes, then of SHORT bytes */
+    #define GHOST_IMPL_CRC32C_INTERLEAVE(size, table) \
+        while (length >= 3 * (size)) { \
+            ghost_uint32_t ghost_impl_v_crc1 = 0; \
+            ghost_uint32_t ghost_impl_v_crc2 = 0; \
+            const unsigned char* ghost_impl_v_end = p + (size); \
+            do { \
+                crc = GHOST_IMPL_CRC32C_U64(crc, ghost_load_le_u64(p)); \
+                ghost_impl_v_crc1 = GHOST_IMPL_CRC32C_U64(ghost_impl_v_crc1, ghost_load_le_u64(p + (size))); \
+                ghost_impl_v_crc2 = GHOST_IMPL_CRC32C_U64(ghost_impl_v_crc2, ghost_load_le_u64(p + 2 * (size))); \
+                p += 8; \
+            } while (p < ghost_impl_v_end); \
+            crc = ghost_impl_crc32c_shift_table(table, crc) ^ ghost_impl_v_crc1; \
+            crc = ghost_impl_crc32c_shift_table(table, crc) ^ ghost_impl_v_crc2; \
+            p += 2 * (size); \
+            length -= 3 * (size); \
+        }
+    GHOST_IMPL_CRC32C_INTERLEAVE(GHOST_IMPL_CRC32C_LONG, long_shift)
+    GHOST_IMPL_CRC32C_INTERLEAVE(GHOST_IMPL_CRC32C_SHORT, short_shift)
+    #undef GHOST_IMPL_CRC32C_INTERLEAVE
+
+    /* The rest one word at a time */
+    while (length >= 8) {
+        crc = GHOST_IMPL_CRC32C_U64(crc, ghost_load_le_u64(p));
+        p += 8;
+        length -= 8;
+    }
+    while (length-- != 0)
+        crc = GHOST_IMPL_CRC32C_U8(crc, *p++);
+    return crc;
+}
+#endif
+
+#endif
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#endif
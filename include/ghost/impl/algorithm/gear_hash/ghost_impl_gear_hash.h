@@ -0,0 +1,79 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_GEAR_HASH_H_INCLUDED
+#define GHOST_IMPL_GEAR_HASH_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Ghost's internal Gear hash implementation, used by ghost_gear_hash_update()
+ * and by the content-defined chunker.
+ *
+ * The Gear hash rolls by shifting left one bit and adding a random 64-bit
+ * value for each byte. A byte is shifted out of the top after 64 more bytes so
+ * the hash depends only on the last 64 bytes, and the top bits of the hash
+ * depend on all of them. There's no need to subtract the byte leaving the
+ * window so this is the cheapest rolling hash there is.
+ *
+ * The table is generated by SplitMix64 seeded with zero. It must never change
+ * since that would move every chunk boundary.
+ */
+
+#include "ghost/impl/ghost_impl_noinline.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+GHOST_IMPL_FUNCTION_OPEN
+
+#if ghost_has(ghost_uint64_t) && ghost_has(GHOST_UINT64_C)
+/*
+ * Returns the table of 256 random values.
+ */
+ghost_impl_noinline
+const ghost_uint64_t* ghost_impl_gear_hash_table(void);
+
+/*
+ * Rolls the given bytes into the hash.
+ */
+ghost_impl_noinline
+ghost_uint64_t ghost_impl_gear_hash_update(ghost_uint64_t hash, const void* bytes, ghost_size_t length);
+
+/*
+ * Rolls the given bytes into *hash, stopping after the first byte that leaves
+ * all of the given mask bits clear.
+ *
+ * Returns the number of bytes consumed up to and including that byte, or 0 if
+ * no byte matched (in which case all bytes were consumed.)
+ */
+ghost_impl_noinline
+ghost_size_t ghost_impl_gear_hash_scan(ghost_uint64_t* hash, const void* bytes,
+        ghost_size_t length, ghost_uint64_t mask);
+#endif
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#if GHOST_EMIT_DEFS
+    #include "ghost/impl/algorithm/gear_hash/ghost_impl_gear_hash_define.h"
+#endif
+
+#endif
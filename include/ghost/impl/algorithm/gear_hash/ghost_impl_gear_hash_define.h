@@ -0,0 +1,399 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_GEAR_HASH_DEFINE_H_INCLUDED
+#define GHOST_IMPL_GEAR_HASH_DEFINE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Defines Ghost's internal Gear hash functions.
+ */
+
+#if !GHOST_EMIT_DEFS && !GHOST_IMPL_AMALGAMATED
+    #error "This file is not supposed to be included if Ghost is not emitting function definitions."
+#endif
+
+#include "ghost/impl/algorithm/gear_hash/ghost_impl_gear_hash.h"
+#include "ghost/impl/ghost_impl_always_inline.h"
+#include "ghost/language/ghost_null.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/type/bool/ghost_bool.h"
+#include "ghost/type/bool/ghost_true.h"
+#include "ghost/type/bool/ghost_false.h"
+
+GHOST_IMPL_FUNCTION_OPEN
+
+#if ghost_has(ghost_uint64_t) && ghost_has(GHOST_UINT64_C)
+
+ghost_impl_noinline
+const ghost_uint64_t* ghost_impl_gear_hash_table(void) {
+    static const ghost_uint64_t table[256] = {
+        GHOST_UINT64_C(0xE220A8397B1DCDAF), GHOST_UINT64_C(0x6E789E6AA1B965F4),
+        GHOST_UINT64_C(0x06C45D188009454F), GHOST_UINT64_C(0xF88BB8A8724C81EC),
+        GHOST_UINT64_C(0x1B39896A51A8749B), GHOST_UINT64_C(0x53CB9F0C747EA2EA),
+        GHOST_UINT64_C(0x2C829ABE1F4532E1), GHOST_UINT64_C(0xC584133AC916AB3C),
+        GHOST_UINT64_C(0x3EE5789041C98AC3), GHOST_UINT64_C(0xF3B8488C368CB0A6),
+        GHOST_UINT64_C(0x657EECDD3CB13D09), GHOST_UINT64_C(0xC2D326E0055BDEF6),
+        GHOST_UINT64_C(0x8621A03FE0BBDB7B), GHOST_UINT64_C(0x8E1F7555983AA92F),
+        GHOST_UINT64_C(0xB54E0F1600CC4D19), GHOST_UINT64_C(0x84BB3F97971D80AB),
+        GHOST_UINT64_C(0x7D29825C75521255), GHOST_UINT64_C(0xC3CF17102B7F7F86),
+        GHOST_UINT64_C(0x3466E9A083914F64), GHOST_UINT64_C(0xD81A8D2B5A4485AC),
+        GHOST_UINT64_C(0xDB01602B100B9ED7), GHOST_UINT64_C(0xA9038A921825F10D),
+        GHOST_UINT64_C(0xEDF5F1D90DCA2F6A), GHOST_UINT64_C(0x54496AD67BD2634C),
+        GHOST_UINT64_C(0xDD7C01D4F5407269), GHOST_UINT64_C(0x935E82F1DB4C4F7B),
+        GHOST_UINT64_C(0x69B82EBC92233300), GHOST_UINT64_C(0x40D29EB57DE1D510),
+        GHOST_UINT64_C(0xA2F09DABB45C6316), GHOST_UINT64_C(0xEE521D7A0F4D3872),
+        GHOST_UINT64_C(0xF16952EE72F3454F), GHOST_UINT64_C(0x377D35DEA8E40225),
+        GHOST_UINT64_C(0x0C7DE8064963BAB0), GHOST_UINT64_C(0x05582D37111AC529),
+        GHOST_UINT64_C(0xD254741F599DC6F7), GHOST_UINT64_C(0x69630F7593D108C3),
+        GHOST_UINT64_C(0x417EF96181DAA383), GHOST_UINT64_C(0x3C3C41A3B43343A1),
+        GHOST_UINT64_C(0x6E19905DCBE531DF), GHOST_UINT64_C(0x4FA9FA7324851729),
+        GHOST_UINT64_C(0x84EB4454A792922A), GHOST_UINT64_C(0x134F7096918175CE),
+        GHOST_UINT64_C(0x07DC930B302278A8), GHOST_UINT64_C(0x12C015A97019E937),
+        GHOST_UINT64_C(0xCC06C31652EBF438), GHOST_UINT64_C(0xECEE65630A691E37),
+        GHOST_UINT64_C(0x3E84ECB1763E79AD), GHOST_UINT64_C(0x690ED476743AAE49),
+        GHOST_UINT64_C(0x774615D7B1A1F2E1), GHOST_UINT64_C(0x22B353F04F4F52DA),
+        GHOST_UINT64_C(0xE3DDD86BA71A5EB1), GHOST_UINT64_C(0xDF268ADEB6513356),
+        GHOST_UINT64_C(0x2098EB73D4367D77), GHOST_UINT64_C(0x03D6845323CE3C71),
+        GHOST_UINT64_C(0xC952C5620043C714), GHOST_UINT64_C(0x9B196BCA844F1705),
+        GHOST_UINT64_C(0x30260345DD9E0EC1), GHOST_UINT64_C(0xCF448A5882BB9698),
+        GHOST_UINT64_C(0xF4A578DCCBC87656), GHOST_UINT64_C(0xBFDEAED9A17B3C8F),
+        GHOST_UINT64_C(0xED79402D1D5C5D7B), GHOST_UINT64_C(0x55F070AB1CBBF170),
+        GHOST_UINT64_C(0x3E00A34929A88F1D), GHOST_UINT64_C(0xE255B237B8BB18FB),
+        GHOST_UINT64_C(0x2A7B67AF6C6AD50E), GHOST_UINT64_C(0x466D5E7F3E46F143),
+        GHOST_UINT64_C(0x42375CB399A4FC72), GHOST_UINT64_C(0x8C8A1F148A8BB259),
+        GHOST_UINT64_C(0x32FCAB5DAED5BDFC), GHOST_UINT64_C(0x9E60398C8D8553C0),
+        GHOST_UINT64_C(0xEE89CCEB8C4064C0), GHOST_UINT64_C(0xDB0215941D86A66F),
+        GHOST_UINT64_C(0x5CCDE78203C367A8), GHOST_UINT64_C(0xF1BCBC6A1EC11786),
+        GHOST_UINT64_C(0xEF054FCEEE954551), GHOST_UINT64_C(0xDF82012D0555C6DF),
+        GHOST_UINT64_C(0x292566FF72403C08), GHOST_UINT64_C(0xC4DD302A1BFA1137),
+        GHOST_UINT64_C(0xD85F219DB5C554E1), GHOST_UINT64_C(0x6A27FF807441BCD2),
+        GHOST_UINT64_C(0x96A573E9B48216E8), GHOST_UINT64_C(0x46A9FDAC40BF0048),
+        GHOST_UINT64_C(0x3DD12464A0EE15B4), GHOST_UINT64_C(0x451E521296A7EEA1),
+        GHOST_UINT64_C(0x56E4398A98F8A0FD), GHOST_UINT64_C(0x7B7DC2160E3335A7),
+        GHOST_UINT64_C(0xC679EE0BEBCB1CCA), GHOST_UINT64_C(0x928D6F2D7453424E),
+        GHOST_UINT64_C(0x1B38994205234C6D), GHOST_UINT64_C(0x8086D193A6F2B568),
+        GHOST_UINT64_C(0x21C6E26639AC2C65), GHOST_UINT64_C(0xD9DCCAC414D23C6F),
+        GHOST_UINT64_C(0x91CD642057E00235), GHOST_UINT64_C(0x77FC607DC6589373),
+        GHOST_UINT64_C(0x05B8ABE26DD3AEE7), GHOST_UINT64_C(0x12F6436AC376CC66),
+        GHOST_UINT64_C(0x64952424897B2307), GHOST_UINT64_C(0xEE8C2BAF6343E5C3),
+        GHOST_UINT64_C(0xDC4C613D9EBA2304), GHOST_UINT64_C(0x3505B7796BD1A506),
+        GHOST_UINT64_C(0x8176DAF800A05F50), GHOST_UINT64_C(0x8BD8FF7A0385CDBC),
+        GHOST_UINT64_C(0x1A764A3CD78101DA), GHOST_UINT64_C(0xBE4D15BF6CA266AC),
+        GHOST_UINT64_C(0xA85E1F38BB2DC749), GHOST_UINT64_C(0x56759A968493CD8C),
+        GHOST_UINT64_C(0xF3A9BCE7336BD182), GHOST_UINT64_C(0x365B15013741519B),
+        GHOST_UINT64_C(0x1F7A44A6B109AC94), GHOST_UINT64_C(0x3521D628813CB177),
+        GHOST_UINT64_C(0x6A77AFAB0F7C9370), GHOST_UINT64_C(0x179642D8CDE95015),
+        GHOST_UINT64_C(0x5EF102A8FB354461), GHOST_UINT64_C(0xF51C504764ED82F2),
+        GHOST_UINT64_C(0xC58427F041CE6808), GHOST_UINT64_C(0xFAD8FC45C9643C37),
+        GHOST_UINT64_C(0xCF8682F9A70FA9C0), GHOST_UINT64_C(0x7E1B3B75A4005729),
+        GHOST_UINT64_C(0x992DD867927B52D8), GHOST_UINT64_C(0x7FBD5DB142F6791F),
+        GHOST_UINT64_C(0x370595AACAB4ADAE), GHOST_UINT64_C(0xB1392DBDC5AB61D6),
+        GHOST_UINT64_C(0x9FEA7DFC79D452D9), GHOST_UINT64_C(0x40B12B120085641C),
+        GHOST_UINT64_C(0xA192AFE3157C85D0), GHOST_UINT64_C(0xC847729F4E08F3A3),
+        GHOST_UINT64_C(0x6F1384A306C41FC2), GHOST_UINT64_C(0x12D05C4045A39C19),
+        GHOST_UINT64_C(0x9899202FD20F0841), GHOST_UINT64_C(0xE9C7191857E774B8),
+        GHOST_UINT64_C(0x4EEAD809AF5B0CC3), GHOST_UINT64_C(0xE809ACAFA23864A4),
+        GHOST_UINT64_C(0x4DA1EDABA1D0F7BD), GHOST_UINT64_C(0x846EB9673349F8E4),
+        GHOST_UINT64_C(0x87BAE55B86039FE8), GHOST_UINT64_C(0x7F367B8BD953EFF2),
+        GHOST_UINT64_C(0x3884700F650D04E1), GHOST_UINT64_C(0xBFE4B2AB46980CAD),
+        GHOST_UINT64_C(0xC5FC89075299106C), GHOST_UINT64_C(0x37B2FA361ADEA7CD),
+        GHOST_UINT64_C(0x7D75D813F04895B4), GHOST_UINT64_C(0x702F5B393F62C0E0),
+        GHOST_UINT64_C(0x0A3FC775F4ECF37F), GHOST_UINT64_C(0xE4B23787A352437F),
+        GHOST_UINT64_C(0xF83FA245C34D6363), GHOST_UINT64_C(0xB99BCF040786CF50),
+        GHOST_UINT64_C(0x38B6EA0A0E6C9D8A), GHOST_UINT64_C(0x093FDC76776E37E1),
+        GHOST_UINT64_C(0x1A75E6F76BA7EEE8), GHOST_UINT64_C(0x442CDCFEE9660C62),
+        GHOST_UINT64_C(0x22D58D35116B5E0B), GHOST_UINT64_C(0x87D4A5180F6A3645),
+        GHOST_UINT64_C(0x589FB216BD82131B), GHOST_UINT64_C(0x91D031CAD319AEC0),
+        GHOST_UINT64_C(0xABECF76A553D320B), GHOST_UINT64_C(0xB8686CB347612DCF),
+        GHOST_UINT64_C(0xFCAB66337C0A77F5), GHOST_UINT64_C(0xAC318214381EC437),
+        GHOST_UINT64_C(0x6EB7F0FCA24494AE), GHOST_UINT64_C(0xCF42861DCDC895A9),
+        GHOST_UINT64_C(0x4ABAD7A1586D7A91), GHOST_UINT64_C(0xC21B318DC2F49745),
+        GHOST_UINT64_C(0xD49474DC2ACBD1F0), GHOST_UINT64_C(0xB1D4873747C1C8E1),
+        GHOST_UINT64_C(0x5434DC8C7D015BF6), GHOST_UINT64_C(0xE1C486287511B6A9),
+        GHOST_UINT64_C(0xA8616DF62E89A193), GHOST_UINT64_C(0x31CE6319498D8347),
+        GHOST_UINT64_C(0xAFD0B486123D6FAA), GHOST_UINT64_C(0xE6495F5D102301EB),
+        GHOST_UINT64_C(0x0DC51CED17A43C52), GHOST_UINT64_C(0x8BCBCDE81355EF2D),
+        GHOST_UINT64_C(0x2412AF73FDEE7CFC), GHOST_UINT64_C(0xC8D589E486E29EED),
+        GHOST_UINT64_C(0x23390E8664517F89), GHOST_UINT64_C(0x251ADE58E8A6849D),
+        GHOST_UINT64_C(0xF8555DBD2E8F9CB0), GHOST_UINT64_C(0xCB417C3EEF54F7C3),
+        GHOST_UINT64_C(0x8028F8E1AAC3A919), GHOST_UINT64_C(0x10E31052ACF748A0),
+        GHOST_UINT64_C(0x2D886C073B1E1B78), GHOST_UINT64_C(0x972974D90DF9FAEE),
+        GHOST_UINT64_C(0xBC1B7B38796893BA), GHOST_UINT64_C(0x1958ED432070E652),
+        GHOST_UINT64_C(0xCA5F297197A12DCC), GHOST_UINT64_C(0xE025A27375704F28),
+        GHOST_UINT64_C(0x418010A570A924FB), GHOST_UINT64_C(0x9828E2941BFC419C),
+        GHOST_UINT64_C(0x4FBACD2F52B85C1F), GHOST_UINT64_C(0x33DD5B756211CC67),
+        GHOST_UINT64_C(0x23C8DFDD1DB57FF0), GHOST_UINT64_C(0x32F81801A1A8E901),
+        GHOST_UINT64_C(0x26884EAC5ADA36DA), GHOST_UINT64_C(0xCAA82F9BB42E37D4),
+        GHOST_UINT64_C(0x19FB1A7491D6A7D1), GHOST_UINT64_C(0x5AA0243AA357F38E),
+        GHOST_UINT64_C(0xB31D917809E447F0), GHOST_UINT64_C(0x3F9C197225215BE0),
+        GHOST_UINT64_C(0xDC3C315A1E33C095), GHOST_UINT64_C(0x3DD399AD533E80AC),
+        GHOST_UINT64_C(0x566F32CCE8301D95), GHOST_UINT64_C(0xC880188083D9BA21),
+        GHOST_UINT64_C(0xB9CC357F3B0E7D2E), GHOST_UINT64_C(0x0237D2123A8A8D6C),
+        GHOST_UINT64_C(0xBF636E9AA7CBF6BD), GHOST_UINT64_C(0xD7BD4284C4E2A6A7),
+        GHOST_UINT64_C(0xDA2EBB47D50577A9), GHOST_UINT64_C(0x90BA1C11B539087D),
+        GHOST_UINT64_C(0x44993D31552B4F57), GHOST_UINT64_C(0x32C2D6F80A8A8898),
+        GHOST_UINT64_C(0x450583ED7FB54B19), GHOST_UINT64_C(0xEC2B0B09E50EF3EF),
+        GHOST_UINT64_C(0xD918A0B6E2EFD65C), GHOST_UINT64_C(0xE37A868D9785F572),
+        GHOST_UINT64_C(0x7D1A6118F2B0F37A), GHOST_UINT64_C(0x9E2E3CC13B343439),
+        GHOST_UINT64_C(0xEFD82C11212E37E8), GHOST_UINT64_C(0xAF89C05CD4FC75ED),
+        GHOST_UINT64_C(0x55BC16BB9697108E), GHOST_UINT64_C(0x6C4701FA5DB69BEE),
+        GHOST_UINT64_C(0x9237338441DAF445), GHOST_UINT64_C(0x248CF0831E81A5FC),
+        GHOST_UINT64_C(0xACC13557E77DE273), GHOST_UINT64_C(0x520970C25E06513A),
+        GHOST_UINT64_C(0x657329CB02987CAB), GHOST_UINT64_C(0xA9B0B3366A4E55A8),
+        GHOST_UINT64_C(0xC4D06CA2F39ACDD4), GHOST_UINT64_C(0x5DCE37D68170CDE1),
+        GHOST_UINT64_C(0x5F1E44E77E1854C9), GHOST_UINT64_C(0x6883D452D55DF899),
+        GHOST_UINT64_C(0x05C5BD62F1067032), GHOST_UINT64_C(0xE680B683CE60FAB0),
+        GHOST_UINT64_C(0x5DC9DA3F286D18B1), GHOST_UINT64_C(0x94B4BF3AB85ED6D8),
+        GHOST_UINT64_C(0xCE65F449E3ACC5A3), GHOST_UINT64_C(0x34B0209642CEA639),
+        GHOST_UINT64_C(0xC14C3C771D904827), GHOST_UINT64_C(0x6ADDCEE2BD9CDEE5),
+        GHOST_UINT64_C(0xE24EED137FFBB613), GHOST_UINT64_C(0x75DD58EF79963D1B),
+        GHOST_UINT64_C(0xFDB83ECF6CC24920), GHOST_UINT64_C(0x7A1D0057C57169FB),
+        GHOST_UINT64_C(0x339200F4FEB62D07), GHOST_UINT64_C(0xD33F4D4AC88469F4),
+        GHOST_UINT64_C(0x8226F234E68DFEE4), GHOST_UINT64_C(0x320DEF4F2A105536),
+        GHOST_UINT64_C(0x7786F3B13AEFC159), GHOST_UINT64_C(0xB28225AC9DF63EE2),
+        GHOST_UINT64_C(0x781B9D0376CC6044), GHOST_UINT64_C(0x05BD0115226C6AB6),
+        GHOST_UINT64_C(0xD302230207BDFDAB), GHOST_UINT64_C(0xDB898ABD8E0D2933),
+        GHOST_UINT64_C(0x9E79A397BA00B9CC), GHOST_UINT64_C(0x89DF84A5F0003EE8),
+        GHOST_UINT64_C(0x011F04F2A75FB9BE), GHOST_UINT64_C(0x5A5832BB47BCF19E)
+    };
+    return table;
+}
+
+ghost_impl_noinline
+ghost_uint64_t ghost_impl_gear_hash_update(ghost_uint64_t hash, const void* bytes, ghost_size_t length) {
+    const ghost_uint64_t* table = ghost_impl_gear_hash_table();
+    const unsigned char* p = ghost_static_cast(const unsigned char*, bytes);
+    const unsigned char* end = p + length;
+    while (p != end)
+        hash = (hash << 1) + table[*p++];
+    return hash;
+}
+
+/*
+ * Rolls the bytes of [*p, end) into *hash a byte at a time, advancing the
+ * hash two bytes per step. Returns true and leaves *p just past the first
+ * byte whose hash matches the mask, or returns false if none do.
+ */
+ghost_impl_always_inline
+ghost_bool ghost_impl_gear_hash_scan_serial(const ghost_uint64_t* table, ghost_uint64_t* out_hash,
+        const unsigned char** out_p, const unsigned char* end, ghost_uint64_t mask)
+{
+    const unsigned char* p = *out_p;
+    ghost_uint64_t hash = *out_hash;
+
+    /* Each byte shifts the hash and adds a table entry so a byte at a time
+     * this is bound by the latency of two dependent instructions per byte.
+     * Instead we advance two bytes per step:
+     *
+     *     hash = (hash << 2) + ((table[a] << 1) + table[b])
+     *
+     * The table sum doesn't depend on the hash so this halves the dependency
+     * chain. The hash after the first byte is computed off the chain just to
+     * test it. When either hash matches, we stop and let the loop below find
+     * the exact boundary. */
+    while (end - p >= 2) {
+        ghost_uint64_t entry = table[p[0]];
+        ghost_uint64_t next = (hash << 2) + ((entry << 1) + table[p[1]]);
+        if ((((hash << 1) + entry) & mask) == 0 || (next & mask) == 0)
+            break;
+        hash = next;
+        p += 2;
+    }
+
+    while (p != end) {
+        hash = (hash << 1) + table[*p++];
+        if ((hash & mask) == 0) {
+            *out_hash = hash;
+            *out_p = p;
+            return ghost_true;
+        }
+    }
+    *out_hash = hash;
+    *out_p = p;
+    return ghost_false;
+}
+
+/*
+ * Every lane of the lane scan below but the first hashes the 64 bytes before
+ * its segment to warm up. Segments shorter than this aren't worth the extra
+ * work so shorter ranges (or masks that match too often) are scanned
+ * serially.
+ */
+#define GHOST_IMPL_GEAR_HASH_SCAN_SEGMENT_MIN 256
+
+ghost_impl_noinline
+ghost_size_t ghost_impl_gear_hash_scan(ghost_uint64_t* out_hash, const void* bytes,
+        ghost_size_t length, ghost_uint64_t mask)
+{
+    const ghost_uint64_t* table = ghost_impl_gear_hash_table();
+    const unsigned char* start = ghost_static_cast(const unsigned char*, bytes);
+    const unsigned char* p = start;
+    const unsigned char* end = start + length;
+    ghost_uint64_t hash = *out_hash;
+
+    /* After a lane other than the first finds a match, the rest of the lanes
+     * before it still have to be scanned, in order. These are the ranges left
+     * to scan and the match to return if none of them matches. */
+    const unsigned char* pending_first[3];
+    const unsigned char* pending_end[3];
+    ghost_uint64_t pending_hash[3];
+    ghost_size_t pending_count = 0;
+    ghost_size_t pending_next = 0;
+    const unsigned char* match = ghost_null;
+    ghost_uint64_t match_hash = 0;
+
+    /* Every byte matches with probability 2^-n where n is the number of bits
+     * in the mask. As soon as any lane matches, the lanes after it have done
+     * wasted work so we limit segments to an eighth of the expected distance
+     * between matches. */
+    ghost_size_t segment_max = 1;
+    ghost_uint64_t bits = mask;
+    while (bits != 0 && segment_max < (ghost_static_cast(ghost_size_t, -1) >> 4)) {
+        bits &= bits - 1;
+        segment_max <<= 1;
+    }
+    segment_max /= 8;
+
+    for (;;) {
+        /* A Gear hash depends only on the last 64 bytes: each byte's table
+         * entry is shifted out of the hash 64 bytes later. We can therefore
+         * split a long range into four segments and hash them as independent
+         * lanes, giving the CPU four dependency chains to interleave instead
+         * of one. Each lane but the first starts by hashing the 64 bytes
+         * before its segment so its hash is exact from its first byte. The
+         * first lane continues the hash we have. The first match of the
+         * lowest lane that matches is the earliest so boundaries are exactly
+         * the same as with a serial scan. */
+        while (segment_max >= GHOST_IMPL_GEAR_HASH_SCAN_SEGMENT_MIN &&
+                ghost_static_cast(ghost_size_t, end - p) >= 4 * GHOST_IMPL_GEAR_HASH_SCAN_SEGMENT_MIN)
+        {
+            ghost_size_t segment = ghost_static_cast(ghost_size_t, end - p) / 4;
+            const unsigned char* a = p;
+            const unsigned char* b = a + segment;
+            const unsigned char* c = b + segment;
+            const unsigned char* d = c + segment;
+            ghost_uint64_t h0 = hash;
+            ghost_uint64_t h1 = 0;
+            ghost_uint64_t h2 = 0;
+            ghost_uint64_t h3 = 0;
+            ghost_size_t i;
+
+            if (segment > segment_max) {
+                segment = segment_max;
+                b = a + segment;
+                c = b + segment;
+                d = c + segment;
+            }
+
+            for (i = 64; i > 0; --i) {
+                h1 = (h1 << 1) + table[b[0 - i]];
+                h2 = (h2 << 1) + table[c[0 - i]];
+                h3 = (h3 << 1) + table[d[0 - i]];
+            }
+
+            for (i = 0; i < segment; ++i) {
+                h0 = (h0 << 1) + table[a[i]];
+                h1 = (h1 << 1) + table[b[i]];
+                h2 = (h2 << 1) + table[c[i]];
+                h3 = (h3 << 1) + table[d[i]];
+                if ((h0 & mask) == 0 || (h1 & mask) == 0 || (h2 & mask) == 0 || (h3 & mask) == 0)
+                    break;
+            }
+
+            if (i == segment) {
+                /* No match. The last lane's hash is exact so we continue
+                 * with the few bytes left over after it. */
+                hash = h3;
+                p = d + segment;
+                continue;
+            }
+
+            ++i;
+            if ((h0 & mask) == 0) {
+                hash = h0;
+                p = a + i;
+                goto found;
+            }
+
+            /* The first lane to match is the earliest match so far. The
+             * lanes before it still have to scan the rest of their segments
+             * since they may match earlier. Any match within these is earlier
+             * than anything we had pending before so we replace it. */
+            pending_count = 0;
+            pending_next = 0;
+            pending_first[pending_count] = a + i;
+            pending_end[pending_count] = b;
+            pending_hash[pending_count++] = h0;
+            if ((h1 & mask) == 0) {
+                match = b + i;
+                match_hash = h1;
+            } else {
+                pending_first[pending_count] = b + i;
+                pending_end[pending_count] = c;
+                pending_hash[pending_count++] = h1;
+                if ((h2 & mask) == 0) {
+                    match = c + i;
+                    match_hash = h2;
+                } else {
+                    pending_first[pending_count] = c + i;
+                    pending_end[pending_count] = d;
+                    pending_hash[pending_count++] = h2;
+                    match = d + i;
+                    match_hash = h3;
+                }
+            }
+
+            p = pending_first[pending_next];
+            end = pending_end[pending_next];
+            hash = pending_hash[pending_next++];
+        }
+
+        if (ghost_impl_gear_hash_scan_serial(table, &hash, &p, end, mask))
+            goto found;
+
+        if (pending_next != pending_count) {
+            p = pending_first[pending_next];
+            end = pending_end[pending_next];
+            hash = pending_hash[pending_next++];
+            continue;
+        }
+
+        if (match == ghost_null) {
+            *out_hash = hash;
+            return 0;
+        }
+        p = match;
+        hash = match_hash;
+        goto found;
+    }
+
+found:
+    *out_hash = hash;
+    return ghost_static_cast(ghost_size_t, p - start);
+}
+
+#endif
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#endif
@@ -0,0 +1,120 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_KNUTH_HASH_ARRAY_H_INCLUDED
+#define GHOST_IMPL_KNUTH_HASH_ARRAY_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Ghost's internal implementation of the array variants of the Knuth
+ * multiplicative hash.
+ *
+ * These take the shift (the width minus the number of bits) rather than the
+ * number of bits; the public functions check the bits once and compute it.
+ *
+ * The 32-bit hash is vectorized with AVX2 (eight lanes) and NEON (four
+ * lanes.) AVX2 has no 64-bit multiply so the 64-bit hash is built from three
+ * 32x32->64 multiplies per four lanes. NEON has no cheap equivalent so the
+ * 64-bit hash stays scalar there.
+ *
+ * On x86-64 with GCC or Clang, if AVX2 isn't enabled at compile time we
+ * compile the AVX2 versions anyway with a target attribute and choose them at
+ * runtime if the CPU supports it.
+ *
+ * If a histogram is given, the bucket counts are incremented from the output
+ * after each vector (or element) so the data is only read once.
+ */
+
+#include "ghost/impl/ghost_impl_noinline.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+#include "ghost/type/uint32_t/ghost_uint32_t.h"
+#include "ghost/type/uint32_t/ghost_uint32_c.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "ghost/detect/ghost_x86_64.h"
+#include "ghost/detect/ghost_cproc.h"
+
+#ifndef GHOST_IMPL_KNUTH_HASH_AVX2
+    #if defined(__AVX2__)
+        #define GHOST_IMPL_KNUTH_HASH_AVX2 1
+    #else
+        #define GHOST_IMPL_KNUTH_HASH_AVX2 0
+    #endif
+#endif
+
+#ifndef GHOST_IMPL_KNUTH_HASH_AVX2_DISPATCH
+    #if !GHOST_IMPL_KNUTH_HASH_AVX2 && GHOST_X86_64 && !GHOST_CPROC && \
+            (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+        #define GHOST_IMPL_KNUTH_HASH_AVX2_DISPATCH 1
+    #else
+        #define GHOST_IMPL_KNUTH_HASH_AVX2_DISPATCH 0
+    #endif
+#endif
+
+#ifndef GHOST_IMPL_KNUTH_HASH_NEON
+    #if !GHOST_IMPL_KNUTH_HASH_AVX2 && !GHOST_IMPL_KNUTH_HASH_AVX2_DISPATCH && \
+            (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64))
+        #define GHOST_IMPL_KNUTH_HASH_NEON 1
+    #else
+        #define GHOST_IMPL_KNUTH_HASH_NEON 0
+    #endif
+#endif
+
+#if GHOST_IMPL_KNUTH_HASH_AVX2_DISPATCH
+    #define GHOST_IMPL_KNUTH_HASH_TARGET __attribute__((__target__("avx2")))
+#else
+    #define GHOST_IMPL_KNUTH_HASH_TARGET /*nothing*/
+#endif
+
+GHOST_IMPL_FUNCTION_OPEN
+
+#if ghost_has(ghost_uint32_t) && ghost_has(GHOST_UINT32_C)
+ghost_impl_noinline
+void ghost_impl_knuth_hash_u32_array(const ghost_uint32_t* in, ghost_uint32_t* out,
+        ghost_size_t count, unsigned shift, ghost_size_t* histogram);
+
+#if GHOST_IMPL_KNUTH_HASH_AVX2 || GHOST_IMPL_KNUTH_HASH_AVX2_DISPATCH
+ghost_impl_noinline GHOST_IMPL_KNUTH_HASH_TARGET
+void ghost_impl_knuth_hash_u32_array_avx2(const ghost_uint32_t* in, ghost_uint32_t* out,
+        ghost_size_t count, unsigned shift, ghost_size_t* histogram);
+#endif
+#endif
+
+#if ghost_has(ghost_uint64_t) && ghost_has(GHOST_UINT64_C)
+ghost_impl_noinline
+void ghost_impl_knuth_hash_u64_array(const ghost_uint64_t* in, ghost_uint64_t* out,
+        ghost_size_t count, unsigned shift, ghost_size_t* histogram);
+
+#if GHOST_IMPL_KNUTH_HASH_AVX2 || GHOST_IMPL_KNUTH_HASH_AVX2_DISPATCH
+ghost_impl_noinline GHOST_IMPL_KNUTH_HASH_TARGET
+void ghost_impl_knuth_hash_u64_array_avx2(const ghost_uint64_t* in, ghost_uint64_t* out,
+        ghost_size_t count, unsigned shift, ghost_size_t* histogram);
+#endif
+#endif
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#if GHOST_EMIT_DEFS
+    #include "ghost/impl/algorithm/knuth_hash/ghost_impl_knuth_hash_array_define.h"
+#endif
+
+#endif
@@ -0,0 +1,196 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_KNUTH_HASH_ARRAY_DEFINE_H_INCLUDED
+#define GHOST_IMPL_KNUTH_HASH_ARRAY_DEFINE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if !GHOST_EMIT_DEFS && !GHOST_IMPL_AMALGAMATED
+    #error "This file is not supposed to be included if Ghost is not emitting function definitions."
+#endif
+
+#include "ghost/impl/algorithm/knuth_hash/ghost_impl_knuth_hash_array.h"
+#include "ghost/impl/ghost_impl_always_inline.h"
+#include "ghost/language/ghost_null.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/language/ghost_reinterpret_cast.h"
+
+#if GHOST_IMPL_KNUTH_HASH_AVX2 || GHOST_IMPL_KNUTH_HASH_AVX2_DISPATCH
+    #include <immintrin.h>
+#elif GHOST_IMPL_KNUTH_HASH_NEON
+    #include <arm_neon.h>
+#endif
+
+/* The same primes as ghost_knuth_hash_u32() and ghost_knuth_hash_u64(). */
+#define GHOST_IMPL_KNUTH_HASH_PRIME_32 GHOST_UINT32_C(2654435761)
+#define GHOST_IMPL_KNUTH_HASH_PRIME_64 GHOST_UINT64_C(11400714819323198393)
+
+GHOST_IMPL_FUNCTION_OPEN
+
+#if ghost_has(ghost_uint32_t) && ghost_has(GHOST_UINT32_C)
+/*
+ * Hashes the elements from the given index to the end with scalar code.
+ */
+ghost_impl_always_inline
+void ghost_impl_knuth_hash_u32_array_scalar(const ghost_uint32_t* in, ghost_uint32_t* out,
+        ghost_size_t i, ghost_size_t count, unsigned shift, ghost_size_t* histogram)
+{
+    if (histogram == ghost_null) {
+        for (; i < count; ++i)
+            out[i] = (in[i] * GHOST_IMPL_KNUTH_HASH_PRIME_32) >> shift;
+    } else {
+        for (; i < count; ++i) {
+            out[i] = (in[i] * GHOST_IMPL_KNUTH_HASH_PRIME_32) >> shift;
+            ++histogram[out[i]];
+        }
+    }
+}
+
+#if GHOST_IMPL_KNUTH_HASH_AVX2 || GHOST_IMPL_KNUTH_HASH_AVX2_DISPATCH
+ghost_impl_noinline GHOST_IMPL_KNUTH_HASH_TARGET
+void ghost_impl_knuth_hash_u32_array_avx2(const ghost_uint32_t* in, ghost_uint32_t* out,
+        ghost_size_t count, unsigned shift, ghost_size_t* histogram)
+{
+    /* 2654435761 as a signed 32-bit integer */
+    __m256i prime = _mm256_set1_epi32(-1640531535);
+    __m128i vshift = _mm_cvtsi32_si128(ghost_static_cast(int, shift));
+    ghost_size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256(ghost_reinterpret_cast(const __m256i*, in + i));
+        v = _mm256_srl_epi32(_mm256_mullo_epi32(v, prime), vshift);
+        _mm256_storeu_si256(ghost_reinterpret_cast(__m256i*, out + i), v);
+        if (histogram != ghost_null) {
+            ++histogram[out[i]];
+            ++histogram[out[i + 1]];
+            ++histogram[out[i + 2]];
+            ++histogram[out[i + 3]];
+            ++histogram[out[i + 4]];
+            ++histogram[out[i + 5]];
+            ++histogram[out[i + 6]];
+            ++histogram[out[i + 7]];
+        }
+    }
+    ghost_impl_knuth_hash_u32_array_scalar(in, out, i, count, shift, histogram);
+}
+#endif
+
+ghost_impl_noinline
+void ghost_impl_knuth_hash_u32_array(const ghost_uint32_t* in, ghost_uint32_t* out,
+        ghost_size_t count, unsigned shift, ghost_size_t* histogram)
+{
+    #if GHOST_IMPL_KNUTH_HASH_AVX2
+        ghost_impl_knuth_hash_u32_array_avx2(in, out, count, shift, histogram);
+    #elif GHOST_IMPL_KNUTH_HASH_AVX2_DISPATCH
+        if (__builtin_cpu_supports("avx2"))
+            ghost_impl_knuth_hash_u32_array_avx2(in, out, count, shift, histogram);
+        else
+            ghost_impl_knuth_hash_u32_array_scalar(in, out, 0, count, shift, histogram);
+    #elif GHOST_IMPL_KNUTH_HASH_NEON
+        uint32x4_t prime = vdupq_n_u32(GHOST_IMPL_KNUTH_HASH_PRIME_32);
+        int32x4_t vshift = vdupq_n_s32(-ghost_static_cast(int, shift));
+        ghost_size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            vst1q_u32(out + i, vshlq_u32(vmulq_u32(vld1q_u32(in + i), prime), vshift));
+            if (histogram != ghost_null) {
+                ++histogram[out[i]];
+                ++histogram[out[i + 1]];
+                ++histogram[out[i + 2]];
+                ++histogram[out[i + 3]];
+            }
+        }
+        ghost_impl_knuth_hash_u32_array_scalar(in, out, i, count, shift, histogram);
+    #else
+        ghost_impl_knuth_hash_u32_array_scalar(in, out, 0, count, shift, histogram);
+    #endif
+}
+#endif
+
+#if ghost_has(ghost_uint64_t) && ghost_has(GHOST_UINT64_C)
+ghost_impl_always_inline
+void ghost_impl_knuth_hash_u64_array_scalar(const ghost_uint64_t* in, ghost_uint64_t* out,
+        ghost_size_t i, ghost_size_t count, unsigned shift, ghost_size_t* histogram)
+{
+    if (histogram == ghost_null) {
+        for (; i < count; ++i)
+            out[i] = (in[i] * GHOST_IMPL_KNUTH_HASH_PRIME_64) >> shift;
+    } else {
+        for (; i < count; ++i) {
+            out[i] = (in[i] * GHOST_IMPL_KNUTH_HASH_PRIME_64) >> shift;
+            ++histogram[out[i]];
+        }
+    }
+}
+
+#if GHOST_IMPL_KNUTH_HASH_AVX2 || GHOST_IMPL_KNUTH_HASH_AVX2_DISPATCH
+ghost_impl_noinline GHOST_IMPL_KNUTH_HASH_TARGET
+void ghost_impl_knuth_hash_u64_array_avx2(const ghost_uint64_t* in, ghost_uint64_t* out,
+        ghost_size_t count, unsigned shift, ghost_size_t* histogram)
+{
+    /*
+     * With x = xh*2^32 + xl and p = ph*2^32 + pl, the low 64 bits of x*p
+     * are xl*pl + ((xh*pl + xl*ph) << 32).
+     */
+    /* _mm256_mul_epu32() only reads the low half of each 64-bit lane so we
+     * can broadcast the halves of the prime as 32-bit integers. These are
+     * 0x7F4A7BB9 and 0x9E3779B9 (as signed.) */
+    __m256i prime_low = _mm256_set1_epi32(2135587769);
+    __m256i prime_high = _mm256_set1_epi32(-1640531527);
+    __m128i vshift = _mm_cvtsi32_si128(ghost_static_cast(int, shift));
+    ghost_size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i v = _mm256_loadu_si256(ghost_reinterpret_cast(const __m256i*, in + i));
+        __m256i cross = _mm256_add_epi64(
+                _mm256_mul_epu32(_mm256_srli_epi64(v, 32), prime_low),
+                _mm256_mul_epu32(v, prime_high));
+        v = _mm256_add_epi64(_mm256_mul_epu32(v, prime_low), _mm256_slli_epi64(cross, 32));
+        _mm256_storeu_si256(ghost_reinterpret_cast(__m256i*, out + i), _mm256_srl_epi64(v, vshift));
+        if (histogram != ghost_null) {
+            ++histogram[out[i]];
+            ++histogram[out[i + 1]];
+            ++histogram[out[i + 2]];
+            ++histogram[out[i + 3]];
+        }
+    }
+    ghost_impl_knuth_hash_u64_array_scalar(in, out, i, count, shift, histogram);
+}
+#endif
+
+ghost_impl_noinline
+void ghost_impl_knuth_hash_u64_array(const ghost_uint64_t* in, ghost_uint64_t* out,
+        ghost_size_t count, unsigned shift, ghost_size_t* histogram)
+{
+    #if GHOST_IMPL_KNUTH_HASH_AVX2
+        ghost_impl_knuth_hash_u64_array_avx2(in, out, count, shift, histogram);
+    #elif GHOST_IMPL_KNUTH_HASH_AVX2_DISPATCH
+        if (__builtin_cpu_supports("avx2"))
+            ghost_impl_knuth_hash_u64_array_avx2(in, out, count, shift, histogram);
+        else
+            ghost_impl_knuth_hash_u64_array_scalar(in, out, 0, count, shift, histogram);
+    #else
+        ghost_impl_knuth_hash_u64_array_scalar(in, out, 0, count, shift, histogram);
+    #endif
+}
+#endif
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#endif
@@ -0,0 +1,61 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_MERGE_K_H_INCLUDED
+#define GHOST_IMPL_MERGE_K_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Ghost's internal k-way merge. This is used to implement all of the merge_k
+ * variants. It uses the same state as the internal qsort for the compare
+ * function variants (only the element size, variant, compare function and
+ * context are used.)
+ *
+ * Two runs are merged directly with galloping as in the stable sort. More
+ * than two runs are merged with a loser tree which needs only ceil(log2(k))
+ * comparisons per element. When one run wins many times in a row, the merge
+ * finds the runner-up and gallops through the winning run to copy everything
+ * that precedes it in one block.
+ */
+
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_config.h"
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_internal_declare.h"
+#include "ghost/impl/ghost_impl_noinline.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+
+GHOST_IMPL_FUNCTION_OPEN
+
+/*
+ * Merges the given sorted runs into out. The merge is stable: equal elements
+ * are output in run order. The output must not overlap any run.
+ */
+ghost_impl_noinline
+void ghost_impl_merge_k(ghost_impl_qsort_state_t* state, void* out,
+        const void* const* runs, const ghost_size_t* counts, ghost_size_t run_count);
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#if GHOST_EMIT_DEFS
+    #include "ghost/impl/algorithm/merge_k/ghost_impl_merge_k_define.h"
+#endif
+
+#endif
@@ -0,0 +1,419 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_MERGE_K_DEFINE_H_INCLUDED
+#define GHOST_IMPL_MERGE_K_DEFINE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Defines Ghost's internal k-way merge.
+ */
+
+#if !GHOST_EMIT_DEFS && !GHOST_IMPL_AMALGAMATED
+    #error "This file is not supposed to be included if Ghost is not emitting function definitions."
+#endif
+
+#include "ghost/impl/algorithm/merge_k/ghost_impl_merge_k.h"
+#include "ghost/impl/ghost_impl_inline.h"
+#include "ghost/impl/ghost_impl_noinline.h"
+#include "ghost/language/ghost_null.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/language/ghost_unreachable.h"
+#include "ghost/string/ghost_memcpy.h"
+#include "ghost/type/bool/ghost_bool.h"
+#include "ghost/type/bool/ghost_true.h"
+#include "ghost/type/bool/ghost_false.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+#include "ghost/type/size_t/ghost_size_max.h"
+#include "ghost/malloc/ghost_malloc.h"
+#include "ghost/malloc/ghost_free.h"
+
+/*
+ * The number of consecutive wins by one run before the merge starts
+ * galloping. This is the same as the initial min_gallop of the stable sort.
+ */
+#define GHOST_IMPL_MERGE_K_MIN_GALLOP 7
+
+/*
+ * Merges of up to this many runs keep their loser tree and run positions on
+ * the stack. Larger merges allocate them.
+ */
+#define GHOST_IMPL_MERGE_K_STACK_RUNS 64
+
+GHOST_IMPL_FUNCTION_OPEN
+
+ghost_impl_inline
+int ghost_impl_merge_k_compare(ghost_impl_qsort_state_t* state, const void* left, const void* right) {
+    switch (state->variant) {
+        case ghost_impl_qsort_variant_nocontext: return state->compare.nocontext(left, right);
+        case ghost_impl_qsort_variant_gnu: return state->compare.gnu(left, right, state->user_context);
+        case ghost_impl_qsort_variant_bsd: return state->compare.bsd(state->user_context, left, right);
+        #if GHOST_WIN_QSORT_S_USE_CDECL
+        case ghost_impl_qsort_variant_windows: return state->compare.windows(state->user_context, left, right);
+        #endif
+        case ghost_impl_qsort_variant_indirect: break;
+    }
+    ghost_unreachable(0);
+}
+
+/*
+ * Returns a pointer to the given element of the given run.
+ */
+ghost_impl_inline
+const char* ghost_impl_merge_k_element(ghost_impl_qsort_state_t* state,
+        const void* run, ghost_size_t index)
+{
+    return ghost_static_cast(const char*, run) + index * state->element_size;
+}
+
+/*
+ * Copies count elements to out, returning a pointer past the copied elements.
+ */
+ghost_impl_inline
+char* ghost_impl_merge_k_copy(ghost_impl_qsort_state_t* state, char* out,
+        const char* from, ghost_size_t count)
+{
+    ghost_size_t bytes = count * state->element_size;
+    ghost_memcpy(out, from, bytes);
+    return out + bytes;
+}
+
+/*
+ * Returns the number of elements at the start of the given sorted run that
+ * precede the key in the merge.
+ *
+ * If upper is true, the key comes from a later run so elements equal to it
+ * precede it. Otherwise only elements less than it do.
+ *
+ * This searches exponentially from the start of the run so it's cheap when
+ * the result is small.
+ */
+ghost_impl_noinline
+ghost_size_t ghost_impl_merge_k_gallop(ghost_impl_qsort_state_t* state,
+        const void* key, const void* run, ghost_size_t count, ghost_bool upper)
+{
+    ghost_size_t low = 0;
+    ghost_size_t high;
+    ghost_size_t step = 1;
+    int limit = upper ? 0 : -1;
+
+    /* Elements before low precede the key. The element at high does not (if
+     * high < count.) */
+    for (;;) {
+        if (step >= count - low) {
+            high = count;
+            break;
+        }
+        if (ghost_impl_merge_k_compare(state,
+                    ghost_impl_merge_k_element(state, run, low + step - 1), key) > limit)
+        {
+            high = low + step - 1;
+            break;
+        }
+        low += step;
+        step += step;
+    }
+
+    while (low < high) {
+        ghost_size_t mid = low + (high - low) / 2;
+        if (ghost_impl_merge_k_compare(state,
+                    ghost_impl_merge_k_element(state, run, mid), key) > limit)
+            high = mid;
+        else
+            low = mid + 1;
+    }
+    return low;
+}
+
+/*
+ * Merges two runs. Ties go to the left run.
+ */
+ghost_impl_noinline
+void ghost_impl_merge_k_two(ghost_impl_qsort_state_t* state, char* out,
+        const char* left, ghost_size_t left_count,
+        const char* right, ghost_size_t right_count)
+{
+    ghost_size_t element_size = state->element_size;
+    ghost_size_t left_wins = 0;
+    ghost_size_t right_wins = 0;
+    ghost_size_t n;
+
+    while (left_count != 0 && right_count != 0) {
+        if (ghost_impl_merge_k_compare(state, right, left) < 0) {
+            ghost_memcpy(out, right, element_size);
+            out += element_size;
+            right += element_size;
+            --right_count;
+            left_wins = 0;
+            if (++right_wins < GHOST_IMPL_MERGE_K_MIN_GALLOP || right_count == 0)
+                continue;
+            n = ghost_impl_merge_k_gallop(state, left, right, right_count, ghost_false);
+            out = ghost_impl_merge_k_copy(state, out, right, n);
+            right += n * element_size;
+            right_count -= n;
+            right_wins = 0;
+        } else {
+            ghost_memcpy(out, left, element_size);
+            out += element_size;
+            left += element_size;
+            --left_count;
+            right_wins = 0;
+            if (++left_wins < GHOST_IMPL_MERGE_K_MIN_GALLOP || left_count == 0)
+                continue;
+            n = ghost_impl_merge_k_gallop(state, right, left, left_count, ghost_true);
+            out = ghost_impl_merge_k_copy(state, out, left, n);
+            left += n * element_size;
+            left_count -= n;
+            left_wins = 0;
+        }
+    }
+
+    out = ghost_impl_merge_k_copy(state, out, left, left_count);
+    ghost_impl_merge_k_copy(state, out, right, right_count);
+}
+
+/*
+ * Returns true if the current element of run a precedes the current element
+ * of run b in the merge. An exhausted run precedes nothing and ties go to the
+ * lower run index so the merge is stable.
+ */
+ghost_impl_inline
+ghost_bool ghost_impl_merge_k_precedes(ghost_impl_qsort_state_t* state,
+        const void* const* runs, const ghost_size_t* counts, const ghost_size_t* positions,
+        ghost_size_t a, ghost_size_t b)
+{
+    int c;
+    if (positions[a] == counts[a])
+        return ghost_false;
+    if (positions[b] == counts[b])
+        return ghost_true;
+    c = ghost_impl_merge_k_compare(state,
+            ghost_impl_merge_k_element(state, runs[a], positions[a]),
+            ghost_impl_merge_k_element(state, runs[b], positions[b]));
+    return c < 0 || (c == 0 && a < b);
+}
+
+/*
+ * Merges with a loser tree.
+ *
+ * The tree has run_count leaves (implicitly at indices run_count to
+ * 2*run_count-1) and run_count-1 internal nodes at indices 1 and up, each
+ * holding the run that lost the match there. Index 0 holds the overall winner.
+ * After the winner outputs an element, only the matches on its path to the
+ * root need to be replayed.
+ */
+ghost_impl_noinline
+void ghost_impl_merge_k_tree(ghost_impl_qsort_state_t* state, char* out,
+        const void* const* runs, const ghost_size_t* counts, ghost_size_t run_count,
+        ghost_size_t* tree, ghost_size_t* positions)
+{
+    ghost_size_t remaining = 0;
+    ghost_size_t last = run_count;
+    ghost_size_t wins = 0;
+    ghost_size_t node;
+    ghost_size_t i;
+
+    for (i = 0; i < run_count; ++i) {
+        positions[i] = 0;
+        remaining += counts[i];
+    }
+
+    /* Play the matches bottom-up storing the winner of each, then walk
+     * top-down replacing each winner with the loser. A node's children are
+     * visited after it so they still hold their winners. */
+    #define GHOST_IMPL_MERGE_K_CHILD(child) \
+        ((child) >= run_count ? (child) - run_count : tree[child])
+    for (node = run_count - 1; node > 0; --node) {
+        ghost_size_t a = GHOST_IMPL_MERGE_K_CHILD(2 * node);
+        ghost_size_t b = GHOST_IMPL_MERGE_K_CHILD(2 * node + 1);
+        tree[node] = ghost_impl_merge_k_precedes(state, runs, counts, positions, b, a) ? b : a;
+    }
+    tree[0] = tree[1];
+    for (node = 1; node < run_count; ++node) {
+        ghost_size_t a = GHOST_IMPL_MERGE_K_CHILD(2 * node);
+        ghost_size_t b = GHOST_IMPL_MERGE_K_CHILD(2 * node + 1);
+        tree[node] = tree[node] == a ? b : a;
+    }
+    #undef GHOST_IMPL_MERGE_K_CHILD
+
+    while (remaining != 0) {
+        ghost_size_t winner = tree[0];
+
+        out = ghost_impl_merge_k_copy(state, out,
+                ghost_impl_merge_k_element(state, runs[winner], positions[winner]), 1);
+        ++positions[winner];
+        --remaining;
+
+        if (winner != last) {
+            last = winner;
+            wins = 0;
+        }
+
+        /* If this run keeps winning, copy everything that precedes the
+         * runner-up in one block. The runner-up is the best of the runs that
+         * lost to the winner on its path. */
+        if (++wins >= GHOST_IMPL_MERGE_K_MIN_GALLOP && positions[winner] != counts[winner]) {
+            ghost_size_t runner_up = tree[(winner + run_count) / 2];
+            ghost_size_t n = counts[winner] - positions[winner];
+            for (node = (winner + run_count) / 4; node > 0; node /= 2)
+                if (ghost_impl_merge_k_precedes(state, runs, counts, positions, tree[node], runner_up))
+                    runner_up = tree[node];
+            if (positions[runner_up] != counts[runner_up])
+                n = ghost_impl_merge_k_gallop(state,
+                        ghost_impl_merge_k_element(state, runs[runner_up], positions[runner_up]),
+                        ghost_impl_merge_k_element(state, runs[winner], positions[winner]),
+                        n, runner_up > winner);
+            out = ghost_impl_merge_k_copy(state, out,
+                    ghost_impl_merge_k_element(state, runs[winner], positions[winner]), n);
+            positions[winner] += n;
+            remaining -= n;
+            wins = 0;
+        }
+
+        for (node = (winner + run_count) / 2; node > 0; node /= 2) {
+            if (ghost_impl_merge_k_precedes(state, runs, counts, positions, tree[node], winner)) {
+                ghost_size_t loser = winner;
+                winner = tree[node];
+                tree[node] = loser;
+            }
+        }
+        tree[0] = winner;
+    }
+}
+
+/*
+ * Merges without storing any per-run state. This is only used when the run
+ * positions can't be allocated.
+ *
+ * Each step recomputes the position in every run by searching for the last
+ * element output so it's much slower than the loser tree, but it's correct
+ * and it doesn't fail.
+ */
+ghost_impl_noinline
+void ghost_impl_merge_k_stateless(ghost_impl_qsort_state_t* state, char* out,
+        const void* const* runs, const ghost_size_t* counts, ghost_size_t run_count)
+{
+    const char* last = ghost_null;
+    ghost_size_t last_run = 0;
+    ghost_size_t last_position = 0;
+
+    for (;;) {
+        ghost_size_t best = run_count;
+        ghost_size_t best_position = 0;
+        const char* best_element = ghost_null;
+        ghost_size_t i;
+
+        for (i = 0; i < run_count; ++i) {
+            ghost_size_t position;
+            const char* element;
+            if (last == ghost_null)
+                position = 0;
+            else if (i == last_run)
+                position = last_position;
+            else
+                position = ghost_impl_merge_k_gallop(state, last, runs[i], counts[i], i < last_run);
+            if (position == counts[i])
+                continue;
+            element = ghost_impl_merge_k_element(state, runs[i], position);
+            if (best_element == ghost_null ||
+                    ghost_impl_merge_k_compare(state, element, best_element) < 0)
+            {
+                best = i;
+                best_position = position;
+                best_element = element;
+            }
+        }
+
+        if (best == run_count)
+            return;
+        ghost_memcpy(out, best_element, state->element_size);
+        last = out;
+        last_run = best;
+        last_position = best_position + 1;
+        out += state->element_size;
+    }
+}
+
+ghost_impl_noinline
+void ghost_impl_merge_k(ghost_impl_qsort_state_t* state, void* vout,
+        const void* const* runs, const ghost_size_t* counts, ghost_size_t run_count)
+{
+    char* out = ghost_static_cast(char*, vout);
+    ghost_size_t first = run_count;
+    ghost_size_t second = run_count;
+    ghost_size_t nonempty = 0;
+    ghost_size_t i;
+
+    /* Find the non-empty runs. If there are no more than two, we don't need a
+     * tree. */
+    for (i = 0; i < run_count; ++i) {
+        if (counts[i] == 0)
+            continue;
+        if (nonempty == 0)
+            first = i;
+        else if (nonempty == 1)
+            second = i;
+        ++nonempty;
+    }
+
+    if (nonempty == 0)
+        return;
+    if (nonempty == 1) {
+        ghost_impl_merge_k_copy(state, out, ghost_static_cast(const char*, runs[first]), counts[first]);
+        return;
+    }
+    if (nonempty == 2) {
+        ghost_impl_merge_k_two(state, out,
+                ghost_static_cast(const char*, runs[first]), counts[first],
+                ghost_static_cast(const char*, runs[second]), counts[second]);
+        return;
+    }
+
+    if (run_count <= GHOST_IMPL_MERGE_K_STACK_RUNS) {
+        ghost_size_t tree[GHOST_IMPL_MERGE_K_STACK_RUNS];
+        ghost_size_t positions[GHOST_IMPL_MERGE_K_STACK_RUNS];
+        ghost_impl_merge_k_tree(state, out, runs, counts, run_count, tree, positions);
+        return;
+    }
+
+    #if ghost_has(ghost_malloc) && ghost_has(ghost_free)
+    {
+        ghost_size_t* tree = ghost_null;
+        #if ghost_has(GHOST_SIZE_MAX)
+        if (run_count <= GHOST_SIZE_MAX / (2 * sizeof(ghost_size_t)))
+        #endif
+            tree = ghost_static_cast(ghost_size_t*, ghost_malloc(2 * run_count * sizeof(ghost_size_t)));
+        if (tree == ghost_null) {
+            ghost_impl_merge_k_stateless(state, out, runs, counts, run_count);
+            return;
+        }
+        ghost_impl_merge_k_tree(state, out, runs, counts, run_count, tree, tree + run_count);
+        ghost_free(tree);
+    }
+    #else
+    ghost_impl_merge_k_stateless(state, out, runs, counts, run_count);
+    #endif
+}
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#endif
@@ -63,6 +63,81 @@
     #define GHOST_QSORT_DISABLE_SYSTEM 0
 #endif
 
+/**
+ * @def GHOST_QSORT_PARALLEL_THREADS
+ *
+ * The maximum number of threads (including the calling thread) that the
+ * parallel qsort functions will use to sort a single array.
+ *
+ * Ghost has no way to query the number of processors so this should be set
+ * to something appropriate for your hardware.
+ *
+ * The default is 8.
+ */
+#ifndef GHOST_QSORT_PARALLEL_THREADS
+    #define GHOST_QSORT_PARALLEL_THREADS 8
+#endif
+
+/**
+ * @def GHOST_QSORT_PARALLEL_THRESHOLD
+ *
+ * The number of elements at or below which the parallel qsort functions sort
+ * a partition on the current thread rather than splitting it further and
+ * handing part of it to another thread.
+ *
+ * The default is 65536.
+ */
+#ifndef GHOST_QSORT_PARALLEL_THRESHOLD
+    #define GHOST_QSORT_PARALLEL_THRESHOLD 65536
+#endif
+
+/**
+ * @def GHOST_QSORT_BLOCK_PARTITION
+ *
+ * Controls whether Ghost's internal introsort uses branchless block
+ * partitioning (as in BlockQuicksort and pdqsort) instead of a three-way
+ * scan. Block partitioning avoids branch mispredictions on random keys.
+ * Ranges whose pivot equals the preceding element still use the three-way
+ * scan so that runs of equal keys are gathered in one pass.
+ *
+ * - 0 always uses the three-way scan;
+ * - 1 uses block partitioning for 4-byte and 8-byte elements;
+ * - 2 uses block partitioning for all elements.
+ *
+ * Block partitioning is not used when optimizing for size.
+ *
+ * The default is 1.
+ */
+#ifndef GHOST_QSORT_BLOCK_PARTITION
+    #define GHOST_QSORT_BLOCK_PARTITION 1
+#endif
+
+/**
+ * @def GHOST_QSORT_INDIRECT_THRESHOLD
+ *
+ * The element size in bytes at or above which Ghost's internal introsort
+ * sorts an array of pointers to the elements instead of the elements
+ * themselves. Once the pointers are sorted, the elements are permuted into
+ * place by following cycles so that each element is moved only once.
+ *
+ * Comparisons through pointers are less cache-friendly so this only pays off
+ * for large elements. Smaller elements are swapped directly in vector-sized
+ * chunks.
+ *
+ * This allocates one pointer per element with ghost_malloc(). If allocation
+ * fails or no allocator is available, the elements are sorted directly.
+ *
+ * The default is 0 which disables indirect sorting so that the internal
+ * qsort never allocates. If allocation is acceptable, 512 is a good value:
+ * below it the chunked swaps are faster, and at 1KB the indirect sort is
+ * about twice as fast.
+ *
+ * Indirect sorting is not used when optimizing for size.
+ */
+#ifndef GHOST_QSORT_INDIRECT_THRESHOLD
+    #define GHOST_QSORT_INDIRECT_THRESHOLD 0
+#endif
+
 #if GHOST_QSORT_FORCE_INTERNAL && GHOST_QSORT_DISABLE_INTERNAL
     #error "GHOST_QSORT_FORCE_INTERNAL and GHOST_QSORT_DISABLE_INTERNAL cannot both be enabled."
 #endif
@@ -31,27 +31,41 @@
 #include "ghost/language/ghost_alignof.h"
 #include "ghost/language/ghost_optimize_for_size_opt.h"
 #include "ghost/language/ghost_is_aligned.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/impl/ghost_impl_always_inline.h"
 #include "ghost/impl/ghost_impl_inline.h"
 #include "ghost/impl/ghost_impl_noinline.h"
 #include "ghost/type/size_t/ghost_size_t.h"
 #include "ghost/type/char/ghost_char_width.h"
 #include "ghost/type/uint32_t/ghost_uint32_t.h"
 #include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/string/ghost_memcpy.h"
 
 GHOST_IMPL_FUNCTION_OPEN
 
 typedef enum ghost_impl_qsort_variant_t {
     ghost_impl_qsort_variant_nocontext,
     ghost_impl_qsort_variant_gnu,
-    ghost_impl_qsort_variant_bsd
+    ghost_impl_qsort_variant_bsd,
     #if GHOST_WIN_QSORT_S_USE_CDECL
-    , ghost_impl_qsort_variant_windows
+    ghost_impl_qsort_variant_windows,
     #endif
+
+    /* The array contains pointers to the elements being sorted. The user
+     * context is the state for the elements. */
+    ghost_impl_qsort_variant_indirect
 } ghost_impl_qsort_variant_t;
 
+/*
+ * The 4 and 8 size classes are swapped as integers so they must be aligned.
+ * The 16 and 32 size classes are swapped with fixed-size copies which
+ * compilers turn into vector moves; these don't need any alignment.
+ */
 typedef enum ghost_impl_qsort_size_class_t {
     ghost_impl_qsort_size_class_4,
     ghost_impl_qsort_size_class_8,
+    ghost_impl_qsort_size_class_16,
+    ghost_impl_qsort_size_class_32,
     ghost_impl_qsort_size_class_any
 } ghost_impl_qsort_size_class_t;
 
@@ -82,9 +96,54 @@ ghost_impl_qsort_size_class_t ghost_impl_qsort_resolve_size_class(void* first, g
                 #endif
                 ))
         return ghost_impl_qsort_size_class_8;
+    if (element_size == 16)
+        return ghost_impl_qsort_size_class_16;
+    if (element_size == 32)
+        return ghost_impl_qsort_size_class_32;
     return ghost_impl_qsort_size_class_any;
 }
 
+/*
+ * Swaps two non-overlapping blocks of memory of any size and alignment.
+ *
+ * The bulk is swapped in 32-byte and then 8-byte chunks through a temporary
+ * buffer. A fixed-size ghost_memcpy() compiles to plain (vector) loads and
+ * stores so this is much faster than swapping byte by byte. When inlined with
+ * a constant size, the loops disappear entirely.
+ */
+ghost_impl_always_inline
+void ghost_impl_qsort_swap_chunks(void* vleft, void* vright, ghost_size_t size) {
+    char* left = ghost_static_cast(char*, vleft);
+    char* right = ghost_static_cast(char*, vright);
+
+    while (size >= 32) {
+        char temp[32];
+        ghost_memcpy(temp, left, 32);
+        ghost_memcpy(left, right, 32);
+        ghost_memcpy(right, temp, 32);
+        left += 32;
+        right += 32;
+        size -= 32;
+    }
+
+    while (size >= 8) {
+        char temp[8];
+        ghost_memcpy(temp, left, 8);
+        ghost_memcpy(left, right, 8);
+        ghost_memcpy(right, temp, 8);
+        left += 8;
+        right += 8;
+        size -= 8;
+    }
+
+    while (size > 0) {
+        char temp = *left;
+        *left++ = *right;
+        *right++ = temp;
+        --size;
+    }
+}
+
 typedef struct ghost_impl_qsort_state_t {
     ghost_size_t element_size;
     ghost_impl_qsort_size_class_t size_class;
@@ -109,9 +168,62 @@ typedef struct ghost_impl_qsort_state_t {
 #else
     ghost_impl_noinline
     void ghost_impl_qsort_introsort(ghost_impl_qsort_state_t* state, void* base, ghost_size_t count);
+    ghost_impl_noinline
+    void ghost_impl_qsort_introsort_depth(ghost_impl_qsort_state_t* state, void* base,
+            ghost_size_t count, ghost_size_t depth_limit);
+
+    /*
+     * Returns the maximum partition depth for an introsort of the given count
+     * before we fall back to heapsort.
+     */
+    ghost_impl_inline
+    ghost_size_t ghost_impl_qsort_depth_limit(ghost_size_t count) {
+        ghost_size_t n = 1;
+        ghost_size_t depth_limit = 2;
+        while (n < count) {
+            n *= 2;
+            depth_limit += 2;
+        }
+        return depth_limit;
+    }
     #define ghost_impl_qsort_internal ghost_impl_qsort_introsort
 #endif
 
+/*
+ * Partially sorts the array so that the element at index nth is the one that
+ * would be there if the array were sorted, with no greater elements before it
+ * and no lesser elements after it. Does nothing if nth >= count.
+ */
+ghost_impl_noinline
+void ghost_impl_qsort_nth_element(ghost_impl_qsort_state_t* state, void* base,
+        ghost_size_t count, ghost_size_t nth);
+
+/*
+ * Sorts the smallest sort_count elements of the array into its front. The
+ * order of the remaining elements is unspecified. Sorts the whole array if
+ * sort_count >= count.
+ */
+ghost_impl_noinline
+void ghost_impl_qsort_partial_sort(ghost_impl_qsort_state_t* state, void* base,
+        ghost_size_t count, ghost_size_t sort_count);
+
+/*
+ * Binary max-heap operations. The greatest element is at index 0.
+ *
+ * - heap_make() turns an array into a heap.
+ * - heap_push() adds the last element to a heap of the first count-1 elements.
+ * - heap_pop() moves the top to the end and makes the first count-1 elements a heap.
+ * - heap_replace_top() restores the heap after the top has been overwritten.
+ */
+ghost_impl_noinline
+void ghost_impl_qsort_heap_make(ghost_impl_qsort_state_t* state, void* base, ghost_size_t count);
+ghost_impl_noinline
+void ghost_impl_qsort_heap_push(ghost_impl_qsort_state_t* state, void* base, ghost_size_t count);
+ghost_impl_noinline
+void ghost_impl_qsort_heap_pop(ghost_impl_qsort_state_t* state, void* base, ghost_size_t count);
+ghost_impl_noinline
+void ghost_impl_qsort_heap_replace_top(ghost_impl_qsort_state_t* state, void* base, ghost_size_t count);
+
 GHOST_IMPL_FUNCTION_CLOSE
 
 #endif
@@ -38,6 +38,7 @@
 #include "ghost/language/ghost_expect_false.h"
 #include "ghost/language/ghost_optimize_for_size_opt.h"
 #include "ghost/language/ghost_discard.h"
+#include "ghost/language/ghost_null.h"
 #include "ghost/language/ghost_static_cast.h"
 #include "ghost/language/ghost_unreachable.h"
 #include "ghost/preprocessor/ghost_msvc_traditional.h"
@@ -51,6 +52,8 @@
 #include "ghost/type/bool/ghost_false.h"
 #include "ghost/math/min/ghost_min_z.h"
 #include "ghost/debug/ghost_assert.h"
+#include "ghost/string/ghost_memcpy.h"
+#include "ghost/impl/algorithm/sort_small/ghost_impl_sort_small.h"
 
 #if GHOST_OPTIMIZE_FOR_SIZE_OPT
 #include "ghost/language/ghost_array_count.h"
@@ -58,6 +61,27 @@
 #include "ghost/math/checked_mul/ghost_checked_mul_z.h"
 #endif
 
+#ifndef GHOST_IMPL_QSORT_INDIRECT
+    #if !GHOST_OPTIMIZE_FOR_SIZE_OPT && GHOST_QSORT_INDIRECT_THRESHOLD > 0
+        #include "ghost/malloc/ghost_malloc.h"
+        #include "ghost/malloc/ghost_free.h"
+        #if ghost_has(ghost_malloc) && ghost_has(ghost_free)
+            #define GHOST_IMPL_QSORT_INDIRECT 1
+        #endif
+    #endif
+#endif
+#ifndef GHOST_IMPL_QSORT_INDIRECT
+    #define GHOST_IMPL_QSORT_INDIRECT 0
+#endif
+
+/*
+ * Called with the number of element swaps performed each time the sort swaps
+ * elements. The sort benchmark in test/bench/ defines this to count swaps.
+ */
+#ifndef GHOST_IMPL_QSORT_SWAP_HOOK
+    #define GHOST_IMPL_QSORT_SWAP_HOOK(count) ((void)0)
+#endif
+
 /*
  * This file contains two implementations of qsort() and friends: one using a
  * fast introsort and one using shellsort.
@@ -77,7 +101,15 @@
  * properties that we don't really want to compromise on for a safe and fast
  * qsort function:
  *
- * - memory usage is O(1) because it does not recurse or allocate;
+ * - memory usage is O(logn) stack space and it doesn't allocate (unless
+ *   indirect sorting of large elements is enabled with
+ *   GHOST_QSORT_INDIRECT_THRESHOLD, which is off by default). Partitions are
+ *   tracked in a fixed-size array rather than by recursion. The only
+ *   recursion is in handling a sorted run followed by a short unsorted tail:
+ *   the tail (at most 1/16th of the range) is sorted recursively, so this
+ *   nests at most log16(n) deep, and it's merged in by
+ *   ghost_impl_qsort_merge_in_place() which recurses only on the smaller
+ *   half, so at most log2(n) deep;
  *
  * - speed and number of comparisons are both excellent in the average case due
  *   to quicksort with insertion sort optimization for short partitions;
@@ -99,6 +131,9 @@
  *   musl.)
  *
  * At least for C, introsort is still king.
+ *
+ * (A stable sort is a different matter. See ghost_impl_stable_sort() which
+ * avoids allocation by taking an optional scratch buffer from the caller.)
  */
 
 /*
@@ -124,10 +159,22 @@
 /* TODO if GHOST_MANUAL_DEFS is enabled, all the below inline functions should
  * be static. */
 
+/*
+ * The comparison and swap primitives are always inlined when optimizing for
+ * speed. Together with ghost_impl_qsort_introsort_depth_inline(), this lets
+ * GHOST_QSORT_DEFINE() resolve them at compile time. The shellsort below
+ * leaves the choice to the compiler since it's meant to be small.
+ */
+#if GHOST_OPTIMIZE_FOR_SIZE_OPT
+    #define GHOST_IMPL_QSORT_PRIMITIVE ghost_impl_inline
+#else
+    #define GHOST_IMPL_QSORT_PRIMITIVE ghost_impl_always_inline
+#endif
+
 GHOST_IMPL_FUNCTION_OPEN
 
-ghost_impl_inline
-int ghost_impl_qsort_compare(ghost_impl_qsort_state_t* state, void* left, void* right) {
+GHOST_IMPL_QSORT_PRIMITIVE
+int ghost_impl_qsort_compare_user(ghost_impl_qsort_state_t* state, void* left, void* right) {
     switch (state->variant) {
         case ghost_impl_qsort_variant_nocontext: return state->compare.nocontext(left, right);
         case ghost_impl_qsort_variant_gnu: return state->compare.gnu(left, right, state->user_context);
@@ -135,13 +182,29 @@ int ghost_impl_qsort_compare(ghost_impl_qsort_state_t* state, void* left, void*
         #if GHOST_WIN_QSORT_S_USE_CDECL
         case ghost_impl_qsort_variant_windows: return state->compare.windows(state->user_context, left, right);
         #endif
+        case ghost_impl_qsort_variant_indirect: break;
     }
     ghost_unreachable(0);
 }
 
-ghost_impl_inline
+GHOST_IMPL_QSORT_PRIMITIVE
+int ghost_impl_qsort_compare(ghost_impl_qsort_state_t* state, void* left, void* right) {
+    /* Indirect sorting is compiled out unless GHOST_QSORT_INDIRECT_THRESHOLD
+     * is set so we don't check for it on every comparison. */
+    #if GHOST_IMPL_QSORT_INDIRECT
+    if (state->variant == ghost_impl_qsort_variant_indirect)
+        return ghost_impl_qsort_compare_user(
+                ghost_static_cast(ghost_impl_qsort_state_t*, state->user_context),
+                *ghost_static_cast(void**, left),
+                *ghost_static_cast(void**, right));
+    #endif
+    return ghost_impl_qsort_compare_user(state, left, right);
+}
+
+GHOST_IMPL_QSORT_PRIMITIVE
 void ghost_impl_qsort_swap_restrict(ghost_impl_qsort_state_t* state, void* vleft, void* vright) {
     /* TODO add ghost_restrict here, make sure it works before and after */
+    GHOST_IMPL_QSORT_SWAP_HOOK(1);
     switch (state->size_class) {
         case ghost_impl_qsort_size_class_4: {
             ghost_uint32_t* left = ghost_static_cast(ghost_uint32_t*, vleft);
@@ -157,30 +220,168 @@ void ghost_impl_qsort_swap_restrict(ghost_impl_qsort_state_t* state, void* vleft
             *left = *right;
             *right = temp;
         } return;
-        case ghost_impl_qsort_size_class_any: {
-            char* left = ghost_static_cast(char*, vleft);
-            char* right = ghost_static_cast(char*, vright);
-            char* end = right + state->element_size;
-            while (right != end) {
-                char temp = *left;
-                *left++ = *right;
-                *right++ = temp;
-            }
-        } return;
+        case ghost_impl_qsort_size_class_16:
+            ghost_impl_qsort_swap_chunks(vleft, vright, 16);
+            return;
+        case ghost_impl_qsort_size_class_32:
+            ghost_impl_qsort_swap_chunks(vleft, vright, 32);
+            return;
+        case ghost_impl_qsort_size_class_any:
+            ghost_impl_qsort_swap_chunks(vleft, vright, state->element_size);
+            return;
     }
     ghost_unreachable();
 }
 
-ghost_impl_inline
+GHOST_IMPL_QSORT_PRIMITIVE
 void* ghost_impl_qsort_select( ghost_impl_qsort_state_t* context, void* base, ghost_size_t ghost_impl_v_index) {
     return ghost_static_cast(char*, base) + ghost_impl_v_index * context->element_size;
 }
 
-ghost_impl_inline
+GHOST_IMPL_QSORT_PRIMITIVE
 ghost_bool ghost_impl_qsort_compare_less(ghost_impl_qsort_state_t* context, void* left, void* right) {
     return 0 > ghost_impl_qsort_compare(context, left, right);
 }
 
+ghost_impl_always_inline
+ghost_bool ghost_impl_qsort_compare_greater(ghost_impl_qsort_state_t* context, void* left, void* right) {
+    return 0 < ghost_impl_qsort_compare(context, left, right);
+}
+
+ghost_impl_always_inline
+ghost_bool ghost_impl_qsort_compare_greater_or_equal(ghost_impl_qsort_state_t* context, void* left, void* right) {
+    return 0 <= ghost_impl_qsort_compare(context, left, right);
+}
+
+ghost_impl_always_inline
+ghost_size_t ghost_impl_qsort_array_access_index(ghost_impl_qsort_state_t* context, void* base, void* entry) {
+    return ghost_static_cast(ghost_size_t, (ghost_static_cast(char*, entry) - ghost_static_cast(char*, base))) / context->element_size;
+}
+
+ghost_impl_always_inline
+void* ghost_impl_qsort_array_access_next(ghost_impl_qsort_state_t* context, void* base, void* entry) {
+    ghost_discard(base);
+    return ghost_static_cast(char*, entry) + context->element_size;
+}
+
+ghost_impl_always_inline
+void* ghost_impl_qsort_array_access_previous(ghost_impl_qsort_state_t* context, void* base, void* entry) {
+    ghost_discard(base);
+    return ghost_static_cast(char*, entry) - context->element_size;
+}
+
+ghost_impl_always_inline
+ghost_size_t ghost_impl_qsort_heap_sort_heap_parent(ghost_size_t offset, ghost_size_t ghost_impl_v_index) {
+    return offset + ((ghost_impl_v_index - offset) - 1) / 2;
+}
+
+ghost_impl_always_inline
+ghost_size_t ghost_impl_qsort_heap_sort_heap_child_left(ghost_size_t offset, ghost_size_t ghost_impl_v_index) {
+    return offset + 2 * (ghost_impl_v_index - offset) + 1;
+}
+
+ghost_impl_always_inline
+ghost_size_t ghost_impl_qsort_heap_sort_heap_child_right(ghost_size_t offset, ghost_size_t ghost_impl_v_index) {
+    return offset + 2 * (ghost_impl_v_index - offset) + 2;
+}
+
+ghost_impl_function
+void ghost_impl_qsort_heap_sort_heap_sift_down(ghost_impl_qsort_state_t* context, void* base, ghost_size_t offset, ghost_size_t count, ghost_size_t ghost_impl_v_index) {
+    for (;;) {
+
+        ghost_size_t child_index = ghost_impl_qsort_heap_sort_heap_child_left(offset, ghost_impl_v_index);
+        if (child_index >= offset + count) {
+
+            break;
+        }
+
+        {
+        void* current_ref = ghost_impl_qsort_select(context, base, ghost_impl_v_index);
+        void* child_ref = ghost_impl_qsort_select(context, base, child_index);
+
+        ghost_size_t right_index = ghost_impl_qsort_heap_sort_heap_child_right(offset, ghost_impl_v_index);
+        if (right_index < offset + count) {
+            void* right_child_ref = ghost_impl_qsort_array_access_next(context, base, child_ref);
+            if (ghost_impl_qsort_compare_greater(context, right_child_ref, child_ref)) {
+                child_ref = right_child_ref;
+                child_index = right_index;
+            }
+        }
+
+        if (ghost_impl_qsort_compare_greater_or_equal(context, current_ref, child_ref))
+            break;
+
+        ghost_impl_qsort_swap_restrict(context, current_ref, child_ref);
+        ghost_impl_v_index = child_index;
+        }
+    }
+}
+
+ghost_impl_function
+void ghost_impl_qsort_heap_sort_heap_sift_up(ghost_impl_qsort_state_t* context, void* base, ghost_size_t offset, ghost_size_t ghost_impl_v_index) {
+    while (ghost_impl_v_index != offset) {
+        ghost_size_t parent_index = ghost_impl_qsort_heap_sort_heap_parent(offset, ghost_impl_v_index);
+
+        void* current_ref = ghost_impl_qsort_select(context, base, ghost_impl_v_index);
+        void* parent_ref = ghost_impl_qsort_select(context, base, parent_index);
+
+        if (ghost_impl_qsort_compare_greater_or_equal(context, parent_ref, current_ref))
+            break;
+
+        ghost_impl_qsort_swap_restrict(context, parent_ref, current_ref);
+        ghost_impl_v_index = parent_index;
+    }
+}
+
+ghost_impl_inline
+void ghost_impl_qsort_heap_sort_heap_build_range(ghost_impl_qsort_state_t* context, void* base, ghost_size_t offset, ghost_size_t count) {
+    ghost_size_t ghost_impl_v_index;
+
+    if (count <= 1)
+        return;
+
+    #if ghost_has(GHOST_SIZE_MAX)
+    ghost_assert(count <= GHOST_SIZE_MAX / 4, "");
+    #endif
+
+    ghost_impl_v_index = ghost_impl_qsort_heap_sort_heap_parent(offset, offset + count - 1) + 1;
+
+    while (ghost_impl_v_index > offset) {
+        --ghost_impl_v_index;
+        ghost_impl_qsort_heap_sort_heap_sift_down(context, base, offset, count, ghost_impl_v_index);
+    }
+}
+
+/*
+ * Heap operations for ghost_heap_make() and friends. These use the same
+ * binary max-heap as the heap sort fallback of the introsort so they are
+ * available regardless of whether we're optimizing for size.
+ */
+
+ghost_impl_noinline
+void ghost_impl_qsort_heap_make(ghost_impl_qsort_state_t* state, void* base, ghost_size_t count) {
+    ghost_impl_qsort_heap_sort_heap_build_range(state, base, 0, count);
+}
+
+ghost_impl_noinline
+void ghost_impl_qsort_heap_push(ghost_impl_qsort_state_t* state, void* base, ghost_size_t count) {
+    if (count > 1)
+        ghost_impl_qsort_heap_sort_heap_sift_up(state, base, 0, count - 1);
+}
+
+ghost_impl_noinline
+void ghost_impl_qsort_heap_pop(ghost_impl_qsort_state_t* state, void* base, ghost_size_t count) {
+    if (count > 1) {
+        ghost_impl_qsort_swap_restrict(state, base, ghost_impl_qsort_select(state, base, count - 1));
+        ghost_impl_qsort_heap_sort_heap_sift_down(state, base, 0, count - 1, 0);
+    }
+}
+
+ghost_impl_noinline
+void ghost_impl_qsort_heap_replace_top(ghost_impl_qsort_state_t* state, void* base, ghost_size_t count) {
+    ghost_impl_qsort_heap_sort_heap_sift_down(state, base, 0, count, 0);
+}
+
 #if GHOST_OPTIMIZE_FOR_SIZE_OPT
 
 /*
@@ -268,6 +469,27 @@ void ghost_impl_qsort_shellsort(ghost_impl_qsort_state_t* state, void* base, gho
     }
 }
 
+/*
+ * When optimizing for size, selection and partial sorting just sort the whole
+ * array.
+ */
+
+ghost_impl_noinline
+void ghost_impl_qsort_nth_element(ghost_impl_qsort_state_t* state, void* base,
+        ghost_size_t count, ghost_size_t nth)
+{
+    if (nth < count)
+        ghost_impl_qsort_shellsort(state, base, count);
+}
+
+ghost_impl_noinline
+void ghost_impl_qsort_partial_sort(ghost_impl_qsort_state_t* state, void* base,
+        ghost_size_t count, ghost_size_t sort_count)
+{
+    if (sort_count > 0)
+        ghost_impl_qsort_shellsort(state, base, count);
+}
+
 #else /* !GHOST_OPTIMIZE_FOR_SIZE_OPT */
 
 ghost_impl_always_inline
@@ -278,16 +500,6 @@ void ghost_impl_qsort_swap(ghost_impl_qsort_state_t* context,
         ghost_impl_qsort_swap_restrict(context, left, right);
 }
 
-ghost_impl_always_inline
-ghost_bool ghost_impl_qsort_compare_greater(ghost_impl_qsort_state_t* context, void* left, void* right) {
-    return 0 < ghost_impl_qsort_compare(context, left, right);
-}
-
-ghost_impl_always_inline
-ghost_bool ghost_impl_qsort_compare_greater_or_equal(ghost_impl_qsort_state_t* context, void* left, void* right) {
-    return 0 <= ghost_impl_qsort_compare(context, left, right);
-}
-
 ghost_impl_always_inline
 void* ghost_impl_qsort_compare_min(ghost_impl_qsort_state_t* context, void* left, void* right) {
     return ghost_impl_qsort_compare_less(context, left, right) ? left : right;
@@ -298,7 +510,7 @@ void* ghost_impl_qsort_compare_max(ghost_impl_qsort_state_t* context, void* left
     return ghost_impl_qsort_compare_greater(context, left, right) ? left : right;
 }
 
-ghost_impl_inline
+ghost_impl_always_inline
 void* ghost_impl_qsort_compare_median(ghost_impl_qsort_state_t* context, void* a, void* b, void* c) {
     if (ghost_impl_qsort_compare_less(context, a, b)) {
         if (ghost_impl_qsort_compare_less(context, a, c))
@@ -307,118 +519,11 @@ void* ghost_impl_qsort_compare_median(ghost_impl_qsort_state_t* context, void* a
     }
     if (ghost_impl_qsort_compare_less(context, a, c))
         return a;
-    return ghost_impl_qsort_compare_max(context, b, c);
-}
-
-
-
-ghost_impl_always_inline
-ghost_size_t ghost_impl_qsort_array_access_index(ghost_impl_qsort_state_t* context, void* base, void* entry) {
-    return ghost_static_cast(ghost_size_t, (ghost_static_cast(char*, entry) - ghost_static_cast(char*, base))) / context->element_size;
-}
-
-ghost_impl_always_inline
-void* ghost_impl_qsort_array_access_next(ghost_impl_qsort_state_t* context, void* base, void* entry) {
-    ghost_discard(base);
-    return ghost_static_cast(char*, entry) + context->element_size;
-}
-
-ghost_impl_always_inline
-void* ghost_impl_qsort_array_access_previous(ghost_impl_qsort_state_t* context, void* base, void* entry) {
-    ghost_discard(base);
-    return ghost_static_cast(char*, entry) - context->element_size;
-}
-
-
-
-
-ghost_impl_always_inline
-ghost_size_t ghost_impl_qsort_heap_sort_heap_parent(ghost_size_t offset, ghost_size_t ghost_impl_v_index) {
-    return offset + ((ghost_impl_v_index - offset) - 1) / 2;
-}
-
-ghost_impl_always_inline
-ghost_size_t ghost_impl_qsort_heap_sort_heap_child_left(ghost_size_t offset, ghost_size_t ghost_impl_v_index) {
-    return offset + 2 * (ghost_impl_v_index - offset) + 1;
-}
-
-ghost_impl_always_inline
-ghost_size_t ghost_impl_qsort_heap_sort_heap_child_right(ghost_size_t offset, ghost_size_t ghost_impl_v_index) {
-    return offset + 2 * (ghost_impl_v_index - offset) + 2;
-}
-
-ghost_impl_function
-void ghost_impl_qsort_heap_sort_heap_sift_down(ghost_impl_qsort_state_t* context, void* base, ghost_size_t offset, ghost_size_t count, ghost_size_t ghost_impl_v_index) {
-    for (;;) {
-
-        ghost_size_t child_index = ghost_impl_qsort_heap_sort_heap_child_left(offset, ghost_impl_v_index);
-        if (child_index >= offset + count) {
-
-            break;
-        }
-
-        {
-        void* current_ref = ghost_impl_qsort_select(context, base, ghost_impl_v_index);
-        void* child_ref = ghost_impl_qsort_select(context, base, child_index);
-
-        ghost_size_t right_index = ghost_impl_qsort_heap_sort_heap_child_right(offset, ghost_impl_v_index);
-        if (right_index < offset + count) {
-            void* right_child_ref = ghost_impl_qsort_array_access_next(context, base, child_ref);
-            if (ghost_impl_qsort_compare_greater(context, right_child_ref, child_ref)) {
-                child_ref = right_child_ref;
-                child_index = right_index;
-            }
-        }
-
-        if (ghost_impl_qsort_compare_greater_or_equal(context, current_ref, child_ref))
-            break;
-
-        ghost_impl_qsort_swap_restrict(context, current_ref, child_ref);
-        ghost_impl_v_index = child_index;
-        }
-    }
-}
-
-/* TODO looks like this one is unused */
-#if 0
-ghost_impl_function
-void ghost_impl_qsort_heap_sort_heap_sift_up(ghost_impl_qsort_state_t* context, void* base, ghost_size_t offset, ghost_size_t ghost_impl_v_index) {
-
-
-    while (ghost_impl_v_index != offset) {
-        ghost_size_t parent_index = ghost_impl_qsort_heap_sort_heap_parent(offset, ghost_impl_v_index);
-
-        void* current_ref = ghost_impl_qsort_select(context, base, ghost_impl_v_index);
-        void* parent_ref = ghost_impl_qsort_select(context, base, parent_index);
-
-        if (ghost_impl_qsort_compare_greater_or_equal(context, parent_ref, current_ref))
-            break;
-
-        ghost_impl_qsort_swap_restrict(context, parent_ref, current_ref);
-        ghost_impl_v_index = parent_index;
-    }
-}
-#endif
-
-ghost_impl_inline
-void ghost_impl_qsort_heap_sort_heap_build_range(ghost_impl_qsort_state_t* context, void* base, ghost_size_t offset, ghost_size_t count) {
-    ghost_size_t ghost_impl_v_index;
-
-    if (count <= 1)
-        return;
-
-    #if ghost_has(GHOST_SIZE_MAX)
-    ghost_assert(count <= GHOST_SIZE_MAX / 4, "");
-    #endif
-
-    ghost_impl_v_index = ghost_impl_qsort_heap_sort_heap_parent(offset, offset + count - 1) + 1;
-
-    while (ghost_impl_v_index > offset) {
-        --ghost_impl_v_index;
-        ghost_impl_qsort_heap_sort_heap_sift_down(context, base, offset, count, ghost_impl_v_index);
-    }
+    return ghost_impl_qsort_compare_max(context, b, c);
 }
 
+
+
 ghost_impl_inline
 void ghost_impl_qsort_heap_sort_heap_contract_bulk_range(ghost_impl_qsort_state_t* context, void* base,
         ghost_size_t offset, ghost_size_t current_count, ghost_size_t contract_count)
@@ -456,7 +561,7 @@ void ghost_impl_qsort_heap_sort_range(
             offset, range_count, range_count);
 }
 
-ghost_impl_inline
+ghost_impl_always_inline
 void ghost_impl_qsort_insertion_sort_range(
         ghost_impl_qsort_state_t* context, void* base,
         ghost_size_t offset,
@@ -535,8 +640,15 @@ void* ghost_impl_qsort_choose_pivot(
     }
 }
 
-ghost_impl_inline
-void ghost_impl_qsort_partition(
+/*
+ * Partitions a range around the pivot at its first element with a three-way
+ * scan, gathering elements equal to the pivot at both ends and then swapping
+ * them into the middle (a "fat" pivot.)
+ *
+ * Returns true if no inversions had to be swapped.
+ */
+ghost_impl_always_inline
+ghost_bool ghost_impl_qsort_partition_fat(
         ghost_impl_qsort_state_t* context, void* base,
         ghost_size_t* first_index, ghost_size_t* last_index)
 {
@@ -549,13 +661,7 @@ void ghost_impl_qsort_partition(
     void* last_entry = ghost_impl_qsort_select(
                 context, base, old_last_index);
 
-
-    void* original_pivot_ref =
-            ghost_impl_qsort_choose_pivot(context, base, old_first_index, old_last_index);
-
-    void* first_ref = (first_entry);
-    void* pivot_ref = first_ref;
-    ghost_impl_qsort_swap(context, original_pivot_ref, pivot_ref);
+    void* pivot_ref = first_entry;
 
     {
     void* left_entry = first_entry;
@@ -564,6 +670,7 @@ void ghost_impl_qsort_partition(
 
     void* left_equal_entry = left_entry;
     void* right_equal_entry = right_entry;
+    ghost_bool swapped = ghost_false;
 
     for (;;) {
 
@@ -621,7 +728,7 @@ void ghost_impl_qsort_partition(
         ghost_impl_qsort_swap_restrict(context,
                 (left_entry),
                 (right_entry));
-
+        swapped = ghost_true;
     }
 
 done_inversions:;
@@ -663,10 +770,416 @@ done_inversions:;
 
     *first_index = old_first_index + end_less_index - first_less_index;
     *last_index = old_last_index - end_greater_index + first_greater_index;
+    return !swapped;
     }}
 }
 
+/*
+ * Block partitioning is the technique from BlockQuicksort (Edelkamp and Weiss)
+ * as used in pdqsort. Rather than branching on each comparison, we compare a
+ * block of elements from each end of the range and record the offsets of
+ * those that are on the wrong side. These are then swapped in bulk. The
+ * comparison results are only used as data so the loop has no unpredictable
+ * branches (aside from those within the user's compare function.)
+ *
+ * A block partition is two-way: elements less than the pivot go left and
+ * everything else goes right. Equal keys are handled by the fat partition
+ * instead (see ghost_impl_qsort_partition().)
+ */
+
+#define GHOST_IMPL_QSORT_BLOCK_SIZE 64
+
+/*
+ * Partitions the range (first_index, last_index] around the pivot at
+ * first_index, returning the index one past the last element that is less
+ * than the pivot.
+ *
+ * already_partitioned is set to true if no elements had to be moved.
+ */
+ghost_impl_always_inline
+ghost_size_t ghost_impl_qsort_block_partition_range(
+        ghost_impl_qsort_state_t* context, void* base,
+        ghost_size_t first_index, ghost_size_t last_index,
+        ghost_bool* already_partitioned)
+{
+    ghost_size_t element_size = context->element_size;
+    ghost_size_t block_bytes = GHOST_IMPL_QSORT_BLOCK_SIZE * element_size;
+    void* pivot = ghost_impl_qsort_select(context, base, first_index);
+    char* left = ghost_static_cast(char*, pivot) + element_size;
+    char* right = ghost_static_cast(char*, ghost_impl_qsort_select(context, base, last_index)) + element_size;
+    unsigned char left_offsets[GHOST_IMPL_QSORT_BLOCK_SIZE];
+    unsigned char right_offsets[GHOST_IMPL_QSORT_BLOCK_SIZE];
+    ghost_size_t left_count = 0;
+    ghost_size_t right_count = 0;
+    ghost_size_t left_start = 0;
+    ghost_size_t right_start = 0;
+    ghost_size_t i;
+
+    /* Everything in [pivot + 1, left) goes left and everything in
+     * [right, last] goes right. We start by skipping elements that are
+     * already in place; if the scans meet, the range is already
+     * partitioned. */
+    while (left < right && ghost_impl_qsort_compare_less(context, left, pivot))
+        left += element_size;
+    while (left < right && !ghost_impl_qsort_compare_less(context, right - element_size, pivot))
+        right -= element_size;
+    *already_partitioned = left == right;
+
+    /* We fill a block of offsets from each side whenever the previous one
+     * has been used up. */
+    while (ghost_static_cast(ghost_size_t, right - left) >= 2 * block_bytes) {
+        ghost_size_t swap_count;
+
+        if (left_count == 0) {
+            left_start = 0;
+            for (i = 0; i < GHOST_IMPL_QSORT_BLOCK_SIZE; ++i) {
+                left_offsets[left_count] = ghost_static_cast(unsigned char, i);
+                left_count += ghost_static_cast(ghost_size_t, !ghost_impl_qsort_compare_less(
+                            context, left + i * element_size, pivot));
+            }
+        }
+
+        if (right_count == 0) {
+            right_start = 0;
+            for (i = 0; i < GHOST_IMPL_QSORT_BLOCK_SIZE; ++i) {
+                right_offsets[right_count] = ghost_static_cast(unsigned char, i + 1);
+                right_count += ghost_static_cast(ghost_size_t, ghost_impl_qsort_compare_less(
+                            context, right - (i + 1) * element_size, pivot));
+            }
+        }
+
+        swap_count = ghost_min_z(left_count, right_count);
+        for (i = 0; i < swap_count; ++i)
+            ghost_impl_qsort_swap_restrict(context,
+                    left + left_offsets[left_start + i] * element_size,
+                    right - right_offsets[right_start + i] * element_size);
+        left_count -= swap_count;
+        right_count -= swap_count;
+        left_start += swap_count;
+        right_start += swap_count;
+
+        if (left_count == 0)
+            left += block_bytes;
+        if (right_count == 0)
+            right -= block_bytes;
+    }
+
+    /* Finish the remainder (including any partially processed block) with a
+     * plain scan. */
+    for (;;) {
+        while (left < right && ghost_impl_qsort_compare_less(context, left, pivot))
+            left += element_size;
+        while (left < right && !ghost_impl_qsort_compare_less(context, right - element_size, pivot))
+            right -= element_size;
+        if (left == right)
+            break;
+        right -= element_size;
+        ghost_impl_qsort_swap_restrict(context, left, right);
+        left += element_size;
+    }
+
+    return ghost_impl_qsort_array_access_index(context, base, left);
+}
+
+/*
+ * Partitions a range around the pivot at its first element with a block
+ * partition. Only the pivot itself is returned as the equal range.
+ */
+ghost_impl_always_inline
+ghost_bool ghost_impl_qsort_partition_block(
+        ghost_impl_qsort_state_t* context, void* base,
+        ghost_size_t* first_index, ghost_size_t* last_index)
+{
+    ghost_size_t first = *first_index;
+    ghost_size_t last = *last_index;
+    void* first_entry = ghost_impl_qsort_select(context, base, first);
+    ghost_size_t boundary;
+    ghost_bool already_partitioned;
+
+    boundary = ghost_impl_qsort_block_partition_range(context, base, first, last,
+            &already_partitioned);
+    ghost_impl_qsort_swap(context, first_entry, ghost_impl_qsort_select(context, base, boundary - 1));
+    *first_index = boundary - 1;
+    *last_index = boundary - 1;
+    return already_partitioned;
+}
+
+/*
+ * Partitions the range [*first_index, *last_index] around a pivot, returning
+ * the range of elements equal to the pivot. Elements before it are less than
+ * the pivot and elements after it are greater.
+ *
+ * Elements of 4 or 8 bytes (or all elements, depending on
+ * GHOST_QSORT_BLOCK_PARTITION) are normally split with a branchless block
+ * partition into less than the pivot and not less. The returned range is then
+ * just the pivot; other elements equal to it are left on the right.
+ *
+ * Equal keys are handled as in pdqsort. The element before a range (if any)
+ * is never greater than any element in the range: it's either the pivot of an
+ * earlier partition or somewhere to the left of one. If our pivot is not
+ * greater than it, they are equal, so we use the fat partition which gathers
+ * every element equal to the pivot in one pass and excludes them from further
+ * sorting. A run of equal keys therefore costs one extra linear pass at most.
+ *
+ * Returns true if the range was already partitioned, i.e. no elements other
+ * than the pivot had to be moved. This is a hint that the range may already
+ * be sorted.
+ */
+ghost_impl_always_inline
+ghost_bool ghost_impl_qsort_partition(
+        ghost_impl_qsort_state_t* context, void* base,
+        ghost_size_t* first_index, ghost_size_t* last_index)
+{
+    ghost_size_t first = *first_index;
+    void* first_entry = ghost_impl_qsort_select(context, base, first);
+    ghost_impl_qsort_swap(context, first_entry,
+            ghost_impl_qsort_choose_pivot(context, base, first, *last_index));
+
+    #if GHOST_QSORT_BLOCK_PARTITION
+    if ((GHOST_QSORT_BLOCK_PARTITION == 2 ||
+                context->size_class == ghost_impl_qsort_size_class_4 ||
+                context->size_class == ghost_impl_qsort_size_class_8) &&
+            (first == 0 || ghost_impl_qsort_compare_less(context,
+                ghost_impl_qsort_select(context, base, first - 1), first_entry)))
+        return ghost_impl_qsort_partition_block(context, base, first_index, last_index);
+    #endif
+
+    return ghost_impl_qsort_partition_fat(context, base, first_index, last_index);
+}
+
+/*
+ * The functions below detect patterns in the input in the style of pdqsort
+ * so that sorted, reverse sorted and nearly sorted inputs (including a sorted
+ * array with a short unsorted tail appended) sort in near-linear time.
+ */
+
+ghost_impl_always_inline
+void ghost_impl_qsort_reverse(ghost_impl_qsort_state_t* context, void* base,
+        ghost_size_t first, ghost_size_t count)
+{
+    ghost_size_t last = first + count - 1;
+    if (count < 2)
+        return;
+    while (first < last) {
+        ghost_impl_qsort_swap_restrict(context,
+                ghost_impl_qsort_select(context, base, first),
+                ghost_impl_qsort_select(context, base, last));
+        ++first;
+        --last;
+    }
+}
+
+/*
+ * Returns the number of elements at the start of the given sorted range that
+ * are less than the key (or less than or equal to it if or_equal is true.)
+ */
 ghost_impl_inline
+ghost_size_t ghost_impl_qsort_bound(ghost_impl_qsort_state_t* context, void* base,
+        ghost_size_t first, ghost_size_t count, void* key, ghost_bool or_equal)
+{
+    ghost_size_t low = 0;
+    ghost_size_t high = count;
+    while (low < high) {
+        ghost_size_t mid = low + (high - low) / 2;
+        void* element = ghost_impl_qsort_select(context, base, first + mid);
+        if (or_equal ? !ghost_impl_qsort_compare_less(context, key, element) :
+                ghost_impl_qsort_compare_less(context, element, key))
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low;
+}
+
+/*
+ * Merges two adjacent sorted ranges in place by rotation.
+ *
+ * The longer range is split in half and the matching split point is found
+ * in the shorter range. Rotating the middle leaves two smaller merges. We
+ * recurse on the smaller one and loop on the larger. Merging a short range
+ * of t elements into a long one of n elements takes O(tlogn) comparisons
+ * and O(nlogt) swaps.
+ */
+ghost_impl_noinline
+void ghost_impl_qsort_merge_in_place(ghost_impl_qsort_state_t* context, void* base,
+        ghost_size_t first, ghost_size_t left_count, ghost_size_t right_count)
+{
+    while (left_count != 0 && right_count != 0) {
+        ghost_size_t middle = first + left_count;
+        ghost_size_t left_cut;
+        ghost_size_t right_cut;
+
+        if (left_count + right_count == 2) {
+            void* left = ghost_impl_qsort_select(context, base, first);
+            void* right = ghost_impl_qsort_select(context, base, middle);
+            if (ghost_impl_qsort_compare_less(context, right, left))
+                ghost_impl_qsort_swap_restrict(context, left, right);
+            return;
+        }
+
+        if (left_count >= right_count) {
+            left_cut = left_count / 2;
+            right_cut = ghost_impl_qsort_bound(context, base, middle, right_count,
+                    ghost_impl_qsort_select(context, base, first + left_cut), ghost_false);
+        } else {
+            right_cut = right_count / 2;
+            left_cut = ghost_impl_qsort_bound(context, base, first, left_count,
+                    ghost_impl_qsort_select(context, base, middle + right_cut), ghost_true);
+        }
+
+        /* Rotate [left_cut, middle) with [middle, middle + right_cut) */
+        ghost_impl_qsort_reverse(context, base, first + left_cut, left_count - left_cut);
+        ghost_impl_qsort_reverse(context, base, middle, right_cut);
+        ghost_impl_qsort_reverse(context, base, first + left_cut, left_count - left_cut + right_cut);
+
+        if (left_cut + right_cut < left_count + right_count - left_cut - right_cut) {
+            ghost_impl_qsort_merge_in_place(context, base, first, left_cut, right_cut);
+            first += left_cut + right_cut;
+            left_count -= left_cut;
+            right_count -= right_cut;
+        } else {
+            ghost_impl_qsort_merge_in_place(context, base, first + left_cut + right_cut,
+                    left_count - left_cut, right_count - right_cut);
+            left_count = left_cut;
+            right_count = right_cut;
+        }
+    }
+}
+
+/*
+ * Returns the length of the sorted run at the start of the given range.
+ *
+ * If the range starts with a descending run, it's reversed first. (The sort
+ * is not stable so equal elements in a descending run don't need special
+ * treatment.)
+ */
+ghost_impl_always_inline
+ghost_size_t ghost_impl_qsort_find_run(ghost_impl_qsort_state_t* context, void* base,
+        ghost_size_t first, ghost_size_t count)
+{
+    ghost_size_t i = first + 1;
+    ghost_size_t end = first + count;
+    if (count < 2)
+        return count;
+
+    if (ghost_impl_qsort_compare_less(context,
+                ghost_impl_qsort_select(context, base, i),
+                ghost_impl_qsort_select(context, base, first)))
+    {
+        while (i + 1 < end && !ghost_impl_qsort_compare_less(context,
+                    ghost_impl_qsort_select(context, base, i),
+                    ghost_impl_qsort_select(context, base, i + 1)))
+            ++i;
+        ghost_impl_qsort_reverse(context, base, first, i + 1 - first);
+    } else {
+        while (i + 1 < end && !ghost_impl_qsort_compare_less(context,
+                    ghost_impl_qsort_select(context, base, i + 1),
+                    ghost_impl_qsort_select(context, base, i)))
+            ++i;
+    }
+    return i + 1 - first;
+}
+
+/*
+ * Attempts an insertion sort on the given range, giving up if more than a
+ * few elements are out of place. Returns true if the range is now sorted.
+ *
+ * This is used after a partition that didn't need to move anything: such a
+ * range is likely to be sorted already.
+ */
+ghost_impl_always_inline
+ghost_bool ghost_impl_qsort_partial_insertion_sort(ghost_impl_qsort_state_t* context, void* base,
+        ghost_size_t first, ghost_size_t count)
+{
+    ghost_size_t moves = 0;
+    ghost_size_t i;
+    for (i = first + 1; i < first + count; ++i) {
+        ghost_size_t j;
+        for (j = i; j > first; --j) {
+            void* current = ghost_impl_qsort_select(context, base, j);
+            void* previous = ghost_impl_qsort_select(context, base, j - 1);
+            if (!ghost_impl_qsort_compare_less(context, current, previous))
+                break;
+            ghost_impl_qsort_swap_restrict(context, current, previous);
+            if (++moves > 8)
+                return ghost_false;
+        }
+    }
+    return ghost_true;
+}
+
+/*
+ * Swaps a few elements in the given range to break up patterns. This is done
+ * after a badly unbalanced partition so that the next pivot is likely to be
+ * better.
+ */
+ghost_impl_always_inline
+void ghost_impl_qsort_shuffle(ghost_impl_qsort_state_t* context, void* base,
+        ghost_size_t first, ghost_size_t count)
+{
+    ghost_size_t last = first + count - 1;
+    ghost_size_t quarter = count / 4;
+    if (count < 24)
+        return;
+    ghost_impl_qsort_swap_restrict(context,
+            ghost_impl_qsort_select(context, base, first),
+            ghost_impl_qsort_select(context, base, first + quarter));
+    ghost_impl_qsort_swap_restrict(context,
+            ghost_impl_qsort_select(context, base, last),
+            ghost_impl_qsort_select(context, base, last - quarter));
+    if (count > 128) {
+        ghost_impl_qsort_swap_restrict(context,
+                ghost_impl_qsort_select(context, base, first + 1),
+                ghost_impl_qsort_select(context, base, first + quarter + 1));
+        ghost_impl_qsort_swap_restrict(context,
+                ghost_impl_qsort_select(context, base, first + 2),
+                ghost_impl_qsort_select(context, base, first + quarter + 2));
+        ghost_impl_qsort_swap_restrict(context,
+                ghost_impl_qsort_select(context, base, last - 1),
+                ghost_impl_qsort_select(context, base, last - quarter - 1));
+        ghost_impl_qsort_swap_restrict(context,
+                ghost_impl_qsort_select(context, base, last - 2),
+                ghost_impl_qsort_select(context, base, last - quarter - 2));
+    }
+}
+
+/*
+ * Sorts a small range of 4-byte or 8-byte elements with a sorting network
+ * (see ghost_impl_sort_small.h.) Each compare-exchange still calls the
+ * compare function but the elements are exchanged with conditional selects
+ * rather than a branch, so there are no mispredictions on the data.
+ */
+ghost_impl_always_inline
+void ghost_impl_qsort_network_sort_range(ghost_impl_qsort_state_t* context, void* base,
+        ghost_size_t first, ghost_size_t count)
+{
+    void* range = ghost_impl_qsort_select(context, base, first);
+
+    if (context->size_class == ghost_impl_qsort_size_class_4) {
+        ghost_uint32_t* array = ghost_static_cast(ghost_uint32_t*, range);
+        GHOST_IMPL_SORT_SMALL_NETWORK(count, ghost_impl_v_left, ghost_impl_v_right, {
+            ghost_uint32_t x = array[ghost_impl_v_left];
+            ghost_uint32_t y = array[ghost_impl_v_right];
+            ghost_bool swap = ghost_impl_qsort_compare_less(context, &array[ghost_impl_v_right], &array[ghost_impl_v_left]);
+            array[ghost_impl_v_left] = swap ? y : x;
+            array[ghost_impl_v_right] = swap ? x : y;
+            GHOST_IMPL_QSORT_SWAP_HOOK(swap);
+        });
+    } else {
+        ghost_uint64_t* array = ghost_static_cast(ghost_uint64_t*, range);
+        ghost_assert(context->size_class == ghost_impl_qsort_size_class_8, "");
+        GHOST_IMPL_SORT_SMALL_NETWORK(count, ghost_impl_v_left, ghost_impl_v_right, {
+            ghost_uint64_t x = array[ghost_impl_v_left];
+            ghost_uint64_t y = array[ghost_impl_v_right];
+            ghost_bool swap = ghost_impl_qsort_compare_less(context, &array[ghost_impl_v_right], &array[ghost_impl_v_left]);
+            array[ghost_impl_v_left] = swap ? y : x;
+            array[ghost_impl_v_right] = swap ? x : y;
+            GHOST_IMPL_QSORT_SWAP_HOOK(swap);
+        });
+    }
+}
+
+ghost_impl_always_inline
 ghost_bool ghost_impl_qsort_fallback(
         ghost_impl_qsort_state_t* context, void* base,
         ghost_size_t first, ghost_size_t count, ghost_size_t depth, ghost_size_t depth_limit
@@ -674,7 +1187,11 @@ ghost_bool ghost_impl_qsort_fallback(
     ghost_size_t count_limit = 8;
 
     if (count <= count_limit) {
-        ghost_impl_qsort_insertion_sort_range(context, base, first, count);
+        if (context->size_class == ghost_impl_qsort_size_class_4 ||
+                context->size_class == ghost_impl_qsort_size_class_8)
+            ghost_impl_qsort_network_sort_range(context, base, first, count);
+        else
+            ghost_impl_qsort_insertion_sort_range(context, base, first, count);
         return ghost_true;
     }
 
@@ -687,13 +1204,23 @@ ghost_bool ghost_impl_qsort_fallback(
 }
 
 /*
- * As above, we use ghost_impl_noinline to reduce the risk of duplicates
- * existing in the final link.
+ * Performs an introsort that falls back to heapsort for any partition deeper
+ * than the given depth limit.
+ *
+ * This lets callers that have already partitioned the array (e.g. the
+ * parallel qsort) pass along their remaining depth so that the O(nlogn) worst
+ * case still holds for the array as a whole.
+ *
+ * The body is always inlined so that GHOST_QSORT_DEFINE() can expand it with
+ * a constant state: the compiler then resolves the comparison and swap at
+ * compile time. Everything else calls ghost_impl_qsort_introsort_depth()
+ * below which, as above, is ghost_impl_noinline to reduce the risk of
+ * duplicates existing in the final link.
  */
-ghost_impl_noinline
-void ghost_impl_qsort_introsort(
+ghost_impl_always_inline
+void ghost_impl_qsort_introsort_depth_inline(
     ghost_impl_qsort_state_t* context, void* base,
-    ghost_size_t range_count
+    ghost_size_t range_count, ghost_size_t depth_limit
 ) {
     struct {
         ghost_size_t first;
@@ -704,20 +1231,28 @@ void ghost_impl_qsort_introsort(
     if (range_count <= 1)
         return;
 
+    /* Check for a sorted or reverse sorted array, possibly with a short
+     * unsorted tail. If the tail is short enough, we sort it separately and
+     * merge it in. */
+    {
+    ghost_size_t run = ghost_impl_qsort_find_run(context, base, 0, range_count);
+    ghost_size_t tail = range_count - run;
+    if (tail == 0)
+        return;
+    if (tail <= range_count / 16) {
+        ghost_impl_qsort_introsort_depth(context,
+                ghost_impl_qsort_select(context, base, run), tail, depth_limit);
+        ghost_impl_qsort_merge_in_place(context, base, 0, run, tail);
+        return;
+    }
+    }
+
     {
     ghost_size_t pos = 0;
     stack[0].first = 0;
     stack[0].last = range_count - 1;
     stack[0].depth = 0;
 
-    {
-    ghost_size_t n = 1;
-    ghost_size_t depth_limit = 2;
-    while (n < range_count) {
-        n *= 2;
-        depth_limit += 2;
-    }
-
     for (;;) {
         ghost_size_t first = stack[pos].first;
         ghost_size_t last = stack[pos].last;
@@ -735,11 +1270,26 @@ void ghost_impl_qsort_introsort(
         {
         ghost_size_t equal_first = first;
         ghost_size_t equal_last = last;
-        ghost_impl_qsort_partition(context, base, &equal_first, &equal_last);
+        ghost_bool already_partitioned = ghost_impl_qsort_partition(context, base, &equal_first, &equal_last);
         {
         ghost_size_t left_count = equal_first - first;
         ghost_size_t right_count = last - equal_last;
 
+        if (equal_first == equal_last && ghost_min_z(left_count, right_count) < step_count / 8) {
+            /* The partition was badly unbalanced. We shuffle some elements
+             * around to try to get a better pivot next time. (If the equal
+             * range is larger, the imbalance is due to duplicates, which is
+             * fine.) */
+            ghost_impl_qsort_shuffle(context, base, first, left_count);
+            ghost_impl_qsort_shuffle(context, base, equal_last + 1, right_count);
+        } else if (already_partitioned) {
+            /* Nothing moved so the sides may already be sorted. */
+            if (ghost_impl_qsort_partial_insertion_sort(context, base, first, left_count))
+                left_count = 0;
+            if (ghost_impl_qsort_partial_insertion_sort(context, base, equal_last + 1, right_count))
+                right_count = 0;
+        }
+
         if (left_count <= 1 && right_count <= 1) {
             if (pos == 0)
                 break;
@@ -773,7 +1323,226 @@ void ghost_impl_qsort_introsort(
         }
         }}}
     }
-    }}
+    }
+}
+
+ghost_impl_noinline
+void ghost_impl_qsort_introsort_depth(
+    ghost_impl_qsort_state_t* context, void* base,
+    ghost_size_t range_count, ghost_size_t depth_limit
+) {
+    ghost_impl_qsort_introsort_depth_inline(context, base, range_count, depth_limit);
+}
+
+#if GHOST_IMPL_QSORT_INDIRECT
+/*
+ * Moves the elements into the order given by the sorted array of pointers,
+ * i.e. the element that refs[i] points to is moved to index i.
+ *
+ * We follow each cycle of the permutation, lifting out its first element
+ * into temp and then moving each element directly to its destination. Each
+ * element is therefore copied only once (plus once more per cycle.) The refs
+ * are updated as we go so that cycles already placed are skipped.
+ */
+ghost_impl_inline
+void ghost_impl_qsort_indirect_permute(ghost_impl_qsort_state_t* context, void* base,
+        void** refs, ghost_size_t count, void* temp)
+{
+    ghost_size_t element_size = context->element_size;
+    ghost_size_t i;
+
+    for (i = 0; i < count; ++i) {
+        void* hole = ghost_impl_qsort_select(context, base, i);
+        ghost_size_t j = i;
+        if (refs[i] == hole)
+            continue;
+
+        ghost_memcpy(temp, hole, element_size);
+        while (refs[j] != hole) {
+            void* to = ghost_impl_qsort_select(context, base, j);
+            char* from = ghost_static_cast(char*, refs[j]);
+            ghost_memcpy(to, from, element_size);
+            refs[j] = to;
+            j = ghost_static_cast(ghost_size_t, from - ghost_static_cast(char*, base)) / element_size;
+        }
+        ghost_memcpy(ghost_impl_qsort_select(context, base, j), temp, element_size);
+        refs[j] = ghost_impl_qsort_select(context, base, j);
+    }
+}
+
+/*
+ * Sorts large elements indirectly: we sort an array of pointers to them and
+ * then permute the elements into place. Swapping a pointer is far cheaper
+ * than swapping a large element, and partitioning swaps each element
+ * O(logn) times.
+ *
+ * Returns false if memory could not be allocated.
+ */
+ghost_impl_inline
+ghost_bool ghost_impl_qsort_indirect(ghost_impl_qsort_state_t* context, void* base,
+        ghost_size_t count)
+{
+    ghost_impl_qsort_state_t indirect;
+    void** refs;
+    ghost_size_t i;
+
+    #if ghost_has(GHOST_SIZE_MAX)
+    if (count > (GHOST_SIZE_MAX - context->element_size) / sizeof(void*))
+        return ghost_false;
+    #endif
+
+    /* The temporary element for permuting goes after the pointers. */
+    refs = ghost_static_cast(void**, ghost_malloc(count * sizeof(void*) + context->element_size));
+    if (refs == ghost_null)
+        return ghost_false;
+    for (i = 0; i < count; ++i)
+        refs[i] = ghost_impl_qsort_select(context, base, i);
+
+    indirect.element_size = sizeof(void*);
+    indirect.size_class = ghost_impl_qsort_resolve_size_class(refs, sizeof(void*));
+    indirect.variant = ghost_impl_qsort_variant_indirect;
+    indirect.user_context = context;
+    ghost_impl_qsort_introsort_depth(&indirect, refs, count,
+            ghost_impl_qsort_depth_limit(count));
+
+    ghost_impl_qsort_indirect_permute(context, base, refs, count, refs + count);
+    ghost_free(refs);
+    return ghost_true;
+}
+#endif
+
+/*
+ * Sorts with introsort. Like ghost_impl_qsort_introsort_depth_inline(), this
+ * is always inlined so that GHOST_QSORT_DEFINE() can expand it.
+ */
+ghost_impl_always_inline
+void ghost_impl_qsort_introsort_inline(
+    ghost_impl_qsort_state_t* context, void* base,
+    ghost_size_t range_count
+) {
+    #if GHOST_IMPL_QSORT_INDIRECT
+    /* Small arrays are insertion sorted or detected as already sorted so
+     * there's no point allocating for them. */
+    if (context->element_size >= GHOST_QSORT_INDIRECT_THRESHOLD && range_count > 16 &&
+            ghost_impl_qsort_indirect(context, base, range_count))
+        return;
+    #endif
+
+    ghost_impl_qsort_introsort_depth_inline(context, base, range_count,
+            ghost_impl_qsort_depth_limit(range_count));
+}
+
+ghost_impl_noinline
+void ghost_impl_qsort_introsort(
+    ghost_impl_qsort_state_t* context, void* base,
+    ghost_size_t range_count
+) {
+    ghost_impl_qsort_introsort_inline(context, base, range_count);
+}
+
+/*
+ * Moves the k smallest elements of the range to its front using a max-heap of
+ * size k, leaving the largest of them at first + k - 1. This is O(nlogk)
+ * regardless of input so it's the worst-case fallback of nth_element.
+ */
+ghost_impl_inline
+void ghost_impl_qsort_heap_select(ghost_impl_qsort_state_t* context, void* base,
+        ghost_size_t first, ghost_size_t count, ghost_size_t k)
+{
+    void* top = ghost_impl_qsort_select(context, base, first);
+    ghost_size_t i;
+
+    ghost_impl_qsort_heap_sort_heap_build_range(context, base, first, k);
+    for (i = first + k; i < first + count; ++i) {
+        void* current = ghost_impl_qsort_select(context, base, i);
+        if (ghost_impl_qsort_compare_less(context, current, top)) {
+            ghost_impl_qsort_swap_restrict(context, current, top);
+            ghost_impl_qsort_heap_sort_heap_sift_down(context, base, first, k, first);
+        }
+    }
+    ghost_impl_qsort_swap(context, top,
+            ghost_impl_qsort_select(context, base, first + k - 1));
+}
+
+/*
+ * Performs an introselect: a quickselect with the same pivot selection and
+ * partitioning as the introsort above, recursing only into the side that
+ * contains nth. Past the depth limit it falls back to a heap select so the
+ * worst case is O(nlogn).
+ *
+ * Every range we narrow down to is preceded by elements that are not greater
+ * than any element in it, just like in the introsort, so the partition's
+ * handling of equal elements and the insertion sort still apply.
+ */
+ghost_impl_noinline
+void ghost_impl_qsort_nth_element(
+    ghost_impl_qsort_state_t* context, void* base,
+    ghost_size_t range_count, ghost_size_t nth
+) {
+    ghost_size_t first = 0;
+    ghost_size_t last;
+    ghost_size_t depth = 0;
+    ghost_size_t depth_limit;
+
+    if (nth >= range_count)
+        return;
+    last = range_count - 1;
+    depth_limit = ghost_impl_qsort_depth_limit(range_count);
+
+    for (;;) {
+        ghost_size_t step_count = last - first + 1;
+
+        if (step_count <= 8) {
+            ghost_impl_qsort_insertion_sort_range(context, base, first, step_count);
+            return;
+        }
+
+        if (depth == depth_limit) {
+            ghost_impl_qsort_heap_select(context, base, first, step_count, nth - first + 1);
+            return;
+        }
+
+        {
+        ghost_size_t equal_first = first;
+        ghost_size_t equal_last = last;
+        ghost_discard(ghost_impl_qsort_partition(context, base, &equal_first, &equal_last));
+
+        if (equal_first == equal_last &&
+                ghost_min_z(equal_first - first, last - equal_last) < step_count / 8)
+        {
+            ghost_impl_qsort_shuffle(context, base, first, equal_first - first);
+            ghost_impl_qsort_shuffle(context, base, equal_last + 1, last - equal_last);
+        }
+
+        if (nth < equal_first)
+            last = equal_first - 1;
+        else if (nth > equal_last)
+            first = equal_last + 1;
+        else
+            return;
+        ++depth;
+        }
+    }
+}
+
+/*
+ * Sorts the smallest sort_count elements into the front of the array. We
+ * select the last of them with nth_element and then sort those in front of
+ * it, so this is O(n + klogk) on average.
+ */
+ghost_impl_noinline
+void ghost_impl_qsort_partial_sort(
+    ghost_impl_qsort_state_t* context, void* base,
+    ghost_size_t range_count, ghost_size_t sort_count
+) {
+    if (sort_count >= range_count) {
+        ghost_impl_qsort_introsort(context, base, range_count);
+        return;
+    }
+    if (sort_count == 0)
+        return;
+    ghost_impl_qsort_nth_element(context, base, range_count, sort_count - 1);
+    ghost_impl_qsort_introsort(context, base, sort_count - 1);
 }
 
 #endif
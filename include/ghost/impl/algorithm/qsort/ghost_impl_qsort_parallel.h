@@ -0,0 +1,204 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_QSORT_PARALLEL_H_INCLUDED
+#define GHOST_IMPL_QSORT_PARALLEL_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * ghost_impl_qsort_parallel()
+ *
+ * Ghost's internal parallel qsort. This is used to implement all of the
+ * parallel qsort variants (which never wrap a platform function.)
+ *
+ * The array is partitioned with the same pivot selection and partitioning as
+ * the introsort. Each partition step splits the remaining threads between the
+ * two sides: one side is handed to a new thread while the current thread
+ * continues with the other. Once a partition is small enough or no more
+ * threads are available, it is finished with the serial introsort.
+ *
+ * Every partition step counts towards the introsort depth limit, and the
+ * remaining depth is passed along to the serial introsort. A bad run of
+ * pivots therefore still falls back to heapsort so the worst case remains
+ * O(nlogn).
+ *
+ * When optimizing for size or when threads are not available, this simply
+ * calls the serial internal qsort.
+ */
+
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_config.h"
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_internal.h"
+#include "ghost/language/ghost_optimize_for_size_opt.h"
+
+#ifdef GHOST_IMPL_QSORT_PARALLEL_USE_THREADS
+    #error
+#endif
+#if !GHOST_OPTIMIZE_FOR_SIZE_OPT
+    #include "ghost/thread/vthread/ghost_vthread_create.h"
+    #include "ghost/thread/vthread/ghost_vthread_join.h"
+    #if ghost_has(ghost_vthread_create) && ghost_has(ghost_vthread_join)
+        #define GHOST_IMPL_QSORT_PARALLEL_USE_THREADS
+    #endif
+#endif
+
+#ifdef GHOST_IMPL_QSORT_PARALLEL_USE_THREADS
+    #undef GHOST_IMPL_QSORT_PARALLEL_USE_THREADS
+
+    #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/ghost_impl_inline.h"
+    #include "ghost/language/ghost_discard.h"
+    #include "ghost/language/ghost_null.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+
+    GHOST_IMPL_FUNCTION_OPEN
+
+    typedef struct ghost_impl_qsort_parallel_task_t {
+        ghost_impl_qsort_state_t* state;
+        void* base;
+        ghost_size_t first;
+        ghost_size_t count;
+        ghost_size_t depth;
+        ghost_size_t depth_limit;
+        ghost_size_t threads;
+    } ghost_impl_qsort_parallel_task_t;
+
+    ghost_impl_function
+    void ghost_impl_qsort_parallel_thread(void* ghost_impl_v_task);
+
+    ghost_impl_function
+    void ghost_impl_qsort_parallel_range(ghost_impl_qsort_parallel_task_t* ghost_impl_v_task)
+    #if !GHOST_EMIT_DEFS
+    ;
+    #else
+    {
+        ghost_impl_qsort_state_t* state = ghost_impl_v_task->state;
+        char* base = ghost_static_cast(char*, ghost_impl_v_task->base);
+        ghost_size_t first = ghost_impl_v_task->first;
+        ghost_size_t count = ghost_impl_v_task->count;
+        ghost_size_t depth = ghost_impl_v_task->depth;
+        ghost_size_t depth_limit = ghost_impl_v_task->depth_limit;
+        ghost_size_t threads = ghost_impl_v_task->threads;
+
+        /* We track ranges by index into the whole array (rather than moving
+         * the base) so that the partition can see the element before each
+         * range. */
+        for (;;) {
+            ghost_size_t equal_first = first;
+            ghost_size_t equal_last = first + count - 1;
+            ghost_size_t left_count;
+            ghost_size_t right_count;
+            ghost_size_t right_first;
+
+            if (count <= GHOST_QSORT_PARALLEL_THRESHOLD || threads <= 1) {
+                ghost_impl_qsort_introsort_depth(state, base + first * state->element_size,
+                        count, depth_limit - depth);
+                return;
+            }
+            if (depth == depth_limit) {
+                ghost_impl_qsort_heap_sort_range(state, base, first, count);
+                return;
+            }
+
+            ghost_discard(ghost_impl_qsort_partition(state, base, &equal_first, &equal_last));
+            ++depth;
+            left_count = equal_first - first;
+            right_count = first + count - 1 - equal_last;
+            right_first = equal_last + 1;
+
+            /* If one side is small it isn't worth a thread. We sort it here
+             * and keep all our threads for the other side. */
+            if (left_count <= GHOST_QSORT_PARALLEL_THRESHOLD || right_count <= GHOST_QSORT_PARALLEL_THRESHOLD) {
+                if (left_count < right_count) {
+                    ghost_impl_qsort_introsort_depth(state, base + first * state->element_size,
+                            left_count, depth_limit - depth);
+                    first = right_first;
+                    count = right_count;
+                } else {
+                    ghost_impl_qsort_introsort_depth(state, base + right_first * state->element_size,
+                            right_count, depth_limit - depth);
+                    count = left_count;
+                }
+                if (count <= 1)
+                    return;
+                continue;
+            }
+
+            /* Otherwise we hand the right side and half our threads to a new
+             * thread and continue with the left side here. */
+            {
+                ghost_impl_qsort_parallel_task_t left;
+                ghost_impl_qsort_parallel_task_t right;
+                ghost_vthread_t thread;
+
+                right.state = state;
+                right.base = base;
+                right.first = right_first;
+                right.count = right_count;
+                right.depth = depth;
+                right.depth_limit = depth_limit;
+                right.threads = threads / 2;
+                ghost_vthread_create(&thread, &ghost_impl_qsort_parallel_thread, &right, ghost_null);
+
+                left.state = state;
+                left.base = base;
+                left.first = first;
+                left.count = left_count;
+                left.depth = depth;
+                left.depth_limit = depth_limit;
+                left.threads = threads - threads / 2;
+                ghost_impl_qsort_parallel_range(&left);
+
+                ghost_vthread_join(&thread);
+                return;
+            }
+        }
+    }
+    #endif
+
+    ghost_impl_function
+    void ghost_impl_qsort_parallel_thread(void* ghost_impl_v_task) GHOST_IMPL_DEF({
+        ghost_impl_qsort_parallel_range(
+                ghost_static_cast(ghost_impl_qsort_parallel_task_t*, ghost_impl_v_task));
+    })
+
+    ghost_impl_inline
+    void ghost_impl_qsort_parallel(ghost_impl_qsort_state_t* state, void* base, ghost_size_t count) {
+        ghost_impl_qsort_parallel_task_t task;
+        if (count <= 1)
+            return;
+        task.state = state;
+        task.base = base;
+        task.first = 0;
+        task.count = count;
+        task.depth = 0;
+        task.depth_limit = ghost_impl_qsort_depth_limit(count);
+        task.threads = GHOST_QSORT_PARALLEL_THREADS;
+        ghost_impl_qsort_parallel_range(&task);
+    }
+
+    GHOST_IMPL_FUNCTION_CLOSE
+#else
+    #define ghost_impl_qsort_parallel ghost_impl_qsort_internal
+#endif
+
+#endif
@@ -0,0 +1,43 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_RABIN_KARP_H_INCLUDED
+#define GHOST_IMPL_RABIN_KARP_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * The base of the Rabin-Karp polynomial.
+ *
+ * Any odd base works modulo 2^64. This one (the 64-bit golden ratio constant)
+ * has well-mixed bits so each byte affects the high bits of the hash quickly.
+ * It must never change since that would change every hash.
+ */
+
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+#ifndef GHOST_IMPL_RABIN_KARP_BASE
+    #if ghost_has(GHOST_UINT64_C)
+        #define GHOST_IMPL_RABIN_KARP_BASE GHOST_UINT64_C(0x9E3779B97F4A7C15)
+    #endif
+#endif
+
+#endif
@@ -0,0 +1,213 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_RADIX_SORT_H_INCLUDED
+#define GHOST_IMPL_RADIX_SORT_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Ghost's internal LSD radix sort. This is used to implement all of the
+ * radix sort variants.
+ *
+ * Keys are sorted one byte at a time from least to most significant. The
+ * histograms for all bytes are built in a single pass over the input. Passes
+ * in which every key has the same byte are skipped entirely, so for example
+ * small unsigned values only pay for the low bytes. Each pass scatters
+ * elements from one buffer to the other; if the result ends up in the
+ * scratch buffer it is copied back at the end.
+ *
+ * Elements are moved and keys are read with ghost_memcpy() so that any
+ * element type can be sorted without violating aliasing rules. The core
+ * functions are always inlined into the public functions so that the element
+ * size, key offset and key kind are constants and these copies compile to
+ * plain loads and stores.
+ *
+ * Keys are transformed as they are read so that they sort correctly as
+ * unsigned integers. The elements themselves are never modified:
+ *
+ * - Signed integers have their sign bit flipped.
+ *
+ * - Floats have their sign bit flipped if positive, or all bits flipped if
+ *   negative. This puts -0.0 before +0.0 and negative NaNs before -infinity
+ *   and positive NaNs after +infinity.
+ *
+ * The histograms are on the stack: 8 KiB for 32-bit keys and 16 KiB for
+ * 64-bit keys on a 64-bit platform.
+ */
+
+#include "ghost/impl/ghost_impl_always_inline.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+#include "ghost/type/uint32_t/ghost_uint32_t.h"
+#include "ghost/type/uint32_t/ghost_uint32_c.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/string/ghost_memcpy.h"
+#include "ghost/string/ghost_memset.h"
+
+#define GHOST_IMPL_RADIX_SORT_UNSIGNED 0
+#define GHOST_IMPL_RADIX_SORT_SIGNED 1
+#define GHOST_IMPL_RADIX_SORT_FLOAT 2
+
+GHOST_IMPL_FUNCTION_OPEN
+
+#if ghost_has(ghost_uint32_t)
+ghost_impl_always_inline
+ghost_uint32_t ghost_impl_radix_sort_key_32(const char* element, ghost_size_t key_offset, int kind) {
+    ghost_uint32_t key;
+    ghost_memcpy(&key, element + key_offset, sizeof(key));
+    if (kind == GHOST_IMPL_RADIX_SORT_SIGNED)
+        return key ^ GHOST_UINT32_C(0x80000000);
+    if (kind == GHOST_IMPL_RADIX_SORT_FLOAT)
+        return (key & GHOST_UINT32_C(0x80000000)) ? ~key : (key | GHOST_UINT32_C(0x80000000));
+    return key;
+}
+
+ghost_impl_always_inline
+void ghost_impl_radix_sort_32(void* array, void* scratch, ghost_size_t count,
+        ghost_size_t element_size, ghost_size_t key_offset, int kind)
+{
+    ghost_size_t histograms[4][256];
+    char* src = ghost_static_cast(char*, array);
+    char* dst = ghost_static_cast(char*, scratch);
+    ghost_size_t i;
+    unsigned pass;
+
+    if (count <= 1)
+        return;
+
+    ghost_memset(histograms, 0, sizeof(histograms));
+    for (i = 0; i < count; ++i) {
+        ghost_uint32_t key = ghost_impl_radix_sort_key_32(src + i * element_size, key_offset, kind);
+        ++histograms[0][key & 0xFF];
+        ++histograms[1][(key >> 8) & 0xFF];
+        ++histograms[2][(key >> 16) & 0xFF];
+        ++histograms[3][key >> 24];
+    }
+
+    for (pass = 0; pass < 4; ++pass) {
+        ghost_size_t* histogram = histograms[pass];
+        unsigned shift = pass * 8;
+        ghost_size_t total = 0;
+        ghost_size_t digit;
+        char* temp;
+
+        /* If all keys have the same byte, this pass would not move anything. */
+        digit = ghost_static_cast(ghost_size_t,
+                (ghost_impl_radix_sort_key_32(src, key_offset, kind) >> shift) & 0xFF);
+        if (histogram[digit] == count)
+            continue;
+
+        for (digit = 0; digit < 256; ++digit) {
+            ghost_size_t bucket = histogram[digit];
+            histogram[digit] = total;
+            total += bucket;
+        }
+
+        for (i = 0; i < count; ++i) {
+            const char* element = src + i * element_size;
+            digit = ghost_static_cast(ghost_size_t,
+                    (ghost_impl_radix_sort_key_32(element, key_offset, kind) >> shift) & 0xFF);
+            ghost_memcpy(dst + histogram[digit]++ * element_size, element, element_size);
+        }
+
+        temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != array)
+        ghost_memcpy(array, src, count * element_size);
+}
+#endif
+
+#if ghost_has(ghost_uint64_t)
+ghost_impl_always_inline
+ghost_uint64_t ghost_impl_radix_sort_key_64(const char* element, ghost_size_t key_offset, int kind) {
+    ghost_uint64_t key;
+    ghost_memcpy(&key, element + key_offset, sizeof(key));
+    if (kind == GHOST_IMPL_RADIX_SORT_SIGNED)
+        return key ^ GHOST_UINT64_C(0x8000000000000000);
+    if (kind == GHOST_IMPL_RADIX_SORT_FLOAT)
+        return (key & GHOST_UINT64_C(0x8000000000000000)) ? ~key : (key | GHOST_UINT64_C(0x8000000000000000));
+    return key;
+}
+
+ghost_impl_always_inline
+void ghost_impl_radix_sort_64(void* array, void* scratch, ghost_size_t count,
+        ghost_size_t element_size, ghost_size_t key_offset, int kind)
+{
+    ghost_size_t histograms[8][256];
+    char* src = ghost_static_cast(char*, array);
+    char* dst = ghost_static_cast(char*, scratch);
+    ghost_size_t i;
+    unsigned pass;
+
+    if (count <= 1)
+        return;
+
+    ghost_memset(histograms, 0, sizeof(histograms));
+    for (i = 0; i < count; ++i) {
+        ghost_uint64_t key = ghost_impl_radix_sort_key_64(src + i * element_size, key_offset, kind);
+        for (pass = 0; pass < 8; ++pass)
+            ++histograms[pass][ghost_static_cast(ghost_size_t, (key >> (pass * 8)) & 0xFF)];
+    }
+
+    for (pass = 0; pass < 8; ++pass) {
+        ghost_size_t* histogram = histograms[pass];
+        unsigned shift = pass * 8;
+        ghost_size_t total = 0;
+        ghost_size_t digit;
+        char* temp;
+
+        /* If all keys have the same byte, this pass would not move anything. */
+        digit = ghost_static_cast(ghost_size_t,
+                (ghost_impl_radix_sort_key_64(src, key_offset, kind) >> shift) & 0xFF);
+        if (histogram[digit] == count)
+            continue;
+
+        for (digit = 0; digit < 256; ++digit) {
+            ghost_size_t bucket = histogram[digit];
+            histogram[digit] = total;
+            total += bucket;
+        }
+
+        for (i = 0; i < count; ++i) {
+            const char* element = src + i * element_size;
+            digit = ghost_static_cast(ghost_size_t,
+                    (ghost_impl_radix_sort_key_64(element, key_offset, kind) >> shift) & 0xFF);
+            ghost_memcpy(dst + histogram[digit]++ * element_size, element, element_size);
+        }
+
+        temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != array)
+        ghost_memcpy(array, src, count * element_size);
+}
+#endif
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#endif
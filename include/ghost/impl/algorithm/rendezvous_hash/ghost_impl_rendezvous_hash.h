@@ -0,0 +1,57 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_RENDEZVOUS_HASH_H_INCLUDED
+#define GHOST_IMPL_RENDEZVOUS_HASH_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Shared code for rendezvous (highest random weight) hashing.
+ *
+ * The score of a key on a node is a wyhash-style mix of the two 64-bit
+ * hashes. Two multiply-folds are enough to make every bit of both inputs
+ * affect every bit of the output.
+ */
+
+#include "ghost/impl/algorithm/wyhash/ghost_impl_wyhash.h"
+
+#ifndef ghost_has_ghost_impl_rendezvous_hash
+    #include "ghost/type/uint64_t/ghost_uint64_t.h"
+    #include "ghost/type/uint64_t/ghost_uint64_c.h"
+    #if !ghost_has(ghost_uint64_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_impl_rendezvous_hash 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_impl_rendezvous_hash
+    #include "ghost/impl/ghost_impl_always_inline.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_always_inline
+    ghost_uint64_t ghost_impl_rendezvous_hash_score(ghost_uint64_t key, ghost_uint64_t node) {
+        ghost_uint64_t h = ghost_impl_wyhash_mix(key ^ GHOST_IMPL_WYHASH_P0, node ^ GHOST_IMPL_WYHASH_P1);
+        return ghost_impl_wyhash_mix(h ^ GHOST_IMPL_WYHASH_P2, key ^ node ^ GHOST_IMPL_WYHASH_P3);
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_impl_rendezvous_hash 1
+#endif
+
+#endif
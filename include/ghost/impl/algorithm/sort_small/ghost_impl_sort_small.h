@@ -0,0 +1,158 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_SORT_SMALL_H_INCLUDED
+#define GHOST_IMPL_SORT_SMALL_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Sorting networks for small arrays. These are used to implement the
+ * ghost_sort_*_small() functions, their batched _rows() variants and the leaf
+ * case of Ghost's internal introsort.
+ *
+ * The network is Batcher's odd-even merge sort. It sorts any count (not just
+ * powers of two) by skipping comparators that would reach past the end,
+ * which is equivalent to padding with elements that sort last. It needs 19
+ * comparators for 8 elements (which is optimal), 63 for 16 and 191 for 32.
+ *
+ * Which pairs get compared depends only on the count, never on the data. Each
+ * compare-exchange is written as a pair of conditional selects so that it
+ * compiles to branchless code (cmov or SIMD min/max.) The loops that generate
+ * the comparators branch only on the count so they predict perfectly, and
+ * when the count is a compile-time constant they can be unrolled entirely.
+ */
+
+#include "ghost/type/size_t/ghost_size_t.h"
+
+/*
+ * Runs the network over count elements.
+ *
+ * For each comparator, the given compare_exchange statement is run with left
+ * and right declared as the indices of the elements to compare. It must
+ * leave the lesser element at left and the greater at right.
+ */
+#define GHOST_IMPL_SORT_SMALL_NETWORK(count, left, right, compare_exchange) \
+    do { \
+        ghost_size_t ghost_impl_v_p; \
+        ghost_size_t ghost_impl_v_k; \
+        ghost_size_t ghost_impl_v_j; \
+        ghost_size_t ghost_impl_v_i; \
+        for (ghost_impl_v_p = 1; ghost_impl_v_p < (count); ghost_impl_v_p <<= 1) { \
+            for (ghost_impl_v_k = ghost_impl_v_p; ghost_impl_v_k >= 1; ghost_impl_v_k >>= 1) { \
+                for (ghost_impl_v_j = ghost_impl_v_k & (ghost_impl_v_p - 1); \
+                        ghost_impl_v_j + ghost_impl_v_k < (count); \
+                        ghost_impl_v_j += 2 * ghost_impl_v_k) \
+                { \
+                    for (ghost_impl_v_i = 0; ghost_impl_v_i < ghost_impl_v_k && \
+                            ghost_impl_v_i + ghost_impl_v_j + ghost_impl_v_k < (count); ++ghost_impl_v_i) \
+                    { \
+                        ghost_size_t left = ghost_impl_v_i + ghost_impl_v_j; \
+                        ghost_size_t right = left + ghost_impl_v_k; \
+                        /* Only compare within the same merge block */ \
+                        if ((left & ~(2 * ghost_impl_v_p - 1)) == (right & ~(2 * ghost_impl_v_p - 1))) { \
+                            compare_exchange; \
+                        } \
+                    } \
+                } \
+            } \
+        } \
+    } while (0)
+
+/*
+ * A branchless compare-exchange of two elements of an array of a scalar type.
+ *
+ * Elements are swapped only if the right one is strictly less. If neither is
+ * less (e.g. floats where either is NaN) they stay where they are, so the
+ * result is always a permutation of the input. Both selects are written in
+ * the form compilers recognize as min and max (e.g. minss/maxss for floats.)
+ */
+#define GHOST_IMPL_SORT_SMALL_COMPARE_EXCHANGE(type, array, left, right) \
+    do { \
+        type ghost_impl_v_x = (array)[left]; \
+        type ghost_impl_v_y = (array)[right]; \
+        (array)[left] = ghost_impl_v_y < ghost_impl_v_x ? ghost_impl_v_y : ghost_impl_v_x; \
+        (array)[right] = ghost_impl_v_x > ghost_impl_v_y ? ghost_impl_v_x : ghost_impl_v_y; \
+    } while (0)
+
+/*
+ * The _rows() variants sort several rows at once with one row per SIMD lane.
+ * This is the longest row they can transpose into lanes; longer rows are
+ * sorted one at a time.
+ */
+#define GHOST_IMPL_SORT_SMALL_ROWS_MAX 32
+
+/*
+ * SSE2 gives us float and double min/max. SSE4.1 adds 32-bit integer
+ * min/max. (There is no 64-bit integer min/max before AVX-512 so the 64-bit
+ * integer variants are not vectorized.)
+ */
+#ifndef GHOST_IMPL_SORT_SMALL_SSE2
+    #include "ghost/detect/ghost_x86_64.h"
+    #if GHOST_X86_64 || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define GHOST_IMPL_SORT_SMALL_SSE2 1
+    #else
+        #define GHOST_IMPL_SORT_SMALL_SSE2 0
+    #endif
+#endif
+#ifndef GHOST_IMPL_SORT_SMALL_SSE4_1
+    #if GHOST_IMPL_SORT_SMALL_SSE2 && (defined(__SSE4_1__) || defined(__AVX__))
+        #define GHOST_IMPL_SORT_SMALL_SSE4_1 1
+    #else
+        #define GHOST_IMPL_SORT_SMALL_SSE4_1 0
+    #endif
+#endif
+
+#if GHOST_IMPL_SORT_SMALL_SSE4_1
+    #include <smmintrin.h>
+#elif GHOST_IMPL_SORT_SMALL_SSE2
+    #include <emmintrin.h>
+#endif
+
+/*
+ * Compilers merge the two comparisons of the generic compare-exchange into
+ * one and then branch on it, even for floats where min and max instructions
+ * exist. With SSE2 we use scalar min/max explicitly. The operand order
+ * matches the generic version so NaNs are handled the same way.
+ */
+#if GHOST_IMPL_SORT_SMALL_SSE2
+    #define GHOST_IMPL_SORT_SMALL_COMPARE_EXCHANGE_F32(array, left, right) \
+        do { \
+            __m128 ghost_impl_v_x = _mm_load_ss((array) + (left)); \
+            __m128 ghost_impl_v_y = _mm_load_ss((array) + (right)); \
+            _mm_store_ss((array) + (left), _mm_min_ss(ghost_impl_v_y, ghost_impl_v_x)); \
+            _mm_store_ss((array) + (right), _mm_max_ss(ghost_impl_v_x, ghost_impl_v_y)); \
+        } while (0)
+    #define GHOST_IMPL_SORT_SMALL_COMPARE_EXCHANGE_F64(array, left, right) \
+        do { \
+            __m128d ghost_impl_v_x = _mm_load_sd((array) + (left)); \
+            __m128d ghost_impl_v_y = _mm_load_sd((array) + (right)); \
+            _mm_store_sd((array) + (left), _mm_min_sd(ghost_impl_v_y, ghost_impl_v_x)); \
+            _mm_store_sd((array) + (right), _mm_max_sd(ghost_impl_v_x, ghost_impl_v_y)); \
+        } while (0)
+#else
+    #define GHOST_IMPL_SORT_SMALL_COMPARE_EXCHANGE_F32(array, left, right) \
+        GHOST_IMPL_SORT_SMALL_COMPARE_EXCHANGE(ghost_float32_t, array, left, right)
+    #define GHOST_IMPL_SORT_SMALL_COMPARE_EXCHANGE_F64(array, left, right) \
+        GHOST_IMPL_SORT_SMALL_COMPARE_EXCHANGE(ghost_float64_t, array, left, right)
+#endif
+
+#endif
@@ -0,0 +1,422 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_SORTED_SET_H_INCLUDED
+#define GHOST_IMPL_SORTED_SET_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Ghost's internal set operations on sorted arrays of unsigned integers. These
+ * are used to implement the sorted_set functions.
+ *
+ * The scalar merges are written so that the compiler can use conditional
+ * moves: each step advances one or both inputs by the result of a
+ * comparison rather than branching on it. Input is random-looking so
+ * branches would mispredict about half the time.
+ *
+ * When one input is much smaller than the other, each element of the small
+ * input is found in the large one with an exponential search from the last
+ * position (galloping.) This is O(m log(n/m)) rather than O(m + n).
+ *
+ * Intersection additionally has SIMD paths for SSE2 and NEON that compare a
+ * block of elements from each input all-against-all, as in:
+ *
+ *     Lemire, Boytsov and Kurz, "SIMD Compression and the Intersection of
+ *     Sorted Integers" https://arxiv.org/abs/1401.6399
+ *
+ * The output is written no faster than the inputs are read so the output of
+ * an intersection or difference may be the same array as an input.
+ */
+
+#include "ghost/impl/ghost_impl_always_inline.h"
+#include "ghost/language/ghost_discard.h"
+#include "ghost/language/ghost_reinterpret_cast.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/string/ghost_memmove.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+#include "ghost/type/uint32_t/ghost_uint32_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+
+/*
+ * An input is galloped through when it's at least this many times larger than
+ * the other.
+ */
+#ifndef GHOST_IMPL_SORTED_SET_GALLOP_RATIO
+    #define GHOST_IMPL_SORTED_SET_GALLOP_RATIO 32
+#endif
+
+#ifndef GHOST_IMPL_SORTED_SET_SSE2
+    #include "ghost/detect/ghost_x86_64.h"
+    #if GHOST_X86_64 || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define GHOST_IMPL_SORTED_SET_SSE2 1
+    #else
+        #define GHOST_IMPL_SORTED_SET_SSE2 0
+    #endif
+#endif
+#ifndef GHOST_IMPL_SORTED_SET_NEON
+    #if !GHOST_IMPL_SORTED_SET_SSE2 && \
+            (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64))
+        #define GHOST_IMPL_SORTED_SET_NEON 1
+    #else
+        #define GHOST_IMPL_SORTED_SET_NEON 0
+    #endif
+#endif
+
+/* 64-bit lane comparisons on NEON are only available on AArch64. */
+#ifndef GHOST_IMPL_SORTED_SET_NEON_64
+    #if GHOST_IMPL_SORTED_SET_NEON && (defined(__aarch64__) || defined(_M_ARM64))
+        #define GHOST_IMPL_SORTED_SET_NEON_64 1
+    #else
+        #define GHOST_IMPL_SORTED_SET_NEON_64 0
+    #endif
+#endif
+
+#if GHOST_IMPL_SORTED_SET_SSE2
+    #include <emmintrin.h>
+#elif GHOST_IMPL_SORTED_SET_NEON
+    #include <arm_neon.h>
+#endif
+
+/*
+ * Defines the scalar set operations for the given unsigned integer type. They
+ * are identical other than the type so they're generated from this template.
+ *
+ * - gallop() returns the index of the first element not less than the key,
+ *   searching exponentially forward from the start index.
+ *
+ * - intersect_gallop() intersects a small input with a much larger one.
+ *
+ * - intersect_merge() intersects inputs in a single pass. It's also used to
+ *   finish after a SIMD loop.
+ *
+ * - union(), difference() and unique() are the public operations.
+ */
+#define GHOST_IMPL_SORTED_SET_DEFINE(suffix, T) \
+    ghost_impl_always_inline \
+    ghost_size_t ghost_impl_sorted_gallop_##suffix(const T* array, ghost_size_t start, \
+            ghost_size_t count, T key) \
+    { \
+        ghost_size_t low = start; \
+        ghost_size_t high; \
+        ghost_size_t step = 1; \
+        for (;;) { \
+            if (step >= count - low) { \
+                high = count; \
+                break; \
+            } \
+            if (array[low + step - 1] >= key) { \
+                high = low + step - 1; \
+                break; \
+            } \
+            low += step; \
+            step += step; \
+        } \
+        while (low < high) { \
+            ghost_size_t mid = low + (high - low) / 2; \
+            if (array[mid] < key) \
+                low = mid + 1; \
+            else \
+                high = mid; \
+        } \
+        return low; \
+    } \
+    \
+    ghost_impl_always_inline \
+    ghost_size_t ghost_impl_sorted_intersect_gallop_##suffix(T* out, \
+            const T* small, ghost_size_t small_count, \
+            const T* large, ghost_size_t large_count) \
+    { \
+        ghost_size_t k = 0; \
+        ghost_size_t i; \
+        ghost_size_t j = 0; \
+        for (i = 0; i < small_count; ++i) { \
+            T x = small[i]; \
+            j = ghost_impl_sorted_gallop_##suffix(large, j, large_count, x); \
+            if (j == large_count) \
+                break; \
+            if (large[j] == x) \
+                out[k++] = x; \
+        } \
+        return k; \
+    } \
+    \
+    ghost_impl_always_inline \
+    ghost_size_t ghost_impl_sorted_intersect_merge_##suffix(T* out, ghost_size_t k, \
+            const T* a, ghost_size_t i, ghost_size_t a_count, \
+            const T* b, ghost_size_t j, ghost_size_t b_count) \
+    { \
+        while (i < a_count && j < b_count) { \
+            T x = a[i]; \
+            T y = b[j]; \
+            if (x == y) \
+                out[k++] = x; \
+            i += x <= y; \
+            j += y <= x; \
+        } \
+        return k; \
+    } \
+    \
+    ghost_impl_always_inline \
+    ghost_size_t ghost_impl_sorted_union_##suffix(T* out, \
+            const T* a, ghost_size_t a_count, \
+            const T* b, ghost_size_t b_count) \
+    { \
+        ghost_size_t k = 0; \
+        ghost_size_t i = 0; \
+        ghost_size_t j = 0; \
+        while (i < a_count && j < b_count) { \
+            T x = a[i]; \
+            T y = b[j]; \
+            out[k++] = (x < y) ? x : y; \
+            i += x <= y; \
+            j += y <= x; \
+        } \
+        while (i < a_count) \
+            out[k++] = a[i++]; \
+        while (j < b_count) \
+            out[k++] = b[j++]; \
+        return k; \
+    } \
+    \
+    ghost_impl_always_inline \
+    ghost_size_t ghost_impl_sorted_difference_##suffix(T* out, \
+            const T* a, ghost_size_t a_count, \
+            const T* b, ghost_size_t b_count) \
+    { \
+        ghost_size_t k = 0; \
+        ghost_size_t i = 0; \
+        ghost_size_t j = 0; \
+        \
+        if (b_count / GHOST_IMPL_SORTED_SET_GALLOP_RATIO > a_count) { \
+            /* Look up each element of a in b. */ \
+            for (; i < a_count; ++i) { \
+                T x = a[i]; \
+                j = ghost_impl_sorted_gallop_##suffix(b, j, b_count, x); \
+                if (j == b_count || b[j] != x) \
+                    out[k++] = x; \
+            } \
+            return k; \
+        } \
+        \
+        if (a_count / GHOST_IMPL_SORTED_SET_GALLOP_RATIO > b_count) { \
+            /* Copy the blocks of a between the elements of b. */ \
+            for (; j < b_count; ++j) { \
+                ghost_size_t next = ghost_impl_sorted_gallop_##suffix(a, i, a_count, b[j]); \
+                ghost_memmove(out + k, a + i, (next - i) * sizeof(T)); \
+                k += next - i; \
+                i = next; \
+                if (i < a_count && a[i] == b[j]) \
+                    ++i; \
+            } \
+        } else { \
+            while (i < a_count && j < b_count) { \
+                T x = a[i]; \
+                T y = b[j]; \
+                out[k] = x; \
+                k += x < y; \
+                i += x <= y; \
+                j += y <= x; \
+            } \
+        } \
+        \
+        ghost_memmove(out + k, a + i, (a_count - i) * sizeof(T)); \
+        return k + (a_count - i); \
+    } \
+    \
+    ghost_impl_always_inline \
+    ghost_size_t ghost_impl_sorted_unique_##suffix(T* out, const T* in, ghost_size_t count) { \
+        ghost_size_t k = 1; \
+        ghost_size_t i; \
+        if (count == 0) \
+            return 0; \
+        out[0] = in[0]; \
+        for (i = 1; i < count; ++i) { \
+            T x = in[i]; \
+            out[k] = x; \
+            k += x != out[k - 1]; \
+        } \
+        return k; \
+    }
+
+GHOST_IMPL_FUNCTION_OPEN
+
+#if ghost_has(ghost_uint32_t)
+GHOST_IMPL_SORTED_SET_DEFINE(u32, ghost_uint32_t)
+
+/*
+ * Intersects blocks of four elements from each input. Returns the number of
+ * elements written to out and updates the input positions. The remainder
+ * (less than a block of either input) is left for the scalar merge.
+ */
+ghost_impl_always_inline
+ghost_size_t ghost_impl_sorted_intersect_simd_u32(ghost_uint32_t* out,
+        const ghost_uint32_t* a, ghost_size_t* pi, ghost_size_t a_count,
+        const ghost_uint32_t* b, ghost_size_t* pj, ghost_size_t b_count)
+{
+    ghost_size_t k = 0;
+    ghost_size_t i = *pi;
+    ghost_size_t j = *pj;
+
+    #if GHOST_IMPL_SORTED_SET_SSE2 || GHOST_IMPL_SORTED_SET_NEON
+    while (i + 4 <= a_count && j + 4 <= b_count) {
+        ghost_uint32_t a_last = a[i + 3];
+        ghost_uint32_t b_last = b[j + 3];
+        unsigned mask;
+
+        #if GHOST_IMPL_SORTED_SET_SSE2
+        {
+            __m128i va = _mm_loadu_si128(ghost_reinterpret_cast(const __m128i*, a + i));
+            __m128i vb = _mm_loadu_si128(ghost_reinterpret_cast(const __m128i*, b + j));
+            __m128i eq = _mm_cmpeq_epi32(va, vb);
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+            mask = ghost_static_cast(unsigned, _mm_movemask_ps(_mm_castsi128_ps(eq)));
+        }
+        #else
+        {
+            uint32x4_t va = vld1q_u32(a + i);
+            uint32x4_t vb = vld1q_u32(b + j);
+            uint32x4_t eq = vceqq_u32(va, vb);
+            eq = vorrq_u32(eq, vceqq_u32(va, vextq_u32(vb, vb, 1)));
+            eq = vorrq_u32(eq, vceqq_u32(va, vextq_u32(vb, vb, 2)));
+            eq = vorrq_u32(eq, vceqq_u32(va, vextq_u32(vb, vb, 3)));
+            mask = (vgetq_lane_u32(eq, 0) & 1u) | (vgetq_lane_u32(eq, 1) & 2u) |
+                    (vgetq_lane_u32(eq, 2) & 4u) | (vgetq_lane_u32(eq, 3) & 8u);
+        }
+        #endif
+
+        if (mask & 1u) out[k++] = a[i];
+        if (mask & 2u) out[k++] = a[i + 1];
+        if (mask & 4u) out[k++] = a[i + 2];
+        if (mask & 8u) out[k++] = a[i + 3];
+
+        i += (a_last <= b_last) ? 4 : 0;
+        j += (b_last <= a_last) ? 4 : 0;
+    }
+    #else
+    ghost_discard(out);
+    ghost_discard(a);
+    ghost_discard(a_count);
+    ghost_discard(b);
+    ghost_discard(b_count);
+    #endif
+
+    *pi = i;
+    *pj = j;
+    return k;
+}
+#endif
+
+#if ghost_has(ghost_uint64_t)
+GHOST_IMPL_SORTED_SET_DEFINE(u64, ghost_uint64_t)
+
+/*
+ * Intersects blocks of two elements from each input. SSE2 has no 64-bit
+ * equality comparison so we compare 32-bit halves and combine them.
+ */
+ghost_impl_always_inline
+ghost_size_t ghost_impl_sorted_intersect_simd_u64(ghost_uint64_t* out,
+        const ghost_uint64_t* a, ghost_size_t* pi, ghost_size_t a_count,
+        const ghost_uint64_t* b, ghost_size_t* pj, ghost_size_t b_count)
+{
+    ghost_size_t k = 0;
+    ghost_size_t i = *pi;
+    ghost_size_t j = *pj;
+
+    #if GHOST_IMPL_SORTED_SET_SSE2 || GHOST_IMPL_SORTED_SET_NEON_64
+    while (i + 2 <= a_count && j + 2 <= b_count) {
+        ghost_uint64_t a_last = a[i + 1];
+        ghost_uint64_t b_last = b[j + 1];
+        unsigned mask;
+
+        #if GHOST_IMPL_SORTED_SET_SSE2
+        {
+            __m128i va = _mm_loadu_si128(ghost_reinterpret_cast(const __m128i*, a + i));
+            __m128i vb = _mm_loadu_si128(ghost_reinterpret_cast(const __m128i*, b + j));
+            __m128i e0 = _mm_cmpeq_epi32(va, vb);
+            __m128i e1 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2)));
+            e0 = _mm_and_si128(e0, _mm_shuffle_epi32(e0, _MM_SHUFFLE(2, 3, 0, 1)));
+            e1 = _mm_and_si128(e1, _mm_shuffle_epi32(e1, _MM_SHUFFLE(2, 3, 0, 1)));
+            mask = ghost_static_cast(unsigned, _mm_movemask_pd(_mm_castsi128_pd(_mm_or_si128(e0, e1))));
+        }
+        #else
+        {
+            uint64x2_t va = vld1q_u64(a + i);
+            uint64x2_t vb = vld1q_u64(b + j);
+            uint64x2_t eq = vorrq_u64(vceqq_u64(va, vb), vceqq_u64(va, vextq_u64(vb, vb, 1)));
+            mask = ghost_static_cast(unsigned, (vgetq_lane_u64(eq, 0) & 1u) | (vgetq_lane_u64(eq, 1) & 2u));
+        }
+        #endif
+
+        if (mask & 1u) out[k++] = a[i];
+        if (mask & 2u) out[k++] = a[i + 1];
+
+        i += (a_last <= b_last) ? 2 : 0;
+        j += (b_last <= a_last) ? 2 : 0;
+    }
+    #else
+    ghost_discard(out);
+    ghost_discard(a);
+    ghost_discard(a_count);
+    ghost_discard(b);
+    ghost_discard(b_count);
+    #endif
+
+    *pi = i;
+    *pj = j;
+    return k;
+}
+#endif
+
+/*
+ * Defines the intersection for the given type on top of the above.
+ */
+#define GHOST_IMPL_SORTED_SET_DEFINE_INTERSECT(suffix, T) \
+    ghost_impl_always_inline \
+    ghost_size_t ghost_impl_sorted_intersect_##suffix(T* out, \
+            const T* a, ghost_size_t a_count, \
+            const T* b, ghost_size_t b_count) \
+    { \
+        ghost_size_t i = 0; \
+        ghost_size_t j = 0; \
+        ghost_size_t k; \
+        if (a_count == 0 || b_count == 0) \
+            return 0; \
+        if (b_count / GHOST_IMPL_SORTED_SET_GALLOP_RATIO > a_count) \
+            return ghost_impl_sorted_intersect_gallop_##suffix(out, a, a_count, b, b_count); \
+        if (a_count / GHOST_IMPL_SORTED_SET_GALLOP_RATIO > b_count) \
+            return ghost_impl_sorted_intersect_gallop_##suffix(out, b, b_count, a, a_count); \
+        k = ghost_impl_sorted_intersect_simd_##suffix(out, a, &i, a_count, b, &j, b_count); \
+        return ghost_impl_sorted_intersect_merge_##suffix(out, k, a, i, a_count, b, j, b_count); \
+    }
+
+#if ghost_has(ghost_uint32_t)
+GHOST_IMPL_SORTED_SET_DEFINE_INTERSECT(u32, ghost_uint32_t)
+#endif
+#if ghost_has(ghost_uint64_t)
+GHOST_IMPL_SORTED_SET_DEFINE_INTERSECT(u64, ghost_uint64_t)
+#endif
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#endif
@@ -0,0 +1,86 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_STABLE_SORT_H_INCLUDED
+#define GHOST_IMPL_STABLE_SORT_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * ghost_impl_stable_sort()
+ *
+ * Ghost's internal stable sort. This is used to implement all of the stable
+ * sort variants. It uses the same state as the internal qsort for the compare
+ * function variants and swap size classes.
+ *
+ * This is a natural mergesort in the style of timsort:
+ *
+ * - The array is scanned for ascending or strictly descending runs. Descending
+ *   runs are reversed. Short runs are extended with binary insertion sort.
+ *
+ * - Runs are merged following the powersort merge policy, the same policy
+ *   CPython uses for list.sort(). It is near-optimal for any pattern of runs
+ *   and it bounds the run stack by the bit width of size_t so it can live on
+ *   the stack.
+ *
+ * - Before each merge, galloping searches trim off the prefix of the left run
+ *   and the suffix of the right run that are already in place.
+ *
+ * - If the scratch buffer can hold the shorter run, it is copied out and the
+ *   runs are merged into place. The merge switches to galloping mode when one
+ *   side keeps winning, copying whole blocks at a time.
+ *
+ * - Otherwise the merge is done in place with rotations (the same algorithm
+ *   as std::stable_sort without a buffer.) This is O(nlogn) per merge so the
+ *   whole sort degrades to O(nlog^2n) but it still needs no memory. As soon
+ *   as a sub-merge fits in the scratch buffer, it switches back to the
+ *   buffered merge.
+ *
+ * The scratch buffer can therefore be any size. With room for count/2
+ * elements, the sort never needs to rotate.
+ */
+
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_config.h"
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_internal_declare.h"
+#include "ghost/impl/ghost_impl_noinline.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+
+GHOST_IMPL_FUNCTION_OPEN
+
+/*
+ * Sorts the array stably. The scratch buffer may be null, in which case
+ * scratch_count must be 0.
+ *
+ * The size class in the given state must have been resolved against the
+ * array. If the scratch buffer doesn't share its alignment, the size class is
+ * demoted.
+ */
+ghost_impl_noinline
+void ghost_impl_stable_sort(ghost_impl_qsort_state_t* state, void* base, ghost_size_t count,
+        void* scratch, ghost_size_t scratch_count);
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#if GHOST_EMIT_DEFS
+    #include "ghost/impl/algorithm/stable_sort/ghost_impl_stable_sort_define.h"
+#endif
+
+#endif
@@ -0,0 +1,650 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_STABLE_SORT_DEFINE_H_INCLUDED
+#define GHOST_IMPL_STABLE_SORT_DEFINE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Defines Ghost's internal stable sort.
+ */
+
+#if !GHOST_EMIT_DEFS && !GHOST_IMPL_AMALGAMATED
+    #error "This file is not supposed to be included if Ghost is not emitting function definitions."
+#endif
+
+#include "ghost/impl/algorithm/stable_sort/ghost_impl_stable_sort.h"
+#include "ghost/impl/ghost_impl_inline.h"
+#include "ghost/impl/ghost_impl_noinline.h"
+#include "ghost/language/ghost_null.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/language/ghost_unreachable.h"
+#include "ghost/string/ghost_memcpy.h"
+#include "ghost/string/ghost_memmove.h"
+#include "ghost/type/bool/ghost_bool.h"
+#include "ghost/type/char/ghost_char_width.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+#include "ghost/type/uint32_t/ghost_uint32_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/debug/ghost_assert.h"
+
+/* The number of consecutive wins by one side of a merge before we switch to
+ * galloping mode. This is the same as timsort's initial MIN_GALLOP. */
+#define GHOST_IMPL_STABLE_SORT_MIN_GALLOP 7
+
+GHOST_IMPL_FUNCTION_OPEN
+
+typedef struct ghost_impl_stable_sort_t {
+    ghost_impl_qsort_state_t* state;
+    ghost_size_t element_size;
+    char* scratch;
+    ghost_size_t scratch_count;
+} ghost_impl_stable_sort_t;
+
+ghost_impl_inline
+ghost_bool ghost_impl_stable_sort_less(ghost_impl_stable_sort_t* sort, const char* left, const char* right) {
+    ghost_impl_qsort_state_t* state = sort->state;
+    switch (state->variant) {
+        case ghost_impl_qsort_variant_nocontext: return 0 > state->compare.nocontext(left, right);
+        case ghost_impl_qsort_variant_gnu: return 0 > state->compare.gnu(left, right, state->user_context);
+        case ghost_impl_qsort_variant_bsd: return 0 > state->compare.bsd(state->user_context, left, right);
+        #if GHOST_WIN_QSORT_S_USE_CDECL
+        case ghost_impl_qsort_variant_windows: return 0 > state->compare.windows(state->user_context, left, right);
+        #endif
+        case ghost_impl_qsort_variant_indirect: break;
+    }
+    ghost_unreachable(0);
+}
+
+/* Copies a single element. The source and destination must not overlap. */
+ghost_impl_inline
+void ghost_impl_stable_sort_copy(ghost_impl_stable_sort_t* sort, char* to, const char* from) {
+    switch (sort->state->size_class) {
+        case ghost_impl_qsort_size_class_4:
+            *ghost_static_cast(ghost_uint32_t*, ghost_static_cast(void*, to)) =
+                    *ghost_static_cast(const ghost_uint32_t*, ghost_static_cast(const void*, from));
+            return;
+        case ghost_impl_qsort_size_class_8:
+            *ghost_static_cast(ghost_uint64_t*, ghost_static_cast(void*, to)) =
+                    *ghost_static_cast(const ghost_uint64_t*, ghost_static_cast(const void*, from));
+            return;
+        case ghost_impl_qsort_size_class_16:
+            ghost_memcpy(to, from, 16);
+            return;
+        case ghost_impl_qsort_size_class_32:
+            ghost_memcpy(to, from, 32);
+            return;
+        case ghost_impl_qsort_size_class_any:
+            ghost_memcpy(to, from, sort->element_size);
+            return;
+    }
+    ghost_unreachable();
+}
+
+ghost_impl_inline
+void ghost_impl_stable_sort_swap(ghost_impl_stable_sort_t* sort, char* left, char* right) {
+    switch (sort->state->size_class) {
+        case ghost_impl_qsort_size_class_4: {
+            ghost_uint32_t* l = ghost_static_cast(ghost_uint32_t*, ghost_static_cast(void*, left));
+            ghost_uint32_t* r = ghost_static_cast(ghost_uint32_t*, ghost_static_cast(void*, right));
+            ghost_uint32_t temp = *l;
+            *l = *r;
+            *r = temp;
+        } return;
+        case ghost_impl_qsort_size_class_8: {
+            ghost_uint64_t* l = ghost_static_cast(ghost_uint64_t*, ghost_static_cast(void*, left));
+            ghost_uint64_t* r = ghost_static_cast(ghost_uint64_t*, ghost_static_cast(void*, right));
+            ghost_uint64_t temp = *l;
+            *l = *r;
+            *r = temp;
+        } return;
+        case ghost_impl_qsort_size_class_16:
+            ghost_impl_qsort_swap_chunks(left, right, 16);
+            return;
+        case ghost_impl_qsort_size_class_32:
+            ghost_impl_qsort_swap_chunks(left, right, 32);
+            return;
+        case ghost_impl_qsort_size_class_any:
+            ghost_impl_qsort_swap_chunks(left, right, sort->element_size);
+            return;
+    }
+    ghost_unreachable();
+}
+
+ghost_impl_inline
+void ghost_impl_stable_sort_reverse(ghost_impl_stable_sort_t* sort, char* first, ghost_size_t count) {
+    char* last;
+    if (count < 2)
+        return;
+    last = first + (count - 1) * sort->element_size;
+    while (first < last) {
+        ghost_impl_stable_sort_swap(sort, first, last);
+        first += sort->element_size;
+        last -= sort->element_size;
+    }
+}
+
+/*
+ * Swaps the left_count elements at first with the right_count elements that
+ * follow them.
+ */
+ghost_impl_inline
+void ghost_impl_stable_sort_rotate(ghost_impl_stable_sort_t* sort, char* first,
+        ghost_size_t left_count, ghost_size_t right_count)
+{
+    if (left_count == 0 || right_count == 0)
+        return;
+    ghost_impl_stable_sort_reverse(sort, first, left_count);
+    ghost_impl_stable_sort_reverse(sort, first + left_count * sort->element_size, right_count);
+    ghost_impl_stable_sort_reverse(sort, first, left_count + right_count);
+}
+
+/*
+ * Returns true if the element at the given index belongs before the key.
+ *
+ * If upper is true, elements equal to the key belong before it (i.e. the key
+ * comes from a later run); otherwise they belong after it.
+ */
+ghost_impl_inline
+ghost_bool ghost_impl_stable_sort_before(ghost_impl_stable_sort_t* sort, const char* key,
+        const char* base, ghost_size_t index, ghost_bool upper)
+{
+    const char* element = base + index * sort->element_size;
+    if (upper)
+        return !ghost_impl_stable_sort_less(sort, key, element);
+    return ghost_impl_stable_sort_less(sort, element, key);
+}
+
+/*
+ * Returns the number of elements in the sorted range of count elements at
+ * base that belong before the given key.
+ *
+ * This is an exponential (galloping) search from the left or right end of the
+ * range followed by a binary search. It takes O(log k) comparisons where k is
+ * the distance of the result from the starting end.
+ */
+ghost_impl_noinline
+ghost_size_t ghost_impl_stable_sort_gallop(ghost_impl_stable_sort_t* sort, const char* key,
+        const char* base, ghost_size_t count, ghost_bool upper, ghost_bool from_right)
+{
+    ghost_size_t low = 0;
+    ghost_size_t high = count;
+    ghost_size_t offset = 1;
+
+    /* Find a range containing the result */
+    while (offset <= count) {
+        if (!from_right) {
+            if (!ghost_impl_stable_sort_before(sort, key, base, offset - 1, upper)) {
+                high = offset - 1;
+                break;
+            }
+            low = offset;
+        } else {
+            if (ghost_impl_stable_sort_before(sort, key, base, count - offset, upper)) {
+                low = count - offset + 1;
+                break;
+            }
+            high = count - offset;
+        }
+        if (offset > count / 2)
+            break;
+        offset = offset * 2 + 1;
+    }
+
+    /* Binary search within it */
+    while (low < high) {
+        ghost_size_t mid = low + (high - low) / 2;
+        if (ghost_impl_stable_sort_before(sort, key, base, mid, upper))
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low;
+}
+
+/*
+ * Merges two adjacent runs where the left run fits in the scratch buffer.
+ *
+ * The left run is moved to the scratch buffer and the runs are merged from
+ * left to right back into the array.
+ */
+ghost_impl_noinline
+void ghost_impl_stable_sort_merge_left(ghost_impl_stable_sort_t* sort, char* first,
+        ghost_size_t left_count, ghost_size_t right_count)
+{
+    ghost_size_t element_size = sort->element_size;
+    char* left = sort->scratch;
+    char* right = first + left_count * element_size;
+    char* out = first;
+    ghost_size_t left_wins = 0;
+    ghost_size_t right_wins = 0;
+
+    ghost_memcpy(left, first, left_count * element_size);
+
+    while (left_count > 0 && right_count > 0) {
+        if (ghost_impl_stable_sort_less(sort, right, left)) {
+            ghost_impl_stable_sort_copy(sort, out, right);
+            right += element_size;
+            --right_count;
+            ++right_wins;
+            left_wins = 0;
+        } else {
+            ghost_impl_stable_sort_copy(sort, out, left);
+            left += element_size;
+            --left_count;
+            ++left_wins;
+            right_wins = 0;
+        }
+        out += element_size;
+
+        if (left_wins >= GHOST_IMPL_STABLE_SORT_MIN_GALLOP || right_wins >= GHOST_IMPL_STABLE_SORT_MIN_GALLOP) {
+            ghost_size_t left_run;
+            ghost_size_t right_run;
+            if (left_count == 0 || right_count == 0)
+                break;
+
+            /* One side is winning consistently so we gallop to find how many
+             * elements we can move as a block. We keep galloping as long as
+             * it pays off. */
+            do {
+                left_run = ghost_impl_stable_sort_gallop(sort, right, left, left_count, 1, 0);
+                ghost_memcpy(out, left, left_run * element_size);
+                out += left_run * element_size;
+                left += left_run * element_size;
+                left_count -= left_run;
+                if (left_count == 0)
+                    break;
+
+                right_run = ghost_impl_stable_sort_gallop(sort, left, right, right_count, 0, 0);
+                ghost_memmove(out, right, right_run * element_size);
+                out += right_run * element_size;
+                right += right_run * element_size;
+                right_count -= right_run;
+                if (right_count == 0)
+                    break;
+            } while (left_run >= GHOST_IMPL_STABLE_SORT_MIN_GALLOP ||
+                    right_run >= GHOST_IMPL_STABLE_SORT_MIN_GALLOP);
+
+            left_wins = 0;
+            right_wins = 0;
+        }
+    }
+
+    /* Anything left on the right is already in place. */
+    ghost_memcpy(out, left, left_count * element_size);
+}
+
+/*
+ * Merges two adjacent runs where the right run fits in the scratch buffer.
+ *
+ * The right run is moved to the scratch buffer and the runs are merged from
+ * right to left back into the array. We use indices rather than pointers here
+ * to avoid forming pointers before the start of the buffers.
+ */
+ghost_impl_noinline
+void ghost_impl_stable_sort_merge_right(ghost_impl_stable_sort_t* sort, char* first,
+        ghost_size_t left_count, ghost_size_t right_count)
+{
+    ghost_size_t element_size = sort->element_size;
+    char* right = sort->scratch;
+    ghost_size_t left_wins = 0;
+    ghost_size_t right_wins = 0;
+
+    ghost_memcpy(right, first + left_count * element_size, right_count * element_size);
+
+    while (left_count > 0 && right_count > 0) {
+        char* out = first + (left_count + right_count - 1) * element_size;
+        char* left_last = first + (left_count - 1) * element_size;
+        char* right_last = right + (right_count - 1) * element_size;
+
+        if (ghost_impl_stable_sort_less(sort, right_last, left_last)) {
+            ghost_impl_stable_sort_copy(sort, out, left_last);
+            --left_count;
+            ++left_wins;
+            right_wins = 0;
+        } else {
+            ghost_impl_stable_sort_copy(sort, out, right_last);
+            --right_count;
+            ++right_wins;
+            left_wins = 0;
+        }
+
+        if (left_wins >= GHOST_IMPL_STABLE_SORT_MIN_GALLOP || right_wins >= GHOST_IMPL_STABLE_SORT_MIN_GALLOP) {
+            ghost_size_t left_run;
+            ghost_size_t right_run;
+            if (left_count == 0 || right_count == 0)
+                break;
+
+            do {
+                left_run = left_count - ghost_impl_stable_sort_gallop(sort,
+                        right + (right_count - 1) * element_size, first, left_count, 1, 1);
+                ghost_memmove(first + (left_count + right_count - left_run) * element_size,
+                        first + (left_count - left_run) * element_size,
+                        left_run * element_size);
+                left_count -= left_run;
+                if (left_count == 0)
+                    break;
+
+                right_run = right_count - ghost_impl_stable_sort_gallop(sort,
+                        first + (left_count - 1) * element_size, right, right_count, 0, 1);
+                ghost_memcpy(first + (left_count + right_count - right_run) * element_size,
+                        right + (right_count - right_run) * element_size,
+                        right_run * element_size);
+                right_count -= right_run;
+                if (right_count == 0)
+                    break;
+            } while (left_run >= GHOST_IMPL_STABLE_SORT_MIN_GALLOP ||
+                    right_run >= GHOST_IMPL_STABLE_SORT_MIN_GALLOP);
+
+            left_wins = 0;
+            right_wins = 0;
+        }
+    }
+
+    /* Anything left on the left is already in place. */
+    ghost_memcpy(first, right, right_count * element_size);
+}
+
+/*
+ * Merges two adjacent runs, using the scratch buffer if the shorter run fits
+ * or splitting the merge in two with a rotation otherwise.
+ *
+ * The rotation splits the longer run in half and finds the matching split
+ * point in the shorter run. We recurse on the smaller half and loop on the
+ * larger so the recursion depth is logarithmic.
+ */
+ghost_impl_noinline
+void ghost_impl_stable_sort_merge_adaptive(ghost_impl_stable_sort_t* sort, char* first,
+        ghost_size_t left_count, ghost_size_t right_count)
+{
+    ghost_size_t element_size = sort->element_size;
+
+    while (left_count != 0 && right_count != 0) {
+        char* middle = first + left_count * element_size;
+        ghost_size_t left_cut;
+        ghost_size_t right_cut;
+        char* new_middle;
+
+        if (left_count <= right_count && left_count <= sort->scratch_count) {
+            ghost_impl_stable_sort_merge_left(sort, first, left_count, right_count);
+            return;
+        }
+        if (right_count <= sort->scratch_count) {
+            ghost_impl_stable_sort_merge_right(sort, first, left_count, right_count);
+            return;
+        }
+
+        if (left_count + right_count == 2) {
+            if (ghost_impl_stable_sort_less(sort, middle, first))
+                ghost_impl_stable_sort_swap(sort, first, middle);
+            return;
+        }
+
+        if (left_count >= right_count) {
+            left_cut = left_count / 2;
+            right_cut = ghost_impl_stable_sort_gallop(sort, first + left_cut * element_size,
+                    middle, right_count, 0, 0);
+        } else {
+            right_cut = right_count / 2;
+            left_cut = ghost_impl_stable_sort_gallop(sort, middle + right_cut * element_size,
+                    first, left_count, 1, 0);
+        }
+
+        ghost_impl_stable_sort_rotate(sort, first + left_cut * element_size,
+                left_count - left_cut, right_cut);
+        new_middle = first + (left_cut + right_cut) * element_size;
+
+        if (left_cut + right_cut < left_count + right_count - left_cut - right_cut) {
+            ghost_impl_stable_sort_merge_adaptive(sort, first, left_cut, right_cut);
+            first = new_middle;
+            left_count -= left_cut;
+            right_count -= right_cut;
+        } else {
+            ghost_impl_stable_sort_merge_adaptive(sort, new_middle,
+                    left_count - left_cut, right_count - right_cut);
+            left_count = left_cut;
+            right_count = right_cut;
+        }
+    }
+}
+
+/*
+ * Merges two adjacent sorted runs.
+ */
+ghost_impl_inline
+void ghost_impl_stable_sort_merge(ghost_impl_stable_sort_t* sort, char* first,
+        ghost_size_t left_count, ghost_size_t right_count)
+{
+    ghost_size_t element_size = sort->element_size;
+    char* middle = first + left_count * element_size;
+    ghost_size_t skip;
+
+    /* Elements at the start of the left run that are not greater than the
+     * start of the right run are already in place. */
+    skip = ghost_impl_stable_sort_gallop(sort, middle, first, left_count, 1, 0);
+    first += skip * element_size;
+    left_count -= skip;
+    if (left_count == 0)
+        return;
+
+    /* Elements at the end of the right run that are not less than the end of
+     * the left run are also in place. */
+    right_count = ghost_impl_stable_sort_gallop(sort, middle - element_size,
+            middle, right_count, 0, 1);
+    if (right_count == 0)
+        return;
+
+    ghost_impl_stable_sort_merge_adaptive(sort, first, left_count, right_count);
+}
+
+/*
+ * Finds the length of the run at the start of the given range, reversing it
+ * if it's descending.
+ *
+ * Descending runs must be strictly descending so that reversing them
+ * preserves stability.
+ */
+ghost_impl_inline
+ghost_size_t ghost_impl_stable_sort_count_run(ghost_impl_stable_sort_t* sort, char* first, ghost_size_t count) {
+    ghost_size_t element_size = sort->element_size;
+    ghost_size_t length = 2;
+
+    if (count < 2)
+        return count;
+
+    if (ghost_impl_stable_sort_less(sort, first + element_size, first)) {
+        while (length < count && ghost_impl_stable_sort_less(sort,
+                    first + length * element_size, first + (length - 1) * element_size))
+            ++length;
+        ghost_impl_stable_sort_reverse(sort, first, length);
+    } else {
+        while (length < count && !ghost_impl_stable_sort_less(sort,
+                    first + length * element_size, first + (length - 1) * element_size))
+            ++length;
+    }
+
+    return length;
+}
+
+/*
+ * Extends a sorted run of sorted_count elements to count elements with binary
+ * insertion sort.
+ *
+ * If we have scratch space for an element, we move it aside and shift the
+ * rest over. Otherwise we shift it into place by swapping.
+ */
+ghost_impl_inline
+void ghost_impl_stable_sort_insertion_sort(ghost_impl_stable_sort_t* sort, char* first,
+        ghost_size_t sorted_count, ghost_size_t count)
+{
+    ghost_size_t element_size = sort->element_size;
+    ghost_size_t i;
+
+    for (i = sorted_count; i < count; ++i) {
+        char* element = first + i * element_size;
+        ghost_size_t low = 0;
+        ghost_size_t high = i;
+
+        while (low < high) {
+            ghost_size_t mid = low + (high - low) / 2;
+            if (ghost_impl_stable_sort_less(sort, element, first + mid * element_size))
+                high = mid;
+            else
+                low = mid + 1;
+        }
+        if (low == i)
+            continue;
+
+        if (sort->scratch_count > 0) {
+            ghost_impl_stable_sort_copy(sort, sort->scratch, element);
+            ghost_memmove(first + (low + 1) * element_size, first + low * element_size,
+                    (i - low) * element_size);
+            ghost_impl_stable_sort_copy(sort, first + low * element_size, sort->scratch);
+        } else {
+            ghost_size_t j;
+            for (j = i; j > low; --j)
+                ghost_impl_stable_sort_swap(sort, first + (j - 1) * element_size,
+                        first + j * element_size);
+        }
+    }
+}
+
+/*
+ * Returns the minimum run length for the given array size. This is timsort's
+ * minrun: a number between 32 and 64 (unless count is smaller) such that
+ * count / minrun is equal to or slightly less than a power of two.
+ */
+ghost_impl_inline
+ghost_size_t ghost_impl_stable_sort_min_run(ghost_size_t count) {
+    ghost_size_t extra = 0;
+    while (count >= 64) {
+        extra |= count & 1;
+        count >>= 1;
+    }
+    return count + extra;
+}
+
+/*
+ * Returns the powersort node power of the boundary between two adjacent runs.
+ *
+ * This is the depth in a perfectly balanced binary merge tree over the whole
+ * array at which the midpoints of the two runs would be split apart. See
+ * CPython's listsort.txt for details.
+ *
+ * This requires that 2*count doesn't overflow, which can only be a problem
+ * for an array of single bytes spanning more than half the address space.
+ */
+ghost_impl_inline
+unsigned ghost_impl_stable_sort_power(ghost_size_t start, ghost_size_t left_count,
+        ghost_size_t right_count, ghost_size_t count)
+{
+    unsigned power = 0;
+    ghost_size_t a = 2 * start + left_count;
+    ghost_size_t b = a + left_count + right_count;
+    for (;;) {
+        ++power;
+        if (a >= count) {
+            a -= count;
+            b -= count;
+        } else if (b >= count) {
+            break;
+        }
+        a <<= 1;
+        b <<= 1;
+    }
+    return power;
+}
+
+ghost_impl_noinline
+void ghost_impl_stable_sort(ghost_impl_qsort_state_t* state, void* base, ghost_size_t count,
+        void* scratch, ghost_size_t scratch_count)
+{
+    /* Powers on the stack are strictly increasing and bounded by the width of
+     * size_t so this is enough for any array. */
+    struct {
+        ghost_size_t start;
+        ghost_size_t count;
+        unsigned power;
+    } runs[sizeof(ghost_size_t) * GHOST_CHAR_WIDTH + 2];
+    ghost_size_t run_count = 0;
+    ghost_impl_stable_sort_t sort;
+    char* first = ghost_static_cast(char*, base);
+    ghost_size_t min_run;
+    ghost_size_t start;
+
+    if (count < 2)
+        return;
+
+    ghost_assert(scratch != ghost_null || scratch_count == 0, "");
+    if (scratch_count != 0 && state->size_class != ghost_impl_qsort_resolve_size_class(scratch, state->element_size))
+        state->size_class = ghost_impl_qsort_size_class_any;
+
+    sort.state = state;
+    sort.element_size = state->element_size;
+    sort.scratch = ghost_static_cast(char*, scratch);
+    sort.scratch_count = scratch_count;
+
+    min_run = ghost_impl_stable_sort_min_run(count);
+
+    for (start = 0; start < count;) {
+        char* run = first + start * sort.element_size;
+        ghost_size_t run_length = ghost_impl_stable_sort_count_run(&sort, run, count - start);
+
+        /* Extend short runs */
+        if (run_length < min_run) {
+            ghost_size_t extended = count - start < min_run ? count - start : min_run;
+            ghost_impl_stable_sort_insertion_sort(&sort, run, run_length, extended);
+            run_length = extended;
+        }
+
+        /* Merge runs on the stack whose boundary is deeper than the new one */
+        if (run_count > 0) {
+            unsigned power = ghost_impl_stable_sort_power(runs[run_count - 1].start,
+                    runs[run_count - 1].count, run_length, count);
+            while (run_count > 1 && runs[run_count - 2].power > power) {
+                ghost_impl_stable_sort_merge(&sort, first + runs[run_count - 2].start * sort.element_size,
+                        runs[run_count - 2].count, runs[run_count - 1].count);
+                runs[run_count - 2].count += runs[run_count - 1].count;
+                --run_count;
+            }
+            runs[run_count - 1].power = power;
+        }
+
+        ghost_assert(run_count < sizeof(runs) / sizeof(*runs), "");
+        runs[run_count].start = start;
+        runs[run_count].count = run_length;
+        ++run_count;
+        start += run_length;
+    }
+
+    /* Merge everything that's left */
+    while (run_count > 1) {
+        ghost_impl_stable_sort_merge(&sort, first + runs[run_count - 2].start * sort.element_size,
+                runs[run_count - 2].count, runs[run_count - 1].count);
+        runs[run_count - 2].count += runs[run_count - 1].count;
+        --run_count;
+    }
+}
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#endif
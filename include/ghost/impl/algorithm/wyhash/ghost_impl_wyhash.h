@@ -0,0 +1,190 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_WYHASH_H_INCLUDED
+#define GHOST_IMPL_WYHASH_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Helpers for wyhash, the final version 4.2 by Wang Yi:
+ *
+ *     https://github.com/wangyi-fudan/wyhash
+ *
+ * (The reference implementation is released into the public domain under The
+ * Unlicense.)
+ *
+ * The core operation is a 64x64->128-bit multiply whose halves are xored
+ * together ("mum"). We use a native 128-bit integer or intrinsic if there is
+ * one, otherwise we multiply 32-bit halves. All three give the same results.
+ */
+
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+#ifndef GHOST_IMPL_WYHASH_INT128
+    #if defined(__SIZEOF_INT128__)
+        #define GHOST_IMPL_WYHASH_INT128 1
+    #else
+        #define GHOST_IMPL_WYHASH_INT128 0
+    #endif
+#endif
+
+#ifndef GHOST_IMPL_WYHASH_UMUL128
+    #if !GHOST_IMPL_WYHASH_INT128 && defined(_MSC_VER) && defined(_M_X64)
+        #define GHOST_IMPL_WYHASH_UMUL128 1
+    #else
+        #define GHOST_IMPL_WYHASH_UMUL128 0
+    #endif
+#endif
+
+#if GHOST_IMPL_WYHASH_UMUL128
+    #include <intrin.h>
+    #pragma intrinsic(_umul128)
+#endif
+
+#if ghost_has(ghost_uint64_t) && ghost_has(GHOST_UINT64_C)
+    #include "ghost/impl/ghost_impl_always_inline.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/serialization/load/ghost_load_le_u32.h"
+    #include "ghost/serialization/load/ghost_load_le_u64.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+
+    #if GHOST_IMPL_WYHASH_INT128
+        __extension__ typedef unsigned __int128 ghost_impl_wyhash_u128_t;
+    #endif
+
+    /* The default secret. */
+    #define GHOST_IMPL_WYHASH_P0 GHOST_UINT64_C(0x2d358dccaa6c78a5)
+    #define GHOST_IMPL_WYHASH_P1 GHOST_UINT64_C(0x8bb84b93962eacc9)
+    #define GHOST_IMPL_WYHASH_P2 GHOST_UINT64_C(0x4b33a62ed433d4a3)
+    #define GHOST_IMPL_WYHASH_P3 GHOST_UINT64_C(0x4d5a2da51de1aa47)
+
+    GHOST_IMPL_FUNCTION_OPEN
+
+    /* Replaces a and b with the low and high halves of their product. */
+    ghost_impl_always_inline
+    void ghost_impl_wyhash_mum(ghost_uint64_t* a, ghost_uint64_t* b) {
+        #if GHOST_IMPL_WYHASH_INT128
+            ghost_impl_wyhash_u128_t r = *a;
+            r *= *b;
+            *a = ghost_static_cast(ghost_uint64_t, r);
+            *b = ghost_static_cast(ghost_uint64_t, r >> 64);
+        #elif GHOST_IMPL_WYHASH_UMUL128
+            *a = _umul128(*a, *b, b);
+        #else
+            ghost_uint64_t ha = *a >> 32;
+            ghost_uint64_t hb = *b >> 32;
+            ghost_uint64_t la = *a & GHOST_UINT64_C(0xFFFFFFFF);
+            ghost_uint64_t lb = *b & GHOST_UINT64_C(0xFFFFFFFF);
+            ghost_uint64_t rh = ha * hb;
+            ghost_uint64_t rm0 = ha * lb;
+            ghost_uint64_t rm1 = hb * la;
+            ghost_uint64_t rl = la * lb;
+            ghost_uint64_t t = rl + (rm0 << 32);
+            ghost_uint64_t carry = t < rl;
+            ghost_uint64_t lo = t + (rm1 << 32);
+            carry += lo < t;
+            *a = lo;
+            *b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+        #endif
+    }
+
+    ghost_impl_always_inline
+    ghost_uint64_t ghost_impl_wyhash_mix(ghost_uint64_t a, ghost_uint64_t b) {
+        ghost_impl_wyhash_mum(&a, &b);
+        return a ^ b;
+    }
+
+    /* Reads 1 to 3 bytes: the first, middle and last. */
+    ghost_impl_always_inline
+    ghost_uint64_t ghost_impl_wyhash_read3(const unsigned char* p, ghost_size_t length) {
+        return (ghost_static_cast(ghost_uint64_t, p[0]) << 16) |
+                (ghost_static_cast(ghost_uint64_t, p[length >> 1]) << 8) |
+                ghost_static_cast(ghost_uint64_t, p[length - 1]);
+    }
+
+    /*
+     * Mixes one 48-byte block into the three lanes of the bulk loop.
+     */
+    ghost_impl_always_inline
+    void ghost_impl_wyhash_block(const unsigned char* p,
+            ghost_uint64_t* seed, ghost_uint64_t* see1, ghost_uint64_t* see2)
+    {
+        *seed = ghost_impl_wyhash_mix(ghost_load_le_u64(p) ^ GHOST_IMPL_WYHASH_P1,
+                ghost_load_le_u64(p + 8) ^ *seed);
+        *see1 = ghost_impl_wyhash_mix(ghost_load_le_u64(p + 16) ^ GHOST_IMPL_WYHASH_P2,
+                ghost_load_le_u64(p + 24) ^ *see1);
+        *see2 = ghost_impl_wyhash_mix(ghost_load_le_u64(p + 32) ^ GHOST_IMPL_WYHASH_P3,
+                ghost_load_le_u64(p + 40) ^ *see2);
+    }
+
+    /*
+     * Hashes the last bytes of the input.
+     *
+     * p points to the tail (fewer than 48 bytes remaining) and length is the
+     * total input length. If the input was longer than 16 bytes, the 16 bytes
+     * before p must be readable (they are the end of the last block.) The
+     * seed has already been mixed with the bulk lanes.
+     */
+    ghost_impl_always_inline
+    ghost_uint64_t ghost_impl_wyhash_finish(const unsigned char* p, ghost_size_t remaining,
+            ghost_size_t length, ghost_uint64_t seed)
+    {
+        ghost_uint64_t a;
+        ghost_uint64_t b;
+
+        if (length <= 16) {
+            if (length >= 4) {
+                ghost_size_t offset = (length >> 3) << 2;
+                a = (ghost_static_cast(ghost_uint64_t, ghost_load_le_u32(p)) << 32) |
+                        ghost_load_le_u32(p + offset);
+                b = (ghost_static_cast(ghost_uint64_t, ghost_load_le_u32(p + length - 4)) << 32) |
+                        ghost_load_le_u32(p + length - 4 - offset);
+            } else if (length > 0) {
+                a = ghost_impl_wyhash_read3(p, length);
+                b = 0;
+            } else {
+                a = 0;
+                b = 0;
+            }
+        } else {
+            while (remaining > 16) {
+                seed = ghost_impl_wyhash_mix(ghost_load_le_u64(p) ^ GHOST_IMPL_WYHASH_P1,
+                        ghost_load_le_u64(p + 8) ^ seed);
+                p += 16;
+                remaining -= 16;
+            }
+            a = ghost_load_le_u64(p + remaining - 16);
+            b = ghost_load_le_u64(p + remaining - 8);
+        }
+
+        a ^= GHOST_IMPL_WYHASH_P1;
+        b ^= seed;
+        ghost_impl_wyhash_mum(&a, &b);
+        return ghost_impl_wyhash_mix(a ^ GHOST_IMPL_WYHASH_P0 ^ ghost_static_cast(ghost_uint64_t, length),
+                b ^ GHOST_IMPL_WYHASH_P1);
+    }
+
+    GHOST_IMPL_FUNCTION_CLOSE
+#endif
+
+#endif
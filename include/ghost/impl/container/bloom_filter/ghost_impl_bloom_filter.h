@@ -0,0 +1,72 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_BLOOM_FILTER_H_INCLUDED
+#define GHOST_IMPL_BLOOM_FILTER_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Shared code for the blocked Bloom filter.
+ *
+ * This is a "split block" Bloom filter as used by Apache Parquet and Impala,
+ * widened to 512-bit blocks of eight 64-bit words. The high 32 bits of the
+ * hash choose a block and the low 32 bits set one bit in each of its eight
+ * words. Each word's bit comes from multiplying the low bits by a different
+ * odd salt and taking the top six bits of the 32-bit product.
+ *
+ * A lookup touches one cache line and has no data-dependent branches. The
+ * eight independent words are easily vectorized by the compiler.
+ */
+
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+#ifndef ghost_has_ghost_impl_bloom_filter
+    #if !ghost_has(ghost_uint64_t) || !ghost_has(GHOST_UINT64_C)
+        #define ghost_has_ghost_impl_bloom_filter 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_impl_bloom_filter
+    /* The salts are the ones from the Parquet specification. */
+    #define GHOST_IMPL_BLOOM_FILTER_BIT(key, salt) \
+            (GHOST_UINT64_C(1) << (((key) * GHOST_UINT64_C(salt) >> 26) & 63))
+    #define GHOST_IMPL_BLOOM_FILTER_BIT0(key) GHOST_IMPL_BLOOM_FILTER_BIT(key, 0x47b6137b)
+    #define GHOST_IMPL_BLOOM_FILTER_BIT1(key) GHOST_IMPL_BLOOM_FILTER_BIT(key, 0x44974d91)
+    #define GHOST_IMPL_BLOOM_FILTER_BIT2(key) GHOST_IMPL_BLOOM_FILTER_BIT(key, 0x8824ad5b)
+    #define GHOST_IMPL_BLOOM_FILTER_BIT3(key) GHOST_IMPL_BLOOM_FILTER_BIT(key, 0xa2b7289d)
+    #define GHOST_IMPL_BLOOM_FILTER_BIT4(key) GHOST_IMPL_BLOOM_FILTER_BIT(key, 0x705495c7)
+    #define GHOST_IMPL_BLOOM_FILTER_BIT5(key) GHOST_IMPL_BLOOM_FILTER_BIT(key, 0x2df1424b)
+    #define GHOST_IMPL_BLOOM_FILTER_BIT6(key) GHOST_IMPL_BLOOM_FILTER_BIT(key, 0x9efc4947)
+    #define GHOST_IMPL_BLOOM_FILTER_BIT7(key) GHOST_IMPL_BLOOM_FILTER_BIT(key, 0x5c6bfb31)
+
+    /* Returns the first word of the block for the given hash. */
+    #define GHOST_IMPL_BLOOM_FILTER_BLOCK(filter, hash) \
+            ((filter)->ghost_impl_words + 8 * ghost_static_cast(ghost_size_t, \
+                ((hash) >> 32) * ghost_static_cast(ghost_uint64_t, (filter)->ghost_impl_blocks) >> 32))
+
+    #define ghost_has_ghost_impl_bloom_filter 1
+#endif
+
+#endif
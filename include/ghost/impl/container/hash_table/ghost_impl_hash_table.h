@@ -0,0 +1,543 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_HASH_TABLE_H_INCLUDED
+#define GHOST_IMPL_HASH_TABLE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * This is the implementation of GHOST_HASH_SET_DEFINE() and
+ * GHOST_HASH_MAP_DEFINE().
+ *
+ * The table is an open-addressing table in the style of SwissTable. Besides
+ * the array of entries there is an array of control bytes, one per slot. A
+ * control byte is either empty (0x80), deleted (0xFE) or full, in which case
+ * it holds the low seven bits (h2) of the entry's hash. Lookups probe groups
+ * of 16 control bytes at a time, comparing them all against h2 at once with
+ * SSE2, NEON or SWAR on two 64-bit words. Only entries whose control byte
+ * matches are compared with the user's equality function, so nearly all
+ * comparisons of unequal keys are skipped. A probe stops at the first group
+ * containing an empty slot.
+ *
+ * Groups start at any slot, not just at multiples of 16. To load a group
+ * near the end of the array without wrapping, the first 15 control bytes are
+ * mirrored after the last one. The capacity is a power of two of at least 16
+ * and groups are probed quadratically (by triangular numbers of groups)
+ * which visits every slot.
+ *
+ * An erased entry only needs a tombstone (a deleted control byte) if some
+ * probe might have passed over its slot, i.e. if it's part of a run of at
+ * least 16 consecutive non-empty slots. Otherwise its control byte goes
+ * straight back to empty. With a maximum load of 7/8 most erasures need no
+ * tombstone at all. Tombstones are dropped whenever the table is rehashed.
+ *
+ * The user's hash is mixed with a 64-bit multiplication (Fibonacci hashing)
+ * so weak hash functions such as the identity on integers work fine. The
+ * probe position comes from the high bits of the product and h2 from the
+ * seven bits just below it.
+ */
+
+#include "ghost/impl/ghost_impl_always_inline.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/language/ghost_reinterpret_cast.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "ghost/math/ffs/ghost_ffs_u32.h"
+
+#ifndef ghost_has_ghost_impl_hash_table
+    #if !ghost_has(ghost_uint64_t) || !ghost_has(GHOST_UINT64_C) || !ghost_has(ghost_ffs_u32)
+        #define ghost_has_ghost_impl_hash_table 0
+    #endif
+#endif
+
+#ifndef ghost_has_ghost_impl_hash_table
+
+#ifndef GHOST_IMPL_HASH_TABLE_SSE2
+    #include "ghost/detect/ghost_x86_64.h"
+    #if GHOST_X86_64 || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define GHOST_IMPL_HASH_TABLE_SSE2 1
+    #else
+        #define GHOST_IMPL_HASH_TABLE_SSE2 0
+    #endif
+#endif
+
+/* We need horizontal adds to collapse a NEON comparison into a bitmask so we
+ * only use NEON on AArch64. */
+#ifndef GHOST_IMPL_HASH_TABLE_NEON
+    #if !GHOST_IMPL_HASH_TABLE_SSE2 && (defined(__aarch64__) || defined(_M_ARM64))
+        #define GHOST_IMPL_HASH_TABLE_NEON 1
+    #else
+        #define GHOST_IMPL_HASH_TABLE_NEON 0
+    #endif
+#endif
+
+#if GHOST_IMPL_HASH_TABLE_SSE2
+    #include <emmintrin.h>
+#elif GHOST_IMPL_HASH_TABLE_NEON
+    #include <arm_neon.h>
+#else
+    #include "ghost/serialization/load/ghost_load_le_u64.h"
+#endif
+
+#define GHOST_IMPL_HASH_TABLE_GROUP 16
+#define GHOST_IMPL_HASH_TABLE_EMPTY 0x80
+#define GHOST_IMPL_HASH_TABLE_DELETED 0xFE
+
+GHOST_IMPL_FUNCTION_OPEN
+
+#if GHOST_IMPL_HASH_TABLE_NEON
+/* Collapses a NEON comparison result into one bit per byte. */
+ghost_impl_always_inline
+unsigned ghost_impl_hash_table_neon_mask(uint8x16_t v) {
+    static const unsigned char bits[16] = {
+        1, 2, 4, 8, 16, 32, 64, 128,
+        1, 2, 4, 8, 16, 32, 64, 128,
+    };
+    v = vandq_u8(v, vld1q_u8(bits));
+    return ghost_static_cast(unsigned, vaddv_u8(vget_low_u8(v))) |
+            (ghost_static_cast(unsigned, vaddv_u8(vget_high_u8(v))) << 8);
+}
+#endif
+
+#if !GHOST_IMPL_HASH_TABLE_SSE2 && !GHOST_IMPL_HASH_TABLE_NEON
+/* Collapses the high bit of each byte of a 64-bit word into an 8-bit mask. */
+ghost_impl_always_inline
+unsigned ghost_impl_hash_table_swar_mask(ghost_uint64_t high_bits) {
+    return ghost_static_cast(unsigned,
+            ((high_bits >> 7) * GHOST_UINT64_C(0x0102040810204080)) >> 56);
+}
+
+/* Returns the high bit of each byte that may be zero. This may have false
+ * positives (only after a true zero byte) which is fine for matching h2. */
+ghost_impl_always_inline
+ghost_uint64_t ghost_impl_hash_table_swar_zero(ghost_uint64_t x) {
+    return (x - GHOST_UINT64_C(0x0101010101010101)) & ~x & GHOST_UINT64_C(0x8080808080808080);
+}
+#endif
+
+/*
+ * Returns a bitmask of the control bytes in the group that may match h2. The
+ * matches must be checked with the equality function anyway so the SWAR
+ * version is allowed false positives.
+ */
+ghost_impl_always_inline
+unsigned ghost_impl_hash_table_match(const unsigned char* group, unsigned h2) {
+    #if GHOST_IMPL_HASH_TABLE_SSE2
+        __m128i g = _mm_loadu_si128(ghost_reinterpret_cast(const __m128i*, group));
+        return ghost_static_cast(unsigned, _mm_movemask_epi8(_mm_cmpeq_epi8(g,
+                    _mm_set1_epi8(ghost_static_cast(char, h2)))));
+    #elif GHOST_IMPL_HASH_TABLE_NEON
+        return ghost_impl_hash_table_neon_mask(vceqq_u8(vld1q_u8(group),
+                    vdupq_n_u8(ghost_static_cast(unsigned char, h2))));
+    #else
+        ghost_uint64_t pattern = GHOST_UINT64_C(0x0101010101010101) * h2;
+        return ghost_impl_hash_table_swar_mask(ghost_impl_hash_table_swar_zero(ghost_load_le_u64(group) ^ pattern)) |
+                (ghost_impl_hash_table_swar_mask(ghost_impl_hash_table_swar_zero(ghost_load_le_u64(group + 8) ^ pattern)) << 8);
+    #endif
+}
+
+/*
+ * Returns a bitmask of the empty control bytes in the group.
+ */
+ghost_impl_always_inline
+unsigned ghost_impl_hash_table_match_empty(const unsigned char* group) {
+    #if GHOST_IMPL_HASH_TABLE_SSE2
+        __m128i g = _mm_loadu_si128(ghost_reinterpret_cast(const __m128i*, group));
+        return ghost_static_cast(unsigned, _mm_movemask_epi8(_mm_cmpeq_epi8(g,
+                    _mm_set1_epi8(ghost_static_cast(char, -128)))));
+    #elif GHOST_IMPL_HASH_TABLE_NEON
+        return ghost_impl_hash_table_neon_mask(vceqq_u8(vld1q_u8(group),
+                    vdupq_n_u8(GHOST_IMPL_HASH_TABLE_EMPTY)));
+    #else
+        /* Empty is the only control byte with the high bit set and bit 1
+         * clear. */
+        ghost_uint64_t low = ghost_load_le_u64(group);
+        ghost_uint64_t high = ghost_load_le_u64(group + 8);
+        return ghost_impl_hash_table_swar_mask(low & ~(low << 6) & GHOST_UINT64_C(0x8080808080808080)) |
+                (ghost_impl_hash_table_swar_mask(high & ~(high << 6) & GHOST_UINT64_C(0x8080808080808080)) << 8);
+    #endif
+}
+
+/*
+ * Returns a bitmask of the empty or deleted control bytes in the group.
+ */
+ghost_impl_always_inline
+unsigned ghost_impl_hash_table_match_free(const unsigned char* group) {
+    #if GHOST_IMPL_HASH_TABLE_SSE2
+        return ghost_static_cast(unsigned, _mm_movemask_epi8(
+                    _mm_loadu_si128(ghost_reinterpret_cast(const __m128i*, group))));
+    #elif GHOST_IMPL_HASH_TABLE_NEON
+        return ghost_impl_hash_table_neon_mask(vtstq_u8(vld1q_u8(group), vdupq_n_u8(0x80)));
+    #else
+        return ghost_impl_hash_table_swar_mask(ghost_load_le_u64(group) & GHOST_UINT64_C(0x8080808080808080)) |
+                (ghost_impl_hash_table_swar_mask(ghost_load_le_u64(group + 8) & GHOST_UINT64_C(0x8080808080808080)) << 8);
+    #endif
+}
+
+/*
+ * Returns the index of the lowest set bit in a non-zero mask.
+ */
+ghost_impl_always_inline
+ghost_size_t ghost_impl_hash_table_lowest(unsigned mask) {
+    return ghost_static_cast(ghost_size_t, ghost_ffs_u32(mask) - 1);
+}
+
+/*
+ * Mixes the user's hash. The probe position is (mixed >> shift) & mask and
+ * h2 is the seven bits below it.
+ */
+ghost_impl_always_inline
+ghost_uint64_t ghost_impl_hash_table_mix(ghost_uint64_t hash) {
+    return hash * GHOST_UINT64_C(0x9E3779B97F4A7C15);
+}
+
+ghost_impl_always_inline
+unsigned ghost_impl_hash_table_h2(ghost_uint64_t mixed, unsigned shift) {
+    return ghost_static_cast(unsigned, (mixed >> (shift - 7)) & 0x7F);
+}
+
+/*
+ * Sets a control byte along with its mirror.
+ */
+ghost_impl_always_inline
+void ghost_impl_hash_table_set_control(unsigned char* control, ghost_size_t mask,
+        ghost_size_t index, unsigned value)
+{
+    control[index] = ghost_static_cast(unsigned char, value);
+    /* This is branchless: for index >= 15 it writes the same byte twice. */
+    control[((index - (GHOST_IMPL_HASH_TABLE_GROUP - 1)) & mask) + (GHOST_IMPL_HASH_TABLE_GROUP - 1)] =
+            ghost_static_cast(unsigned char, value);
+}
+
+/*
+ * Returns true if the slot at the given index is not part of a run of 16 or
+ * more non-empty slots. No probe can have passed over such a slot so it can
+ * be emptied without leaving a tombstone.
+ *
+ * The run through the slot is less than 16 long if the lowest empty slot at
+ * or after it (in the group starting at it) is at a lower bit position than
+ * the highest empty slot before it (in the group ending just before it.)
+ */
+ghost_impl_always_inline
+int ghost_impl_hash_table_can_empty(const unsigned char* control, ghost_size_t mask, ghost_size_t index) {
+    unsigned after = ghost_impl_hash_table_match_empty(control + index);
+    unsigned before = ghost_impl_hash_table_match_empty(control + ((index - GHOST_IMPL_HASH_TABLE_GROUP) & mask));
+    return after != 0 && before >= (after & (0u - after));
+}
+
+/*
+ * Finds the first empty or deleted slot on the probe sequence starting at
+ * the given position. The table must have at least one.
+ */
+ghost_impl_always_inline
+ghost_size_t ghost_impl_hash_table_find_free(const unsigned char* control, ghost_size_t mask, ghost_size_t position) {
+    ghost_size_t stride = 0;
+    for (;;) {
+        unsigned available = ghost_impl_hash_table_match_free(control + position);
+        if (available != 0)
+            return (position + ghost_impl_hash_table_lowest(available)) & mask;
+        stride += GHOST_IMPL_HASH_TABLE_GROUP;
+        position = (position + stride) & mask;
+    }
+}
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+/*
+ * Defines a hash table. entry_type is the type stored in the slots and
+ * key_of(entry) is an expression giving a `const key_type*` to its key.
+ *
+ * Everything is written in C89 style (no mixed declarations and code) since
+ * it's expanded into user code.
+ */
+
+#include "ghost/language/ghost_maybe_unused.h"
+#include "ghost/language/ghost_inline_opt.h"
+#include "ghost/language/ghost_null.h"
+#include "ghost/malloc/ghost_malloc.h"
+#include "ghost/malloc/ghost_free.h"
+#include "ghost/string/ghost_memset.h"
+#include "ghost/type/bool/ghost_bool.h"
+#include "ghost/type/bool/ghost_true.h"
+#include "ghost/type/bool/ghost_false.h"
+#include "ghost/type/size_t/ghost_size_max.h"
+
+#define GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION ghost_maybe_unused static
+#define GHOST_IMPL_HASH_TABLE_DEFINE_INLINE ghost_maybe_unused static ghost_inline_opt
+
+#define GHOST_IMPL_HASH_TABLE_DEFINE_TYPE(name, entry_type) \
+    typedef struct name##_t { \
+        /* This structure is meant to be opaque. Don't access these fields directly. */ \
+        entry_type* ghost_impl_entries; \
+        unsigned char* ghost_impl_control; \
+        ghost_size_t ghost_impl_mask; /* capacity - 1, or 0 if unallocated */ \
+        ghost_size_t ghost_impl_count; \
+        ghost_size_t ghost_impl_growth_left; \
+        unsigned ghost_impl_shift; /* 64 - log2(capacity) */ \
+    } name##_t;
+
+#define GHOST_IMPL_HASH_TABLE_DEFINE_BASICS(name, entry_type) \
+    GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION \
+    void name##_init(name##_t* ghost_impl_v_table) { \
+        ghost_impl_v_table->ghost_impl_entries = ghost_null; \
+        ghost_impl_v_table->ghost_impl_control = ghost_null; \
+        ghost_impl_v_table->ghost_impl_mask = 0; \
+        ghost_impl_v_table->ghost_impl_count = 0; \
+        ghost_impl_v_table->ghost_impl_growth_left = 0; \
+        ghost_impl_v_table->ghost_impl_shift = 64; \
+    } \
+    \
+    GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION \
+    void name##_destroy(name##_t* ghost_impl_v_table) { \
+        if (ghost_impl_v_table->ghost_impl_entries != ghost_null) \
+            ghost_free(ghost_impl_v_table->ghost_impl_entries); \
+    } \
+    \
+    GHOST_IMPL_HASH_TABLE_DEFINE_INLINE \
+    ghost_size_t name##_count(const name##_t* ghost_impl_v_table) { \
+        return ghost_impl_v_table->ghost_impl_count; \
+    } \
+    \
+    GHOST_IMPL_HASH_TABLE_DEFINE_INLINE \
+    ghost_size_t ghost_impl_##name##_capacity(const name##_t* ghost_impl_v_table) { \
+        return ghost_impl_v_table->ghost_impl_entries == ghost_null ? 0 : \
+                ghost_impl_v_table->ghost_impl_mask + 1; \
+    } \
+    \
+    GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION \
+    void name##_clear(name##_t* ghost_impl_v_table) { \
+        ghost_size_t ghost_impl_v_capacity = ghost_impl_##name##_capacity(ghost_impl_v_table); \
+        if (ghost_impl_v_capacity == 0) \
+            return; \
+        ghost_memset(ghost_impl_v_table->ghost_impl_control, GHOST_IMPL_HASH_TABLE_EMPTY, \
+                ghost_impl_v_capacity + GHOST_IMPL_HASH_TABLE_GROUP - 1); \
+        ghost_impl_v_table->ghost_impl_count = 0; \
+        ghost_impl_v_table->ghost_impl_growth_left = ghost_impl_v_capacity - ghost_impl_v_capacity / 8; \
+    } \
+    \
+    GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION \
+    entry_type* name##_next(const name##_t* ghost_impl_v_table, ghost_size_t* ghost_impl_v_cursor) { \
+        ghost_size_t ghost_impl_v_capacity = ghost_impl_##name##_capacity(ghost_impl_v_table); \
+        ghost_size_t ghost_impl_v_index = *ghost_impl_v_cursor; \
+        for (; ghost_impl_v_index < ghost_impl_v_capacity; ++ghost_impl_v_index) { \
+            if ((ghost_impl_v_table->ghost_impl_control[ghost_impl_v_index] & 0x80) == 0) { \
+                *ghost_impl_v_cursor = ghost_impl_v_index + 1; \
+                return ghost_impl_v_table->ghost_impl_entries + ghost_impl_v_index; \
+            } \
+        } \
+        *ghost_impl_v_cursor = ghost_impl_v_index; \
+        return ghost_null; \
+    } \
+    \
+    GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION \
+    void name##_erase_entry(name##_t* ghost_impl_v_table, entry_type* ghost_impl_v_entry) { \
+        ghost_size_t ghost_impl_v_index = ghost_static_cast(ghost_size_t, \
+                ghost_impl_v_entry - ghost_impl_v_table->ghost_impl_entries); \
+        unsigned char* ghost_impl_v_control = ghost_impl_v_table->ghost_impl_control; \
+        ghost_size_t ghost_impl_v_mask = ghost_impl_v_table->ghost_impl_mask; \
+        --ghost_impl_v_table->ghost_impl_count; \
+        if (ghost_impl_hash_table_can_empty(ghost_impl_v_control, ghost_impl_v_mask, ghost_impl_v_index)) { \
+            ghost_impl_hash_table_set_control(ghost_impl_v_control, ghost_impl_v_mask, \
+                    ghost_impl_v_index, GHOST_IMPL_HASH_TABLE_EMPTY); \
+            ++ghost_impl_v_table->ghost_impl_growth_left; \
+        } else { \
+            ghost_impl_hash_table_set_control(ghost_impl_v_control, ghost_impl_v_mask, \
+                    ghost_impl_v_index, GHOST_IMPL_HASH_TABLE_DELETED); \
+        } \
+    }
+
+#define GHOST_IMPL_HASH_TABLE_DEFINE_LOOKUP(name, key_type, entry_type, key_of, hash, equal) \
+    GHOST_IMPL_HASH_TABLE_DEFINE_INLINE \
+    ghost_uint64_t ghost_impl_##name##_hash(const key_type* ghost_impl_v_key) { \
+        return ghost_impl_hash_table_mix(ghost_static_cast(ghost_uint64_t, hash(ghost_impl_v_key))); \
+    } \
+    \
+    GHOST_IMPL_HASH_TABLE_DEFINE_INLINE \
+    entry_type* ghost_impl_##name##_find(const name##_t* ghost_impl_v_table, \
+            const key_type* ghost_impl_v_key, ghost_uint64_t ghost_impl_v_hash) \
+    { \
+        const unsigned char* ghost_impl_v_control = ghost_impl_v_table->ghost_impl_control; \
+        ghost_size_t ghost_impl_v_mask = ghost_impl_v_table->ghost_impl_mask; \
+        unsigned ghost_impl_v_shift = ghost_impl_v_table->ghost_impl_shift; \
+        unsigned ghost_impl_v_h2 = ghost_impl_hash_table_h2(ghost_impl_v_hash, ghost_impl_v_shift); \
+        ghost_size_t ghost_impl_v_position = ghost_static_cast(ghost_size_t, \
+                ghost_impl_v_hash >> ghost_impl_v_shift) & ghost_impl_v_mask; \
+        ghost_size_t ghost_impl_v_stride = 0; \
+        for (;;) { \
+            const unsigned char* ghost_impl_v_group = ghost_impl_v_control + ghost_impl_v_position; \
+            unsigned ghost_impl_v_matches = ghost_impl_hash_table_match(ghost_impl_v_group, ghost_impl_v_h2); \
+            while (ghost_impl_v_matches != 0) { \
+                entry_type* ghost_impl_v_entry = ghost_impl_v_table->ghost_impl_entries + \
+                        ((ghost_impl_v_position + ghost_impl_hash_table_lowest(ghost_impl_v_matches)) & ghost_impl_v_mask); \
+                if (equal(key_of(ghost_impl_v_entry), ghost_impl_v_key)) \
+                    return ghost_impl_v_entry; \
+                ghost_impl_v_matches &= ghost_impl_v_matches - 1; \
+            } \
+            if (ghost_impl_hash_table_match_empty(ghost_impl_v_group) != 0) \
+                return ghost_null; \
+            ghost_impl_v_stride += GHOST_IMPL_HASH_TABLE_GROUP; \
+            ghost_impl_v_position = (ghost_impl_v_position + ghost_impl_v_stride) & ghost_impl_v_mask; \
+        } \
+    } \
+    \
+    GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION \
+    entry_type* name##_find(const name##_t* ghost_impl_v_table, const key_type* ghost_impl_v_key) { \
+        if (ghost_impl_v_table->ghost_impl_count == 0) \
+            return ghost_null; \
+        return ghost_impl_##name##_find(ghost_impl_v_table, ghost_impl_v_key, \
+                ghost_impl_##name##_hash(ghost_impl_v_key)); \
+    } \
+    \
+    GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION \
+    ghost_bool name##_erase(name##_t* ghost_impl_v_table, const key_type* ghost_impl_v_key) { \
+        entry_type* ghost_impl_v_entry = name##_find(ghost_impl_v_table, ghost_impl_v_key); \
+        if (ghost_impl_v_entry == ghost_null) \
+            return ghost_false; \
+        name##_erase_entry(ghost_impl_v_table, ghost_impl_v_entry); \
+        return ghost_true; \
+    }
+
+#define GHOST_IMPL_HASH_TABLE_DEFINE_INSERT(name, key_type, entry_type, key_of, hash, equal) \
+    /* Moves all entries into a new allocation of the given capacity. */ \
+    GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION \
+    ghost_bool ghost_impl_##name##_rehash(name##_t* ghost_impl_v_table, ghost_size_t ghost_impl_v_capacity) { \
+        name##_t ghost_impl_v_old = *ghost_impl_v_table; \
+        ghost_size_t ghost_impl_v_old_capacity = ghost_impl_##name##_capacity(ghost_impl_v_table); \
+        ghost_size_t ghost_impl_v_index; \
+        unsigned ghost_impl_v_shift = 64; \
+        void* ghost_impl_v_allocation; \
+        \
+        for (ghost_impl_v_index = 1; ghost_impl_v_index < ghost_impl_v_capacity; ghost_impl_v_index <<= 1) \
+            --ghost_impl_v_shift; \
+        if (ghost_impl_v_shift < 8 || ghost_impl_v_capacity > \
+                (GHOST_SIZE_MAX - GHOST_IMPL_HASH_TABLE_GROUP) / (sizeof(entry_type) + 1)) \
+            return ghost_false; \
+        ghost_impl_v_allocation = ghost_malloc(ghost_impl_v_capacity * (sizeof(entry_type) + 1) + \
+                GHOST_IMPL_HASH_TABLE_GROUP - 1); \
+        if (ghost_impl_v_allocation == ghost_null) \
+            return ghost_false; \
+        \
+        ghost_impl_v_table->ghost_impl_entries = ghost_static_cast(entry_type*, ghost_impl_v_allocation); \
+        ghost_impl_v_table->ghost_impl_control = ghost_reinterpret_cast(unsigned char*, \
+                ghost_impl_v_table->ghost_impl_entries + ghost_impl_v_capacity); \
+        ghost_impl_v_table->ghost_impl_mask = ghost_impl_v_capacity - 1; \
+        ghost_impl_v_table->ghost_impl_shift = ghost_impl_v_shift; \
+        name##_clear(ghost_impl_v_table); \
+        \
+        for (ghost_impl_v_index = 0; ghost_impl_v_index < ghost_impl_v_old_capacity; ++ghost_impl_v_index) { \
+            if ((ghost_impl_v_old.ghost_impl_control[ghost_impl_v_index] & 0x80) == 0) { \
+                entry_type* ghost_impl_v_entry = ghost_impl_v_old.ghost_impl_entries + ghost_impl_v_index; \
+                ghost_uint64_t ghost_impl_v_hash = ghost_impl_##name##_hash(key_of(ghost_impl_v_entry)); \
+                ghost_size_t ghost_impl_v_slot = ghost_impl_hash_table_find_free(ghost_impl_v_table->ghost_impl_control, \
+                        ghost_impl_v_table->ghost_impl_mask, \
+                        ghost_static_cast(ghost_size_t, ghost_impl_v_hash >> ghost_impl_v_shift) & ghost_impl_v_table->ghost_impl_mask); \
+                ghost_impl_hash_table_set_control(ghost_impl_v_table->ghost_impl_control, ghost_impl_v_table->ghost_impl_mask, \
+                        ghost_impl_v_slot, ghost_impl_hash_table_h2(ghost_impl_v_hash, ghost_impl_v_shift)); \
+                ghost_impl_v_table->ghost_impl_entries[ghost_impl_v_slot] = *ghost_impl_v_entry; \
+            } \
+        } \
+        ghost_impl_v_table->ghost_impl_count = ghost_impl_v_old.ghost_impl_count; \
+        ghost_impl_v_table->ghost_impl_growth_left -= ghost_impl_v_old.ghost_impl_count; \
+        \
+        name##_destroy(&ghost_impl_v_old); \
+        return ghost_true; \
+    } \
+    \
+    GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION \
+    ghost_bool name##_reserve(name##_t* ghost_impl_v_table, ghost_size_t ghost_impl_v_count) { \
+        ghost_size_t ghost_impl_v_capacity = GHOST_IMPL_HASH_TABLE_GROUP; \
+        if (ghost_impl_v_count <= ghost_impl_v_table->ghost_impl_count + ghost_impl_v_table->ghost_impl_growth_left) \
+            return ghost_true; \
+        while (ghost_impl_v_capacity - ghost_impl_v_capacity / 8 < ghost_impl_v_count) { \
+            if (ghost_impl_v_capacity > GHOST_SIZE_MAX / 2) \
+                return ghost_false; \
+            ghost_impl_v_capacity *= 2; \
+        } \
+        return ghost_impl_##name##_rehash(ghost_impl_v_table, ghost_impl_v_capacity); \
+    } \
+    \
+    GHOST_IMPL_HASH_TABLE_DEFINE_FUNCTION \
+    entry_type* ghost_impl_##name##_insert(name##_t* ghost_impl_v_table, \
+            const key_type* ghost_impl_v_key, ghost_bool* ghost_impl_v_inserted) \
+    { \
+        ghost_uint64_t ghost_impl_v_hash = ghost_impl_##name##_hash(ghost_impl_v_key); \
+        entry_type* ghost_impl_v_entry; \
+        ghost_size_t ghost_impl_v_slot; \
+        \
+        if (ghost_impl_v_table->ghost_impl_entries == ghost_null) { \
+            if (!ghost_impl_##name##_rehash(ghost_impl_v_table, GHOST_IMPL_HASH_TABLE_GROUP)) \
+                return ghost_null; \
+        } else if (ghost_impl_v_table->ghost_impl_count != 0) { \
+            ghost_impl_v_entry = ghost_impl_##name##_find(ghost_impl_v_table, ghost_impl_v_key, ghost_impl_v_hash); \
+            if (ghost_impl_v_entry != ghost_null) { \
+                if (ghost_impl_v_inserted != ghost_null) \
+                    *ghost_impl_v_inserted = ghost_false; \
+                return ghost_impl_v_entry; \
+            } \
+        } \
+        \
+        ghost_impl_v_slot = ghost_impl_hash_table_find_free(ghost_impl_v_table->ghost_impl_control, \
+                ghost_impl_v_table->ghost_impl_mask, \
+                ghost_static_cast(ghost_size_t, ghost_impl_v_hash >> ghost_impl_v_table->ghost_impl_shift) & \
+                    ghost_impl_v_table->ghost_impl_mask); \
+        \
+        /* If we need to use up an empty slot and we're at the maximum load, \
+         * grow the table. If it's mostly tombstones, rehash it at the same \
+         * size instead. */ \
+        if (ghost_impl_v_table->ghost_impl_growth_left == 0 && \
+                ghost_impl_v_table->ghost_impl_control[ghost_impl_v_slot] == GHOST_IMPL_HASH_TABLE_EMPTY) \
+        { \
+            ghost_size_t ghost_impl_v_capacity = ghost_impl_v_table->ghost_impl_mask + 1; \
+            if (ghost_impl_v_table->ghost_impl_count >= ghost_impl_v_capacity / 2) { \
+                if (ghost_impl_v_capacity > GHOST_SIZE_MAX / 2) \
+                    return ghost_null; \
+                ghost_impl_v_capacity *= 2; \
+            } \
+            if (!ghost_impl_##name##_rehash(ghost_impl_v_table, ghost_impl_v_capacity)) \
+                return ghost_null; \
+            ghost_impl_v_slot = ghost_impl_hash_table_find_free(ghost_impl_v_table->ghost_impl_control, \
+                    ghost_impl_v_table->ghost_impl_mask, \
+                    ghost_static_cast(ghost_size_t, ghost_impl_v_hash >> ghost_impl_v_table->ghost_impl_shift) & \
+                        ghost_impl_v_table->ghost_impl_mask); \
+        } \
+        \
+        if (ghost_impl_v_table->ghost_impl_control[ghost_impl_v_slot] == GHOST_IMPL_HASH_TABLE_EMPTY) \
+            --ghost_impl_v_table->ghost_impl_growth_left; \
+        ghost_impl_hash_table_set_control(ghost_impl_v_table->ghost_impl_control, ghost_impl_v_table->ghost_impl_mask, \
+                ghost_impl_v_slot, ghost_impl_hash_table_h2(ghost_impl_v_hash, ghost_impl_v_table->ghost_impl_shift)); \
+        ++ghost_impl_v_table->ghost_impl_count; \
+        if (ghost_impl_v_inserted != ghost_null) \
+            *ghost_impl_v_inserted = ghost_true; \
+        return ghost_impl_v_table->ghost_impl_entries + ghost_impl_v_slot; \
+    }
+
+#define GHOST_IMPL_HASH_TABLE_DEFINE(name, key_type, entry_type, key_of, hash, equal) \
+    GHOST_IMPL_HASH_TABLE_DEFINE_TYPE(name, entry_type) \
+    GHOST_IMPL_HASH_TABLE_DEFINE_BASICS(name, entry_type) \
+    GHOST_IMPL_HASH_TABLE_DEFINE_LOOKUP(name, key_type, entry_type, key_of, hash, equal) \
+    GHOST_IMPL_HASH_TABLE_DEFINE_INSERT(name, key_type, entry_type, key_of, hash, equal)
+
+#define ghost_has_ghost_impl_hash_table 1
+#endif
+
+#endif
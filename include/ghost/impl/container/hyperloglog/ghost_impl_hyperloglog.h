@@ -0,0 +1,107 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_HYPERLOGLOG_H_INCLUDED
+#define GHOST_IMPL_HYPERLOGLOG_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Ghost's internal HyperLogLog implementation.
+ *
+ * Dense registers are one byte each. A sketch starts out sparse: the memory
+ * instead holds a list of the non-zero registers sorted by index. Each entry
+ * is the distance from the previous index as big-endian base-128 digits
+ * (bytes below 0x80, omitted if the distance is 1) followed by the rank ORed
+ * with 0x80. (The first entry's distance is from index -1.)
+ *
+ * An entry is never longer than its distance so the bytes of each entry end
+ * at or before the register it describes. This lets the sketch be converted
+ * to dense registers in place: we walk the entries backwards, writing each
+ * register (and zeroing the gap above it) only after the entry has been read
+ * and never touching the bytes of earlier entries.
+ *
+ * Adding to a sparse sketch takes time proportional to its size so it is
+ * converted to dense registers once the list reaches an eighth of the memory
+ * or 4 KiB. Until then the sketch is much faster to merge and estimate.
+ */
+
+#include "ghost/container/hyperloglog/ghost_hyperloglog_t.h"
+
+#if ghost_has(ghost_hyperloglog_t)
+    #include "ghost/impl/ghost_impl_always_inline.h"
+    #include "ghost/impl/ghost_impl_noinline.h"
+    #include "ghost/language/ghost_static_cast.h"
+    #include "ghost/type/double/ghost_double.h"
+    #include "ghost/math/sqrt/ghost_sqrt_d.h"
+
+    #define GHOST_IMPL_HYPERLOGLOG_SPARSE_MAX(precision) \
+            ((precision) >= 15 ? 4096 : (ghost_static_cast(ghost_size_t, 1) << (precision)) / 8)
+
+    GHOST_IMPL_FUNCTION_OPEN
+
+    /*
+     * Decodes the sparse entry at *position, advancing it past the entry.
+     * Returns the register index and stores the rank. `next` is one more than
+     * the index of the previous entry (or 0 for the first.)
+     */
+    ghost_impl_always_inline
+    ghost_size_t ghost_impl_hyperloglog_sparse_decode(const unsigned char* bytes,
+            ghost_size_t* position, ghost_size_t next, unsigned char* rank)
+    {
+        ghost_size_t p = *position;
+        ghost_size_t delta = 0;
+        while (bytes[p] < 0x80)
+            delta = (delta << 7) | bytes[p++];
+        *rank = ghost_static_cast(unsigned char, bytes[p++] & 0x7F);
+        *position = p;
+        return delta == 0 ? next : next - 1 + delta;
+    }
+
+    /*
+     * Sets the register with the given index to at least the given rank in a
+     * sparse sketch, converting it to dense if it gets too large.
+     */
+    ghost_impl_noinline
+    void ghost_impl_hyperloglog_sparse_add(ghost_hyperloglog_t* hll, ghost_size_t index, unsigned char rank);
+
+    /*
+     * Converts a sparse sketch to dense registers.
+     */
+    ghost_impl_noinline
+    void ghost_impl_hyperloglog_densify(ghost_hyperloglog_t* hll);
+
+    ghost_impl_noinline
+    void ghost_impl_hyperloglog_merge(ghost_hyperloglog_t* to, const ghost_hyperloglog_t* from);
+
+    #if ghost_has(ghost_double) && ghost_has(ghost_sqrt_d)
+    ghost_impl_noinline
+    double ghost_impl_hyperloglog_estimate(const ghost_hyperloglog_t* hll);
+    #endif
+
+    GHOST_IMPL_FUNCTION_CLOSE
+
+    #if GHOST_EMIT_DEFS
+        #include "ghost/impl/container/hyperloglog/ghost_impl_hyperloglog_define.h"
+    #endif
+#endif
+
+#endif
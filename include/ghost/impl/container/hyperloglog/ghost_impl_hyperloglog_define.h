@@ -0,0 +1,274 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_HYPERLOGLOG_DEFINE_H_INCLUDED
+#define GHOST_IMPL_HYPERLOGLOG_DEFINE_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Defines Ghost's internal HyperLogLog functions.
+ *
+ * The estimate uses Otmar Ertl's improved estimator which is unbiased over
+ * the whole range of cardinalities without empirical bias tables or a switch
+ * to linear counting:
+ *
+ *     https://arxiv.org/abs/1702.01284
+ */
+
+#if !GHOST_EMIT_DEFS && !GHOST_IMPL_AMALGAMATED
+    #error "This file is not supposed to be included if Ghost is not emitting function definitions."
+#endif
+
+#include "ghost/impl/container/hyperloglog/ghost_impl_hyperloglog.h"
+#include "ghost/debug/ghost_assert.h"
+#include "ghost/string/ghost_memmove.h"
+#include "ghost/string/ghost_memset.h"
+
+GHOST_IMPL_FUNCTION_OPEN
+
+/* Returns the number of base-128 digits used to encode a distance. */
+ghost_impl_always_inline
+ghost_size_t ghost_impl_hyperloglog_sparse_digits(ghost_size_t delta) {
+    ghost_size_t digits = 0;
+    if (delta == 1)
+        return 0;
+    while (delta != 0) {
+        ++digits;
+        delta >>= 7;
+    }
+    return digits;
+}
+
+/* Writes the digits of a distance, returning the number of bytes written. */
+ghost_impl_always_inline
+ghost_size_t ghost_impl_hyperloglog_sparse_encode(unsigned char* out, ghost_size_t delta) {
+    ghost_size_t digits = ghost_impl_hyperloglog_sparse_digits(delta);
+    ghost_size_t i;
+    for (i = digits; i > 0; --i) {
+        out[i - 1] = ghost_static_cast(unsigned char, delta & 0x7F);
+        delta >>= 7;
+    }
+    return digits;
+}
+
+ghost_impl_noinline
+void ghost_impl_hyperloglog_sparse_add(ghost_hyperloglog_t* hll, ghost_size_t index, unsigned char rank) {
+    unsigned char* bytes = hll->ghost_impl_registers;
+    ghost_size_t length = hll->ghost_impl_sparse_length;
+    ghost_size_t position = 0;
+    ghost_size_t next = 0;
+    ghost_size_t start = 0;
+    ghost_size_t old_digits = 0;
+    ghost_size_t new_length;
+    ghost_size_t follower = 0;
+    unsigned char existing;
+
+    /* Find the first entry at or after index. */
+    while (position < length) {
+        ghost_size_t entry_index;
+        start = position;
+        entry_index = ghost_impl_hyperloglog_sparse_decode(bytes, &position, next, &existing);
+        if (entry_index == index) {
+            if (existing < rank)
+                bytes[position - 1] = ghost_static_cast(unsigned char, 0x80 | rank);
+            return;
+        }
+        if (entry_index > index) {
+            follower = entry_index - index;
+            old_digits = position - 1 - start;
+            break;
+        }
+        next = entry_index + 1;
+    }
+    if (follower == 0)
+        start = length;
+
+    /* Insert a new entry at start. If there is a following entry, its
+     * distance digits are replaced (its rank byte stays where it is.) */
+    new_length = length - old_digits + ghost_impl_hyperloglog_sparse_digits(index + 1 - next) + 1;
+    if (follower != 0)
+        new_length += ghost_impl_hyperloglog_sparse_digits(follower);
+    if (new_length > GHOST_IMPL_HYPERLOGLOG_SPARSE_MAX(hll->ghost_impl_precision)) {
+        ghost_impl_hyperloglog_densify(hll);
+        if (bytes[index] < rank)
+            bytes[index] = rank;
+        return;
+    }
+
+    ghost_memmove(bytes + start + old_digits + (new_length - length), bytes + start + old_digits,
+            length - start - old_digits);
+    start += ghost_impl_hyperloglog_sparse_encode(bytes + start, index + 1 - next);
+    bytes[start++] = ghost_static_cast(unsigned char, 0x80 | rank);
+    if (follower != 0)
+        ghost_impl_hyperloglog_sparse_encode(bytes + start, follower);
+    hll->ghost_impl_sparse_length = new_length;
+}
+
+ghost_impl_noinline
+void ghost_impl_hyperloglog_densify(ghost_hyperloglog_t* hll) {
+    unsigned char* bytes = hll->ghost_impl_registers;
+    ghost_size_t end = hll->ghost_impl_sparse_length;
+    ghost_size_t fill = ghost_static_cast(ghost_size_t, 1) << hll->ghost_impl_precision;
+    ghost_size_t position = 0;
+    ghost_size_t next = 0;
+    ghost_size_t index;
+    unsigned char rank;
+
+    /* Find the index of the last entry. */
+    while (position < end)
+        next = ghost_impl_hyperloglog_sparse_decode(bytes, &position, next, &rank) + 1;
+    index = next - 1;
+
+    /* Walk backwards. Each entry's bytes are at or below its index so
+     * writing its register and zeroing above it never clobbers an entry
+     * we haven't read yet. */
+    while (end != 0) {
+        ghost_size_t start = end - 1;
+        ghost_size_t delta = 0;
+        ghost_size_t i;
+        rank = ghost_static_cast(unsigned char, bytes[end - 1] & 0x7F);
+        while (start != 0 && bytes[start - 1] < 0x80)
+            --start;
+        for (i = start; i != end - 1; ++i)
+            delta = (delta << 7) | bytes[i];
+        if (delta == 0)
+            delta = 1;
+
+        ghost_memset(bytes + index + 1, 0, fill - index - 1);
+        bytes[index] = rank;
+        fill = index;
+        end = start;
+        index -= delta;
+    }
+
+    ghost_memset(bytes, 0, fill);
+    hll->ghost_impl_dense = 1;
+}
+
+ghost_impl_noinline
+void ghost_impl_hyperloglog_merge(ghost_hyperloglog_t* to, const ghost_hyperloglog_t* from) {
+    ghost_size_t count = ghost_static_cast(ghost_size_t, 1) << to->ghost_impl_precision;
+    ghost_size_t i;
+    ghost_assert(to->ghost_impl_precision == from->ghost_impl_precision, "");
+
+    if (!from->ghost_impl_dense) {
+        /* Add each entry. (If from and to are the same sketch, this changes
+         * nothing.) */
+        const unsigned char* bytes = from->ghost_impl_registers;
+        ghost_size_t length = from->ghost_impl_sparse_length;
+        ghost_size_t position = 0;
+        ghost_size_t next = 0;
+        while (position < length) {
+            unsigned char rank;
+            ghost_size_t index = ghost_impl_hyperloglog_sparse_decode(bytes, &position, next, &rank);
+            next = index + 1;
+            if (to->ghost_impl_dense) {
+                if (to->ghost_impl_registers[index] < rank)
+                    to->ghost_impl_registers[index] = rank;
+            } else {
+                ghost_impl_hyperloglog_sparse_add(to, index, rank);
+            }
+        }
+        return;
+    }
+
+    if (!to->ghost_impl_dense)
+        ghost_impl_hyperloglog_densify(to);
+    for (i = 0; i < count; ++i)
+        if (to->ghost_impl_registers[i] < from->ghost_impl_registers[i])
+            to->ghost_impl_registers[i] = from->ghost_impl_registers[i];
+}
+
+#if ghost_has(ghost_double) && ghost_has(ghost_sqrt_d)
+ghost_impl_always_inline
+double ghost_impl_hyperloglog_sigma(double x) {
+    double y = 1.0;
+    double z = x;
+    double previous;
+    do {
+        x *= x;
+        previous = z;
+        z += x * y;
+        y += y;
+    } while (z != previous);
+    return z;
+}
+
+ghost_impl_always_inline
+double ghost_impl_hyperloglog_tau(double x) {
+    double y = 1.0;
+    double z;
+    double previous;
+    if (x == 0.0 || x == 1.0)
+        return 0.0;
+    z = 1.0 - x;
+    do {
+        x = ghost_sqrt_d(x);
+        previous = z;
+        y *= 0.5;
+        z -= (1.0 - x) * (1.0 - x) * y;
+    } while (z != previous);
+    return z / 3.0;
+}
+
+ghost_impl_noinline
+double ghost_impl_hyperloglog_estimate(const ghost_hyperloglog_t* hll) {
+    ghost_size_t counts[66];
+    ghost_size_t m = ghost_static_cast(ghost_size_t, 1) << hll->ghost_impl_precision;
+    ghost_size_t q = 64 - ghost_static_cast(ghost_size_t, hll->ghost_impl_precision);
+    double dm = ghost_static_cast(double, m);
+    double z;
+    ghost_size_t k;
+
+    for (k = 0; k < 66; ++k)
+        counts[k] = 0;
+    if (hll->ghost_impl_dense) {
+        for (k = 0; k < m; ++k)
+            ++counts[hll->ghost_impl_registers[k]];
+    } else {
+        ghost_size_t position = 0;
+        ghost_size_t next = 0;
+        counts[0] = m;
+        while (position < hll->ghost_impl_sparse_length) {
+            unsigned char rank;
+            next = ghost_impl_hyperloglog_sparse_decode(hll->ghost_impl_registers,
+                    &position, next, &rank) + 1;
+            --counts[0];
+            ++counts[rank];
+        }
+    }
+    if (counts[0] == m)
+        return 0.0;
+
+    z = dm * ghost_impl_hyperloglog_tau(1.0 - ghost_static_cast(double, counts[q + 1]) / dm);
+    for (k = q; k >= 1; --k)
+        z = 0.5 * (z + ghost_static_cast(double, counts[k]));
+    z += dm * ghost_impl_hyperloglog_sigma(ghost_static_cast(double, counts[0]) / dm);
+
+    /* 1 / (2 ln 2) */
+    return 0.72134752044448170368 * dm * dm / z;
+}
+#endif
+
+GHOST_IMPL_FUNCTION_CLOSE
+
+#endif
@@ -0,0 +1,90 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_IMPL_SWAR_H_INCLUDED
+#define GHOST_IMPL_SWAR_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+/*
+ * Helpers for scanning memory a word at a time ("SIMD within a register").
+ *
+ * The fallbacks of the string functions use these when there is no builtin
+ * or libc function to call. They scan bytes up to a word boundary and then
+ * read whole aligned words, testing each for a zero or matching byte with the
+ * has-zero-byte trick. Then they scan the bytes of the final word to find the
+ * exact position.
+ *
+ * An aligned word never crosses a page boundary, so this never faults even
+ * when it reads a few bytes past the end of a string. These reads are
+ * harmless but AddressSanitizer reports them, so the functions that use this
+ * are declared GHOST_IMPL_SWAR_NO_SANITIZE.
+ *
+ * GHOST_IMPL_SWAR is 0 if this isn't supported (e.g. if char is not 8 bits.)
+ * In this case the fallbacks scan a byte at a time.
+ */
+
+#ifndef GHOST_IMPL_SWAR
+    #include "ghost/type/char/ghost_char_width.h"
+    #include "ghost/type/size_t/ghost_size_t.h"
+    #include "ghost/type/uintptr_t/ghost_uintptr_t.h"
+    #if !ghost_has(GHOST_CHAR_WIDTH) || !ghost_has(ghost_size_t) || !ghost_has(ghost_uintptr_t)
+        #define GHOST_IMPL_SWAR 0
+    #elif GHOST_CHAR_WIDTH != 8
+        #define GHOST_IMPL_SWAR 0
+    #else
+        #define GHOST_IMPL_SWAR 1
+    #endif
+#endif
+
+#if GHOST_IMPL_SWAR
+    #include "ghost/language/ghost_may_alias.h"
+    #include "ghost/language/ghost_reinterpret_cast.h"
+    #include "ghost/language/ghost_static_cast.h"
+
+    /* The word type. may_alias allows us to read char arrays through it. */
+    typedef ghost_size_t ghost_may_alias ghost_impl_swar_t;
+
+    /* 0x0101...01 and 0x8080...80 */
+    #define GHOST_IMPL_SWAR_ONES (~ghost_static_cast(ghost_impl_swar_t, 0) / 0xFF)
+    #define GHOST_IMPL_SWAR_HIGHS (GHOST_IMPL_SWAR_ONES << 7)
+
+    /* Non-zero if any byte of the word is zero. This is exact: borrows only
+     * propagate above a zero byte so there are no false positives. */
+    #define GHOST_IMPL_SWAR_HAS_ZERO(word) \
+        ((((word) - GHOST_IMPL_SWAR_ONES) & ~(word) & GHOST_IMPL_SWAR_HIGHS) != 0)
+
+    /* A word with every byte set to the given byte value. XOR a word with
+     * this to turn matching bytes into zero bytes. */
+    #define GHOST_IMPL_SWAR_BROADCAST(byte) \
+        (GHOST_IMPL_SWAR_ONES * ghost_static_cast(ghost_impl_swar_t, ghost_static_cast(unsigned char, (byte))))
+
+    #define GHOST_IMPL_SWAR_IS_ALIGNED(p) \
+        (ghost_reinterpret_cast(ghost_uintptr_t, (p)) % sizeof(ghost_impl_swar_t) == 0)
+
+    #if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+        #define GHOST_IMPL_SWAR_NO_SANITIZE __attribute__((__no_sanitize_address__))
+    #else
+        #define GHOST_IMPL_SWAR_NO_SANITIZE /*nothing*/
+    #endif
+#endif
+
+#endif
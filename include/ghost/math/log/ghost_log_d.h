@@ -0,0 +1,103 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GHOST_LOG_D_H_INCLUDED
+#define GHOST_LOG_D_H_INCLUDED
+
+#include "ghost/ghost_core.h"
+
+#if GHOST_DOCUMENTATION
+/**
+ * Returns the natural logarithm of the given double.
+ */
+double ghost_log_d(double);
+#endif
+
+/* Allow override */
+#ifndef ghost_has_ghost_log_d
+    #ifdef ghost_log_d
+        #define ghost_has_ghost_log_d 1
+    #endif
+#endif
+
+/* We need double. */
+#ifndef ghost_has_ghost_log_d
+    #include "ghost/type/double/ghost_double.h"
+    #if !ghost_has(ghost_double)
+        #define ghost_has_ghost_log_d 0
+    #endif
+#endif
+
+/* log() has the same overloading and type-generic problems as sqrt(). See
+ * ghost_sqrt_d() for details. We always wrap it so that our function only
+ * takes doubles. */
+
+/* First figure out whether we have the builtin */
+#ifdef GHOST_IMPL_LOG_D_BUILTIN
+    #error
+#endif
+#ifndef ghost_has_ghost_log_d
+    #include "ghost/preprocessor/ghost_has_builtin.h"
+    #if ghost_has(ghost_has_builtin)
+        #if __has_builtin(__builtin_log)
+            #define GHOST_IMPL_LOG_D_BUILTIN
+        #endif
+    #else
+        #include "ghost/detect/ghost_gcc.h"
+        #if GHOST_GCC
+            /* Assume GCC has this. */
+            #define GHOST_IMPL_LOG_D_BUILTIN
+        #endif
+    #endif
+#endif
+
+/* Require <math.h> if we don't have the builtin. */
+#ifndef ghost_has_ghost_log_d
+    #ifndef GHOST_IMPL_LOG_D_BUILTIN
+        #include "ghost/header/c/ghost_math_h.h"
+        #if !ghost_has(ghost_math_h)
+            #define ghost_has_ghost_log_d 0
+        #endif
+    #endif
+#endif
+
+/* Define our wrapper */
+#ifndef ghost_has_ghost_log_d
+    #include "ghost/impl/ghost_impl_always_inline.h"
+    GHOST_IMPL_FUNCTION_OPEN
+    ghost_impl_always_inline
+    double ghost_log_d(double ghost_impl_v_x) {
+        /* No casts here. This should take and return double. */
+        #ifdef GHOST_IMPL_LOG_D_BUILTIN
+            return __builtin_log(ghost_impl_v_x);
+        #elif defined(__cplusplus)
+            return ::std::log(ghost_impl_v_x);
+        #else
+            return log(ghost_impl_v_x);
+        #endif
+    }
+    GHOST_IMPL_FUNCTION_CLOSE
+    #define ghost_has_ghost_log_d 1
+#endif
+
+#undef GHOST_IMPL_LOG_D_BUILTIN
+
+#endif
@@ -80,23 +80,53 @@ void* ghost_memchr(const void* s, int c, size_t n);
     #endif
 #endif
 
-/* Otherwise we define our own. We don't bother with the C++ overloads. */
+/* Otherwise we define our own. We don't bother with the C++ overloads. This
+ * scans a word at a time if possible.
+ *
+ * Like the standard function, this stops at the first match so the memory
+ * only needs to be readable up to there. (The word-at-a-time loop may read
+ * up to the end of the word containing it.) */
 #ifndef ghost_has_ghost_memchr
     #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/string/ghost_impl_swar.h"
     #include "ghost/type/size_t/ghost_size_t.h"
     #include "ghost/language/ghost_null.h"
     #include "ghost/language/ghost_static_cast.h"
     #include "ghost/language/ghost_const_cast.h"
     GHOST_IMPL_FUNCTION_OPEN
-    ghost_impl_function
-    void* ghost_memchr(const void* vdata, int c, ghost_size_t count) GHOST_IMPL_DEF({
-        const char* data = ghost_static_cast(const char*, vdata);
-        ghost_size_t i;
-        for (i = 0; i < count; ++i)
-            if (data[i] == c)
-                return ghost_const_cast(char*, data + i);
-        return ghost_null;
-    })
+    #if GHOST_IMPL_SWAR
+        GHOST_IMPL_SWAR_NO_SANITIZE
+        ghost_impl_function
+        void* ghost_memchr(const void* vdata, int c, ghost_size_t count) GHOST_IMPL_DEF({
+            const unsigned char* data = ghost_static_cast(const unsigned char*, vdata);
+            unsigned char uc = ghost_static_cast(unsigned char, c);
+            ghost_impl_swar_t pattern = GHOST_IMPL_SWAR_BROADCAST(uc);
+            const ghost_impl_swar_t* word;
+            for (; count != 0 && !GHOST_IMPL_SWAR_IS_ALIGNED(data); ++data, --count)
+                if (*data == uc)
+                    return ghost_const_cast(unsigned char*, data);
+            word = ghost_reinterpret_cast(const ghost_impl_swar_t*, data);
+            for (; count >= sizeof(ghost_impl_swar_t); ++word, count -= sizeof(ghost_impl_swar_t))
+                if (GHOST_IMPL_SWAR_HAS_ZERO(*word ^ pattern))
+                    break;
+            data = ghost_reinterpret_cast(const unsigned char*, word);
+            for (; count != 0; ++data, --count)
+                if (*data == uc)
+                    return ghost_const_cast(unsigned char*, data);
+            return ghost_null;
+        })
+    #else
+        ghost_impl_function
+        void* ghost_memchr(const void* vdata, int c, ghost_size_t count) GHOST_IMPL_DEF({
+            const unsigned char* data = ghost_static_cast(const unsigned char*, vdata);
+            unsigned char uc = ghost_static_cast(unsigned char, c);
+            ghost_size_t i;
+            for (i = 0; i < count; ++i)
+                if (data[i] == uc)
+                    return ghost_const_cast(unsigned char*, data + i);
+            return ghost_null;
+        })
+    #endif
     GHOST_IMPL_FUNCTION_CLOSE
     #define ghost_has_ghost_memchr 1
 #endif
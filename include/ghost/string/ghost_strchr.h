@@ -68,25 +68,51 @@ char* ghost_strchr(const char* s, int c);
     #endif
 #endif
 
-/* Otherwise we define our own. We don't bother with the C++ overloads. */
+/* Otherwise we define our own. We don't bother with the C++ overloads. This
+ * scans a word at a time if possible. */
 #ifndef ghost_has_ghost_strchr
     #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/string/ghost_impl_swar.h"
     #include "ghost/type/size_t/ghost_size_t.h"
     #include "ghost/language/ghost_null.h"
     #include "ghost/language/ghost_static_cast.h"
     #include "ghost/language/ghost_const_cast.h"
     GHOST_IMPL_FUNCTION_OPEN
-    ghost_impl_function
-    char* ghost_strchr(const char* s, int c) GHOST_IMPL_DEF({
-        for (;;) {
-            if (*s == c)
-                return ghost_const_cast(char*, s);
-            if (*s != '\000')
-                break;
-            ++s;
-        }
-        return ghost_null;
-    })
+    #if GHOST_IMPL_SWAR
+        GHOST_IMPL_SWAR_NO_SANITIZE
+        ghost_impl_function
+        char* ghost_strchr(const char* s, int c) GHOST_IMPL_DEF({
+            char ch = ghost_static_cast(char, c);
+            ghost_impl_swar_t pattern = GHOST_IMPL_SWAR_BROADCAST(c);
+            const ghost_impl_swar_t* word;
+            for (; !GHOST_IMPL_SWAR_IS_ALIGNED(s); ++s) {
+                if (*s == ch)
+                    return ghost_const_cast(char*, s);
+                if (*s == '\000')
+                    return ghost_null;
+            }
+            word = ghost_reinterpret_cast(const ghost_impl_swar_t*, s);
+            while (!GHOST_IMPL_SWAR_HAS_ZERO(*word) && !GHOST_IMPL_SWAR_HAS_ZERO(*word ^ pattern))
+                ++word;
+            for (s = ghost_reinterpret_cast(const char*, word);; ++s) {
+                if (*s == ch)
+                    return ghost_const_cast(char*, s);
+                if (*s == '\000')
+                    return ghost_null;
+            }
+        })
+    #else
+        ghost_impl_function
+        char* ghost_strchr(const char* s, int c) GHOST_IMPL_DEF({
+            char ch = ghost_static_cast(char, c);
+            for (;; ++s) {
+                if (*s == ch)
+                    return ghost_const_cast(char*, s);
+                if (*s == '\000')
+                    return ghost_null;
+            }
+        })
+    #endif
     GHOST_IMPL_FUNCTION_CLOSE
     #define ghost_has_ghost_strchr 1
 #endif
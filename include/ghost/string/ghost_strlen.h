@@ -66,19 +66,39 @@ size_t ghost_strlen(const char* s);
     #endif
 #endif
 
-/* Otherwise define a slow but small fallback. */
-#ifndef ghost_strlen
+/* Otherwise define a fallback. This scans a word at a time if possible. */
+#ifndef ghost_has_ghost_strlen
     #include "ghost/language/ghost_static_cast.h"
     #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/string/ghost_impl_swar.h"
     #include "ghost/type/size_t/ghost_size_t.h"
     GHOST_IMPL_FUNCTION_OPEN
-    ghost_impl_function
-    ghost_size_t ghost_strlen(const char* s) GHOST_IMPL_DEF({
-        const char* end = s;
-        while (*end != '\000')
-            ++end;
-        return ghost_static_cast(ghost_size_t, end - s);
-    })
+    #if GHOST_IMPL_SWAR
+        GHOST_IMPL_SWAR_NO_SANITIZE
+        ghost_impl_function
+        ghost_size_t ghost_strlen(const char* s) GHOST_IMPL_DEF({
+            const char* end = s;
+            const ghost_impl_swar_t* word;
+            for (; !GHOST_IMPL_SWAR_IS_ALIGNED(end); ++end)
+                if (*end == '\000')
+                    return ghost_static_cast(ghost_size_t, end - s);
+            word = ghost_reinterpret_cast(const ghost_impl_swar_t*, end);
+            while (!GHOST_IMPL_SWAR_HAS_ZERO(*word))
+                ++word;
+            end = ghost_reinterpret_cast(const char*, word);
+            while (*end != '\000')
+                ++end;
+            return ghost_static_cast(ghost_size_t, end - s);
+        })
+    #else
+        ghost_impl_function
+        ghost_size_t ghost_strlen(const char* s) GHOST_IMPL_DEF({
+            const char* end = s;
+            while (*end != '\000')
+                ++end;
+            return ghost_static_cast(ghost_size_t, end - s);
+        })
+    #endif
     GHOST_IMPL_FUNCTION_CLOSE
     #define ghost_has_ghost_strlen 1
 #endif
@@ -108,20 +108,41 @@ size_t ghost_strnlen(const char* s, size_t maxlen);
 
 /* TODO we should try to detect POSIX support here, it's in POSIX 2008. */
 
-/* Otherwise define a slow but small fallback. */
+/* Otherwise define a fallback. This scans a word at a time if possible. */
 #ifndef ghost_has_ghost_strnlen
     #include "ghost/language/ghost_static_cast.h"
     #include "ghost/impl/ghost_impl_function.h"
+    #include "ghost/impl/string/ghost_impl_swar.h"
     #include "ghost/type/size_t/ghost_size_t.h"
     GHOST_IMPL_FUNCTION_OPEN
-    ghost_impl_function
-    ghost_size_t ghost_strnlen(const char* s, ghost_size_t maxlen) GHOST_IMPL_DEF({
-        const char* maxend = s + maxlen;
-        const char* end = s;
-        while (end != maxend && *end != '\000')
-            ++end;
-        return ghost_static_cast(ghost_size_t, end - s);
-    })
+    #if GHOST_IMPL_SWAR
+        GHOST_IMPL_SWAR_NO_SANITIZE
+        ghost_impl_function
+        ghost_size_t ghost_strnlen(const char* s, ghost_size_t maxlen) GHOST_IMPL_DEF({
+            const char* end = s;
+            const ghost_impl_swar_t* word;
+            for (; maxlen != 0 && !GHOST_IMPL_SWAR_IS_ALIGNED(end); ++end, --maxlen)
+                if (*end == '\000')
+                    return ghost_static_cast(ghost_size_t, end - s);
+            word = ghost_reinterpret_cast(const ghost_impl_swar_t*, end);
+            for (; maxlen >= sizeof(ghost_impl_swar_t); ++word, maxlen -= sizeof(ghost_impl_swar_t))
+                if (GHOST_IMPL_SWAR_HAS_ZERO(*word))
+                    break;
+            end = ghost_reinterpret_cast(const char*, word);
+            for (; maxlen != 0 && *end != '\000'; ++end, --maxlen)
+                {}
+            return ghost_static_cast(ghost_size_t, end - s);
+        })
+    #else
+        ghost_impl_function
+        ghost_size_t ghost_strnlen(const char* s, ghost_size_t maxlen) GHOST_IMPL_DEF({
+            const char* maxend = s + maxlen;
+            const char* end = s;
+            while (end != maxend && *end != '\000')
+                ++end;
+            return ghost_static_cast(ghost_size_t, end - s);
+        })
+    #endif
     GHOST_IMPL_FUNCTION_CLOSE
     #define ghost_has_ghost_strnlen 1
 #endif
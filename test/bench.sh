@@ -0,0 +1,35 @@
+#!/bin/sh
+
+# MIT No Attribution
+#
+# Copyright (c) 2023 Fraser Heavy Software
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+# Builds and runs the sort benchmark, printing CSV results to stdout.
+# Set CC and CFLAGS before calling this to use a different compiler or flags.
+# Arguments are passed to the benchmark: [count [repeats]]
+#
+# Save the output of each Ghost release to compare them, e.g.:
+#
+#     test/bench.sh 1000000 > bench-before.csv
+
+set -e
+cd "$(dirname "$0")/.."
+BUILD=test/.build/bench
+mkdir -p $BUILD
+${CC:-cc} ${CFLAGS:--O2} -Iinclude -o $BUILD/bench_sort test/bench/src/*.c
+$BUILD/bench_sort "$@"
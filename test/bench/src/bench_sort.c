@@ -0,0 +1,338 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/*
+ * Benchmarks Ghost's sort functions against the platform's qsort() and
+ * qsort_r() on a range of element sizes and input distributions.
+ *
+ * Usage: bench_sort [count [repeats]]
+ *
+ * Results are printed to stdout as CSV with one row per combination of sort
+ * function, element size and distribution. The time is the fastest of all
+ * repeats in seconds. Comparisons and swaps are counted on the first repeat
+ * (they are the same for every repeat since the input is the same.) Swaps
+ * can only be counted in Ghost's internal sorts so the column is left empty
+ * for platform sorts.
+ */
+
+#include "bench_sort.h"
+
+/* We include these without forcing the internal sort so that we can detect
+ * the platform's qsort_r(). */
+#include "ghost/impl/algorithm/qsort/ghost_impl_ex_gnu_qsort_r.h"
+#include "ghost/impl/algorithm/qsort/ghost_impl_ex_bsd_qsort_r.h"
+#include "ghost/type/uint32_t/ghost_uint32_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+unsigned long bench_compare_count;
+unsigned long bench_swap_count;
+
+
+
+/*
+ * Element types
+ *
+ * Every element starts with its key. The rest is padding which is filled with
+ * a copy of the key to make sure the sort moves whole elements.
+ */
+
+typedef struct bench_element_16_t {
+    ghost_uint64_t key;
+    ghost_uint64_t payload;
+} bench_element_16_t;
+
+typedef struct bench_element_64_t {
+    ghost_uint64_t key;
+    ghost_uint64_t payload[7];
+} bench_element_64_t;
+
+#define BENCH_DEFINE_COMPARE(name, type, key_type, key) \
+    static int name(const void* vleft, const void* vright) { \
+        key_type left = ((const type*)vleft)key; \
+        key_type right = ((const type*)vright)key; \
+        ++bench_compare_count; \
+        return (left < right) ? -1 : (left > right) ? 1 : 0; \
+    } \
+    static int name##_gnu(const void* left, const void* right, void* context) { \
+        (void)context; \
+        return name(left, right); \
+    } \
+    static int name##_bsd(void* context, const void* left, const void* right) { \
+        (void)context; \
+        return name(left, right); \
+    }
+
+BENCH_DEFINE_COMPARE(bench_compare_4, ghost_uint32_t, ghost_uint32_t, [0])
+BENCH_DEFINE_COMPARE(bench_compare_8, ghost_uint64_t, ghost_uint64_t, [0])
+BENCH_DEFINE_COMPARE(bench_compare_16, bench_element_16_t, ghost_uint64_t, ->key)
+BENCH_DEFINE_COMPARE(bench_compare_64, bench_element_64_t, ghost_uint64_t, ->key)
+
+typedef struct bench_type_t {
+    size_t element_size;
+    bench_compare_t compare;
+    bench_compare_r_t compare_gnu;
+    int (*compare_bsd)(void* context, const void* left, const void* right);
+} bench_type_t;
+
+static const bench_type_t bench_types[] = {
+    {4, bench_compare_4, bench_compare_4_gnu, bench_compare_4_bsd},
+    {8, bench_compare_8, bench_compare_8_gnu, bench_compare_8_bsd},
+    {sizeof(bench_element_16_t), bench_compare_16, bench_compare_16_gnu, bench_compare_16_bsd},
+    {sizeof(bench_element_64_t), bench_compare_64, bench_compare_64_gnu, bench_compare_64_bsd},
+};
+
+static ghost_uint64_t bench_get_key(const bench_type_t* type, const void* element) {
+    if (type->element_size == 4)
+        return *(const ghost_uint32_t*)element;
+    return *(const ghost_uint64_t*)element;
+}
+
+static void bench_set_key(const bench_type_t* type, void* element, ghost_uint64_t key) {
+    size_t i;
+    if (type->element_size == 4) {
+        *(ghost_uint32_t*)element = (ghost_uint32_t)key;
+        return;
+    }
+    for (i = 0; i < type->element_size / sizeof(ghost_uint64_t); ++i)
+        ((ghost_uint64_t*)element)[i] = key;
+}
+
+
+
+/*
+ * Sort functions
+ */
+
+typedef void (*bench_sort_t)(void* first, size_t count, const bench_type_t* type);
+
+static void bench_sort_ghost_qsort(void* first, size_t count, const bench_type_t* type) {
+    bench_ghost_qsort(first, count, type->element_size, type->compare);
+}
+
+static void bench_sort_ghost_gnu_qsort_r(void* first, size_t count, const bench_type_t* type) {
+    bench_ghost_gnu_qsort_r(first, count, type->element_size, type->compare_gnu, NULL);
+}
+
+static void bench_sort_ghost_shellsort(void* first, size_t count, const bench_type_t* type) {
+    bench_ghost_shellsort(first, count, type->element_size, type->compare_gnu, NULL);
+}
+
+static void bench_sort_platform_qsort(void* first, size_t count, const bench_type_t* type) {
+    qsort(first, count, type->element_size, type->compare);
+}
+
+#if ghost_has_ghost_impl_ex_gnu_qsort_r
+static void bench_sort_platform_qsort_r(void* first, size_t count, const bench_type_t* type) {
+    ghost_impl_ex_gnu_qsort_r(first, count, type->element_size, type->compare_gnu, NULL);
+}
+#elif ghost_has_ghost_impl_ex_bsd_qsort_r
+static void bench_sort_platform_qsort_r(void* first, size_t count, const bench_type_t* type) {
+    ghost_impl_ex_bsd_qsort_r(first, count, type->element_size, NULL, type->compare_bsd);
+}
+#endif
+
+typedef struct bench_algorithm_t {
+    const char* name;
+    bench_sort_t sort;
+    int counts_swaps;
+} bench_algorithm_t;
+
+static const bench_algorithm_t bench_algorithms[] = {
+    {"ghost_qsort", bench_sort_ghost_qsort, 1},
+    {"ghost_gnu_qsort_r", bench_sort_ghost_gnu_qsort_r, 1},
+    {"ghost_shellsort", bench_sort_ghost_shellsort, 1},
+    {"qsort", bench_sort_platform_qsort, 0},
+    #if ghost_has_ghost_impl_ex_gnu_qsort_r || ghost_has_ghost_impl_ex_bsd_qsort_r
+    {"qsort_r", bench_sort_platform_qsort_r, 0},
+    #endif
+};
+
+
+
+/*
+ * Distributions
+ */
+
+static ghost_uint64_t bench_random_state;
+
+/* splitmix64 */
+static ghost_uint64_t bench_random(void) {
+    ghost_uint64_t z = (bench_random_state += GHOST_UINT64_C(0x9E3779B97F4A7C15));
+    z = (z ^ (z >> 30)) * GHOST_UINT64_C(0xBF58476D1CE4E5B9);
+    z = (z ^ (z >> 27)) * GHOST_UINT64_C(0x94D049BB133111EB);
+    return z ^ (z >> 31);
+}
+
+typedef ghost_uint64_t (*bench_distribution_t)(size_t index, size_t count);
+
+static ghost_uint64_t bench_distribution_random(size_t index, size_t count) {
+    (void)index;
+    (void)count;
+    return bench_random() >> 32;
+}
+
+static ghost_uint64_t bench_distribution_sorted(size_t index, size_t count) {
+    (void)count;
+    return index;
+}
+
+static ghost_uint64_t bench_distribution_reversed(size_t index, size_t count) {
+    return count - index;
+}
+
+static ghost_uint64_t bench_distribution_few_unique(size_t index, size_t count) {
+    (void)index;
+    (void)count;
+    return bench_random() % 8;
+}
+
+static ghost_uint64_t bench_distribution_organ_pipe(size_t index, size_t count) {
+    return (index < count / 2) ? index : count - index;
+}
+
+static ghost_uint64_t bench_distribution_sawtooth(size_t index, size_t count) {
+    return index % (count / 8 + 1);
+}
+
+typedef struct bench_named_distribution_t {
+    const char* name;
+    bench_distribution_t distribution;
+} bench_named_distribution_t;
+
+static const bench_named_distribution_t bench_distributions[] = {
+    {"random", bench_distribution_random},
+    {"sorted", bench_distribution_sorted},
+    {"reversed", bench_distribution_reversed},
+    {"few_unique", bench_distribution_few_unique},
+    {"organ_pipe", bench_distribution_organ_pipe},
+    {"sawtooth", bench_distribution_sawtooth},
+};
+
+#define BENCH_COUNT_OF(array) (sizeof(array) / sizeof(*(array)))
+
+
+
+/*
+ * Benchmark
+ */
+
+static int bench_run(const bench_algorithm_t* algorithm, const bench_type_t* type,
+        const bench_named_distribution_t* distribution,
+        const char* input, char* work, size_t count, int repeats)
+{
+    double best = 0;
+    unsigned long compares = 0;
+    unsigned long swaps = 0;
+    size_t size = type->element_size;
+    size_t i;
+    int repeat;
+
+    for (repeat = 0; repeat < repeats; ++repeat) {
+        clock_t start;
+        double seconds;
+
+        memcpy(work, input, count * size);
+        bench_compare_count = 0;
+        bench_swap_count = 0;
+        start = clock();
+        algorithm->sort(work, count, type);
+        seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        if (repeat == 0) {
+            compares = bench_compare_count;
+            swaps = bench_swap_count;
+            best = seconds;
+        } else if (seconds < best) {
+            best = seconds;
+        }
+    }
+
+    for (i = 1; i < count; ++i) {
+        if (bench_get_key(type, work + (i - 1) * size) > bench_get_key(type, work + i * size)) {
+            fprintf(stderr, "%s failed to sort %s input of element size %lu!\n",
+                    algorithm->name, distribution->name, (unsigned long)size);
+            return 0;
+        }
+    }
+
+    printf("%s,%lu,%s,%lu,%f,%lu,", algorithm->name, (unsigned long)size,
+            distribution->name, (unsigned long)count, best, compares);
+    if (algorithm->counts_swaps)
+        printf("%lu", swaps);
+    printf("\n");
+    fflush(stdout);
+    return 1;
+}
+
+int main(int argc, char** argv) {
+    size_t count = 100000;
+    int repeats = 5;
+    size_t t, d, a, i;
+
+    if (argc > 3) {
+        fprintf(stderr, "Usage: %s [count [repeats]]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc > 1)
+        count = (size_t)strtoul(argv[1], NULL, 10);
+    if (argc > 2)
+        repeats = atoi(argv[2]);
+    if (count == 0 || repeats <= 0) {
+        fprintf(stderr, "Count and repeats must be positive.\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("algorithm,element_size,distribution,count,seconds,comparisons,swaps\n");
+
+    for (t = 0; t < BENCH_COUNT_OF(bench_types); ++t) {
+        const bench_type_t* type = &bench_types[t];
+        char* input = (char*)malloc(count * type->element_size);
+        char* work = (char*)malloc(count * type->element_size);
+        if (input == NULL || work == NULL) {
+            fprintf(stderr, "Out of memory!\n");
+            return EXIT_FAILURE;
+        }
+
+        for (d = 0; d < BENCH_COUNT_OF(bench_distributions); ++d) {
+            const bench_named_distribution_t* distribution = &bench_distributions[d];
+            bench_random_state = 0;
+            for (i = 0; i < count; ++i)
+                bench_set_key(type, input + i * type->element_size,
+                        distribution->distribution(i, count));
+
+            for (a = 0; a < BENCH_COUNT_OF(bench_algorithms); ++a)
+                if (!bench_run(&bench_algorithms[a], type, distribution,
+                            input, work, count, repeats))
+                    return EXIT_FAILURE;
+        }
+
+        free(input);
+        free(work);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef BENCH_SORT_H
+#define BENCH_SORT_H
+
+/*
+ * Declarations shared between the translation units of the sort benchmark.
+ *
+ * Ghost's internal sort is compiled twice: once normally (introsort) and once
+ * with GHOST_OPTIMIZE_FOR_SIZE_OPT forced on (shellsort.) Each translation
+ * unit uses GHOST_STATIC_DEFS so that the two builds of the same Ghost
+ * functions don't collide at link time.
+ */
+
+#include <stddef.h>
+
+/* The number of calls to the compare function */
+extern unsigned long bench_compare_count;
+
+/* The number of element swaps (only counted in Ghost's internal sorts) */
+extern unsigned long bench_swap_count;
+
+typedef int (*bench_compare_t)(const void* left, const void* right);
+typedef int (*bench_compare_r_t)(const void* left, const void* right, void* context);
+
+/* bench_sort_ghost.c */
+void bench_ghost_qsort(void* first, size_t count, size_t element_size,
+        bench_compare_t compare);
+void bench_ghost_gnu_qsort_r(void* first, size_t count, size_t element_size,
+        bench_compare_r_t compare, void* context);
+
+/* bench_sort_shellsort.c */
+void bench_ghost_shellsort(void* first, size_t count, size_t element_size,
+        bench_compare_r_t compare, void* context);
+
+#endif
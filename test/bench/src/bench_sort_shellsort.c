@@ -0,0 +1,44 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/*
+ * Ghost's internal shellsort, as used by ghost_qsort() when optimizing for
+ * size. We force it on here regardless of the compiler flags.
+ */
+
+#define GHOST_STATIC_DEFS 1
+#define GHOST_QSORT_FORCE_INTERNAL 1
+#define GHOST_OPTIMIZE_FOR_SIZE_OPT 1
+#define GHOST_IMPL_QSORT_SWAP_HOOK(count) (bench_swap_count += (unsigned long)(count))
+
+#include "bench_sort.h"
+
+#include "ghost/algorithm/qsort/ghost_gnu_qsort_r.h"
+
+#if !ghost_has_ghost_gnu_qsort_r
+    #error "Ghost's internal qsort is required."
+#endif
+
+void bench_ghost_shellsort(void* first, size_t count, size_t element_size,
+        bench_compare_r_t compare, void* context)
+{
+    ghost_gnu_qsort_r(first, count, element_size, compare, context);
+}
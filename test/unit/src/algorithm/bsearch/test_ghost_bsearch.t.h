@@ -0,0 +1,118 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * This template generates bsearch test functions for a given variant. The test
+ * must define one of the following macros:
+ *
+ * - TEST_GHOST_BSEARCH_GNU
+ * - TEST_GHOST_BSEARCH_BSD
+ * - TEST_GHOST_BSEARCH_C11
+ * - TEST_GHOST_BSEARCH_WIN
+ * - TEST_GHOST_BSEARCH
+ */
+
+#include "test_common.h"
+
+#include "ghost/language/ghost_array_count.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/language/ghost_discard.h"
+#include "ghost/language/ghost_null.h"
+
+static int s_context = 7;
+
+#if defined(TEST_GHOST_BSEARCH_GNU) || defined(TEST_GHOST_BSEARCH_C11)
+static int mycompare(const void* pkey, const void* pelement, void* context)
+#elif defined(TEST_GHOST_BSEARCH_BSD) || defined(TEST_GHOST_BSEARCH_WIN)
+static int mycompare(void* context, const void* pkey, const void* pelement)
+#elif defined(TEST_GHOST_BSEARCH)
+static int mycompare(const void* pkey, const void* pelement)
+#else
+    #error
+#endif
+{
+    int key;
+    int element;
+    #ifdef TEST_GHOST_BSEARCH
+    ghost_discard(s_context);
+    #else
+    mirror_check(context == &s_context);
+    #endif
+    key = *ghost_static_cast(const int*, pkey);
+    element = *ghost_static_cast(const int*, pelement);
+    return (key < element) ? -1 : (key > element) ? 1 : 0;
+}
+
+#if defined(TEST_GHOST_BSEARCH_GNU)
+    #define TEST_BSEARCH(key, array, count) ghost_gnu_bsearch_r(key, array, count, sizeof(int), &mycompare, &s_context)
+#elif defined(TEST_GHOST_BSEARCH_BSD)
+    #define TEST_BSEARCH(key, array, count) ghost_bsd_bsearch_r(key, array, count, sizeof(int), &s_context, &mycompare)
+#elif defined(TEST_GHOST_BSEARCH_WIN)
+    #define TEST_BSEARCH(key, array, count) ghost_win_bsearch_s(key, array, count, sizeof(int), &mycompare, &s_context)
+#elif defined(TEST_GHOST_BSEARCH_C11)
+    #define TEST_BSEARCH(key, array, count) ghost_c11_bsearch_s(key, array, count, sizeof(int), &mycompare, &s_context)
+#elif defined(TEST_GHOST_BSEARCH)
+    #define TEST_BSEARCH(key, array, count) ghost_bsearch(key, array, count, sizeof(int), &mycompare)
+#endif
+
+mirror() {
+    int values[] = {1, 2, 3, 4, 4, 4, 5, 7, 9};
+    int key;
+    for (key = 0; key <= 10; ++key) {
+        int* found = ghost_static_cast(int*, TEST_BSEARCH(&key, values, ghost_array_count(values)));
+        if (key == 0 || key == 6 || key == 8 || key == 10) {
+            mirror_check(found == ghost_null);
+        } else {
+            mirror_check(found != ghost_null);
+            mirror_eq_i(key, *found);
+            /* the first of equal elements is found */
+            mirror_check(found == values || found[-1] < key);
+        }
+    }
+}
+
+mirror() {
+    int values[1] = {5};
+    int key = 5;
+    mirror_check(TEST_BSEARCH(&key, values, 0) == ghost_null);
+    mirror_check(TEST_BSEARCH(&key, values, 1) == values);
+    key = 4;
+    mirror_check(TEST_BSEARCH(&key, values, 1) == ghost_null);
+}
+
+mirror() {
+    /* every size up to 100 with even values, searching for each even and odd key */
+    int values[100];
+    size_t count;
+    for (count = 0; count <= ghost_array_count(values); ++count) {
+        int key;
+        size_t i;
+        for (i = 0; i < count; ++i)
+            values[i] = ghost_static_cast(int, i * 2);
+        for (key = -1; key <= ghost_static_cast(int, count * 2); ++key) {
+            void* found = TEST_BSEARCH(&key, values, count);
+            if ((key & 1) || key < 0 || key >= ghost_static_cast(int, count * 2))
+                mirror_check(found == ghost_null);
+            else
+                mirror_check(found == &values[key / 2]);
+        }
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/cdc/ghost_cdc_init.h"
+
+#ifndef ghost_has_ghost_cdc_init
+    #error "ghost/algorithm/cdc/ghost_cdc_init.h must define ghost_has_ghost_cdc_init."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_cdc_init
+#include "ghost/algorithm/cdc/ghost_cdc_t.h"
+#include "ghost/algorithm/cdc/ghost_cdc_init.h"
+#include "ghost/algorithm/cdc/ghost_cdc_next_boundary.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+
+mirror() {
+    /* Equal sizes give fixed-size chunks. */
+    static const unsigned char bytes[100] = {1, 2, 3};
+    ghost_cdc_t cdc;
+    ghost_cdc_init(&cdc, 30, 30, 30);
+    mirror_eq_z(30, ghost_cdc_next_boundary(&cdc, bytes, 100));
+    mirror_eq_z(30, ghost_cdc_next_boundary(&cdc, bytes + 30, 70));
+    mirror_eq_z(30, ghost_cdc_next_boundary(&cdc, bytes + 60, 40));
+    mirror_eq_z(0, ghost_cdc_next_boundary(&cdc, bytes + 90, 10));
+
+    /* Initializing again restarts the stream. */
+    ghost_cdc_init(&cdc, 1, 1, 1);
+    mirror_eq_z(1, ghost_cdc_next_boundary(&cdc, bytes, 100));
+}
+#endif
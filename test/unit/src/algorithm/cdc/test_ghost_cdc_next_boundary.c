@@ -0,0 +1,174 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/cdc/ghost_cdc_next_boundary.h"
+
+#ifndef ghost_has_ghost_cdc_next_boundary
+    #error "ghost/algorithm/cdc/ghost_cdc_next_boundary.h must define ghost_has_ghost_cdc_next_boundary."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_cdc_next_boundary
+#include "ghost/algorithm/cdc/ghost_cdc_t.h"
+#include "ghost/algorithm/cdc/ghost_cdc_init.h"
+#include "ghost/algorithm/cdc/ghost_cdc_next_boundary.h"
+#include "ghost/algorithm/gear_hash/ghost_gear_hash_update.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+static unsigned char test_cdc_bytes[262144];
+
+static void test_cdc_fill(void) {
+    ghost_uint64_t x = GHOST_UINT64_C(0x0123456789ABCDEF);
+    size_t i;
+    for (i = 0; i < sizeof(test_cdc_bytes); ++i) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        test_cdc_bytes[i] = ghost_static_cast(unsigned char, x >> 56);
+    }
+}
+
+/* Collects the chunk boundaries (as offsets of chunk ends) of the given bytes
+ * fed in pieces of the given size. */
+static size_t test_cdc_boundaries(const unsigned char* bytes, size_t length, size_t piece,
+        size_t* boundaries, size_t max_boundaries)
+{
+    ghost_cdc_t cdc;
+    size_t count = 0;
+    size_t offset = 0;
+    ghost_cdc_init(&cdc, 256, 1024, 8192);
+    while (offset < length) {
+        size_t size = length - offset < piece ? length - offset : piece;
+        const unsigned char* p = bytes + offset;
+        size_t cut;
+        offset += size;
+        while ((cut = ghost_cdc_next_boundary(&cdc, p, size)) != 0) {
+            p += cut;
+            size -= cut;
+            if (count < max_boundaries)
+                boundaries[count] = offset - size;
+            ++count;
+        }
+    }
+    return count;
+}
+
+
+static size_t test_cdc_whole[512];
+static size_t test_cdc_pieces[512];
+
+mirror() {
+    /* Chunk sizes are within limits and average about 1 KiB. */
+    size_t count;
+    size_t i;
+    test_cdc_fill();
+    count = test_cdc_boundaries(test_cdc_bytes, sizeof(test_cdc_bytes), sizeof(test_cdc_bytes),
+            test_cdc_whole, 512);
+    mirror_check(count > 128 && count < 512);
+    for (i = 0; i < count && i < 512; ++i) {
+        size_t previous = i == 0 ? 0 : test_cdc_whole[i - 1];
+        mirror_check(test_cdc_whole[i] - previous >= 256);
+        mirror_check(test_cdc_whole[i] - previous <= 8192);
+    }
+}
+
+mirror() {
+    /* Boundaries don't depend on how the stream is split. */
+    static const size_t pieces[] = {1, 7, 64, 255, 256, 1000, 4096, 65537};
+    size_t count;
+    size_t i;
+    test_cdc_fill();
+    count = test_cdc_boundaries(test_cdc_bytes, sizeof(test_cdc_bytes), sizeof(test_cdc_bytes),
+            test_cdc_whole, 512);
+    for (i = 0; i < sizeof(pieces) / sizeof(*pieces); ++i) {
+        size_t j;
+        mirror_eq_z(count, test_cdc_boundaries(test_cdc_bytes, sizeof(test_cdc_bytes), pieces[i],
+                    test_cdc_pieces, 512));
+        for (j = 0; j < count && j < 512; ++j)
+            mirror_eq_z(test_cdc_whole[j], test_cdc_pieces[j]);
+    }
+}
+
+mirror() {
+    /* Data with no boundaries (all zeroes) is cut at the maximum size. */
+    static unsigned char zeroes[20000];
+    ghost_cdc_t cdc;
+    ghost_cdc_init(&cdc, 256, 1024, 8192);
+    mirror_eq_z(8192, ghost_cdc_next_boundary(&cdc, zeroes, sizeof(zeroes)));
+    mirror_eq_z(8192, ghost_cdc_next_boundary(&cdc, zeroes + 8192, sizeof(zeroes) - 8192));
+    mirror_eq_z(0, ghost_cdc_next_boundary(&cdc, zeroes + 16384, sizeof(zeroes) - 16384));
+    mirror_eq_z(0, ghost_cdc_next_boundary(&cdc, zeroes, 0));
+    mirror_eq_z(8192 - (sizeof(zeroes) - 16384), ghost_cdc_next_boundary(&cdc, zeroes, sizeof(zeroes)));
+}
+/* Finds the next boundary a byte at a time, the slow and obvious way. */
+static size_t test_cdc_reference(const ghost_cdc_t* cdc, const unsigned char* bytes, size_t length) {
+    ghost_uint64_t hash = 0;
+    size_t i;
+    for (i = cdc->ghost_impl_min; i < length && i < cdc->ghost_impl_max; ++i) {
+        hash = ghost_gear_hash_update(hash, bytes + i, 1);
+        if ((hash & (i < cdc->ghost_impl_avg ? cdc->ghost_impl_mask_small : cdc->ghost_impl_mask_large)) == 0)
+            return i + 1;
+    }
+    return i;
+}
+
+mirror() {
+    /* Boundaries match the reference with chunk sizes large enough that long
+     * runs are scanned in lanes. */
+    static const size_t sizes[][3] = {
+        {256, 1024, 8192},
+        {2048, 8192, 65536},
+        {64, 16384, 131072},
+        {4096, 65536, 262144},
+    };
+    static const size_t pieces[] = {sizeof(test_cdc_bytes), 1000, 65537};
+    size_t s;
+    test_cdc_fill();
+    for (s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        size_t i;
+        for (i = 0; i < sizeof(pieces) / sizeof(*pieces); ++i) {
+            ghost_cdc_t cdc;
+            ghost_cdc_t reference;
+            size_t offset = 0;
+            size_t expected = 0;
+            ghost_cdc_init(&cdc, sizes[s][0], sizes[s][1], sizes[s][2]);
+            ghost_cdc_init(&reference, sizes[s][0], sizes[s][1], sizes[s][2]);
+            while (offset < sizeof(test_cdc_bytes)) {
+                size_t size = sizeof(test_cdc_bytes) - offset < pieces[i] ?
+                        sizeof(test_cdc_bytes) - offset : pieces[i];
+                const unsigned char* p = test_cdc_bytes + offset;
+                size_t cut;
+                offset += size;
+                while ((cut = ghost_cdc_next_boundary(&cdc, p, size)) != 0) {
+                    size_t boundary = offset - size + cut;
+                    expected += test_cdc_reference(&reference, test_cdc_bytes + expected,
+                            sizeof(test_cdc_bytes) - expected);
+                    mirror_eq_z(expected, boundary);
+                    p += cut;
+                    size -= cut;
+                }
+            }
+        }
+    }
+}
+#endif
@@ -0,0 +1,109 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/cdc/ghost_cdc_t.h"
+
+#ifndef ghost_has_ghost_cdc_t
+    #error "ghost/algorithm/cdc/ghost_cdc_t.h must define ghost_has_ghost_cdc_t."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_cdc_t
+#include "ghost/algorithm/cdc/ghost_cdc_t.h"
+#include "ghost/algorithm/cdc/ghost_cdc_init.h"
+#include "ghost/algorithm/cdc/ghost_cdc_next_boundary.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "ghost/string/ghost_memcpy.h"
+
+static unsigned char test_cdc_bytes[131072];
+
+static void test_cdc_fill(void) {
+    ghost_uint64_t x = GHOST_UINT64_C(0x0123456789ABCDEF);
+    size_t i;
+    for (i = 0; i < sizeof(test_cdc_bytes); ++i) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        test_cdc_bytes[i] = ghost_static_cast(unsigned char, x >> 56);
+    }
+}
+
+/* Collects the chunk boundaries (as offsets of chunk ends) of the given bytes
+ * fed in pieces of the given size. */
+static size_t test_cdc_boundaries(const unsigned char* bytes, size_t length, size_t piece,
+        size_t* boundaries, size_t max_boundaries)
+{
+    ghost_cdc_t cdc;
+    size_t count = 0;
+    size_t offset = 0;
+    ghost_cdc_init(&cdc, 256, 1024, 8192);
+    while (offset < length) {
+        size_t size = length - offset < piece ? length - offset : piece;
+        const unsigned char* p = bytes + offset;
+        size_t cut;
+        offset += size;
+        while ((cut = ghost_cdc_next_boundary(&cdc, p, size)) != 0) {
+            p += cut;
+            size -= cut;
+            if (count < max_boundaries)
+                boundaries[count] = offset - size;
+            ++count;
+        }
+    }
+    return count;
+}
+
+
+static unsigned char test_cdc_edited[131072 + 10];
+static size_t test_cdc_before[512];
+static size_t test_cdc_after[512];
+
+mirror() {
+    /* Inserting bytes in the middle only changes the chunks around the edit.
+     * All later boundaries are shifted by the size of the insertion. */
+    size_t before_count;
+    size_t after_count;
+    size_t i;
+    size_t shared = 0;
+    test_cdc_fill();
+    ghost_memcpy(test_cdc_edited, test_cdc_bytes, 65536);
+    ghost_memcpy(test_cdc_edited + 65536, "0123456789", 10);
+    ghost_memcpy(test_cdc_edited + 65546, test_cdc_bytes + 65536, 65536);
+
+    before_count = test_cdc_boundaries(test_cdc_bytes, sizeof(test_cdc_bytes), 4096, test_cdc_before, 512);
+    after_count = test_cdc_boundaries(test_cdc_edited, sizeof(test_cdc_edited), 4096, test_cdc_after, 512);
+    mirror_check(before_count <= 512 && after_count <= 512);
+    if (before_count > 512 || after_count > 512)
+        return;
+
+    for (i = 0; i < before_count; ++i) {
+        size_t expected = test_cdc_before[i] < 65536 ? test_cdc_before[i] : test_cdc_before[i] + 10;
+        size_t j;
+        for (j = 0; j < after_count; ++j)
+            if (test_cdc_after[j] == expected)
+                break;
+        shared += j < after_count;
+    }
+    mirror_check(shared + 3 >= before_count);
+}
+#endif
@@ -0,0 +1,108 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/crc32c/ghost_crc32c.h"
+
+#ifndef ghost_has_ghost_crc32c
+    #error "ghost/algorithm/crc32c/ghost_crc32c.h must define ghost_has_ghost_crc32c."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_crc32c
+#include "ghost/string/ghost_strlen.h"
+
+/* Enough for the long interleaved loop plus some extra. */
+static unsigned char test_crc32c_bytes[3 * 8192 + 3 * 256 + 100];
+
+static void test_crc32c_fill(void) {
+    size_t i;
+    ghost_uint32_t x = 1;
+    for (i = 0; i < sizeof(test_crc32c_bytes); ++i) {
+        x = x * 1103515245u + 12345u;
+        test_crc32c_bytes[i] = ghost_static_cast(unsigned char, x >> 24);
+    }
+}
+
+/* A bitwise reference implementation */
+static ghost_uint32_t test_crc32c_reference(const unsigned char* p, size_t length) {
+    ghost_uint32_t crc = 0xFFFFFFFFu;
+    while (length-- != 0) {
+        int k;
+        crc ^= *p++;
+        for (k = 0; k < 8; ++k)
+            crc = (crc & 1) ? (crc >> 1) ^ 0x82F63B78u : crc >> 1;
+    }
+    return ~crc & 0xFFFFFFFFu;
+}
+
+mirror() {
+    mirror_check(ghost_crc32c(0, "123456789", 9) == 0xE3069283u);
+    mirror_check(ghost_crc32c(0, "", 0) == 0);
+    mirror_check(ghost_crc32c(0x12345678u, "", 0) == 0x12345678u);
+}
+
+mirror() {
+    /* iSCSI test vectors from RFC 3720 */
+    unsigned char bytes[32];
+    size_t i;
+    for (i = 0; i < 32; ++i)
+        bytes[i] = 0;
+    mirror_check(ghost_crc32c(0, bytes, 32) == 0x8A9136AAu);
+    for (i = 0; i < 32; ++i)
+        bytes[i] = 0xFF;
+    mirror_check(ghost_crc32c(0, bytes, 32) == 0x62A8AB43u);
+    for (i = 0; i < 32; ++i)
+        bytes[i] = ghost_static_cast(unsigned char, i);
+    mirror_check(ghost_crc32c(0, bytes, 32) == 0x46DD794Eu);
+}
+
+mirror() {
+    /* Lengths and alignments around the word and interleaving boundaries */
+    static const size_t lengths[] = {
+        1, 7, 8, 9, 63, 64, 65,
+        3 * 256 - 1, 3 * 256, 3 * 256 + 1, 3 * 256 + 17, 6 * 256 + 8,
+        3 * 8192 - 1, 3 * 8192, 3 * 8192 + 1, 3 * 8192 + 3 * 256 + 9,
+    };
+    size_t i, offset;
+    test_crc32c_fill();
+    for (i = 0; i < sizeof(lengths) / sizeof(*lengths); ++i) {
+        for (offset = 0; offset < 8; offset += 3) {
+            const unsigned char* p = test_crc32c_bytes + offset;
+            mirror_check(ghost_crc32c(0, p, lengths[i]) == test_crc32c_reference(p, lengths[i]));
+        }
+    }
+}
+
+mirror() {
+    /* Incremental updates match a single call */
+    size_t length = 3 * 8192 + 3 * 256 + 37;
+    ghost_uint32_t expected;
+    size_t split;
+    test_crc32c_fill();
+    expected = ghost_crc32c(0, test_crc32c_bytes, length);
+    for (split = 0; split <= length; split += 997) {
+        ghost_uint32_t crc = ghost_crc32c(0, test_crc32c_bytes, split);
+        crc = ghost_crc32c(crc, test_crc32c_bytes + split, length - split);
+        mirror_check(crc == expected);
+    }
+}
+#endif
@@ -0,0 +1,67 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/crc32c/ghost_crc32c_combine.h"
+
+#ifndef ghost_has_ghost_crc32c_combine
+    #error "ghost/algorithm/crc32c/ghost_crc32c_combine.h must define ghost_has_ghost_crc32c_combine."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_crc32c_combine
+#include "ghost/algorithm/crc32c/ghost_crc32c.h"
+#include "ghost/type/size_t/ghost_size_max.h"
+
+mirror() {
+    mirror_check(ghost_crc32c_combine(ghost_crc32c(0, "1234", 4),
+                ghost_crc32c(0, "56789", 5), 5) == 0xE3069283u);
+    mirror_check(ghost_crc32c_combine(ghost_crc32c(0, "123456789", 9), 0, 0) == 0xE3069283u);
+    mirror_check(ghost_crc32c_combine(0, ghost_crc32c(0, "123456789", 9), 9) == 0xE3069283u);
+}
+
+mirror() {
+    unsigned char bytes[1000];
+    ghost_uint32_t expected;
+    size_t split;
+    for (split = 0; split < sizeof(bytes); ++split)
+        bytes[split] = ghost_static_cast(unsigned char, split * 31 + (split >> 3));
+    expected = ghost_crc32c(0, bytes, sizeof(bytes));
+    for (split = 0; split <= sizeof(bytes); split += 37) {
+        ghost_uint32_t crc1 = ghost_crc32c(0, bytes, split);
+        ghost_uint32_t crc2 = ghost_crc32c(0, bytes + split, sizeof(bytes) - split);
+        mirror_check(ghost_crc32c_combine(crc1, crc2, sizeof(bytes) - split) == expected);
+    }
+}
+
+mirror() {
+    /* Shifting over a huge run of zeroes, checked against shifting in
+     * smaller steps. This also exercises the powers cycling around. */
+    #if GHOST_SIZE_MAX > 0xFFFFFFFFu
+    ghost_uint32_t crc = 0x12345678u;
+    ghost_uint32_t stepped = crc;
+    size_t i;
+    for (i = 0; i < 16; ++i)
+        stepped = ghost_crc32c_combine(stepped, 0, ghost_static_cast(size_t, 1) << 36);
+    mirror_check(ghost_crc32c_combine(crc, 0, ghost_static_cast(size_t, 1) << 40) == stepped);
+    #endif
+}
+#endif
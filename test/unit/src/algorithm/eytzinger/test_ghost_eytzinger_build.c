@@ -0,0 +1,79 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/eytzinger/ghost_eytzinger_build.h"
+
+#ifndef ghost_has_ghost_eytzinger_build
+    #error "ghost/algorithm/eytzinger/ghost_eytzinger_build.h must define ghost_has_ghost_eytzinger_build."
+#endif
+
+#include "test_common.h"
+
+#if !ghost_has_ghost_eytzinger_build
+    #error "ghost_eytzinger_build must exist."
+#endif
+
+#include "ghost/language/ghost_array_count.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/string/ghost_memcmp.h"
+
+/* Appends the in-order traversal of the subtree at index to out. */
+static void test_in_order(const int* tree, size_t count, size_t index, int* out, size_t* pos) {
+    if (index >= count)
+        return;
+    test_in_order(tree, count, 2 * index + 1, out, pos);
+    out[(*pos)++] = tree[index];
+    test_in_order(tree, count, 2 * index + 2, out, pos);
+}
+
+mirror() {
+    int sorted[] = {1, 2, 3, 4, 5, 6, 7};
+    int expected[] = {4, 2, 6, 1, 3, 5, 7};
+    int tree[7];
+    ghost_eytzinger_build(tree, sorted, ghost_array_count(sorted), sizeof(int));
+    mirror_eq(0, ghost_memcmp(expected, tree, sizeof(expected)));
+}
+
+mirror() {
+    int sorted[] = {1, 2, 3, 4, 5, 6};
+    int expected[] = {4, 2, 6, 1, 3, 5};
+    int tree[6];
+    ghost_eytzinger_build(tree, sorted, ghost_array_count(sorted), sizeof(int));
+    mirror_eq(0, ghost_memcmp(expected, tree, sizeof(expected)));
+}
+
+mirror() {
+    /* the in-order traversal of the tree is the sorted array for every size */
+    int sorted[100];
+    int tree[100];
+    int traversal[100];
+    size_t count;
+    size_t i;
+    for (i = 0; i < ghost_array_count(sorted); ++i)
+        sorted[i] = ghost_static_cast(int, i);
+    for (count = 0; count <= ghost_array_count(sorted); ++count) {
+        size_t pos = 0;
+        ghost_eytzinger_build(tree, sorted, count, sizeof(int));
+        test_in_order(tree, count, 0, traversal, &pos);
+        mirror_eq_z(count, pos);
+        mirror_eq(0, ghost_memcmp(sorted, traversal, count * sizeof(int)));
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * This template generates Eytzinger search test functions for a given variant.
+ * The test must define one of the following macros:
+ *
+ * - TEST_GHOST_EYTZINGER_LOWER_BOUND_GNU
+ * - TEST_GHOST_EYTZINGER_LOWER_BOUND
+ */
+
+#include "test_common.h"
+
+#include "ghost/algorithm/eytzinger/ghost_eytzinger_build.h"
+#include "ghost/language/ghost_array_count.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/language/ghost_discard.h"
+
+static int s_context = 7;
+
+#if defined(TEST_GHOST_EYTZINGER_LOWER_BOUND_GNU)
+static int mycompare(const void* pkey, const void* pelement, void* context)
+#elif defined(TEST_GHOST_EYTZINGER_LOWER_BOUND)
+static int mycompare(const void* pkey, const void* pelement)
+#else
+    #error
+#endif
+{
+    int key;
+    int element;
+    #ifdef TEST_GHOST_EYTZINGER_LOWER_BOUND
+    ghost_discard(s_context);
+    #else
+    mirror_check(context == &s_context);
+    #endif
+    key = *ghost_static_cast(const int*, pkey);
+    element = *ghost_static_cast(const int*, pelement);
+    return (key < element) ? -1 : (key > element) ? 1 : 0;
+}
+
+#if defined(TEST_GHOST_EYTZINGER_LOWER_BOUND_GNU)
+    #define TEST_LOWER_BOUND(key, array, count) ghost_gnu_eytzinger_lower_bound_r(key, array, count, sizeof(int), &mycompare, &s_context)
+#elif defined(TEST_GHOST_EYTZINGER_LOWER_BOUND)
+    #define TEST_LOWER_BOUND(key, array, count) ghost_eytzinger_lower_bound(key, array, count, sizeof(int), &mycompare)
+#endif
+
+mirror() {
+    int sorted[] = {1, 2, 3, 4, 4, 4, 5, 7, 9};
+    int tree[9];
+    int key;
+    ghost_eytzinger_build(tree, sorted, ghost_array_count(sorted), sizeof(int));
+    for (key = 0; key <= 10; ++key) {
+        size_t index = TEST_LOWER_BOUND(&key, tree, ghost_array_count(tree));
+        if (key > 9) {
+            mirror_eq_z(ghost_array_count(tree), index);
+        } else {
+            int expected = key;
+            while (expected == 6 || expected == 8 || expected == 0)
+                ++expected;
+            mirror_check(index < ghost_array_count(tree));
+            mirror_eq_i(expected, tree[index]);
+        }
+    }
+}
+
+mirror() {
+    int tree[1] = {5};
+    int key = 5;
+    mirror_eq_z(0, TEST_LOWER_BOUND(&key, tree, 0));
+    mirror_eq_z(0, TEST_LOWER_BOUND(&key, tree, 1));
+    key = 6;
+    mirror_eq_z(1, TEST_LOWER_BOUND(&key, tree, 1));
+}
+
+mirror() {
+    /* every size up to 200 with even values, searching for each even and odd key */
+    int sorted[200];
+    int tree[200];
+    size_t count;
+    for (count = 0; count <= ghost_array_count(sorted); ++count) {
+        int key;
+        size_t i;
+        for (i = 0; i < count; ++i)
+            sorted[i] = ghost_static_cast(int, i * 2);
+        ghost_eytzinger_build(tree, sorted, count, sizeof(int));
+        for (key = -1; key <= ghost_static_cast(int, count * 2); ++key) {
+            size_t index = TEST_LOWER_BOUND(&key, tree, count);
+            if (key >= ghost_static_cast(int, count * 2) - 1) {
+                mirror_eq_z(count, index);
+            } else {
+                mirror_check(index < count);
+                mirror_eq_i(key < 0 ? 0 : (key + 1) / 2 * 2, tree[index]);
+            }
+        }
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_chars_u32.h"
+
+#ifndef ghost_has_GHOST_FNV1A_CHARS_U32
+    #error "ghost/algorithm/fnv1a/ghost_fnv1a_chars_u32.h must define ghost_has_GHOST_FNV1A_CHARS_U32."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_GHOST_FNV1A_CHARS_U32
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_cstr_u32.h"
+
+static int test_fnv1a_chars_u32_switch(const char* key) {
+    switch (ghost_fnv1a_cstr_u32(key)) {
+        case GHOST_FNV1A_CHARS_U32('w','i','d','t','h'): return 1;
+        case GHOST_FNV1A_CHARS_U32('h','e','i','g','h','t'): return 2;
+        case GHOST_FNV1A_CHARS_U32('x'): return 3;
+        default: return 0;
+    }
+}
+
+mirror() {
+    mirror_eq_i(1, test_fnv1a_chars_u32_switch("width"));
+    mirror_eq_i(2, test_fnv1a_chars_u32_switch("height"));
+    mirror_eq_i(3, test_fnv1a_chars_u32_switch("x"));
+    mirror_eq_i(0, test_fnv1a_chars_u32_switch("depth"));
+}
+
+mirror() {
+    mirror_check(GHOST_FNV1A_CHARS_U32('\xFF', '\x80') == ghost_fnv1a_cstr_u32("\xFF\x80"));
+    mirror_check(GHOST_FNV1A_CHARS_U32(
+                '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f',
+                '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f') ==
+            ghost_fnv1a_cstr_u32("0123456789abcdef0123456789abcdef"));
+}
+#endif
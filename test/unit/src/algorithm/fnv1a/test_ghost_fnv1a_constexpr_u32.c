@@ -0,0 +1,56 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_constexpr_u32.h"
+
+#ifndef ghost_has_ghost_fnv1a_constexpr_u32
+    #error "ghost/algorithm/fnv1a/ghost_fnv1a_constexpr_u32.h must define ghost_has_ghost_fnv1a_constexpr_u32."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_fnv1a_constexpr_u32
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_cstr_u32.h"
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u32.h"
+
+static_assert(ghost_fnv1a_constexpr_u32("abc") == ghost_fnv1a_constexpr_u32("abc", 3), "");
+static_assert(ghost_fnv1a_constexpr_u32("") != ghost_fnv1a_constexpr_u32("a"), "");
+
+static int test_ghost_fnv1a_constexpr_u32_switch(const char* key) {
+    switch (ghost_fnv1a_cstr_u32(key)) {
+        case ghost_fnv1a_constexpr_u32("width"): return 1;
+        case ghost_fnv1a_constexpr_u32("height"): return 2;
+        default: return 0;
+    }
+}
+
+mirror() {
+    mirror_eq_i(1, test_ghost_fnv1a_constexpr_u32_switch("width"));
+    mirror_eq_i(2, test_ghost_fnv1a_constexpr_u32_switch("height"));
+    mirror_eq_i(0, test_ghost_fnv1a_constexpr_u32_switch("depth"));
+}
+
+mirror() {
+    const char* key = "some runtime key \xFF";
+    mirror_check(ghost_fnv1a_constexpr_u32(key) == ghost_fnv1a_cstr_u32(key));
+    mirror_check(ghost_fnv1a_constexpr_u32("a\0b", 3) == ghost_fnv1a_u32("a\0b", 3));
+}
+#endif
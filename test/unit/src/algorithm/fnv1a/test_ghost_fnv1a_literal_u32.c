@@ -0,0 +1,62 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_literal_u32.h"
+
+#ifndef ghost_has_GHOST_FNV1A_LITERAL_U32
+    #error "ghost/algorithm/fnv1a/ghost_fnv1a_literal_u32.h must define ghost_has_GHOST_FNV1A_LITERAL_U32."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_GHOST_FNV1A_LITERAL_U32
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_cstr_u32.h"
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u32.h"
+#include "ghost/language/ghost_cplusplus.h"
+
+mirror() {
+    mirror_check(GHOST_FNV1A_LITERAL_U32("") == ghost_fnv1a_cstr_u32(""));
+    mirror_check(GHOST_FNV1A_LITERAL_U32("a") == ghost_fnv1a_cstr_u32("a"));
+    mirror_check(GHOST_FNV1A_LITERAL_U32("width") == ghost_fnv1a_cstr_u32("width"));
+    mirror_check(GHOST_FNV1A_LITERAL_U32("\xFF\x80 high bytes") == ghost_fnv1a_cstr_u32("\xFF\x80 high bytes"));
+    mirror_check(GHOST_FNV1A_LITERAL_U32("0123456789abcdef0123456789abcdef") ==
+            ghost_fnv1a_cstr_u32("0123456789abcdef0123456789abcdef"));
+    /* embedded nulls are hashed */
+    mirror_check(GHOST_FNV1A_LITERAL_U32("a\0b") == ghost_fnv1a_u32("a\0b", 3));
+}
+
+#if defined(__cplusplus) && ghost_cplusplus >= 201103L
+static int test_fnv1a_literal_u32_switch(const char* key) {
+    switch (ghost_fnv1a_cstr_u32(key)) {
+        case GHOST_FNV1A_LITERAL_U32("width"): return 1;
+        case GHOST_FNV1A_LITERAL_U32("height"): return 2;
+        default: return 0;
+    }
+}
+
+mirror() {
+    static_assert(GHOST_FNV1A_LITERAL_U32("abc") == GHOST_FNV1A_LITERAL_U32("abc"), "");
+    mirror_eq_i(1, test_fnv1a_literal_u32_switch("width"));
+    mirror_eq_i(2, test_fnv1a_literal_u32_switch("height"));
+    mirror_eq_i(0, test_fnv1a_literal_u32_switch("depth"));
+}
+#endif
+#endif
@@ -0,0 +1,53 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u64_state_t.h"
+
+#ifndef ghost_has_ghost_fnv1a_u64_state_t
+    #error "ghost/algorithm/fnv1a/ghost_fnv1a_u64_state_t.h must define ghost_has_ghost_fnv1a_u64_state_t."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_fnv1a_u64_state_t
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u64.h"
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u64_init.h"
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u64_update.h"
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u64_final.h"
+
+mirror() {
+    /* The result matches the one-shot hash however the input is split. */
+    static const char text[] = "The quick brown fox jumps over the lazy dog";
+    size_t length = sizeof(text) - 1;
+    size_t split;
+    for (split = 0; split <= length; ++split) {
+        ghost_fnv1a_u64_state_t state;
+        size_t i;
+        ghost_fnv1a_u64_init(&state);
+        mirror_check(ghost_fnv1a_u64_final(&state) == ghost_fnv1a_u64(text, 0));
+        ghost_fnv1a_u64_update(&state, text, split);
+        mirror_check(ghost_fnv1a_u64_final(&state) == ghost_fnv1a_u64(text, split));
+        for (i = split; i < length; ++i)
+            ghost_fnv1a_u64_update(&state, text + i, 1);
+        mirror_check(ghost_fnv1a_u64_final(&state) == ghost_fnv1a_u64(text, length));
+    }
+}
+#endif
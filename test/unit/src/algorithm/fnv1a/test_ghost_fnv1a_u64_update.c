@@ -0,0 +1,44 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u64_update.h"
+
+#ifndef ghost_has_ghost_fnv1a_u64_update
+    #error "ghost/algorithm/fnv1a/ghost_fnv1a_u64_update.h must define ghost_has_ghost_fnv1a_u64_update."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_fnv1a_u64_update
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u64.h"
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u64_init.h"
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u64_update.h"
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u64_final.h"
+
+mirror() {
+    ghost_fnv1a_u64_state_t state;
+    ghost_fnv1a_u64_init(&state);
+    ghost_fnv1a_u64_update(&state, "foo", 3);
+    ghost_fnv1a_u64_update(&state, "", 0);
+    ghost_fnv1a_u64_update(&state, "bar", 3);
+    mirror_check(ghost_fnv1a_u64_final(&state) == ghost_fnv1a_u64("foobar", 6));
+}
+#endif
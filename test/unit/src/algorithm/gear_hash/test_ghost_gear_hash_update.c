@@ -0,0 +1,77 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/gear_hash/ghost_gear_hash_update.h"
+
+#ifndef ghost_has_ghost_gear_hash_update
+    #error "ghost/algorithm/gear_hash/ghost_gear_hash_update.h must define ghost_has_ghost_gear_hash_update."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_gear_hash_update
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+static unsigned char test_gear_hash_bytes[300];
+
+static void test_gear_hash_fill(void) {
+    ghost_uint64_t x = GHOST_UINT64_C(0x0123456789ABCDEF);
+    size_t i;
+    for (i = 0; i < sizeof(test_gear_hash_bytes); ++i) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        test_gear_hash_bytes[i] = ghost_static_cast(unsigned char, x >> 56);
+    }
+}
+
+
+mirror() {
+    /* The table must never change. */
+    unsigned char zero = 0;
+    mirror_check(ghost_gear_hash_update(0, "", 0) == 0);
+    mirror_check(ghost_gear_hash_update(0, &zero, 1) == GHOST_UINT64_C(0xE220A8397B1DCDAF));
+    mirror_check(ghost_gear_hash_update(1, &zero, 1) == GHOST_UINT64_C(0xE220A8397B1DCDB1));
+}
+
+mirror() {
+    /* Pieces give the same hash as the whole. */
+    size_t split;
+    ghost_uint64_t whole;
+    test_gear_hash_fill();
+    whole = ghost_gear_hash_update(0, test_gear_hash_bytes, 100);
+    for (split = 0; split <= 100; ++split) {
+        ghost_uint64_t hash = ghost_gear_hash_update(0, test_gear_hash_bytes, split);
+        mirror_check(ghost_gear_hash_update(hash, test_gear_hash_bytes + split, 100 - split) == whole);
+    }
+}
+
+mirror() {
+    /* The hash depends only on the last 64 bytes. */
+    size_t offset;
+    test_gear_hash_fill();
+    for (offset = 1; offset < 200; ++offset)
+        mirror_check(ghost_gear_hash_update(0, test_gear_hash_bytes + offset, 64) ==
+                ghost_gear_hash_update(0, test_gear_hash_bytes, offset + 64));
+    mirror_check(ghost_gear_hash_update(0, test_gear_hash_bytes + 1, 63) !=
+            ghost_gear_hash_update(0, test_gear_hash_bytes, 64));
+}
+#endif
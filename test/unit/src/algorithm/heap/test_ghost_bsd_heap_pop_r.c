@@ -0,0 +1,34 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/heap/ghost_bsd_heap_pop_r.h"
+
+#ifndef ghost_has_ghost_bsd_heap_pop_r
+    #error "ghost/algorithm/heap/ghost_bsd_heap_pop_r.h must define ghost_has_ghost_bsd_heap_pop_r."
+#endif
+
+#if !ghost_has_ghost_bsd_heap_pop_r
+    #error "ghost_bsd_heap_pop_r must exist."
+#endif
+
+#define TEST_GHOST_HEAP_BSD
+#define TEST_GHOST_HEAP_POP
+#include "test_ghost_heap.t.h"
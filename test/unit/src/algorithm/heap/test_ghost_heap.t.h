@@ -0,0 +1,267 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * This template generates heap test functions for a given variant and
+ * operation. The test must define one of the following variant macros:
+ *
+ * - TEST_GHOST_HEAP_GNU
+ * - TEST_GHOST_HEAP_BSD
+ * - TEST_GHOST_HEAP_C11
+ * - TEST_GHOST_HEAP_WIN
+ * - TEST_GHOST_HEAP
+ *
+ * and one of the following operation macros:
+ *
+ * - TEST_GHOST_HEAP_MAKE
+ * - TEST_GHOST_HEAP_PUSH
+ * - TEST_GHOST_HEAP_POP
+ * - TEST_GHOST_HEAP_REPLACE_TOP
+ *
+ * Each test uses only the operation under test. A heap is set up either by
+ * hand or from an array sorted in descending order (which is a valid heap.)
+ */
+
+#include "test_common.h"
+
+#include "ghost/language/ghost_array_count.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/language/ghost_discard.h"
+
+static int s_context = 7;
+
+#if defined(TEST_GHOST_HEAP_GNU) || defined(TEST_GHOST_HEAP_C11)
+static int mycompare(const void* pa, const void* pb, void* context)
+#elif defined(TEST_GHOST_HEAP_BSD) || defined(TEST_GHOST_HEAP_WIN)
+static int mycompare(void* context, const void* pa, const void* pb)
+#elif defined(TEST_GHOST_HEAP)
+static int mycompare(const void* pa, const void* pb)
+#else
+    #error
+#endif
+{
+    int a;
+    int b;
+    #ifdef TEST_GHOST_HEAP
+    ghost_discard(s_context);
+    #else
+    mirror_check(context == &s_context);
+    #endif
+    a = *ghost_static_cast(const int*, pa);
+    b = *ghost_static_cast(const int*, pb);
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+#if defined(TEST_GHOST_HEAP_MAKE)
+    #define TEST_HEAP_OP make
+#elif defined(TEST_GHOST_HEAP_PUSH)
+    #define TEST_HEAP_OP push
+#elif defined(TEST_GHOST_HEAP_POP)
+    #define TEST_HEAP_OP pop
+#elif defined(TEST_GHOST_HEAP_REPLACE_TOP)
+    #define TEST_HEAP_OP replace_top
+#else
+    #error
+#endif
+
+#define TEST_HEAP_CONCAT_IMPL(a, b, c) a##b##c
+#define TEST_HEAP_CONCAT(a, b, c) TEST_HEAP_CONCAT_IMPL(a, b, c)
+#define TEST_HEAP_CONCAT2_IMPL(a, b) a##b
+#define TEST_HEAP_CONCAT2(a, b) TEST_HEAP_CONCAT2_IMPL(a, b)
+
+#if defined(TEST_GHOST_HEAP_GNU)
+    #define TEST_HEAP(array, count) TEST_HEAP_CONCAT(ghost_gnu_heap_, TEST_HEAP_OP, _r)(array, count, sizeof(int), &mycompare, &s_context)
+#elif defined(TEST_GHOST_HEAP_BSD)
+    #define TEST_HEAP(array, count) TEST_HEAP_CONCAT(ghost_bsd_heap_, TEST_HEAP_OP, _r)(array, count, sizeof(int), &s_context, &mycompare)
+#elif defined(TEST_GHOST_HEAP_WIN)
+    #define TEST_HEAP(array, count) TEST_HEAP_CONCAT(ghost_win_heap_, TEST_HEAP_OP, _s)(array, count, sizeof(int), &mycompare, &s_context)
+#elif defined(TEST_GHOST_HEAP_C11)
+    #define TEST_HEAP(array, count) TEST_HEAP_CONCAT(ghost_c11_heap_, TEST_HEAP_OP, _s)(array, count, sizeof(int), &mycompare, &s_context)
+#elif defined(TEST_GHOST_HEAP)
+    #define TEST_HEAP(array, count) TEST_HEAP_CONCAT2(ghost_heap_, TEST_HEAP_OP)(array, count, sizeof(int), &mycompare)
+#endif
+
+#define TEST_VALUE_COUNT 1000
+
+static int test_values[TEST_VALUE_COUNT];
+
+static unsigned test_random(unsigned* state) {
+    *state = *state * 1103515245U + 12345U;
+    return (*state >> 16) & 0x7FFFU;
+}
+
+static void test_check_heap(const int* values, size_t count) {
+    size_t i;
+    if (count == 0)
+        return;
+    for (i = 1; i < count; ++i)
+        if (values[(i - 1) / 2] < values[i])
+            break;
+    mirror_eq_z(i, count);
+}
+
+#if defined(TEST_GHOST_HEAP_POP) || defined(TEST_GHOST_HEAP_REPLACE_TOP)
+/* Fills the test values with descending values (a valid heap) with the given
+ * range of keys. */
+static void test_fill_descending(unsigned range) {
+    unsigned state = range;
+    size_t i;
+    for (i = 0; i < TEST_VALUE_COUNT; ++i)
+        test_values[i] = ghost_static_cast(int, test_random(&state) % range);
+    for (i = 1; i < TEST_VALUE_COUNT; ++i) {
+        size_t j = i;
+        while (j > 0 && test_values[j - 1] < test_values[j]) {
+            int temp = test_values[j - 1];
+            test_values[j - 1] = test_values[j];
+            test_values[j] = temp;
+            --j;
+        }
+    }
+}
+#endif
+
+#ifdef TEST_GHOST_HEAP_MAKE
+mirror() {
+    int values[] = {4, 1, 6, 4, 2, 5, 3};
+    TEST_HEAP(values, ghost_array_count(values));
+    mirror_eq_i(6, values[0]);
+    test_check_heap(values, ghost_array_count(values));
+}
+
+mirror() {
+    int values[] = {3};
+    TEST_HEAP(values, 0);
+    TEST_HEAP(values, 1);
+    mirror_eq_i(3, values[0]);
+}
+
+mirror() {
+    unsigned ranges[] = {3, 100, 30000};
+    size_t r;
+    for (r = 0; r < ghost_array_count(ranges); ++r) {
+        unsigned state = ranges[r];
+        long sum = 0;
+        int max = 0;
+        size_t i;
+        for (i = 0; i < TEST_VALUE_COUNT; ++i) {
+            test_values[i] = ghost_static_cast(int, test_random(&state) % ranges[r]);
+            sum += test_values[i];
+            if (max < test_values[i])
+                max = test_values[i];
+        }
+        TEST_HEAP(test_values, TEST_VALUE_COUNT);
+        mirror_eq_i(max, test_values[0]);
+        test_check_heap(test_values, TEST_VALUE_COUNT);
+        for (i = 0; i < TEST_VALUE_COUNT; ++i)
+            sum -= test_values[i];
+        mirror_eq_i(0, ghost_static_cast(int, sum));
+    }
+}
+#endif
+
+#ifdef TEST_GHOST_HEAP_PUSH
+mirror() {
+    int values[] = {4, 1, 6, 4, 2, 5, 3};
+    size_t count;
+    for (count = 1; count <= ghost_array_count(values); ++count) {
+        TEST_HEAP(values, count);
+        test_check_heap(values, count);
+    }
+    mirror_eq_i(6, values[0]);
+}
+
+mirror() {
+    unsigned state = 1;
+    int max = 0;
+    size_t count;
+    for (count = 1; count <= TEST_VALUE_COUNT; ++count) {
+        test_values[count - 1] = ghost_static_cast(int, test_random(&state) % 500);
+        if (max < test_values[count - 1])
+            max = test_values[count - 1];
+        TEST_HEAP(test_values, count);
+        mirror_eq_i(max, test_values[0]);
+    }
+    test_check_heap(test_values, TEST_VALUE_COUNT);
+}
+#endif
+
+#ifdef TEST_GHOST_HEAP_POP
+mirror() {
+    int values[] = {6, 5, 4, 4, 3, 2, 1};
+    int expected[] = {1, 2, 3, 4, 4, 5, 6};
+    size_t count;
+    for (count = ghost_array_count(values); count > 0; --count) {
+        TEST_HEAP(values, count);
+        test_check_heap(values, count - 1);
+    }
+    for (count = 0; count < ghost_array_count(values); ++count)
+        mirror_eq_i(expected[count], values[count]);
+}
+
+mirror() {
+    /* popping everything is a heap sort */
+    unsigned ranges[] = {3, 100, 30000};
+    size_t r;
+    for (r = 0; r < ghost_array_count(ranges); ++r) {
+        size_t count;
+        size_t i;
+        test_fill_descending(ranges[r]);
+        for (count = TEST_VALUE_COUNT; count > 0; --count) {
+            TEST_HEAP(test_values, count);
+            if (count > 1)
+                mirror_check(test_values[0] <= test_values[count - 1]);
+        }
+        for (i = 1; i < TEST_VALUE_COUNT; ++i)
+            if (test_values[i - 1] > test_values[i])
+                break;
+        mirror_eq_z(i, TEST_VALUE_COUNT);
+    }
+}
+#endif
+
+#ifdef TEST_GHOST_HEAP_REPLACE_TOP
+mirror() {
+    int values[] = {6, 5, 4, 4, 3, 2, 1};
+    values[0] = 0;
+    TEST_HEAP(values, ghost_array_count(values));
+    mirror_eq_i(5, values[0]);
+    test_check_heap(values, ghost_array_count(values));
+    values[0] = 9;
+    TEST_HEAP(values, ghost_array_count(values));
+    mirror_eq_i(9, values[0]);
+    test_check_heap(values, ghost_array_count(values));
+}
+
+mirror() {
+    /* a running top-k: keep the smallest values seen so far */
+    unsigned state = 5;
+    size_t i;
+    test_fill_descending(30000);
+    for (i = 0; i < 5000; ++i) {
+        int value = ghost_static_cast(int, test_random(&state) % 30000);
+        if (value < test_values[0]) {
+            test_values[0] = value;
+            TEST_HEAP(test_values, TEST_VALUE_COUNT);
+        }
+    }
+    test_check_heap(test_values, TEST_VALUE_COUNT);
+}
+#endif
@@ -0,0 +1,145 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/heap/ghost_heap_define.h"
+
+#ifndef ghost_has_GHOST_HEAP_DEFINE
+    #error "ghost/algorithm/heap/ghost_heap_define.h must define ghost_has_GHOST_HEAP_DEFINE."
+#endif
+
+#include "test_common.h"
+
+#if !ghost_has_GHOST_HEAP_DEFINE
+    #error "GHOST_HEAP_DEFINE must exist."
+#endif
+
+#include "ghost/language/ghost_array_count.h"
+#include "ghost/language/ghost_static_cast.h"
+
+#define test_int_less(left, right) (*(left) < *(right))
+GHOST_HEAP_DEFINE(test_heap2, int, test_int_less, 2)
+GHOST_HEAP_DEFINE(test_heap3, int, test_int_less, 3)
+GHOST_HEAP_DEFINE(test_heap4, int, test_int_less, 4)
+
+typedef struct test_record_t {
+    unsigned deadline;
+    unsigned value;
+} test_record_t;
+
+/* A min-heap on the deadline */
+static int test_record_later(const test_record_t* left, const test_record_t* right) {
+    return left->deadline > right->deadline;
+}
+
+GHOST_HEAP_DEFINE(test_timers, test_record_t, test_record_later, 4)
+
+static unsigned test_heap_define_random(unsigned* state) {
+    *state = *state * 1103515245U + 12345U;
+    return (*state >> 16) & 0x7FFFU;
+}
+
+static void test_check_heap(const int* values, size_t count, size_t arity) {
+    size_t i;
+    for (i = 1; i < count; ++i)
+        if (values[(i - 1) / arity] < values[i])
+            break;
+    mirror_check(count == 0 || i == count);
+}
+
+#define TEST_HEAP_DEFINE(name, arity) \
+    do { \
+        int values[1000]; \
+        unsigned state = 1; \
+        size_t count; \
+        size_t i; \
+        \
+        for (i = 0; i < ghost_array_count(values); ++i) \
+            values[i] = ghost_static_cast(int, test_heap_define_random(&state) % 100); \
+        name##_make(values, ghost_array_count(values)); \
+        test_check_heap(values, ghost_array_count(values), arity); \
+        \
+        for (count = 1; count <= ghost_array_count(values); ++count) { \
+            values[count - 1] = ghost_static_cast(int, test_heap_define_random(&state) % 1000); \
+            name##_push(values, count); \
+        } \
+        test_check_heap(values, ghost_array_count(values), arity); \
+        \
+        for (i = 0; i < 100; ++i) { \
+            values[0] = ghost_static_cast(int, test_heap_define_random(&state) % 1000); \
+            name##_replace_top(values, ghost_array_count(values)); \
+        } \
+        test_check_heap(values, ghost_array_count(values), arity); \
+        \
+        for (count = ghost_array_count(values); count > 0; --count) \
+            name##_pop(values, count); \
+        for (i = 1; i < ghost_array_count(values); ++i) \
+            if (values[i - 1] > values[i]) \
+                break; \
+        mirror_eq_z(i, ghost_array_count(values)); \
+    } while (0)
+
+mirror() {
+    int values[] = {4, 1, 6, 4, 2, 5, 3};
+    int expected[] = {1, 2, 3, 4, 4, 5, 6};
+    size_t count;
+    test_heap4_make(values, ghost_array_count(values));
+    mirror_eq_i(6, values[0]);
+    for (count = ghost_array_count(values); count > 0; --count)
+        test_heap4_pop(values, count);
+    for (count = 0; count < ghost_array_count(values); ++count)
+        mirror_eq_i(expected[count], values[count]);
+}
+
+mirror() {
+    TEST_HEAP_DEFINE(test_heap2, 2);
+}
+
+mirror() {
+    TEST_HEAP_DEFINE(test_heap3, 3);
+}
+
+mirror() {
+    TEST_HEAP_DEFINE(test_heap4, 4);
+}
+
+mirror() {
+    /* a timer queue */
+    test_record_t timers[500];
+    unsigned state = 3;
+    unsigned now = 0;
+    size_t count = 0;
+    size_t i;
+
+    for (i = 0; i < ghost_array_count(timers); ++i) {
+        timers[count].deadline = test_heap_define_random(&state);
+        timers[count].value = timers[count].deadline * 3;
+        ++count;
+        test_timers_push(timers, count);
+    }
+
+    while (count > 0) {
+        mirror_check(now <= timers[0].deadline);
+        mirror_eq_u32(timers[0].deadline * 3, timers[0].value);
+        now = timers[0].deadline;
+        test_timers_pop(timers, count);
+        --count;
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/jump_hash/ghost_jump_hash.h"
+
+#ifndef ghost_has_ghost_jump_hash
+    #error "ghost/algorithm/jump_hash/ghost_jump_hash.h must define ghost_has_ghost_jump_hash."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_jump_hash
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+mirror() {
+    /* Values from the reference implementation */
+    mirror_eq_u32(0, ghost_jump_hash(0, 1));
+    mirror_eq_u32(6, ghost_jump_hash(1, 10));
+    mirror_eq_u32(285, ghost_jump_hash(GHOST_UINT64_C(0xdeadbeef), 1000));
+    mirror_eq_u32(4, ghost_jump_hash(GHOST_UINT64_C(0x123456789abcdef0), 7));
+    mirror_eq_u32(18311, ghost_jump_hash(GHOST_UINT64_C(0xffffffffffffffff), 100000));
+    mirror_eq_u32(1603940301, ghost_jump_hash(42, 2147483647));
+    mirror_eq_u32(6, ghost_jump_hash(GHOST_UINT64_C(10863919174838991), 11));
+}
+
+mirror() {
+    /* Growing from n to n+1 buckets only moves keys into the new bucket and
+     * moves about 1/(n+1) of them. Keys are spread evenly. */
+    ghost_uint32_t buckets;
+    for (buckets = 1; buckets < 20; ++buckets) {
+        unsigned counts[20] = {0};
+        unsigned moved = 0;
+        ghost_uint64_t key;
+        for (key = 0; key < 20000; ++key) {
+            ghost_uint64_t hashed = key * GHOST_UINT64_C(0x9E3779B97F4A7C15);
+            ghost_uint32_t before = ghost_jump_hash(hashed, buckets);
+            ghost_uint32_t after = ghost_jump_hash(hashed, buckets + 1);
+            mirror_check(before < buckets);
+            mirror_check(after == before || after == buckets);
+            moved += after != before;
+            ++counts[after];
+        }
+        mirror_check(moved > 20000 / (buckets + 1) * 8 / 10);
+        mirror_check(moved < 20000 / (buckets + 1) * 12 / 10);
+        for (key = 0; key <= buckets; ++key)
+            mirror_check(counts[key] > 20000 / (buckets + 1) * 8 / 10);
+    }
+}
+#endif
@@ -0,0 +1,91 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/knuth_hash/ghost_knuth_hash_u32_array_histogram.h"
+
+#ifndef ghost_has_ghost_knuth_hash_u32_array_histogram
+    #error "ghost/algorithm/knuth_hash/ghost_knuth_hash_u32_array_histogram.h must define ghost_has_ghost_knuth_hash_u32_array_histogram."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_knuth_hash_u32_array_histogram
+#include "ghost/algorithm/knuth_hash/ghost_knuth_hash_u32.h"
+#include "ghost/language/ghost_static_cast.h"
+
+static ghost_uint32_t test_knuth_hash_value(size_t i) {
+    return ghost_static_cast(ghost_uint32_t, i * 0x9E3779B9u + (i << 13) + 7u);
+}
+
+mirror() {
+    /* All lengths around the vector widths, misaligned, over small bit counts */
+    ghost_uint32_t in[40];
+    ghost_uint32_t out[40];
+    size_t histogram[256] = {0};
+    size_t count, offset, bits, i;
+    for (i = 0; i < 40; ++i)
+        in[i] = test_knuth_hash_value(i);
+    for (bits = 1; bits <= 8; ++bits) {
+        for (offset = 0; offset < 3; ++offset) {
+            for (count = 0; count <= 37; ++count) {
+                ghost_knuth_hash_u32_array_histogram(in + offset, out, count, bits, histogram);
+                for (i = 0; i < count; ++i)
+                    if (out[i] != ghost_knuth_hash_u32(in[offset + i], bits))
+                        break;
+                mirror_eq_z(count, i);
+            }
+        }
+    }
+}
+
+mirror() {
+    /* In place */
+    ghost_uint32_t values[29];
+    size_t i;
+    size_t histogram[32] = {0};
+    for (i = 0; i < 29; ++i)
+        values[i] = test_knuth_hash_value(i);
+    ghost_knuth_hash_u32_array_histogram(values, values, 29, 5, histogram);
+    for (i = 0; i < 29; ++i)
+        mirror_check(values[i] == ghost_knuth_hash_u32(test_knuth_hash_value(i), 5));
+}
+
+mirror() {
+    /* The histogram counts the buckets and accumulates across calls */
+    ghost_uint32_t in[203];
+    ghost_uint32_t out[203];
+    size_t histogram[16];
+    size_t expected[16];
+    size_t i;
+    for (i = 0; i < 16; ++i)
+        histogram[i] = expected[i] = 0;
+    for (i = 0; i < 203; ++i)
+        in[i] = test_knuth_hash_value(i);
+    ghost_knuth_hash_u32_array_histogram(in, out, 100, 4, histogram);
+    ghost_knuth_hash_u32_array_histogram(in + 100, out + 100, 103, 4, histogram);
+    for (i = 0; i < 203; ++i) {
+        mirror_check(out[i] == ghost_knuth_hash_u32(in[i], 4));
+        ++expected[out[i]];
+    }
+    for (i = 0; i < 16; ++i)
+        mirror_eq_z(expected[i], histogram[i]);
+}
+#endif
@@ -0,0 +1,108 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * This template generates lower_bound test functions for a given variant. The
+ * test must define one of the following macros:
+ *
+ * - TEST_GHOST_LOWER_BOUND_GNU
+ * - TEST_GHOST_LOWER_BOUND_BSD
+ * - TEST_GHOST_LOWER_BOUND_C11
+ * - TEST_GHOST_LOWER_BOUND_WIN
+ * - TEST_GHOST_LOWER_BOUND
+ */
+
+#include "test_common.h"
+
+#include "ghost/language/ghost_array_count.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/language/ghost_discard.h"
+
+static int s_context = 7;
+
+#if defined(TEST_GHOST_LOWER_BOUND_GNU) || defined(TEST_GHOST_LOWER_BOUND_C11)
+static int mycompare(const void* pkey, const void* pelement, void* context)
+#elif defined(TEST_GHOST_LOWER_BOUND_BSD) || defined(TEST_GHOST_LOWER_BOUND_WIN)
+static int mycompare(void* context, const void* pkey, const void* pelement)
+#elif defined(TEST_GHOST_LOWER_BOUND)
+static int mycompare(const void* pkey, const void* pelement)
+#else
+    #error
+#endif
+{
+    int key;
+    int element;
+    #ifdef TEST_GHOST_LOWER_BOUND
+    ghost_discard(s_context);
+    #else
+    mirror_check(context == &s_context);
+    #endif
+    key = *ghost_static_cast(const int*, pkey);
+    element = *ghost_static_cast(const int*, pelement);
+    return (key < element) ? -1 : (key > element) ? 1 : 0;
+}
+
+#if defined(TEST_GHOST_LOWER_BOUND_GNU)
+    #define TEST_LOWER_BOUND(key, array, count) ghost_gnu_lower_bound_r(key, array, count, sizeof(int), &mycompare, &s_context)
+#elif defined(TEST_GHOST_LOWER_BOUND_BSD)
+    #define TEST_LOWER_BOUND(key, array, count) ghost_bsd_lower_bound_r(key, array, count, sizeof(int), &s_context, &mycompare)
+#elif defined(TEST_GHOST_LOWER_BOUND_WIN)
+    #define TEST_LOWER_BOUND(key, array, count) ghost_win_lower_bound_s(key, array, count, sizeof(int), &mycompare, &s_context)
+#elif defined(TEST_GHOST_LOWER_BOUND_C11)
+    #define TEST_LOWER_BOUND(key, array, count) ghost_c11_lower_bound_s(key, array, count, sizeof(int), &mycompare, &s_context)
+#elif defined(TEST_GHOST_LOWER_BOUND)
+    #define TEST_LOWER_BOUND(key, array, count) ghost_lower_bound(key, array, count, sizeof(int), &mycompare)
+#endif
+
+mirror() {
+    int values[] = {1, 2, 3, 4, 4, 4, 5, 7, 9};
+    size_t expected[] = {0, 0, 1, 2, 3, 6, 7, 7, 8, 8, 9};
+    int key;
+    for (key = 0; key <= 10; ++key)
+        mirror_eq_z(expected[key], TEST_LOWER_BOUND(&key, values, ghost_array_count(values)));
+}
+
+mirror() {
+    int values[1] = {5};
+    int key = 5;
+    mirror_eq_z(0, TEST_LOWER_BOUND(&key, values, 0));
+    mirror_eq_z(0, TEST_LOWER_BOUND(&key, values, 1));
+    key = 6;
+    mirror_eq_z(1, TEST_LOWER_BOUND(&key, values, 1));
+}
+
+mirror() {
+    /* every size up to 100 with duplicated values, compared to a linear search */
+    int values[100];
+    size_t count;
+    for (count = 0; count <= ghost_array_count(values); ++count) {
+        int key;
+        size_t i;
+        for (i = 0; i < count; ++i)
+            values[i] = ghost_static_cast(int, i / 3);
+        for (key = -1; key <= ghost_static_cast(int, count / 3 + 1); ++key) {
+            size_t expected = 0;
+            while (expected < count && values[expected] < key)
+                ++expected;
+            mirror_eq_z(expected, TEST_LOWER_BOUND(&key, values, count));
+        }
+    }
+}
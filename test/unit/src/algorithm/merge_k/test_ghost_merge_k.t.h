@@ -0,0 +1,234 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * This template generates merge_k test functions for a given variant. The
+ * test must define one of the following macros:
+ *
+ * - TEST_GHOST_MERGE_K_GNU
+ * - TEST_GHOST_MERGE_K_BSD
+ * - TEST_GHOST_MERGE_K_C11
+ * - TEST_GHOST_MERGE_K_WIN
+ * - TEST_GHOST_MERGE_K
+ */
+
+#include "test_common.h"
+
+#include "ghost/language/ghost_array_count.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/language/ghost_discard.h"
+#include "ghost/language/ghost_null.h"
+
+static int s_context = 7;
+
+/* Elements are compared by key only. The run and index record where each
+ * element came from so we can check that the merge is stable. */
+typedef struct test_element_t {
+    int key;
+    int run;
+    int index;
+} test_element_t;
+
+#if defined(TEST_GHOST_MERGE_K_GNU) || defined(TEST_GHOST_MERGE_K_C11)
+static int mycompare(const void* pleft, const void* pright, void* context)
+#elif defined(TEST_GHOST_MERGE_K_BSD) || defined(TEST_GHOST_MERGE_K_WIN)
+static int mycompare(void* context, const void* pleft, const void* pright)
+#elif defined(TEST_GHOST_MERGE_K)
+static int mycompare(const void* pleft, const void* pright)
+#else
+    #error
+#endif
+{
+    int left;
+    int right;
+    #ifdef TEST_GHOST_MERGE_K
+    ghost_discard(s_context);
+    #else
+    mirror_check(context == &s_context);
+    #endif
+    left = ghost_static_cast(const test_element_t*, pleft)->key;
+    right = ghost_static_cast(const test_element_t*, pright)->key;
+    return (left < right) ? -1 : (left > right) ? 1 : 0;
+}
+
+#if defined(TEST_GHOST_MERGE_K_GNU)
+    #define TEST_MERGE_K(out, runs, counts, k) ghost_gnu_merge_k_r(out, runs, counts, k, sizeof(test_element_t), &mycompare, &s_context)
+#elif defined(TEST_GHOST_MERGE_K_BSD)
+    #define TEST_MERGE_K(out, runs, counts, k) ghost_bsd_merge_k_r(out, runs, counts, k, sizeof(test_element_t), &s_context, &mycompare)
+#elif defined(TEST_GHOST_MERGE_K_WIN)
+    #define TEST_MERGE_K(out, runs, counts, k) ghost_win_merge_k_s(out, runs, counts, k, sizeof(test_element_t), &mycompare, &s_context)
+#elif defined(TEST_GHOST_MERGE_K_C11)
+    #define TEST_MERGE_K(out, runs, counts, k) mirror_eq_i(0, ghost_c11_merge_k_s(out, runs, counts, k, sizeof(test_element_t), &mycompare, &s_context))
+#elif defined(TEST_GHOST_MERGE_K)
+    #define TEST_MERGE_K(out, runs, counts, k) ghost_merge_k(out, runs, counts, k, sizeof(test_element_t), &mycompare)
+#endif
+
+#define TEST_MAX_RUNS 80
+#define TEST_MAX_RUN_LENGTH 60
+
+static test_element_t test_elements[TEST_MAX_RUNS][TEST_MAX_RUN_LENGTH];
+static test_element_t test_out[TEST_MAX_RUNS * TEST_MAX_RUN_LENGTH + 1];
+static const void* test_runs[TEST_MAX_RUNS];
+static size_t test_counts[TEST_MAX_RUNS];
+
+static unsigned test_random_state = 1;
+
+static int test_random(int range) {
+    test_random_state = test_random_state * 1103515245u + 12345u;
+    return ghost_static_cast(int, (test_random_state >> 16) % ghost_static_cast(unsigned, range));
+}
+
+/*
+ * Fills the given number of runs with sorted keys. Each key is the previous
+ * key plus a random step in [0, max_step) so there are many ties when
+ * max_step is small.
+ *
+ * If disjoint is positive, each run's keys are all greater than those of the
+ * previous run. If it's negative, they're all less.
+ */
+static void test_fill(size_t k, int max_length, int max_step, int disjoint) {
+    size_t n;
+    int base = 0;
+    for (n = 0; n < k; ++n) {
+        size_t i = (disjoint < 0) ? k - 1 - n : n;
+        int j;
+        int length = test_random(max_length + 1);
+        int key = disjoint ? base : test_random(max_step * 4 + 1);
+        for (j = 0; j < length; ++j) {
+            key += test_random(max_step);
+            test_elements[i][j].key = key;
+            test_elements[i][j].run = ghost_static_cast(int, i);
+            test_elements[i][j].index = j;
+        }
+        base = key + 1;
+        test_runs[i] = test_elements[i];
+        test_counts[i] = ghost_static_cast(size_t, length);
+    }
+}
+
+/*
+ * Merges the runs and checks that the output contains every element in key
+ * order with ties in run order.
+ */
+static void test_merge_and_check(size_t k) {
+    size_t total = 0;
+    size_t i;
+
+    for (i = 0; i < k; ++i)
+        total += test_counts[i];
+
+    /* the element past the end must not be touched */
+    test_out[total].key = -1;
+    TEST_MERGE_K(test_out, test_runs, test_counts, k);
+    mirror_eq_i(-1, test_out[total].key);
+
+    for (i = 1; i < total; ++i) {
+        const test_element_t* a = &test_out[i - 1];
+        const test_element_t* b = &test_out[i];
+        mirror_check(a->key <= b->key);
+        if (a->key == b->key)
+            mirror_check(a->run < b->run || (a->run == b->run && a->index < b->index));
+    }
+
+    /* every output element is a distinct input element (duplicates would fail
+     * the tie check above) */
+    for (i = 0; i < total; ++i) {
+        const test_element_t* e = &test_out[i];
+        mirror_check(e->run >= 0 && ghost_static_cast(size_t, e->run) < k);
+        mirror_check(e->index >= 0 && ghost_static_cast(size_t, e->index) < test_counts[e->run]);
+        mirror_eq_i(test_elements[e->run][e->index].key, e->key);
+    }
+}
+
+mirror() {
+    /* no runs */
+    test_out[0].key = -1;
+    TEST_MERGE_K(test_out, ghost_null, ghost_null, 0);
+    mirror_eq_i(-1, test_out[0].key);
+}
+
+mirror() {
+    /* empty runs */
+    test_counts[0] = 0;
+    test_counts[1] = 0;
+    test_counts[2] = 0;
+    test_runs[0] = test_runs[1] = test_runs[2] = test_elements[0];
+    test_merge_and_check(1);
+    test_merge_and_check(2);
+    test_merge_and_check(3);
+}
+
+mirror() {
+    /* a small fixed merge of three runs */
+    static const int keys[3][4] = {{1, 4, 4, 9}, {2, 4, 8, 10}, {0, 3, 4, 11}};
+    static const int expected_keys[12] = {0, 1, 2, 3, 4, 4, 4, 4, 8, 9, 10, 11};
+    static const int expected_runs[12] = {2, 0, 1, 2, 0, 0, 1, 2, 1, 0, 1, 2};
+    size_t i, j;
+    for (i = 0; i < 3; ++i) {
+        for (j = 0; j < 4; ++j) {
+            test_elements[i][j].key = keys[i][j];
+            test_elements[i][j].run = ghost_static_cast(int, i);
+            test_elements[i][j].index = ghost_static_cast(int, j);
+        }
+        test_runs[i] = test_elements[i];
+        test_counts[i] = 4;
+    }
+    TEST_MERGE_K(test_out, test_runs, test_counts, 3);
+    for (i = 0; i < 12; ++i) {
+        mirror_eq_i(expected_keys[i], test_out[i].key);
+        mirror_eq_i(expected_runs[i], test_out[i].run);
+    }
+}
+
+mirror() {
+    /* random runs with many ties, up to more runs than fit on the stack */
+    size_t k;
+    int trial;
+    for (k = 1; k <= TEST_MAX_RUNS; k += (k < 10) ? 1 : 7) {
+        for (trial = 0; trial < 4; ++trial) {
+            test_fill(k, TEST_MAX_RUN_LENGTH, 3, 0);
+            test_merge_and_check(k);
+        }
+    }
+}
+
+mirror() {
+    /* skewed runs: sparse keys so one run tends to win many times in a row */
+    size_t k;
+    int trial;
+    for (k = 2; k <= TEST_MAX_RUNS; k += (k < 10) ? 1 : 13) {
+        for (trial = 0; trial < 4; ++trial) {
+            test_fill(k, TEST_MAX_RUN_LENGTH, 1000, 0);
+            test_merge_and_check(k);
+        }
+    }
+}
+
+mirror() {
+    /* disjoint runs, in order and in reverse */
+    size_t k;
+    for (k = 2; k <= TEST_MAX_RUNS; k += (k < 10) ? 1 : 13) {
+        test_fill(k, TEST_MAX_RUN_LENGTH, 2, 1);
+        test_merge_and_check(k);
+        test_fill(k, TEST_MAX_RUN_LENGTH, 2, -1);
+        test_merge_and_check(k);
+    }
+}
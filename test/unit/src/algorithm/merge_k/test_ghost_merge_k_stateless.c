@@ -0,0 +1,42 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#define GHOST_STATIC_DEFS 1
+/* Without malloc, merges of more runs than fit on the stack use the stateless
+ * fallback. The template tests up to 80 runs so this covers it. */
+#define ghost_has_ghost_malloc 0
+
+#include "ghost/algorithm/merge_k/ghost_merge_k.h"
+
+/* The merge uses the internal qsort state. With static defs we need its
+ * definitions in this translation unit too. */
+#include "ghost/impl/algorithm/qsort/ghost_impl_qsort_internal.h"
+
+#ifndef ghost_has_ghost_merge_k
+    #error "ghost/algorithm/merge_k/ghost_merge_k.h must define ghost_has_ghost_merge_k."
+#endif
+
+#if !ghost_has_ghost_merge_k
+    #error "ghost_merge_k must exist."
+#endif
+
+#define TEST_GHOST_MERGE_K
+#include "test_ghost_merge_k.t.h"
@@ -0,0 +1,164 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * This template generates partial_sort test functions for a given variant. The test
+ * must define one of the following macros:
+ *
+ * - TEST_GHOST_PARTIAL_SORT_GNU
+ * - TEST_GHOST_PARTIAL_SORT_BSD
+ * - TEST_GHOST_PARTIAL_SORT_C11
+ * - TEST_GHOST_PARTIAL_SORT_WIN
+ * - TEST_GHOST_PARTIAL_SORT
+ */
+
+#include "test_common.h"
+
+#include "ghost/language/ghost_array_count.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/language/ghost_discard.h"
+#include "ghost/string/ghost_memcmp.h"
+
+static int s_context = 7;
+
+#if defined(TEST_GHOST_PARTIAL_SORT_GNU) || defined(TEST_GHOST_PARTIAL_SORT_C11)
+static int mycompare(const void* pa, const void* pb, void* context)
+#elif defined(TEST_GHOST_PARTIAL_SORT_BSD) || defined(TEST_GHOST_PARTIAL_SORT_WIN)
+static int mycompare(void* context, const void* pa, const void* pb)
+#elif defined(TEST_GHOST_PARTIAL_SORT)
+static int mycompare(const void* pa, const void* pb)
+#else
+    #error
+#endif
+{
+    int a;
+    int b;
+    #ifdef TEST_GHOST_PARTIAL_SORT
+    ghost_discard(s_context);
+    #else
+    mirror_check(context == &s_context);
+    #endif
+    a = *ghost_static_cast(const int*, pa);
+    b = *ghost_static_cast(const int*, pb);
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+#if defined(TEST_GHOST_PARTIAL_SORT_GNU)
+    #define TEST_PARTIAL_SORT(array, count, size, sort_count) ghost_gnu_partial_sort_r(array, count, size, &mycompare, &s_context, sort_count)
+#elif defined(TEST_GHOST_PARTIAL_SORT_BSD)
+    #define TEST_PARTIAL_SORT(array, count, size, sort_count) ghost_bsd_partial_sort_r(array, count, size, &s_context, &mycompare, sort_count)
+#elif defined(TEST_GHOST_PARTIAL_SORT_WIN)
+    #define TEST_PARTIAL_SORT(array, count, size, sort_count) ghost_win_partial_sort_s(array, count, size, &mycompare, &s_context, sort_count)
+#elif defined(TEST_GHOST_PARTIAL_SORT_C11)
+    #define TEST_PARTIAL_SORT(array, count, size, sort_count) ghost_c11_partial_sort_s(array, count, size, &mycompare, &s_context, sort_count)
+#elif defined(TEST_GHOST_PARTIAL_SORT)
+    #define TEST_PARTIAL_SORT(array, count, size, sort_count) ghost_partial_sort(array, count, size, &mycompare, sort_count)
+#endif
+
+#define TEST_VALUE_COUNT 5000
+#define TEST_VALUE_RANGE 1000
+
+static int test_values[TEST_VALUE_COUNT];
+static size_t test_histogram[TEST_VALUE_RANGE];
+
+static unsigned test_random(unsigned* state) {
+    *state = *state * 1103515245U + 12345U;
+    return (*state >> 16) & 0x7FFFU;
+}
+
+static void test_fill(unsigned pattern) {
+    unsigned state = pattern + 1;
+    int i;
+    for (i = 0; i < TEST_VALUE_COUNT; ++i) {
+        int value;
+        switch (pattern) {
+            case 0: value = ghost_static_cast(int, test_random(&state) % 10); break; /* few unique */
+            case 1: value = ghost_static_cast(int, test_random(&state) % TEST_VALUE_RANGE); break; /* random */
+            case 2: value = i / 5; break; /* sorted */
+            case 3: value = (TEST_VALUE_COUNT - 1 - i) / 5; break; /* reversed */
+            case 4: value = (i < TEST_VALUE_COUNT / 2 ? i : TEST_VALUE_COUNT - 1 - i) / 3; break; /* organ pipe */
+            default: value = i % 100; break; /* sawtooth */
+        }
+        test_values[i] = value;
+    }
+
+    for (i = 0; i < TEST_VALUE_RANGE; ++i)
+        test_histogram[i] = 0;
+    for (i = 0; i < TEST_VALUE_COUNT; ++i)
+        ++test_histogram[test_values[i]];
+}
+
+/* Returns the value that would be at the given index if the array were sorted. */
+static int test_expected(size_t index) {
+    int value = 0;
+    size_t total = test_histogram[0];
+    while (total <= index)
+        total += test_histogram[++value];
+    return value;
+}
+
+/* Checks that the array is still a permutation of the original values. */
+static void test_check_permutation(void) {
+    static size_t histogram[TEST_VALUE_RANGE];
+    int i;
+    for (i = 0; i < TEST_VALUE_RANGE; ++i)
+        histogram[i] = 0;
+    for (i = 0; i < TEST_VALUE_COUNT; ++i)
+        ++histogram[test_values[i]];
+    mirror_eq(0, ghost_memcmp(histogram, test_histogram, sizeof(histogram)));
+}
+
+mirror() {
+    int expected[] = {1, 2, 3, 4};
+    int actual[] = {4, 1, 6, 4, 2, 5, 3};
+    TEST_PARTIAL_SORT(actual, ghost_array_count(actual), sizeof(*actual), 4);
+    mirror_eq(0, ghost_memcmp(expected, actual, sizeof(expected)));
+}
+
+mirror() {
+    /* sort_count past the end sorts the whole array */
+    int expected[] = {1, 2, 3, 4, 4, 5, 6};
+    int actual[] = {4, 1, 6, 4, 2, 5, 3};
+    TEST_PARTIAL_SORT(actual, ghost_array_count(actual), sizeof(*actual), 100);
+    mirror_eq(0, ghost_memcmp(expected, actual, sizeof(expected)));
+}
+
+mirror() {
+    static const size_t sort_counts[] = {
+        0, 1, 2, 9, 100, TEST_VALUE_COUNT / 2, TEST_VALUE_COUNT - 1, TEST_VALUE_COUNT
+    };
+    unsigned pattern;
+    size_t n;
+    for (pattern = 0; pattern < 6; ++pattern) {
+        for (n = 0; n < ghost_array_count(sort_counts); ++n) {
+            size_t sort_count = sort_counts[n];
+            size_t i;
+            test_fill(pattern);
+            TEST_PARTIAL_SORT(test_values, TEST_VALUE_COUNT, sizeof(int), sort_count);
+            for (i = 0; i < sort_count; ++i) {
+                if (test_values[i] != test_expected(i))
+                    break;
+            }
+            mirror_eq_z(i, sort_count);
+            test_check_permutation();
+        }
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/perfect_hash/ghost_perfect_hash.h"
+
+#ifndef ghost_has_ghost_perfect_hash
+    #error "ghost/algorithm/perfect_hash/ghost_perfect_hash.h must define ghost_has_ghost_perfect_hash."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_perfect_hash
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_u64.h"
+#include "ghost/string/ghost_strlen.h"
+#include "ghost/string/ghost_strcmp.h"
+
+
+/* Tables generated by tools/perfect_hash.py for the C89 keywords. */
+
+static const char* const test_perfect_hash_keys[32] = {
+    "auto", "break", "case", "char", "const", "continue", "default", "do",
+    "double", "else", "enum", "extern", "float", "for", "goto", "if", "int",
+    "long", "register", "return", "short", "signed", "sizeof", "static",
+    "struct", "switch", "typedef", "union", "unsigned", "void", "volatile",
+    "while",
+};
+
+static const ghost_uint16_t test_perfect_hash_seeds[8] = {
+    1, 44, 54, 7, 1, 14, 837, 0,
+};
+
+static const unsigned char test_perfect_hash_slots[32] = {
+    12, 16, 31, 23, 27, 20, 24, 4, 21, 7, 13, 8, 10, 28, 5, 3, 19, 15, 6, 1,
+    22, 2, 11, 30, 29, 18, 0, 17, 14, 25, 9, 26,
+};
+
+static ghost_size_t test_perfect_hash_slot(const char* key) {
+    return ghost_perfect_hash(ghost_fnv1a_u64(key, ghost_strlen(key)),
+            test_perfect_hash_seeds, 8, 32);
+}
+
+mirror() {
+    /* Each key has its own slot and the generated slot table maps it back. */
+    ghost_size_t i;
+    for (i = 0; i < 32; ++i) {
+        ghost_size_t slot = test_perfect_hash_slot(test_perfect_hash_keys[i]);
+        mirror_check(slot < 32);
+        if (slot >= 32)
+            break;
+        mirror_eq_z(i, test_perfect_hash_slots[slot]);
+    }
+}
+
+mirror() {
+    /* Other strings also map to some slot but it holds a different key. */
+    static const char* const others[] = {"", "Auto", "bool", "inline", "restrict", "whiles"};
+    ghost_size_t i;
+    for (i = 0; i < sizeof(others) / sizeof(*others); ++i) {
+        ghost_size_t slot = test_perfect_hash_slot(others[i]);
+        mirror_check(slot < 32);
+        if (slot >= 32)
+            break;
+        mirror_check(0 != ghost_strcmp(others[i], test_perfect_hash_keys[test_perfect_hash_slots[slot]]));
+    }
+}
+
+mirror() {
+    /* A single key in a single bucket. */
+    static const ghost_uint16_t seeds[1] = {0};
+    mirror_eq_z(0, ghost_perfect_hash(0, seeds, 1, 1));
+    mirror_eq_z(0, ghost_perfect_hash(ghost_fnv1a_u64("x", 1), seeds, 1, 1));
+}
+#endif
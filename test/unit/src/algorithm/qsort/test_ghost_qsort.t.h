@@ -31,6 +31,9 @@
  *
  * It can also define TEST_GHOST_QSORT_VARIANT to a string to append to the
  * test name (e.g. "$internal" for the force-internal variants.)
+ *
+ * It can also define TEST_GHOST_QSORT_PARALLEL to test the parallel qsort
+ * function of the given variant instead.
  */
 
 #include "test_common.h"
@@ -56,6 +59,12 @@ static int mycompare(const void* pa, const void* pb)
     int b;
     #ifdef TEST_GHOST_QSORT
     ghost_discard(s_context);
+    #elif defined(TEST_GHOST_QSORT_PARALLEL)
+    /* We may be on another thread so we can't use mirror here. If the
+     * context is wrong we report everything as equal which will fail the
+     * test. */
+    if (context != &s_context)
+        return 0;
     #else
     mirror_check(context == &s_context);
     #endif
@@ -65,7 +74,19 @@ static int mycompare(const void* pa, const void* pb)
     return (a < b) ? -1 : (a > b) ? 1 : 0;
 }
 
-#if defined(TEST_GHOST_QSORT_GNU)
+#if defined(TEST_GHOST_QSORT_PARALLEL)
+    #if defined(TEST_GHOST_QSORT_GNU)
+        #define TEST_QSORT(array, count, size) ghost_gnu_qsort_parallel_r(array, count, size, &mycompare, &s_context);
+    #elif defined(TEST_GHOST_QSORT_BSD)
+        #define TEST_QSORT(array, count, size) ghost_bsd_qsort_parallel_r(array, count, size, &s_context, &mycompare);
+    #elif defined(TEST_GHOST_QSORT_WIN)
+        #define TEST_QSORT(array, count, size) ghost_win_qsort_parallel_s(array, count, size, &mycompare, &s_context);
+    #elif defined(TEST_GHOST_QSORT_C11)
+        #define TEST_QSORT(array, count, size) ghost_c11_qsort_parallel_s(array, count, size, &mycompare, &s_context);
+    #elif defined(TEST_GHOST_QSORT)
+        #define TEST_QSORT(array, count, size) ghost_qsort_parallel(array, count, size, &mycompare);
+    #endif
+#elif defined(TEST_GHOST_QSORT_GNU)
     #define TEST_QSORT(array, count, size) ghost_gnu_qsort_r(array, count, size, &mycompare, &s_context);
 #elif defined(TEST_GHOST_QSORT_BSD)
     #define TEST_QSORT(array, count, size) ghost_bsd_qsort_r(array, count, size, &s_context, &mycompare);
@@ -90,3 +111,93 @@ mirror() {
      *    printf("%i\n",actual[i]); */
     mirror_eq(0, ghost_memcmp(expected, actual, sizeof(expected)));
 }
+
+mirror() {
+    /* Large enough to partition many times (and to use multiple threads in
+     * the parallel tests), with lots of duplicates */
+    static int values[20000];
+    unsigned state = 1;
+    long sum = 0;
+    size_t i;
+    for (i = 0; i < ghost_array_count(values); ++i) {
+        state = state * 1103515245U + 12345U;
+        values[i] = ghost_static_cast(int, (state >> 16) % 5000U);
+        sum += values[i];
+    }
+    TEST_QSORT(values, ghost_array_count(values), sizeof(*values));
+    for (i = 0; i < ghost_array_count(values); ++i) {
+        sum -= values[i];
+        if (i > 0 && values[i - 1] > values[i])
+            break;
+    }
+    mirror_eq_z(i, ghost_array_count(values));
+    mirror_check(sum == 0);
+}
+
+mirror() {
+    /* Sorted, reverse sorted and sorted with an unsorted tail */
+    static int values[20000];
+    unsigned pattern;
+    for (pattern = 0; pattern < 3; ++pattern) {
+        unsigned state = 1;
+        long sum = 0;
+        size_t i;
+        for (i = 0; i < ghost_array_count(values); ++i) {
+            if (pattern == 1) {
+                values[i] = ghost_static_cast(int, (ghost_array_count(values) - i) / 2);
+            } else if (pattern == 2 && i >= ghost_array_count(values) - 100) {
+                state = state * 1103515245U + 12345U;
+                values[i] = ghost_static_cast(int, (state >> 16) % 20000U);
+            } else {
+                values[i] = ghost_static_cast(int, i);
+            }
+            sum += values[i];
+        }
+        TEST_QSORT(values, ghost_array_count(values), sizeof(*values));
+        for (i = 0; i < ghost_array_count(values); ++i) {
+            sum -= values[i];
+            if (i > 0 && values[i - 1] > values[i])
+                break;
+        }
+        mirror_eq_z(i, ghost_array_count(values));
+        mirror_check(sum == 0);
+    }
+}
+
+mirror() {
+    /* Records of various sizes, including the 16 and 32 byte swap classes and
+     * records large enough to be sorted indirectly. The key is a leading int;
+     * every other byte of the record is derived from it so we can check that
+     * records were moved whole. */
+    static const size_t sizes[] = {12, 16, 32, 36, 200, 600};
+    static int storage[1000 * 600 / sizeof(int)];
+    char* records = ghost_static_cast(char*, ghost_static_cast(void*, storage));
+    size_t s;
+    for (s = 0; s < ghost_array_count(sizes); ++s) {
+        size_t size = sizes[s];
+        unsigned state = 1;
+        size_t i, j;
+        for (i = 0; i < 1000; ++i) {
+            char* record = records + i * size;
+            int key;
+            state = state * 1103515245U + 12345U;
+            key = ghost_static_cast(int, (state >> 16) % 300U);
+            *ghost_static_cast(int*, ghost_static_cast(void*, record)) = key;
+            for (j = sizeof(int); j < size; ++j)
+                record[j] = ghost_static_cast(char, (ghost_static_cast(size_t, key) + j) & 0x7F);
+        }
+        TEST_QSORT(records, 1000, size);
+        for (i = 0; i < 1000; ++i) {
+            char* record = records + i * size;
+            int key = *ghost_static_cast(int*, ghost_static_cast(void*, record));
+            if (i > 0 && *ghost_static_cast(int*, ghost_static_cast(void*, record - size)) > key)
+                break;
+            for (j = sizeof(int); j < size; ++j)
+                if (record[j] != ghost_static_cast(char, (ghost_static_cast(size_t, key) + j) & 0x7F))
+                    break;
+            if (j != size)
+                break;
+        }
+        mirror_eq_z(i, 1000);
+    }
+}
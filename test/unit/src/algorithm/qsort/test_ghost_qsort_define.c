@@ -0,0 +1,164 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/qsort/ghost_qsort_define.h"
+
+#ifndef ghost_has_GHOST_QSORT_DEFINE
+    #error "ghost/algorithm/qsort/ghost_qsort_define.h must define ghost_has_GHOST_QSORT_DEFINE."
+#endif
+
+#include "test_common.h"
+
+#if !ghost_has_GHOST_QSORT_DEFINE
+    #error "GHOST_QSORT_DEFINE must exist."
+#endif
+
+#include "ghost/language/ghost_array_count.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/string/ghost_memcmp.h"
+#include "ghost/type/uint32_t/ghost_uint32_t.h"
+
+#define test_int_less(left, right) (*(left) < *(right))
+GHOST_QSORT_DEFINE(test_sort_ints, int, test_int_less)
+
+typedef struct test_record_t {
+    unsigned key;
+    unsigned value;
+} test_record_t;
+
+static int test_record_less(const test_record_t* left, const test_record_t* right) {
+    return left->key < right->key;
+}
+
+GHOST_QSORT_DEFINE(test_sort_records, test_record_t, test_record_less)
+
+#define test_u32_less(left, right) (*(left) < *(right))
+GHOST_QSORT_DEFINE(test_sort_u32, ghost_uint32_t, test_u32_less)
+
+typedef struct test_wide_record_t {
+    unsigned key;
+    unsigned padding[9];
+} test_wide_record_t;
+
+#define test_wide_record_less(left, right) ((left)->key < (right)->key)
+GHOST_QSORT_DEFINE(test_sort_wide_records, test_wide_record_t, test_wide_record_less)
+
+static unsigned test_qsort_define_random(unsigned* state) {
+    *state = *state * 1103515245U + 12345U;
+    return (*state >> 16) & 0x7FFFU;
+}
+
+mirror() {
+    int expected[] = {1, 2, 3, 4, 4, 5, 6};
+    int actual[] = {4, 1, 6, 4, 2, 5, 3};
+    test_sort_ints(actual, ghost_array_count(actual));
+    mirror_eq(0, ghost_memcmp(expected, actual, sizeof(expected)));
+}
+
+mirror() {
+    /* Large enough to partition, with lots of duplicates */
+    test_record_t records[1000];
+    unsigned state = 1;
+    unsigned sum = 0;
+    size_t i;
+    for (i = 0; i < ghost_array_count(records); ++i) {
+        records[i].key = test_qsort_define_random(&state) % 50;
+        records[i].value = records[i].key * 3;
+        sum += records[i].key;
+    }
+    test_sort_records(records, ghost_array_count(records));
+    for (i = 0; i < ghost_array_count(records); ++i) {
+        mirror_eq_u32(records[i].value, records[i].key * 3);
+        sum -= records[i].key;
+        if (i > 0)
+            mirror_check(records[i - 1].key <= records[i].key);
+    }
+    mirror_eq_u32(sum, 0);
+}
+
+mirror() {
+    /* Sorted and reverse sorted */
+    int values[500];
+    size_t i;
+    for (i = 0; i < ghost_array_count(values); ++i)
+        values[i] = ghost_static_cast(int, ghost_array_count(values) - i);
+    test_sort_ints(values, ghost_array_count(values));
+    for (i = 0; i < ghost_array_count(values); ++i)
+        mirror_eq_i(values[i], ghost_static_cast(int, i + 1));
+    test_sort_ints(values, ghost_array_count(values));
+    for (i = 0; i < ghost_array_count(values); ++i)
+        mirror_eq_i(values[i], ghost_static_cast(int, i + 1));
+}
+
+mirror() {
+    /* 4-byte elements use the block partition and sorting networks. We sort
+     * random keys, few distinct keys and a sorted array with an unsorted
+     * tail. */
+    static ghost_uint32_t values[20000];
+    unsigned pattern;
+    for (pattern = 0; pattern < 3; ++pattern) {
+        unsigned state = 1;
+        ghost_uint32_t sum = 0;
+        size_t i;
+        for (i = 0; i < ghost_array_count(values); ++i) {
+            if (pattern == 0)
+                values[i] = test_qsort_define_random(&state);
+            else if (pattern == 1)
+                values[i] = test_qsort_define_random(&state) % 3;
+            else if (i < ghost_array_count(values) - 100)
+                values[i] = ghost_static_cast(ghost_uint32_t, i);
+            else
+                values[i] = test_qsort_define_random(&state);
+            sum += values[i];
+        }
+        test_sort_u32(values, ghost_array_count(values));
+        for (i = 0; i < ghost_array_count(values); ++i) {
+            sum -= values[i];
+            if (i > 0 && values[i - 1] > values[i])
+                break;
+        }
+        mirror_eq_z(i, ghost_array_count(values));
+        mirror_eq_u32(sum, 0);
+    }
+}
+
+mirror() {
+    /* Elements that don't fit a size class are swapped in chunks */
+    static test_wide_record_t records[1000];
+    unsigned state = 1;
+    size_t i, j;
+    for (i = 0; i < ghost_array_count(records); ++i) {
+        records[i].key = test_qsort_define_random(&state) % 200;
+        for (j = 0; j < ghost_array_count(records[i].padding); ++j)
+            records[i].padding[j] = records[i].key + ghost_static_cast(unsigned, j);
+    }
+    test_sort_wide_records(records, ghost_array_count(records));
+    for (i = 0; i < ghost_array_count(records); ++i) {
+        if (i > 0 && records[i - 1].key > records[i].key)
+            break;
+        for (j = 0; j < ghost_array_count(records[i].padding); ++j)
+            if (records[i].padding[j] != records[i].key + ghost_static_cast(unsigned, j))
+                break;
+        if (j != ghost_array_count(records[i].padding))
+            break;
+    }
+    mirror_eq_z(i, ghost_array_count(records));
+}
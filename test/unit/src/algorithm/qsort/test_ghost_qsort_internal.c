@@ -21,11 +21,92 @@
 
 #define GHOST_STATIC_DEFS 1
 #define GHOST_QSORT_FORCE_INTERNAL 1
+/* Indirect sorting is off by default so we enable it here to test it */
+#define GHOST_QSORT_INDIRECT_THRESHOLD 512
 #include "ghost/algorithm/qsort/ghost_qsort.h"
 
 #if !ghost_has_ghost_qsort
     #error "ghost_qsort must exist."
 #endif
 
+#include "ghost/language/ghost_discard.h"
+#include "ghost/language/ghost_optimize_for_size_opt.h"
+#include "ghost/type/uint32_t/ghost_uint32_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+
 #define TEST_GHOST_QSORT
 #include "test_ghost_qsort.t.h"
+
+/*
+ * 4-byte and 8-byte elements are block partitioned. Runs of equal keys must
+ * still be gathered by the three-way partition so that many duplicates sort
+ * in linear time. We count comparisons to check this.
+ */
+
+static size_t test_ghost_qsort_internal_compare_count;
+
+static int test_ghost_qsort_internal_compare_u32(const void* pa, const void* pb) {
+    ghost_uint32_t a = *ghost_static_cast(const ghost_uint32_t*, pa);
+    ghost_uint32_t b = *ghost_static_cast(const ghost_uint32_t*, pb);
+    ++test_ghost_qsort_internal_compare_count;
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+static int test_ghost_qsort_internal_compare_u64(const void* pa, const void* pb) {
+    ghost_uint64_t a = *ghost_static_cast(const ghost_uint64_t*, pa);
+    ghost_uint64_t b = *ghost_static_cast(const ghost_uint64_t*, pb);
+    ++test_ghost_qsort_internal_compare_count;
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+mirror() {
+    static ghost_uint32_t values32[50000];
+    static ghost_uint64_t values64[50000];
+    static const unsigned distinct[] = {1, 2, 3, 5};
+    size_t count = ghost_array_count(values32);
+    size_t d;
+    for (d = 0; d < ghost_array_count(distinct); ++d) {
+        unsigned state = 1;
+        size_t counts32[5] = {0};
+        size_t counts64[5] = {0};
+        size_t compares32, compares64;
+        size_t i;
+        for (i = 0; i < count; ++i) {
+            state = state * 1103515245U + 12345U;
+            values32[i] = ghost_static_cast(ghost_uint32_t, (state >> 16) % distinct[d]);
+            values64[i] = ghost_static_cast(ghost_uint64_t, values32[i]) << 40;
+        }
+
+        test_ghost_qsort_internal_compare_count = 0;
+        ghost_qsort(values32, count, sizeof(*values32), &test_ghost_qsort_internal_compare_u32);
+        compares32 = test_ghost_qsort_internal_compare_count;
+        test_ghost_qsort_internal_compare_count = 0;
+        ghost_qsort(values64, count, sizeof(*values64), &test_ghost_qsort_internal_compare_u64);
+        compares64 = test_ghost_qsort_internal_compare_count;
+
+        for (i = 0; i < count; ++i) {
+            if (i > 0 && (values32[i - 1] > values32[i] || values64[i - 1] > values64[i]))
+                break;
+            if (values64[i] != ghost_static_cast(ghost_uint64_t, values32[i]) << 40)
+                break;
+            ++counts32[values32[i]];
+            ++counts64[values64[i] >> 40];
+        }
+        mirror_eq_z(i, count);
+        for (i = 0; i < distinct[d]; ++i) {
+            mirror_check(counts32[i] > 0);
+            mirror_eq_z(counts32[i], counts64[i]);
+        }
+
+        /* A comparison sort of distinct keys would need about 16 comparisons
+         * per element at this size. (The shellsort used when optimizing for
+         * size makes no such guarantee.) */
+        #if !GHOST_OPTIMIZE_FOR_SIZE_OPT
+        mirror_check(compares32 < 2 * count * (distinct[d] + 1));
+        mirror_check(compares64 < 2 * count * (distinct[d] + 1));
+        #else
+        ghost_discard(compares32);
+        ghost_discard(compares64);
+        #endif
+    }
+}
@@ -0,0 +1,33 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/* Use a small threshold so that we actually use threads */
+#define GHOST_STATIC_DEFS 1
+#define GHOST_QSORT_PARALLEL_THRESHOLD 1000
+#include "ghost/algorithm/qsort/ghost_win_qsort_parallel_s.h"
+
+#if !ghost_has_ghost_win_qsort_parallel_s
+    #error "ghost_win_qsort_parallel_s must exist."
+#endif
+
+#define TEST_GHOST_QSORT_WIN
+#define TEST_GHOST_QSORT_PARALLEL
+#include "test_ghost_qsort.t.h"
@@ -0,0 +1,46 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_push.h"
+
+#ifndef ghost_has_ghost_rabin_karp_push
+    #error "ghost/algorithm/rabin_karp/ghost_rabin_karp_push.h must define ghost_has_ghost_rabin_karp_push."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_rabin_karp_push
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_t.h"
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_init.h"
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_push.h"
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_roll.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+
+mirror() {
+    ghost_rabin_karp_t state;
+    ghost_uint64_t base = GHOST_UINT64_C(0x9E3779B97F4A7C15);
+    ghost_rabin_karp_init(&state, 3);
+    mirror_check(ghost_rabin_karp_push(&state, 'a') == 'a');
+    mirror_check(ghost_rabin_karp_push(&state, 'b') == 'a' * base + 'b');
+    mirror_check(ghost_rabin_karp_push(&state, 'c') == ('a' * base + 'b') * base + 'c');
+}
+#endif
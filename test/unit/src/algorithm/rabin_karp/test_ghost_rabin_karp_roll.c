@@ -0,0 +1,74 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_roll.h"
+
+#ifndef ghost_has_ghost_rabin_karp_roll
+    #error "ghost/algorithm/rabin_karp/ghost_rabin_karp_roll.h must define ghost_has_ghost_rabin_karp_roll."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_rabin_karp_roll
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_t.h"
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_init.h"
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_push.h"
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_roll.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "ghost/language/ghost_static_cast.h"
+
+static unsigned char test_rabin_karp_bytes[200];
+
+static void test_rabin_karp_fill(void) {
+    ghost_uint64_t x = GHOST_UINT64_C(0x0123456789ABCDEF);
+    size_t i;
+    for (i = 0; i < sizeof(test_rabin_karp_bytes); ++i) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        test_rabin_karp_bytes[i] = ghost_static_cast(unsigned char, x >> 56);
+    }
+}
+
+
+mirror() {
+    /* Rolling gives the same hash as pushing the window into a fresh state. */
+    size_t window;
+    test_rabin_karp_fill();
+    for (window = 1; window <= 40; ++window) {
+        ghost_rabin_karp_t rolling;
+        size_t i;
+        ghost_rabin_karp_init(&rolling, window);
+        for (i = 0; i < window; ++i)
+            ghost_rabin_karp_push(&rolling, test_rabin_karp_bytes[i]);
+        for (i = window; i < sizeof(test_rabin_karp_bytes); ++i) {
+            ghost_rabin_karp_t fresh;
+            ghost_uint64_t expected = 0;
+            size_t j;
+            ghost_rabin_karp_init(&fresh, window);
+            for (j = i + 1 - window; j <= i; ++j)
+                expected = ghost_rabin_karp_push(&fresh, test_rabin_karp_bytes[j]);
+            mirror_check(expected == ghost_rabin_karp_roll(&rolling,
+                        test_rabin_karp_bytes[i - window], test_rabin_karp_bytes[i]));
+        }
+    }
+}
+#endif
@@ -0,0 +1,79 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_t.h"
+
+#ifndef ghost_has_ghost_rabin_karp_t
+    #error "ghost/algorithm/rabin_karp/ghost_rabin_karp_t.h must define ghost_has_ghost_rabin_karp_t."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_rabin_karp_t
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_t.h"
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_init.h"
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_push.h"
+#include "ghost/algorithm/rabin_karp/ghost_rabin_karp_roll.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/string/ghost_strlen.h"
+#include "ghost/string/ghost_memcmp.h"
+
+
+static size_t test_rabin_karp_count(const char* haystack, const char* needle) {
+    size_t haystack_length = ghost_strlen(haystack);
+    size_t needle_length = ghost_strlen(needle);
+    ghost_rabin_karp_t state;
+    ghost_uint64_t target = 0;
+    ghost_uint64_t hash = 0;
+    size_t count = 0;
+    size_t i;
+
+    if (needle_length > haystack_length)
+        return 0;
+
+    ghost_rabin_karp_init(&state, needle_length);
+    for (i = 0; i < needle_length; ++i)
+        target = ghost_rabin_karp_push(&state, ghost_static_cast(unsigned char, needle[i]));
+
+    ghost_rabin_karp_init(&state, needle_length);
+    for (i = 0; i < haystack_length; ++i) {
+        if (i < needle_length)
+            hash = ghost_rabin_karp_push(&state, ghost_static_cast(unsigned char, haystack[i]));
+        else
+            hash = ghost_rabin_karp_roll(&state, ghost_static_cast(unsigned char, haystack[i - needle_length]),
+                    ghost_static_cast(unsigned char, haystack[i]));
+        if (i + 1 >= needle_length && hash == target &&
+                0 == ghost_memcmp(haystack + i + 1 - needle_length, needle, needle_length))
+            ++count;
+    }
+    return count;
+}
+
+mirror() {
+    /* substring search */
+    mirror_eq_z(2, test_rabin_karp_count("the cat sat on the mat", "the"));
+    mirror_eq_z(3, test_rabin_karp_count("the cat sat on the mat", "at"));
+    mirror_eq_z(1, test_rabin_karp_count("the cat sat on the mat", "the cat sat on the mat"));
+    mirror_eq_z(0, test_rabin_karp_count("the cat sat on the mat", "dog"));
+    mirror_eq_z(4, test_rabin_karp_count("aaaaa", "aa"));
+}
+#endif
@@ -0,0 +1,144 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/*
+ * This is a template for testing the radix sort functions.
+ *
+ * Define TEST_RADIX_SORT to the function to test, TEST_RADIX_TYPE to its key
+ * type and TEST_RADIX_KEY(x) to convert a random ghost_uint64_t to a key. If
+ * TEST_RADIX_RECORDS is defined, TEST_RADIX_SORT is a records variant and
+ * it's tested with a record containing the key and a payload.
+ */
+
+#include "ghost/language/ghost_array_count.h"
+#include "ghost/language/ghost_offsetof.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+#define TEST_RADIX_COUNT 3000
+
+static ghost_uint64_t test_radix_random(ghost_uint64_t* state) {
+    /* xorshift64 */
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+#ifndef TEST_RADIX_RECORDS
+static TEST_RADIX_TYPE test_radix_array[TEST_RADIX_COUNT];
+static TEST_RADIX_TYPE test_radix_scratch[TEST_RADIX_COUNT];
+
+static void test_radix_check_sorted(size_t count) {
+    size_t i;
+    for (i = 1; i < count; ++i)
+        mirror_check(!(test_radix_array[i] < test_radix_array[i - 1]));
+}
+
+mirror() {
+    /* Empty and single element arrays */
+    TEST_RADIX_SORT(test_radix_array, test_radix_scratch, 0);
+    test_radix_array[0] = TEST_RADIX_KEY(GHOST_UINT64_C(12345));
+    TEST_RADIX_SORT(test_radix_array, test_radix_scratch, 1);
+    mirror_check(test_radix_array[0] == TEST_RADIX_KEY(GHOST_UINT64_C(12345)));
+}
+
+mirror() {
+    /* Random keys using all bits */
+    ghost_uint64_t state = GHOST_UINT64_C(0x9E3779B97F4A7C15);
+    size_t i;
+    for (i = 0; i < TEST_RADIX_COUNT; ++i)
+        test_radix_array[i] = TEST_RADIX_KEY(test_radix_random(&state));
+    TEST_RADIX_SORT(test_radix_array, test_radix_scratch, TEST_RADIX_COUNT);
+    test_radix_check_sorted(TEST_RADIX_COUNT);
+}
+
+mirror() {
+    /* Small keys. Only the low byte varies so all other passes are skipped
+     * and the result has to be copied back out of the scratch buffer. */
+    ghost_uint64_t state = 1;
+    size_t i;
+    for (i = 0; i < TEST_RADIX_COUNT; ++i)
+        test_radix_array[i] = TEST_RADIX_KEY(test_radix_random(&state) & 0xFF);
+    TEST_RADIX_SORT(test_radix_array, test_radix_scratch, TEST_RADIX_COUNT);
+    test_radix_check_sorted(TEST_RADIX_COUNT);
+}
+
+mirror() {
+    /* Reverse sorted */
+    size_t i;
+    for (i = 0; i < TEST_RADIX_COUNT; ++i)
+        test_radix_array[i] = TEST_RADIX_KEY(ghost_static_cast(ghost_uint64_t, TEST_RADIX_COUNT - i) * 1000);
+    TEST_RADIX_SORT(test_radix_array, test_radix_scratch, TEST_RADIX_COUNT);
+    test_radix_check_sorted(TEST_RADIX_COUNT);
+    for (i = 0; i < TEST_RADIX_COUNT; ++i)
+        mirror_check(test_radix_array[i] == TEST_RADIX_KEY(ghost_static_cast(ghost_uint64_t, i + 1) * 1000));
+}
+
+#else
+typedef struct test_radix_record_t {
+    char tag;
+    TEST_RADIX_TYPE key;
+    size_t index;
+} test_radix_record_t;
+
+static test_radix_record_t test_radix_records[TEST_RADIX_COUNT];
+static test_radix_record_t test_radix_scratch[TEST_RADIX_COUNT];
+
+mirror() {
+    /* The sort must be stable so we use few unique keys and check that the
+     * original order is preserved among equal keys. */
+    ghost_uint64_t state = GHOST_UINT64_C(0x9E3779B97F4A7C15);
+    size_t i;
+    for (i = 0; i < TEST_RADIX_COUNT; ++i) {
+        ghost_uint64_t random = test_radix_random(&state);
+        test_radix_records[i].tag = ghost_static_cast(char, 'a' + random % 26);
+        test_radix_records[i].key = TEST_RADIX_KEY((random >> 8) % 7 * GHOST_UINT64_C(0x0101010101010101));
+        test_radix_records[i].index = i;
+    }
+    TEST_RADIX_SORT(test_radix_records, test_radix_scratch, TEST_RADIX_COUNT,
+            sizeof(test_radix_record_t), ghost_offsetof(test_radix_record_t, key));
+    for (i = 1; i < TEST_RADIX_COUNT; ++i) {
+        mirror_check(!(test_radix_records[i].key < test_radix_records[i - 1].key));
+        if (test_radix_records[i].key == test_radix_records[i - 1].key)
+            mirror_check(test_radix_records[i - 1].index < test_radix_records[i].index);
+    }
+}
+
+mirror() {
+    /* Records are moved whole */
+    ghost_uint64_t state = 1;
+    size_t i;
+    for (i = 0; i < TEST_RADIX_COUNT; ++i) {
+        test_radix_records[i].key = TEST_RADIX_KEY(test_radix_random(&state));
+        test_radix_records[i].index = i;
+        test_radix_records[i].tag = ghost_static_cast(char, 'a' + i % 26);
+    }
+    TEST_RADIX_SORT(test_radix_records, test_radix_scratch, TEST_RADIX_COUNT,
+            sizeof(test_radix_record_t), ghost_offsetof(test_radix_record_t, key));
+    for (i = 0; i < TEST_RADIX_COUNT; ++i) {
+        mirror_check(test_radix_records[i].tag == ghost_static_cast(char, 'a' + test_radix_records[i].index % 26));
+        if (i > 0)
+            mirror_check(!(test_radix_records[i].key < test_radix_records[i - 1].key));
+    }
+}
+#endif
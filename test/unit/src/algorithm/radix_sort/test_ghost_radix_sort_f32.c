@@ -0,0 +1,68 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/radix_sort/ghost_radix_sort_f32.h"
+
+#ifndef ghost_has_ghost_radix_sort_f32
+    #error "ghost/algorithm/radix_sort/ghost_radix_sort_f32.h must define ghost_has_ghost_radix_sort_f32."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_radix_sort_f32
+#include "ghost/type/int64_t/ghost_int64_t.h"
+#define TEST_RADIX_SORT ghost_radix_sort_f32
+#define TEST_RADIX_TYPE ghost_float32_t
+#define TEST_RADIX_KEY(x) ghost_static_cast(ghost_float32_t, ghost_static_cast(double, ghost_static_cast(ghost_int64_t, x)) / 268435456.0)
+#include "test_ghost_radix_sort.t.h"
+
+#include "ghost/string/ghost_memcpy.h"
+#include "ghost/type/uint32_t/ghost_uint32_t.h"
+#include "ghost/type/uint32_t/ghost_uint32_c.h"
+
+mirror() {
+    /* Special values have a well-defined order */
+    static const ghost_uint32_t expected[] = {
+        GHOST_UINT32_C(0xFFC00000), /* -NaN */
+        GHOST_UINT32_C(0xFF800000), /* -infinity */
+        GHOST_UINT32_C(0xBF800000), /* -1.0 */
+        GHOST_UINT32_C(0x80000001), /* -denormal */
+        GHOST_UINT32_C(0x80000000), /* -0.0 */
+        GHOST_UINT32_C(0x00000000), /* +0.0 */
+        GHOST_UINT32_C(0x00000001), /* +denormal */
+        GHOST_UINT32_C(0x3F800000), /* +1.0 */
+        GHOST_UINT32_C(0x7F800000), /* +infinity */
+        GHOST_UINT32_C(0x7FC00000), /* +NaN */
+    };
+    static const size_t shuffle[] = {7, 4, 9, 0, 5, 2, 8, 1, 6, 3};
+    ghost_float32_t values[10];
+    ghost_float32_t scratch[10];
+    size_t i;
+    for (i = 0; i < 10; ++i)
+        ghost_memcpy(&values[i], &expected[shuffle[i]], sizeof(values[i]));
+    ghost_radix_sort_f32(values, scratch, 10);
+    for (i = 0; i < 10; ++i) {
+        ghost_uint32_t actual;
+        ghost_memcpy(&actual, &values[i], sizeof(actual));
+        mirror_check(actual == expected[i]);
+    }
+}
+#endif
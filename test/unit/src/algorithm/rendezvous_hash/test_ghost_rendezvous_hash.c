@@ -0,0 +1,92 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/rendezvous_hash/ghost_rendezvous_hash.h"
+
+#ifndef ghost_has_ghost_rendezvous_hash
+    #error "ghost/algorithm/rendezvous_hash/ghost_rendezvous_hash.h must define ghost_has_ghost_rendezvous_hash."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_rendezvous_hash
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+static ghost_uint64_t test_ghost_rendezvous_hash_key(ghost_uint64_t i) {
+    return i * GHOST_UINT64_C(0x9E3779B97F4A7C15);
+}
+
+mirror() {
+    /* The choice doesn't depend on the order of the nodes. */
+    ghost_uint64_t nodes[3] = {11, 22, 33};
+    ghost_uint64_t reversed[3] = {33, 22, 11};
+    ghost_uint64_t i;
+    for (i = 0; i < 1000; ++i) {
+        ghost_uint64_t key = test_ghost_rendezvous_hash_key(i);
+        mirror_eq_u64(nodes[ghost_rendezvous_hash(key, nodes, 3)],
+                reversed[ghost_rendezvous_hash(key, reversed, 3)]);
+    }
+    mirror_eq_z(0, ghost_rendezvous_hash(1234, nodes, 1));
+}
+
+mirror() {
+    /* Removing a node only moves its own keys, and spreads them over the
+     * remaining nodes. Keys are spread evenly. */
+    ghost_uint64_t nodes[8] = {
+        GHOST_UINT64_C(0x243F6A8885A308D3), GHOST_UINT64_C(0x13198A2E03707344),
+        GHOST_UINT64_C(0xA4093822299F31D0), GHOST_UINT64_C(0x082EFA98EC4E6C89),
+        GHOST_UINT64_C(0x452821E638D01377), GHOST_UINT64_C(0xBE5466CF34E90C6C),
+        GHOST_UINT64_C(0xC0AC29B7C97C50DD), GHOST_UINT64_C(0x3F84D5B5B5470917),
+    };
+    ghost_uint64_t removed[7];
+    unsigned counts[8] = {0};
+    unsigned moved_to[8] = {0};
+    ghost_size_t i;
+    ghost_uint64_t key;
+
+    /* remove node 3 */
+    for (i = 0; i < 7; ++i)
+        removed[i] = nodes[i < 3 ? i : i + 1];
+
+    for (key = 0; key < 16000; ++key) {
+        ghost_uint64_t hashed = test_ghost_rendezvous_hash_key(key);
+        ghost_size_t before = ghost_rendezvous_hash(hashed, nodes, 8);
+        ghost_size_t after = ghost_rendezvous_hash(hashed, removed, 7);
+        ghost_size_t after_index = after < 3 ? after : after + 1;
+        mirror_check(before < 8 && after < 7);
+        if (before >= 8 || after >= 7)
+            break;
+        ++counts[before];
+        if (before != 3) {
+            mirror_eq_z(before, after_index);
+        } else {
+            ++moved_to[after_index];
+        }
+    }
+
+    for (i = 0; i < 8; ++i)
+        mirror_check(counts[i] > 2000 * 8 / 10 && counts[i] < 2000 * 12 / 10);
+    mirror_check(moved_to[3] == 0);
+    for (i = 0; i < 8; ++i)
+        if (i != 3)
+            mirror_check(moved_to[i] > counts[3] / 7 / 2);
+}
+#endif
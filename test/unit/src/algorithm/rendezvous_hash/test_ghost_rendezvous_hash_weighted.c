@@ -0,0 +1,91 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/rendezvous_hash/ghost_rendezvous_hash_weighted.h"
+
+#ifndef ghost_has_ghost_rendezvous_hash_weighted
+    #error "ghost/algorithm/rendezvous_hash/ghost_rendezvous_hash_weighted.h must define ghost_has_ghost_rendezvous_hash_weighted."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_rendezvous_hash_weighted
+#include "ghost/math/log/ghost_log_d.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+static ghost_uint64_t test_ghost_rendezvous_hash_weighted_key(ghost_uint64_t i) {
+    return i * GHOST_UINT64_C(0x9E3779B97F4A7C15);
+}
+
+mirror() {
+    /* Keys are spread in proportion to the weights. Nodes with no weight are
+     * never chosen. */
+    ghost_uint64_t nodes[5] = {101, 202, 303, 404, 505};
+    double weights[5] = {1.0, 2.0, 0.0, 4.0, 1.0};
+    unsigned counts[5] = {0};
+    ghost_uint64_t key;
+    for (key = 0; key < 16000; ++key) {
+        ghost_size_t index = ghost_rendezvous_hash_weighted(
+                test_ghost_rendezvous_hash_weighted_key(key), nodes, weights, 5);
+        mirror_check(index < 5);
+        ++counts[index];
+    }
+    mirror_check(counts[2] == 0);
+    mirror_check(counts[0] > 2000 * 8 / 10 && counts[0] < 2000 * 12 / 10);
+    mirror_check(counts[1] > 4000 * 8 / 10 && counts[1] < 4000 * 12 / 10);
+    mirror_check(counts[3] > 8000 * 8 / 10 && counts[3] < 8000 * 12 / 10);
+    mirror_check(counts[4] > 2000 * 8 / 10 && counts[4] < 2000 * 12 / 10);
+}
+
+mirror() {
+    /* Raising one node's weight only moves keys to that node. */
+    ghost_uint64_t nodes[4] = {7, 8, 9, 10};
+    double before_weights[4] = {1.0, 1.0, 1.0, 1.0};
+    double after_weights[4] = {1.0, 1.0, 3.0, 1.0};
+    ghost_uint64_t key;
+    for (key = 0; key < 4000; ++key) {
+        ghost_uint64_t hashed = test_ghost_rendezvous_hash_weighted_key(key);
+        ghost_size_t before = ghost_rendezvous_hash_weighted(hashed, nodes, before_weights, 4);
+        ghost_size_t after = ghost_rendezvous_hash_weighted(hashed, nodes, after_weights, 4);
+        mirror_check(after == before || after == 2);
+    }
+}
+
+mirror() {
+    /* Scores are scaled strictly inside (0,1) even at the extremes. The
+     * largest score used to round up to exactly 1.0 which made its node rank
+     * last instead of first. */
+    double high = ghost_impl_rendezvous_hash_weighted_unit(~GHOST_UINT64_C(0));
+    double low = ghost_impl_rendezvous_hash_weighted_unit(0);
+    mirror_check(high < 1.0);
+    mirror_check(low > 0.0);
+    mirror_check(-ghost_log_d(high) > 0.0);
+    mirror_check(ghost_impl_rendezvous_hash_weighted_unit(~GHOST_UINT64_C(0) - 4096) < high);
+}
+
+mirror() {
+    /* If no node has a positive weight, count is returned. */
+    ghost_uint64_t nodes[2] = {1, 2};
+    double weights[2] = {0.0, -1.0};
+    mirror_eq_z(2, ghost_rendezvous_hash_weighted(5, nodes, weights, 2));
+    mirror_eq_z(0, ghost_rendezvous_hash_weighted(5, nodes, weights, 0));
+}
+#endif
@@ -0,0 +1,58 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/sort_small/ghost_sort_f64_small.h"
+
+#ifndef ghost_has_ghost_sort_f64_small
+    #error "ghost/algorithm/sort_small/ghost_sort_f64_small.h must define ghost_has_ghost_sort_f64_small."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_sort_f64_small
+#include "ghost/type/int64_t/ghost_int64_t.h"
+#define TEST_SORT_SMALL ghost_sort_f64_small
+#define TEST_SORT_SMALL_TYPE ghost_float64_t
+#define TEST_SORT_SMALL_KEY(x) ghost_static_cast(ghost_float64_t, ghost_static_cast(double, ghost_static_cast(ghost_int64_t, x)) / 268435456.0)
+#include "test_ghost_sort_small.t.h"
+
+#include "ghost/string/ghost_memcpy.h"
+
+mirror() {
+    /* NaNs aren't ordered but the result must still be a permutation */
+    ghost_float64_t values[9];
+    ghost_uint64_t nan_bits = GHOST_UINT64_C(0x7FF8000000000000);
+    size_t nans = 0;
+    size_t i;
+    for (i = 0; i < 9; ++i) {
+        if (i % 3 == 1)
+            ghost_memcpy(&values[i], &nan_bits, sizeof(values[i]));
+        else
+            values[i] = ghost_static_cast(ghost_float64_t, 9 - i);
+    }
+    ghost_sort_f64_small(values, 9);
+    for (i = 0; i < 9; ++i) {
+        if (values[i] != values[i])
+            ++nans;
+    }
+    mirror_eq_z(nans, 3);
+}
+#endif
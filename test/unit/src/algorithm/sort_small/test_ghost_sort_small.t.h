@@ -0,0 +1,139 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/*
+ * This is a template for testing the small sort functions.
+ *
+ * Define TEST_SORT_SMALL_TYPE to the element type and TEST_SORT_SMALL_KEY(x)
+ * to convert a random ghost_uint64_t to an element. Then define either
+ * TEST_SORT_SMALL to the function to test or TEST_SORT_SMALL_ROWS to the
+ * _rows() function to test.
+ */
+
+#include "ghost/language/ghost_array_count.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+/* Long enough to cover all of the network's merge levels for each count,
+ * plus a few past GHOST_IMPL_SORT_SMALL_ROWS_MAX */
+#define TEST_SORT_SMALL_MAX 40
+
+static ghost_uint64_t test_sort_small_random(ghost_uint64_t* state) {
+    /* xorshift64 */
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/* Fills the array with keys, with duplicates if few_unique is set. */
+static void test_sort_small_fill(TEST_SORT_SMALL_TYPE* array, size_t count,
+        ghost_uint64_t* state, int few_unique)
+{
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        ghost_uint64_t random = test_sort_small_random(state);
+        if (few_unique)
+            random %= 4;
+        array[i] = TEST_SORT_SMALL_KEY(random);
+    }
+}
+
+/* Sorts the expected result with a plain insertion sort */
+static void test_sort_small_reference(TEST_SORT_SMALL_TYPE* array, size_t count) {
+    size_t i;
+    size_t j;
+    for (i = 1; i < count; ++i) {
+        TEST_SORT_SMALL_TYPE value = array[i];
+        for (j = i; j > 0 && value < array[j - 1]; --j)
+            array[j] = array[j - 1];
+        array[j] = value;
+    }
+}
+
+#ifdef TEST_SORT_SMALL
+mirror() {
+    /* Every count up to the maximum, with both unique and duplicate keys */
+    TEST_SORT_SMALL_TYPE actual[TEST_SORT_SMALL_MAX];
+    TEST_SORT_SMALL_TYPE expected[TEST_SORT_SMALL_MAX];
+    ghost_uint64_t state = GHOST_UINT64_C(0x9E3779B97F4A7C15);
+    size_t count;
+    size_t i;
+    int round;
+    for (round = 0; round < 20; ++round) {
+        for (count = 0; count <= TEST_SORT_SMALL_MAX; ++count) {
+            test_sort_small_fill(actual, count, &state, round % 2);
+            for (i = 0; i < count; ++i)
+                expected[i] = actual[i];
+            test_sort_small_reference(expected, count);
+            TEST_SORT_SMALL(actual, count);
+            for (i = 0; i < count; ++i)
+                if (!(actual[i] == expected[i]))
+                    break;
+            mirror_eq_z(i, count);
+        }
+    }
+}
+
+mirror() {
+    /* Reverse sorted */
+    TEST_SORT_SMALL_TYPE actual[16];
+    size_t i;
+    for (i = 0; i < 16; ++i)
+        actual[i] = TEST_SORT_SMALL_KEY(16 - i);
+    TEST_SORT_SMALL(actual, 16);
+    for (i = 0; i < 16; ++i)
+        mirror_check(actual[i] == TEST_SORT_SMALL_KEY(i + 1));
+}
+#endif
+
+#ifdef TEST_SORT_SMALL_ROWS
+mirror() {
+    /* Row counts that are and aren't multiples of the SIMD width, and row
+     * lengths up to and past the transposable maximum */
+    static const size_t row_counts[] = {0, 1, 3, 4, 5, 9, 16};
+    static const size_t row_lengths[] = {1, 2, 3, 5, 8, 13, 16, 32, 33, 40};
+    static TEST_SORT_SMALL_TYPE actual[16 * TEST_SORT_SMALL_MAX];
+    static TEST_SORT_SMALL_TYPE expected[16 * TEST_SORT_SMALL_MAX];
+    ghost_uint64_t state = GHOST_UINT64_C(0x9E3779B97F4A7C15);
+    size_t c;
+    size_t l;
+    size_t i;
+    for (c = 0; c < ghost_array_count(row_counts); ++c) {
+        for (l = 0; l < ghost_array_count(row_lengths); ++l) {
+            size_t row_count = row_counts[c];
+            size_t row_length = row_lengths[l];
+            size_t total = row_count * row_length;
+            test_sort_small_fill(actual, total, &state, l % 2);
+            for (i = 0; i < total; ++i)
+                expected[i] = actual[i];
+            for (i = 0; i < row_count; ++i)
+                test_sort_small_reference(expected + i * row_length, row_length);
+            TEST_SORT_SMALL_ROWS(actual, row_count, row_length);
+            for (i = 0; i < total; ++i)
+                if (!(actual[i] == expected[i]))
+                    break;
+            mirror_eq_z(i, total);
+        }
+    }
+}
+#endif
@@ -0,0 +1,241 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/*
+ * This is a template for testing the sorted set functions.
+ *
+ * Define TEST_SORTED_SET to the function to test, TEST_SORTED_SET_TYPE to its
+ * element type and one of TEST_SORTED_SET_INTERSECT, TEST_SORTED_SET_UNION,
+ * TEST_SORTED_SET_DIFFERENCE or TEST_SORTED_SET_UNIQUE to select the
+ * operation. Results are compared against a naive reference implementation.
+ */
+
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+#define TEST_SORTED_SET_COUNT 2000
+
+static TEST_SORTED_SET_TYPE test_sorted_set_a[TEST_SORTED_SET_COUNT];
+static TEST_SORTED_SET_TYPE test_sorted_set_out[TEST_SORTED_SET_COUNT * 2];
+static TEST_SORTED_SET_TYPE test_sorted_set_expected[TEST_SORTED_SET_COUNT * 2];
+
+static ghost_uint64_t test_sorted_set_random(ghost_uint64_t* state) {
+    /* xorshift64 */
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+#ifndef TEST_SORTED_SET_UNIQUE
+static TEST_SORTED_SET_TYPE test_sorted_set_b[TEST_SORTED_SET_COUNT];
+
+/*
+ * Fills the array with count strictly increasing values starting near start.
+ * Each step is in [1, max_step]. For 64-bit types the high half of the values
+ * steps as well so that many values share their low 32 bits.
+ */
+static void test_sorted_set_fill(ghost_uint64_t* state, TEST_SORTED_SET_TYPE* array,
+        size_t count, TEST_SORTED_SET_TYPE start, unsigned max_step)
+{
+    TEST_SORTED_SET_TYPE value = start;
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        value = ghost_static_cast(TEST_SORTED_SET_TYPE, value +
+                1u + test_sorted_set_random(state) % max_step);
+        #if TEST_SORTED_SET_WIDE
+        if (test_sorted_set_random(state) % 4 == 0)
+            value = ghost_static_cast(TEST_SORTED_SET_TYPE, value + GHOST_UINT64_C(0x100000000));
+        #endif
+        array[i] = value;
+    }
+}
+
+static int test_sorted_set_contains(const TEST_SORTED_SET_TYPE* array, size_t count,
+        TEST_SORTED_SET_TYPE value)
+{
+    size_t i;
+    for (i = 0; i < count; ++i)
+        if (array[i] == value)
+            return 1;
+    return 0;
+}
+
+/* Computes the expected result of the operation the slow way. */
+static size_t test_sorted_set_reference(const TEST_SORTED_SET_TYPE* a, size_t a_count,
+        const TEST_SORTED_SET_TYPE* b, size_t b_count)
+{
+    size_t k = 0;
+    size_t i;
+    #if defined(TEST_SORTED_SET_INTERSECT)
+    for (i = 0; i < a_count; ++i)
+        if (test_sorted_set_contains(b, b_count, a[i]))
+            test_sorted_set_expected[k++] = a[i];
+    #elif defined(TEST_SORTED_SET_DIFFERENCE)
+    for (i = 0; i < a_count; ++i)
+        if (!test_sorted_set_contains(b, b_count, a[i]))
+            test_sorted_set_expected[k++] = a[i];
+    #elif defined(TEST_SORTED_SET_UNION)
+    /* a plus the elements of b not in a, insertion sorted */
+    for (i = 0; i < a_count; ++i)
+        test_sorted_set_expected[k++] = a[i];
+    for (i = 0; i < b_count; ++i) {
+        size_t j = k;
+        if (test_sorted_set_contains(a, a_count, b[i]))
+            continue;
+        for (; j > 0 && b[i] < test_sorted_set_expected[j - 1]; --j)
+            test_sorted_set_expected[j] = test_sorted_set_expected[j - 1];
+        test_sorted_set_expected[j] = b[i];
+        ++k;
+    }
+    #else
+        #error
+    #endif
+    return k;
+}
+
+static void test_sorted_set_check(ghost_uint64_t* state, size_t a_count, size_t b_count,
+        unsigned max_step)
+{
+    size_t expected;
+    size_t actual;
+    size_t i;
+
+    test_sorted_set_fill(state, test_sorted_set_a, a_count,
+            ghost_static_cast(TEST_SORTED_SET_TYPE, test_sorted_set_random(state) % 8), max_step);
+    test_sorted_set_fill(state, test_sorted_set_b, b_count,
+            ghost_static_cast(TEST_SORTED_SET_TYPE, test_sorted_set_random(state) % 8), max_step);
+    expected = test_sorted_set_reference(test_sorted_set_a, a_count, test_sorted_set_b, b_count);
+
+    actual = TEST_SORTED_SET(test_sorted_set_out, test_sorted_set_a, a_count, test_sorted_set_b, b_count);
+    mirror_eq_z(expected, actual);
+    for (i = 0; i < expected && i < actual; ++i)
+        mirror_check(test_sorted_set_expected[i] == test_sorted_set_out[i]);
+
+    #if !defined(TEST_SORTED_SET_UNION)
+    /* in place in a */
+    actual = TEST_SORTED_SET(test_sorted_set_a, test_sorted_set_a, a_count, test_sorted_set_b, b_count);
+    mirror_eq_z(expected, actual);
+    for (i = 0; i < expected && i < actual; ++i)
+        mirror_check(test_sorted_set_expected[i] == test_sorted_set_a[i]);
+    #endif
+
+    #if defined(TEST_SORTED_SET_INTERSECT)
+    /* in place in b (a was clobbered so regenerate the expected result) */
+    expected = test_sorted_set_reference(test_sorted_set_a, actual, test_sorted_set_b, b_count);
+    actual = TEST_SORTED_SET(test_sorted_set_b, test_sorted_set_a, actual, test_sorted_set_b, b_count);
+    mirror_eq_z(expected, actual);
+    for (i = 0; i < expected && i < actual; ++i)
+        mirror_check(test_sorted_set_expected[i] == test_sorted_set_b[i]);
+    #endif
+}
+
+mirror() {
+    /* empty inputs */
+    TEST_SORTED_SET_TYPE one = 1;
+    mirror_eq_z(0, TEST_SORTED_SET(test_sorted_set_out, test_sorted_set_a, 0, test_sorted_set_b, 0));
+    #if defined(TEST_SORTED_SET_INTERSECT)
+    mirror_eq_z(0, TEST_SORTED_SET(test_sorted_set_out, &one, 1, test_sorted_set_b, 0));
+    mirror_eq_z(0, TEST_SORTED_SET(test_sorted_set_out, test_sorted_set_a, 0, &one, 1));
+    #elif defined(TEST_SORTED_SET_DIFFERENCE)
+    mirror_eq_z(1, TEST_SORTED_SET(test_sorted_set_out, &one, 1, test_sorted_set_b, 0));
+    mirror_eq_z(0, TEST_SORTED_SET(test_sorted_set_out, test_sorted_set_a, 0, &one, 1));
+    #else
+    test_sorted_set_out[0] = 0;
+    mirror_eq_z(1, TEST_SORTED_SET(test_sorted_set_out, &one, 1, test_sorted_set_b, 0));
+    mirror_check(test_sorted_set_out[0] == 1);
+    test_sorted_set_out[0] = 0;
+    mirror_eq_z(1, TEST_SORTED_SET(test_sorted_set_out, test_sorted_set_a, 0, &one, 1));
+    mirror_check(test_sorted_set_out[0] == 1);
+    #endif
+}
+
+mirror() {
+    /* similar sizes, dense and sparse, to exercise the merge and SIMD paths */
+    ghost_uint64_t state = GHOST_UINT64_C(0x9E3779B97F4A7C15);
+    size_t count;
+    for (count = 1; count <= 64; ++count) {
+        test_sorted_set_check(&state, count, count, 2);
+        test_sorted_set_check(&state, count, count + 3, 4);
+        test_sorted_set_check(&state, count + 5, count, 3);
+    }
+    test_sorted_set_check(&state, TEST_SORTED_SET_COUNT, TEST_SORTED_SET_COUNT, 2);
+    test_sorted_set_check(&state, TEST_SORTED_SET_COUNT, TEST_SORTED_SET_COUNT / 3, 8);
+    test_sorted_set_check(&state, TEST_SORTED_SET_COUNT / 3, TEST_SORTED_SET_COUNT, 8);
+}
+
+mirror() {
+    /* very different sizes, to exercise galloping */
+    ghost_uint64_t state = GHOST_UINT64_C(0x12345678);
+    size_t count;
+    for (count = 1; count <= 40; ++count) {
+        test_sorted_set_check(&state, count, TEST_SORTED_SET_COUNT, 2);
+        test_sorted_set_check(&state, TEST_SORTED_SET_COUNT, count, 2);
+        test_sorted_set_check(&state, count, TEST_SORTED_SET_COUNT, 1);
+        test_sorted_set_check(&state, TEST_SORTED_SET_COUNT, count, 1);
+    }
+}
+#else
+mirror() {
+    TEST_SORTED_SET_TYPE values[] = {1, 1, 2, 3, 3, 3, 7, 8, 8};
+    TEST_SORTED_SET_TYPE expected[] = {1, 2, 3, 7, 8};
+    size_t count;
+    size_t i;
+
+    mirror_eq_z(0, TEST_SORTED_SET(test_sorted_set_out, values, 0));
+    mirror_eq_z(1, TEST_SORTED_SET(test_sorted_set_out, values, 1));
+    mirror_check(test_sorted_set_out[0] == 1);
+    mirror_eq_z(1, TEST_SORTED_SET(test_sorted_set_out, values, 2));
+
+    count = TEST_SORTED_SET(test_sorted_set_out, values, sizeof(values) / sizeof(values[0]));
+    mirror_eq_z(5, count);
+    for (i = 0; i < 5; ++i)
+        mirror_check(test_sorted_set_out[i] == expected[i]);
+
+    /* in place */
+    count = TEST_SORTED_SET(values, values, sizeof(values) / sizeof(values[0]));
+    mirror_eq_z(5, count);
+    for (i = 0; i < 5; ++i)
+        mirror_check(values[i] == expected[i]);
+}
+
+mirror() {
+    ghost_uint64_t state = GHOST_UINT64_C(0xDEADBEEF);
+    size_t i;
+    size_t k = 0;
+    size_t count;
+
+    /* steps of zero or one make lots of duplicates */
+    test_sorted_set_a[0] = 5;
+    for (i = 1; i < TEST_SORTED_SET_COUNT; ++i)
+        test_sorted_set_a[i] = ghost_static_cast(TEST_SORTED_SET_TYPE,
+                test_sorted_set_a[i - 1] + test_sorted_set_random(&state) % 2);
+    for (i = 0; i < TEST_SORTED_SET_COUNT; ++i)
+        if (k == 0 || test_sorted_set_expected[k - 1] != test_sorted_set_a[i])
+            test_sorted_set_expected[k++] = test_sorted_set_a[i];
+
+    count = TEST_SORTED_SET(test_sorted_set_a, test_sorted_set_a, TEST_SORTED_SET_COUNT);
+    mirror_eq_z(k, count);
+    for (i = 0; i < k && i < count; ++i)
+        mirror_check(test_sorted_set_expected[i] == test_sorted_set_a[i]);
+}
+#endif
@@ -0,0 +1,188 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * This template generates stable sort test functions for a given variant. The
+ * test must define one of the following macros:
+ *
+ * - TEST_GHOST_STABLE_SORT_GNU
+ * - TEST_GHOST_STABLE_SORT_BSD
+ * - TEST_GHOST_STABLE_SORT
+ */
+
+#include "test_common.h"
+
+#include "ghost/language/ghost_array_count.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/language/ghost_discard.h"
+#include "ghost/language/ghost_null.h"
+#include "ghost/string/ghost_memcmp.h"
+
+static int s_context = 7;
+
+/* Records are compared by key only so we can check stability by index. */
+typedef struct test_record_t {
+    int key;
+    int index;
+} test_record_t;
+
+/* An odd-sized record to test unoptimized element moves */
+typedef struct test_small_record_t {
+    char key;
+    char index[2];
+} test_small_record_t;
+
+#if defined(TEST_GHOST_STABLE_SORT_GNU)
+    #define TEST_COMPARE_FUNCTION(name) static int name(const void* pa, const void* pb, void* context)
+#elif defined(TEST_GHOST_STABLE_SORT_BSD)
+    #define TEST_COMPARE_FUNCTION(name) static int name(void* context, const void* pa, const void* pb)
+#elif defined(TEST_GHOST_STABLE_SORT)
+    #define TEST_COMPARE_FUNCTION(name) static int name(const void* pa, const void* pb)
+#else
+    #error
+#endif
+
+#ifdef TEST_GHOST_STABLE_SORT
+    #define TEST_CHECK_CONTEXT() ghost_discard(s_context)
+#else
+    #define TEST_CHECK_CONTEXT() mirror_check(context == &s_context)
+#endif
+
+TEST_COMPARE_FUNCTION(test_compare_int) {
+    int a;
+    int b;
+    TEST_CHECK_CONTEXT();
+    a = *ghost_static_cast(const int*, pa);
+    b = *ghost_static_cast(const int*, pb);
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+TEST_COMPARE_FUNCTION(test_compare_record) {
+    int a;
+    int b;
+    TEST_CHECK_CONTEXT();
+    a = ghost_static_cast(const test_record_t*, pa)->key;
+    b = ghost_static_cast(const test_record_t*, pb)->key;
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+TEST_COMPARE_FUNCTION(test_compare_small_record) {
+    int a;
+    int b;
+    TEST_CHECK_CONTEXT();
+    a = ghost_static_cast(const test_small_record_t*, pa)->key;
+    b = ghost_static_cast(const test_small_record_t*, pb)->key;
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+#if defined(TEST_GHOST_STABLE_SORT_GNU)
+    #define TEST_STABLE_SORT(array, count, size, compare, scratch, scratch_count) \
+        ghost_gnu_stable_sort_r(array, count, size, &compare, &s_context, scratch, scratch_count)
+#elif defined(TEST_GHOST_STABLE_SORT_BSD)
+    #define TEST_STABLE_SORT(array, count, size, compare, scratch, scratch_count) \
+        ghost_bsd_stable_sort_r(array, count, size, &s_context, &compare, scratch, scratch_count)
+#elif defined(TEST_GHOST_STABLE_SORT)
+    #define TEST_STABLE_SORT(array, count, size, compare, scratch, scratch_count) \
+        ghost_stable_sort(array, count, size, &compare, scratch, scratch_count)
+#endif
+
+#define TEST_STABLE_SORT_COUNT 3000
+
+static test_record_t test_records[TEST_STABLE_SORT_COUNT];
+static test_record_t test_scratch[TEST_STABLE_SORT_COUNT / 2];
+
+static unsigned test_random(unsigned* state) {
+    *state = *state * 1103515245U + 12345U;
+    return (*state >> 16) & 0x7FFFU;
+}
+
+static void test_fill(unsigned pattern) {
+    unsigned state = pattern + 1;
+    int i;
+    for (i = 0; i < TEST_STABLE_SORT_COUNT; ++i) {
+        int key;
+        switch (pattern) {
+            case 0: key = ghost_static_cast(int, test_random(&state) % 20); break; /* few unique */
+            case 1: key = ghost_static_cast(int, test_random(&state)); break; /* random */
+            case 2: key = i / 3; break; /* sorted */
+            case 3: key = (TEST_STABLE_SORT_COUNT - i) / 3; break; /* reversed */
+            case 4: key = i < TEST_STABLE_SORT_COUNT / 2 ? i : TEST_STABLE_SORT_COUNT - i; break; /* organ pipe */
+            case 5: key = i % 100; break; /* sawtooth */
+            default: key = (i % 50 == 0) ? ghost_static_cast(int, test_random(&state)) : i; break; /* mostly sorted */
+        }
+        test_records[i].key = key;
+        test_records[i].index = i;
+    }
+}
+
+static void test_check_stable(void) {
+    int i;
+    for (i = 1; i < TEST_STABLE_SORT_COUNT; ++i) {
+        mirror_check(test_records[i - 1].key <= test_records[i].key);
+        if (test_records[i - 1].key == test_records[i].key)
+            mirror_check(test_records[i - 1].index < test_records[i].index);
+    }
+}
+
+mirror() {
+    int expected[] = {1, 2, 3, 4, 4, 5, 6};
+    int actual[] = {4, 1, 6, 4, 2, 5, 3};
+    TEST_STABLE_SORT(actual, ghost_array_count(actual), sizeof(*actual), test_compare_int, ghost_null, 0);
+    mirror_eq(0, ghost_memcmp(expected, actual, sizeof(expected)));
+}
+
+mirror() {
+    /* Every pattern with a full, partial and missing scratch buffer */
+    static const size_t scratch_counts[] = {
+        TEST_STABLE_SORT_COUNT / 2, 100, 1, 0
+    };
+    unsigned pattern;
+    size_t i;
+    for (pattern = 0; pattern < 7; ++pattern) {
+        for (i = 0; i < ghost_array_count(scratch_counts); ++i) {
+            test_fill(pattern);
+            TEST_STABLE_SORT(test_records, TEST_STABLE_SORT_COUNT, sizeof(test_record_t), test_compare_record,
+                    scratch_counts[i] == 0 ? ghost_null : test_scratch, scratch_counts[i]);
+            test_check_stable();
+        }
+    }
+}
+
+mirror() {
+    /* Odd-sized records with an unaligned scratch buffer */
+    static test_small_record_t records[1000];
+    static char scratch[sizeof(records) / 2 + 1];
+    unsigned state = 1;
+    int i;
+    for (i = 0; i < 1000; ++i) {
+        records[i].key = ghost_static_cast(char, test_random(&state) % 10);
+        records[i].index[0] = ghost_static_cast(char, i / 100);
+        records[i].index[1] = ghost_static_cast(char, i % 100);
+    }
+    TEST_STABLE_SORT(records, 1000, sizeof(test_small_record_t), test_compare_small_record,
+            scratch + 1, 500);
+    for (i = 1; i < 1000; ++i) {
+        mirror_check(records[i - 1].key <= records[i].key);
+        if (records[i - 1].key == records[i].key)
+            mirror_check(records[i - 1].index[0] * 100 + records[i - 1].index[1] <
+                    records[i].index[0] * 100 + records[i].index[1]);
+    }
+}
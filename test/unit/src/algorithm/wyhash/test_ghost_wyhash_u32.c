@@ -0,0 +1,44 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/wyhash/ghost_wyhash_u32.h"
+
+#ifndef ghost_has_ghost_wyhash_u32
+    #error "ghost/algorithm/wyhash/ghost_wyhash_u32.h must define ghost_has_ghost_wyhash_u32."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_wyhash_u32
+#include "ghost/type/uint32_t/ghost_uint32_c.h"
+
+mirror() {
+    /* This is the 64-bit hash folded. */
+    mirror_check(GHOST_UINT32_C(0x73cc4fef) == ghost_wyhash_u32("", 0, 0));
+    mirror_check(GHOST_UINT32_C(0xd23dd01f) == ghost_wyhash_u32("a", 1, 1));
+    mirror_check(GHOST_UINT32_C(0xb4e41c6f) == ghost_wyhash_u32("abc", 3, 2));
+}
+
+mirror() {
+    mirror_check(ghost_wyhash_u32("abc", 3, 0) != ghost_wyhash_u32("abd", 3, 0));
+    mirror_check(ghost_wyhash_u32("abc", 3, 0) != ghost_wyhash_u32("abc", 3, 1));
+}
+#endif
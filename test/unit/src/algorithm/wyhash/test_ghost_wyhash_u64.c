@@ -0,0 +1,87 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/wyhash/ghost_wyhash_u64.h"
+
+#ifndef ghost_has_ghost_wyhash_u64
+    #error "ghost/algorithm/wyhash/ghost_wyhash_u64.h must define ghost_has_ghost_wyhash_u64."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_wyhash_u64
+#include "ghost/string/ghost_strlen.h"
+#include "ghost/string/ghost_memcpy.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+/* The test vectors from the reference implementation (the seed is the index.) */
+static const char* const test_wyhash_strings[] = {
+    "",
+    "a",
+    "abc",
+    "message digest",
+    "abcdefghijklmnopqrstuvwxyz",
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+    "12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+};
+
+mirror() {
+    const ghost_uint64_t expected[] = {
+        GHOST_UINT64_C(0x93228a4de0eec5a2),
+        GHOST_UINT64_C(0xc5bac3db178713c4),
+        GHOST_UINT64_C(0xa97f2f7b1d9b3314),
+        GHOST_UINT64_C(0x786d1f1df3801df4),
+        GHOST_UINT64_C(0xdca5a8138ad37c87),
+        GHOST_UINT64_C(0xb9e734f117cfaf70),
+        GHOST_UINT64_C(0x6cc5eab49a92d617),
+    };
+    size_t i;
+    for (i = 0; i < sizeof(expected) / sizeof(*expected); ++i) {
+        const char* s = test_wyhash_strings[i];
+        mirror_check(expected[i] == ghost_wyhash_u64(s, ghost_strlen(s), i));
+    }
+}
+
+mirror() {
+    /* Every byte of every length affects the hash, and the hash doesn't
+     * depend on alignment. */
+    unsigned char bytes[129];
+    unsigned char shifted[136];
+    size_t length;
+    for (length = 0; length < sizeof(bytes); ++length)
+        bytes[length] = ghost_static_cast(unsigned char, length * 7 + 3);
+    for (length = 0; length <= 128; ++length) {
+        ghost_uint64_t hash = ghost_wyhash_u64(bytes, length, 0);
+        size_t i;
+        mirror_check(hash != ghost_wyhash_u64(bytes, length, 1));
+        mirror_check(hash != ghost_wyhash_u64(bytes, length + 1, 0));
+        for (i = 0; i < length; ++i) {
+            bytes[i] ^= 0x10;
+            mirror_check(hash != ghost_wyhash_u64(bytes, length, 0));
+            bytes[i] ^= 0x10;
+        }
+        for (i = 1; i < 8; ++i) {
+            ghost_memcpy(shifted + i, bytes, length);
+            mirror_check(hash == ghost_wyhash_u64(shifted + i, length, 0));
+        }
+    }
+}
+#endif
@@ -0,0 +1,85 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/wyhash/ghost_wyhash_u64_state_t.h"
+
+#ifndef ghost_has_ghost_wyhash_u64_state_t
+    #error "ghost/algorithm/wyhash/ghost_wyhash_u64_state_t.h must define ghost_has_ghost_wyhash_u64_state_t."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_wyhash_u64_state_t
+#include "ghost/algorithm/wyhash/ghost_wyhash_u64.h"
+#include "ghost/algorithm/wyhash/ghost_wyhash_u64_init.h"
+#include "ghost/algorithm/wyhash/ghost_wyhash_u64_update.h"
+#include "ghost/algorithm/wyhash/ghost_wyhash_u64_final.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+static unsigned char test_wyhash_bytes[300];
+
+static void test_wyhash_fill(void) {
+    size_t i;
+    for (i = 0; i < sizeof(test_wyhash_bytes); ++i)
+        test_wyhash_bytes[i] = ghost_static_cast(unsigned char, i * 31 + (i >> 3));
+}
+
+mirror() {
+    /* Two pieces split at every point, for every length through several
+     * blocks. */
+    size_t length;
+    test_wyhash_fill();
+    for (length = 0; length <= 160; ++length) {
+        ghost_uint64_t expected = ghost_wyhash_u64(test_wyhash_bytes, length, 42);
+        size_t split;
+        for (split = 0; split <= length; ++split) {
+            ghost_wyhash_u64_state_t state;
+            ghost_wyhash_u64_init(&state, 42);
+            ghost_wyhash_u64_update(&state, test_wyhash_bytes, split);
+            mirror_check(ghost_wyhash_u64_final(&state) ==
+                    ghost_wyhash_u64(test_wyhash_bytes, split, 42));
+            ghost_wyhash_u64_update(&state, test_wyhash_bytes + split, length - split);
+            mirror_check(ghost_wyhash_u64_final(&state) == expected);
+        }
+    }
+}
+
+mirror() {
+    /* Many small pieces of varying sizes */
+    size_t step;
+    test_wyhash_fill();
+    for (step = 1; step <= 50; ++step) {
+        ghost_wyhash_u64_state_t state;
+        size_t offset = 0;
+        size_t piece = 0;
+        ghost_wyhash_u64_init(&state, GHOST_UINT64_C(0x123456789));
+        while (offset < sizeof(test_wyhash_bytes)) {
+            size_t size = (step + piece++) % 61;
+            if (size > sizeof(test_wyhash_bytes) - offset)
+                size = sizeof(test_wyhash_bytes) - offset;
+            ghost_wyhash_u64_update(&state, test_wyhash_bytes + offset, size);
+            offset += size;
+            mirror_check(ghost_wyhash_u64_final(&state) ==
+                    ghost_wyhash_u64(test_wyhash_bytes, offset, GHOST_UINT64_C(0x123456789)));
+        }
+    }
+}
+#endif
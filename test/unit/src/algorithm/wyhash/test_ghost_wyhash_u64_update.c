@@ -0,0 +1,46 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/wyhash/ghost_wyhash_u64_update.h"
+
+#ifndef ghost_has_ghost_wyhash_u64_update
+    #error "ghost/algorithm/wyhash/ghost_wyhash_u64_update.h must define ghost_has_ghost_wyhash_u64_update."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_wyhash_u64_update
+#include "ghost/algorithm/wyhash/ghost_wyhash_u64.h"
+#include "ghost/algorithm/wyhash/ghost_wyhash_u64_init.h"
+#include "ghost/algorithm/wyhash/ghost_wyhash_u64_update.h"
+#include "ghost/algorithm/wyhash/ghost_wyhash_u64_final.h"
+
+mirror() {
+    static const char text[] = "12345678901234567890123456789012345678901234567890123456789012345678901234567890";
+    ghost_wyhash_u64_state_t state;
+    ghost_wyhash_u64_init(&state, 6);
+    ghost_wyhash_u64_update(&state, text, 10);
+    ghost_wyhash_u64_update(&state, text + 10, 0);
+    ghost_wyhash_u64_update(&state, text + 10, 50);
+    ghost_wyhash_u64_update(&state, text + 60, 20);
+    mirror_check(ghost_wyhash_u64_final(&state) == ghost_wyhash_u64(text, 80, 6));
+}
+#endif
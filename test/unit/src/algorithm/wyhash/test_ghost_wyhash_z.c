@@ -0,0 +1,47 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/algorithm/wyhash/ghost_wyhash_z.h"
+
+#ifndef ghost_has_ghost_wyhash_z
+    #error "ghost/algorithm/wyhash/ghost_wyhash_z.h must define ghost_has_ghost_wyhash_z."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_wyhash_z
+#include "ghost/algorithm/wyhash/ghost_wyhash_u32.h"
+#include "ghost/algorithm/wyhash/ghost_wyhash_u64.h"
+#include "ghost/type/char/ghost_char_width.h"
+
+mirror() {
+    /* This matches the hash of the size of size_t. */
+    #if ghost_has(ghost_wyhash_u64)
+    if (sizeof(size_t) * GHOST_CHAR_WIDTH > 32) {
+        mirror_check(ghost_static_cast(size_t, ghost_wyhash_u64("message digest", 14, 3)) ==
+                ghost_wyhash_z("message digest", 14, 3));
+        return;
+    }
+    #endif
+    mirror_check(ghost_static_cast(size_t, ghost_wyhash_u32("message digest", 14, 3)) ==
+            ghost_wyhash_z("message digest", 14, 3));
+}
+#endif
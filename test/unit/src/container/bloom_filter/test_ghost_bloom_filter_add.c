@@ -0,0 +1,61 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/bloom_filter/ghost_bloom_filter_add.h"
+
+#ifndef ghost_has_ghost_bloom_filter_add
+    #error "ghost/container/bloom_filter/ghost_bloom_filter_add.h must define ghost_has_ghost_bloom_filter_add."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_bloom_filter_add
+#include "ghost/container/bloom_filter/ghost_bloom_filter_t.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_init.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_add.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_contains.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_merge.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "container/test_ghost_container_hash.t.h"
+
+mirror() {
+    /* An item sets one bit in each word of a single block. */
+    ghost_uint64_t memory[32];
+    ghost_bloom_filter_t filter;
+    ghost_uint64_t i;
+    int bits = 0;
+    ghost_bloom_filter_init(&filter, memory, sizeof(memory));
+    ghost_bloom_filter_add(&filter, test_container_hash(1));
+    for (i = 0; i < 32; ++i) {
+        ghost_uint64_t word = memory[i];
+        for (; word != 0; word &= word - 1)
+            ++bits;
+    }
+    mirror_eq_i(8, bits);
+    for (i = 0; i < 32; i += 8)
+        if (memory[i] != 0)
+            break;
+    mirror_check(i < 32);
+    mirror_check(memory[i + 1] != 0 && memory[i + 2] != 0 && memory[i + 3] != 0 &&
+            memory[i + 4] != 0 && memory[i + 5] != 0 && memory[i + 6] != 0 && memory[i + 7] != 0);
+    mirror_check(ghost_bloom_filter_contains(&filter, test_container_hash(1)));
+}
+#endif
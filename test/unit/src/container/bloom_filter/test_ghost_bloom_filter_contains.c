@@ -0,0 +1,51 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/bloom_filter/ghost_bloom_filter_contains.h"
+
+#ifndef ghost_has_ghost_bloom_filter_contains
+    #error "ghost/container/bloom_filter/ghost_bloom_filter_contains.h must define ghost_has_ghost_bloom_filter_contains."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_bloom_filter_contains
+#include "ghost/container/bloom_filter/ghost_bloom_filter_t.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_init.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_add.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_contains.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_merge.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "container/test_ghost_container_hash.t.h"
+
+mirror() {
+    ghost_uint64_t memory[64];
+    ghost_bloom_filter_t filter;
+    ghost_bloom_filter_init(&filter, memory, sizeof(memory));
+    mirror_check(!ghost_bloom_filter_contains(&filter, 0));
+    mirror_check(!ghost_bloom_filter_contains(&filter, ~GHOST_UINT64_C(0)));
+    ghost_bloom_filter_add(&filter, 0);
+    ghost_bloom_filter_add(&filter, ~GHOST_UINT64_C(0));
+    mirror_check(ghost_bloom_filter_contains(&filter, 0));
+    mirror_check(ghost_bloom_filter_contains(&filter, ~GHOST_UINT64_C(0)));
+    mirror_check(!ghost_bloom_filter_contains(&filter, test_container_hash(1)));
+}
+#endif
@@ -0,0 +1,63 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/bloom_filter/ghost_bloom_filter_merge.h"
+
+#ifndef ghost_has_ghost_bloom_filter_merge
+    #error "ghost/container/bloom_filter/ghost_bloom_filter_merge.h must define ghost_has_ghost_bloom_filter_merge."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_bloom_filter_merge
+#include "ghost/container/bloom_filter/ghost_bloom_filter_t.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_init.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_add.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_contains.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_merge.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+#include "ghost/string/ghost_memcmp.h"
+#include "container/test_ghost_container_hash.t.h"
+
+static ghost_uint64_t test_bloom_filter_a[512];
+static ghost_uint64_t test_bloom_filter_b[512];
+static ghost_uint64_t test_bloom_filter_all[512];
+
+mirror() {
+    /* Merging two halves gives the same bits as adding everything to one. */
+    ghost_bloom_filter_t a;
+    ghost_bloom_filter_t b;
+    ghost_bloom_filter_t all;
+    ghost_uint64_t i;
+    ghost_bloom_filter_init(&a, test_bloom_filter_a, sizeof(test_bloom_filter_a));
+    ghost_bloom_filter_init(&b, test_bloom_filter_b, sizeof(test_bloom_filter_b));
+    ghost_bloom_filter_init(&all, test_bloom_filter_all, sizeof(test_bloom_filter_all));
+    for (i = 0; i < 2000; ++i) {
+        ghost_bloom_filter_add(i & 1 ? &a : &b, test_container_hash(i));
+        ghost_bloom_filter_add(&all, test_container_hash(i));
+    }
+    ghost_bloom_filter_merge(&a, &b);
+    mirror_check(0 == ghost_memcmp(test_bloom_filter_a, test_bloom_filter_all, sizeof(test_bloom_filter_a)));
+    ghost_bloom_filter_merge(&a, &a);
+    mirror_check(0 == ghost_memcmp(test_bloom_filter_a, test_bloom_filter_all, sizeof(test_bloom_filter_a)));
+}
+#endif
@@ -0,0 +1,56 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/bloom_filter/ghost_bloom_filter_t.h"
+
+#ifndef ghost_has_ghost_bloom_filter_t
+    #error "ghost/container/bloom_filter/ghost_bloom_filter_t.h must define ghost_has_ghost_bloom_filter_t."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_bloom_filter_t
+#include "ghost/container/bloom_filter/ghost_bloom_filter_t.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_init.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_add.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_contains.h"
+#include "ghost/container/bloom_filter/ghost_bloom_filter_merge.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "container/test_ghost_container_hash.t.h"
+
+/* 12 bits per item */
+static ghost_uint64_t test_bloom_filter_memory[1500 * 2];
+
+mirror() {
+    /* No false negatives and few false positives. */
+    ghost_bloom_filter_t filter;
+    ghost_uint64_t i;
+    unsigned false_positives = 0;
+    ghost_bloom_filter_init(&filter, test_bloom_filter_memory, sizeof(test_bloom_filter_memory));
+    for (i = 0; i < 16000; ++i)
+        ghost_bloom_filter_add(&filter, test_container_hash(i));
+    for (i = 0; i < 16000; ++i)
+        mirror_check(ghost_bloom_filter_contains(&filter, test_container_hash(i)));
+    for (i = 16000; i < 116000; ++i)
+        false_positives += ghost_bloom_filter_contains(&filter, test_container_hash(i));
+    mirror_check(false_positives < 2000);
+}
+#endif
@@ -0,0 +1,57 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/count_min/ghost_count_min_init.h"
+
+#ifndef ghost_has_ghost_count_min_init
+    #error "ghost/container/count_min/ghost_count_min_init.h must define ghost_has_ghost_count_min_init."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_count_min_init
+#include "ghost/container/count_min/ghost_count_min_t.h"
+#include "ghost/container/count_min/ghost_count_min_init.h"
+#include "ghost/container/count_min/ghost_count_min_add.h"
+#include "ghost/container/count_min/ghost_count_min_estimate.h"
+#include "ghost/container/count_min/ghost_count_min_merge.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "ghost/type/uint32_t/ghost_uint32_max.h"
+#include "container/test_ghost_container_hash.t.h"
+
+mirror() {
+    ghost_uint32_t counters[15];
+    ghost_count_min_t cms;
+    int i;
+    for (i = 0; i < 15; ++i)
+        counters[i] = 12345;
+    ghost_count_min_init(&cms, counters, 5, 3);
+    for (i = 0; i < 15; ++i)
+        mirror_eq_u32(0, counters[i]);
+    mirror_eq_u32(0, ghost_count_min_estimate(&cms, test_container_hash(1)));
+
+    /* A width of one counts everything together. */
+    ghost_count_min_init(&cms, counters, 1, 2);
+    ghost_count_min_add(&cms, test_container_hash(1), 3);
+    ghost_count_min_add(&cms, test_container_hash(2), 4);
+    mirror_eq_u32(7, ghost_count_min_estimate(&cms, test_container_hash(3)));
+}
+#endif
@@ -0,0 +1,67 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/count_min/ghost_count_min_merge.h"
+
+#ifndef ghost_has_ghost_count_min_merge
+    #error "ghost/container/count_min/ghost_count_min_merge.h must define ghost_has_ghost_count_min_merge."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_count_min_merge
+#include "ghost/container/count_min/ghost_count_min_t.h"
+#include "ghost/container/count_min/ghost_count_min_init.h"
+#include "ghost/container/count_min/ghost_count_min_add.h"
+#include "ghost/container/count_min/ghost_count_min_estimate.h"
+#include "ghost/container/count_min/ghost_count_min_merge.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "ghost/type/uint32_t/ghost_uint32_max.h"
+
+#include "ghost/string/ghost_memcmp.h"
+#include "container/test_ghost_container_hash.t.h"
+
+static ghost_uint32_t test_count_min_a[256 * 4];
+static ghost_uint32_t test_count_min_b[256 * 4];
+static ghost_uint32_t test_count_min_all[256 * 4];
+
+mirror() {
+    /* Merging per-thread sketches gives the same counters as one sketch. */
+    ghost_count_min_t a;
+    ghost_count_min_t b;
+    ghost_count_min_t all;
+    ghost_uint64_t i;
+    ghost_count_min_init(&a, test_count_min_a, 256, 4);
+    ghost_count_min_init(&b, test_count_min_b, 256, 4);
+    ghost_count_min_init(&all, test_count_min_all, 256, 4);
+    for (i = 0; i < 3000; ++i) {
+        ghost_count_min_add(i % 3 ? &a : &b, test_container_hash(i % 700), 2);
+        ghost_count_min_add(&all, test_container_hash(i % 700), 2);
+    }
+    ghost_count_min_merge(&a, &b);
+    mirror_check(0 == ghost_memcmp(test_count_min_a, test_count_min_all, sizeof(test_count_min_a)));
+
+    /* Merging saturates. */
+    test_count_min_b[0] = GHOST_UINT32_MAX;
+    ghost_count_min_merge(&a, &b);
+    mirror_eq_u32(GHOST_UINT32_MAX, test_count_min_a[0]);
+}
+#endif
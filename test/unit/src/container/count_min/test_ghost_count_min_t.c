@@ -0,0 +1,67 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/count_min/ghost_count_min_t.h"
+
+#ifndef ghost_has_ghost_count_min_t
+    #error "ghost/container/count_min/ghost_count_min_t.h must define ghost_has_ghost_count_min_t."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_count_min_t
+#include "ghost/container/count_min/ghost_count_min_t.h"
+#include "ghost/container/count_min/ghost_count_min_init.h"
+#include "ghost/container/count_min/ghost_count_min_add.h"
+#include "ghost/container/count_min/ghost_count_min_estimate.h"
+#include "ghost/container/count_min/ghost_count_min_merge.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "ghost/type/uint32_t/ghost_uint32_max.h"
+#include "container/test_ghost_container_hash.t.h"
+
+static ghost_uint32_t test_count_min_counters[1024 * 4];
+
+mirror() {
+    /* Heavy hitters stand out from a long tail. Estimates are never low and
+     * rarely much too high. */
+    ghost_count_min_t cms;
+    ghost_uint64_t i;
+    unsigned bad = 0;
+    ghost_count_min_init(&cms, test_count_min_counters, 1024, 4);
+    for (i = 0; i < 20000; ++i)
+        ghost_count_min_add(&cms, test_container_hash(i), 1);
+    for (i = 0; i < 10; ++i)
+        ghost_count_min_add(&cms, test_container_hash(1000000 + i), ghost_static_cast(ghost_uint32_t, 1000 * (i + 1)));
+
+    for (i = 0; i < 10; ++i) {
+        ghost_uint32_t estimate = ghost_count_min_estimate(&cms, test_container_hash(1000000 + i));
+        mirror_check(estimate >= 1000 * (i + 1));
+        mirror_check(estimate < 1000 * (i + 1) + 200);
+    }
+    for (i = 0; i < 20000; ++i) {
+        ghost_uint32_t estimate = ghost_count_min_estimate(&cms, test_container_hash(i));
+        mirror_check(estimate >= 1);
+        /* e * N / width is about 200 */
+        bad += estimate > 200;
+    }
+    mirror_check(bad < 20000 / 20);
+}
+#endif
@@ -0,0 +1,108 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/hash_table/ghost_hash_map_define.h"
+
+#ifndef ghost_has_GHOST_HASH_MAP_DEFINE
+    #error "ghost/container/hash_table/ghost_hash_map_define.h must define ghost_has_GHOST_HASH_MAP_DEFINE."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_GHOST_HASH_MAP_DEFINE
+#include "ghost/algorithm/fnv1a/ghost_fnv1a_z.h"
+#include "ghost/string/ghost_strcmp.h"
+#include "ghost/string/ghost_strlen.h"
+
+/* The key type is qualified with const textually so pointer types need a
+ * typedef. */
+typedef const char* test_string_t;
+
+static size_t test_string_hash(const test_string_t* key) {
+    return ghost_fnv1a_z(*key, ghost_strlen(*key));
+}
+
+#define test_string_equal(left, right) (0 == ghost_strcmp(*(left), *(right)))
+GHOST_HASH_MAP_DEFINE(test_string_map, test_string_t, int, test_string_hash, test_string_equal)
+
+mirror() {
+    static const char* const words[] = {
+        "the", "quick", "brown", "fox", "jumps", "over", "the", "lazy", "dog",
+        "the", "end",
+    };
+    test_string_map_t map;
+    test_string_map_entry_t* entry;
+    size_t i;
+    test_string_t key;
+
+    test_string_map_init(&map);
+    for (i = 0; i < sizeof(words) / sizeof(*words); ++i) {
+        ghost_bool inserted;
+        entry = test_string_map_insert(&map, &words[i], &inserted);
+        mirror_check(entry != ghost_null);
+        if (inserted)
+            entry->value = 0;
+        ++entry->value;
+    }
+    mirror_eq_z(9, test_string_map_count(&map));
+
+    key = "the";
+    entry = test_string_map_find(&map, &key);
+    mirror_check(entry != ghost_null && entry->value == 3);
+    key = "fox";
+    entry = test_string_map_find(&map, &key);
+    mirror_check(entry != ghost_null && entry->value == 1);
+    key = "cat";
+    mirror_check(ghost_null == test_string_map_find(&map, &key));
+
+    key = "the";
+    mirror_check(test_string_map_erase(&map, &key));
+    mirror_check(ghost_null == test_string_map_find(&map, &key));
+    mirror_eq_z(8, test_string_map_count(&map));
+    test_string_map_destroy(&map);
+}
+
+mirror() {
+    /* Growing through many rehashes preserves the values */
+    static char keys[5000][8];
+    test_string_map_t map;
+    size_t i;
+
+    test_string_map_init(&map);
+    for (i = 0; i < 5000; ++i) {
+        test_string_t key = keys[i];
+        test_string_map_entry_t* entry;
+        keys[i][0] = ghost_static_cast(char, 'a' + i % 26);
+        keys[i][1] = ghost_static_cast(char, 'a' + i / 26 % 26);
+        keys[i][2] = ghost_static_cast(char, 'a' + i / 676 % 26);
+        keys[i][3] = 0;
+        entry = test_string_map_insert(&map, &key, ghost_null);
+        mirror_check(entry != ghost_null);
+        entry->value = ghost_static_cast(int, i);
+    }
+    for (i = 0; i < 5000; ++i) {
+        test_string_t key = keys[i];
+        test_string_map_entry_t* entry = test_string_map_find(&map, &key);
+        mirror_check(entry != ghost_null && entry->value == ghost_static_cast(int, i));
+    }
+    test_string_map_destroy(&map);
+}
+#endif
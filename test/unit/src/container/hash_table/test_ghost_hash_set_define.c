@@ -0,0 +1,169 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/hash_table/ghost_hash_set_define.h"
+
+#ifndef ghost_has_GHOST_HASH_SET_DEFINE
+    #error "ghost/container/hash_table/ghost_hash_set_define.h must define ghost_has_GHOST_HASH_SET_DEFINE."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_GHOST_HASH_SET_DEFINE
+#include "ghost/language/ghost_static_cast.h"
+
+#define test_u32_hash(key) (*(key))
+#define test_u32_equal(left, right) (*(left) == *(right))
+GHOST_HASH_SET_DEFINE(test_u32_set, ghost_uint32_t, test_u32_hash, test_u32_equal)
+
+/* A terrible hash to force long probe sequences and many h2 collisions */
+#define test_bad_hash(key) (*(key) & 3)
+GHOST_HASH_SET_DEFINE(test_bad_set, ghost_uint32_t, test_bad_hash, test_u32_equal)
+
+static ghost_uint32_t test_hash_set_random(ghost_uint32_t* state) {
+    *state = *state * 1103515245u + 12345u;
+    return (*state >> 8) & 0xFFFFu;
+}
+
+mirror() {
+    test_u32_set_t set;
+    ghost_uint32_t key = 5;
+    ghost_bool inserted = ghost_false;
+    size_t cursor = 0;
+
+    test_u32_set_init(&set);
+    mirror_eq_z(0, test_u32_set_count(&set));
+    mirror_check(ghost_null == test_u32_set_find(&set, &key));
+    mirror_check(!test_u32_set_erase(&set, &key));
+    mirror_check(ghost_null == test_u32_set_next(&set, &cursor));
+
+    mirror_check(ghost_null != test_u32_set_insert(&set, &key, &inserted));
+    mirror_check(inserted);
+    mirror_check(ghost_null != test_u32_set_insert(&set, &key, &inserted));
+    mirror_check(!inserted);
+    mirror_eq_z(1, test_u32_set_count(&set));
+    mirror_check(5 == *test_u32_set_find(&set, &key));
+
+    mirror_check(test_u32_set_erase(&set, &key));
+    mirror_eq_z(0, test_u32_set_count(&set));
+    mirror_check(ghost_null == test_u32_set_find(&set, &key));
+    test_u32_set_destroy(&set);
+}
+
+/* Randomly inserts and erases keys, checking against a bitmap. */
+#define TEST_HASH_SET_RANDOM(name, operations) \
+    do { \
+        static unsigned char present[0x10000]; \
+        name##_t set; \
+        ghost_uint32_t state = 7; \
+        size_t expected_count = 0; \
+        size_t i; \
+        ghost_uint32_t* entry; \
+        size_t cursor = 0; \
+        \
+        for (i = 0; i < sizeof(present); ++i) \
+            present[i] = 0; \
+        name##_init(&set); \
+        for (i = 0; i < (operations); ++i) { \
+            ghost_uint32_t key = test_hash_set_random(&state) % ((operations) / 4); \
+            ghost_bool inserted; \
+            if (test_hash_set_random(&state) % 3 != 0) { \
+                mirror_check(ghost_null != name##_insert(&set, &key, &inserted)); \
+                mirror_check(!!inserted == !present[key]); \
+                expected_count += !present[key]; \
+                present[key] = 1; \
+            } else { \
+                mirror_check(!!name##_erase(&set, &key) == !!present[key]); \
+                expected_count -= present[key]; \
+                present[key] = 0; \
+            } \
+        } \
+        mirror_eq_z(expected_count, name##_count(&set)); \
+        for (i = 0; i < (operations) / 4; ++i) { \
+            ghost_uint32_t key = ghost_static_cast(ghost_uint32_t, i); \
+            mirror_check((name##_find(&set, &key) != ghost_null) == !!present[i]); \
+        } \
+        \
+        /* Iterate, erasing every other entry as we go */ \
+        i = 0; \
+        while ((entry = name##_next(&set, &cursor)) != ghost_null) { \
+            mirror_check(present[*entry]); \
+            present[*entry] = 2; \
+            if (i++ % 2 == 0) { \
+                present[*entry] = 0; \
+                name##_erase_entry(&set, entry); \
+            } \
+        } \
+        mirror_eq_z(expected_count, i); \
+        mirror_eq_z(expected_count - (expected_count + 1) / 2, name##_count(&set)); \
+        for (i = 0; i < (operations) / 4; ++i) { \
+            ghost_uint32_t key = ghost_static_cast(ghost_uint32_t, i); \
+            mirror_check((name##_find(&set, &key) != ghost_null) == (present[i] == 2)); \
+        } \
+        \
+        name##_clear(&set); \
+        mirror_eq_z(0, name##_count(&set)); \
+        entry = name##_insert(&set, &state, ghost_null); \
+        mirror_check(entry != ghost_null && *entry == state); \
+        name##_destroy(&set); \
+    } while (0)
+
+mirror() {
+    TEST_HASH_SET_RANDOM(test_u32_set, 200000);
+}
+
+mirror() {
+    TEST_HASH_SET_RANDOM(test_bad_set, 4000);
+}
+
+mirror() {
+    /* Reserving keeps the table from growing (which we detect by checking
+     * that pointers are stable.) */
+    test_u32_set_t set;
+    ghost_uint32_t key = 0;
+    ghost_uint32_t* first;
+    test_u32_set_init(&set);
+    mirror_check(test_u32_set_reserve(&set, 1000));
+    first = test_u32_set_insert(&set, &key, ghost_null);
+    for (key = 1; key < 1000; ++key)
+        mirror_check(ghost_null != test_u32_set_insert(&set, &key, ghost_null));
+    key = 0;
+    mirror_check(first == test_u32_set_find(&set, &key));
+    mirror_eq_z(1000, test_u32_set_count(&set));
+    test_u32_set_destroy(&set);
+}
+
+mirror() {
+    /* Repeated insert/erase churn on a small set must not fill it with
+     * tombstones. */
+    test_u32_set_t set;
+    ghost_uint32_t key;
+    test_u32_set_init(&set);
+    for (key = 0; key < 100000; ++key) {
+        ghost_uint32_t old = key - 10;
+        mirror_check(ghost_null != test_u32_set_insert(&set, &key, ghost_null));
+        if (key >= 10)
+            mirror_check(test_u32_set_erase(&set, &old));
+    }
+    mirror_eq_z(10, test_u32_set_count(&set));
+    test_u32_set_destroy(&set);
+}
+#endif
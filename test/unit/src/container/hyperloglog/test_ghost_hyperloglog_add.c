@@ -0,0 +1,93 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/hyperloglog/ghost_hyperloglog_add.h"
+
+#ifndef ghost_has_ghost_hyperloglog_add
+    #error "ghost/container/hyperloglog/ghost_hyperloglog_add.h must define ghost_has_ghost_hyperloglog_add."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_hyperloglog_add
+#include "ghost/container/hyperloglog/ghost_hyperloglog_t.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_init.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_add.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_estimate.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_merge.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "ghost/string/ghost_memcmp.h"
+#include "container/test_ghost_container_hash.t.h"
+
+static unsigned char test_hyperloglog_memory[1024];
+static unsigned char test_hyperloglog_expected[1024];
+
+static void test_hyperloglog_expect(ghost_uint64_t hash) {
+    ghost_size_t index = ghost_static_cast(ghost_size_t, hash >> 54);
+    unsigned char rank = 1;
+    while (rank < 55 && (hash & (GHOST_UINT64_C(1) << (rank - 1))) == 0)
+        ++rank;
+    if (test_hyperloglog_expected[index] < rank)
+        test_hyperloglog_expected[index] = rank;
+}
+
+/* Adds the hashes (step * i + offset) << 54 | (1 << (i % 7)) for i < count
+ * and checks the registers once the sketch has become dense. */
+static void test_hyperloglog_pattern(ghost_size_t step, ghost_size_t offset, ghost_size_t count) {
+    ghost_hyperloglog_t hll;
+    ghost_size_t i;
+    ghost_hyperloglog_init(&hll, test_hyperloglog_memory, 10);
+    for (i = 0; i < 1024; ++i)
+        test_hyperloglog_expected[i] = 0;
+    for (i = 0; i < count; ++i) {
+        ghost_uint64_t index = (step * i + offset) % 1024;
+        ghost_uint64_t hash = (index << 54) | (GHOST_UINT64_C(1) << (i % 7));
+        ghost_hyperloglog_add(&hll, hash);
+        test_hyperloglog_expect(hash);
+    }
+    mirror_check(0 == ghost_memcmp(test_hyperloglog_memory, test_hyperloglog_expected, 1024));
+}
+
+mirror() {
+    /* Converting to dense registers in place works whether the registers
+     * are clustered at either end, spread out or in a random order. */
+    test_hyperloglog_pattern(1, 0, 300);
+    test_hyperloglog_pattern(1, 724, 300);
+    test_hyperloglog_pattern(1023, 1023, 300);
+    test_hyperloglog_pattern(7, 3, 300);
+    test_hyperloglog_pattern(129, 0, 300);
+    test_hyperloglog_pattern(3, 512, 2000);
+}
+
+mirror() {
+    /* Random hashes */
+    ghost_hyperloglog_t hll;
+    ghost_uint64_t i;
+    ghost_hyperloglog_init(&hll, test_hyperloglog_memory, 10);
+    for (i = 0; i < 1024; ++i)
+        test_hyperloglog_expected[i] = 0;
+    for (i = 0; i < 5000; ++i) {
+        ghost_hyperloglog_add(&hll, test_container_hash(i));
+        test_hyperloglog_expect(test_container_hash(i));
+    }
+    mirror_check(0 == ghost_memcmp(test_hyperloglog_memory, test_hyperloglog_expected, 1024));
+}
+#endif
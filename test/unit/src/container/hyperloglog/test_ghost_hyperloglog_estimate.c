@@ -0,0 +1,61 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/hyperloglog/ghost_hyperloglog_estimate.h"
+
+#ifndef ghost_has_ghost_hyperloglog_estimate
+    #error "ghost/container/hyperloglog/ghost_hyperloglog_estimate.h must define ghost_has_ghost_hyperloglog_estimate."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_hyperloglog_estimate
+#include "ghost/container/hyperloglog/ghost_hyperloglog_t.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_init.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_add.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_estimate.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_merge.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "container/test_ghost_container_hash.t.h"
+
+static unsigned char test_hyperloglog_memory[16384];
+
+mirror() {
+    /* The error stays within a few standard errors (0.81%) from tiny to large
+     * cardinalities, including across the switch from sparse to dense. */
+    static const ghost_uint64_t counts[] = {1, 10, 100, 1000, 3000, 10000, 100000, 1000000};
+    ghost_size_t c;
+    for (c = 0; c < sizeof(counts) / sizeof(*counts); ++c) {
+        ghost_hyperloglog_t hll;
+        ghost_uint64_t i;
+        double estimate;
+        double n = ghost_static_cast(double, counts[c]);
+        ghost_hyperloglog_init(&hll, test_hyperloglog_memory, 14);
+        for (i = 0; i < counts[c]; ++i) {
+            ghost_hyperloglog_add(&hll, test_container_hash(i + (c << 32)));
+            ghost_hyperloglog_add(&hll, test_container_hash(i + (c << 32)));
+        }
+        estimate = ghost_hyperloglog_estimate(&hll);
+        mirror_check(estimate > n * 0.97 - 1.0);
+        mirror_check(estimate < n * 1.03 + 1.0);
+    }
+}
+#endif
@@ -0,0 +1,52 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/hyperloglog/ghost_hyperloglog_init.h"
+
+#ifndef ghost_has_ghost_hyperloglog_init
+    #error "ghost/container/hyperloglog/ghost_hyperloglog_init.h must define ghost_has_ghost_hyperloglog_init."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_hyperloglog_init
+#include "ghost/container/hyperloglog/ghost_hyperloglog_t.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_init.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_add.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_estimate.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_merge.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "container/test_ghost_container_hash.t.h"
+
+mirror() {
+    /* The memory doesn't need to be cleared. */
+    unsigned char memory[16];
+    ghost_hyperloglog_t hll;
+    int i;
+    for (i = 0; i < 16; ++i)
+        memory[i] = 0xAA;
+    ghost_hyperloglog_init(&hll, memory, 4);
+    mirror_check(ghost_hyperloglog_estimate(&hll) == 0.0);
+    ghost_hyperloglog_add(&hll, test_container_hash(1));
+    mirror_check(ghost_hyperloglog_estimate(&hll) > 0.5);
+    mirror_check(ghost_hyperloglog_estimate(&hll) < 1.5);
+}
+#endif
@@ -0,0 +1,76 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/hyperloglog/ghost_hyperloglog_merge.h"
+
+#ifndef ghost_has_ghost_hyperloglog_merge
+    #error "ghost/container/hyperloglog/ghost_hyperloglog_merge.h must define ghost_has_ghost_hyperloglog_merge."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_hyperloglog_merge
+#include "ghost/container/hyperloglog/ghost_hyperloglog_t.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_init.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_add.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_estimate.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_merge.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+#include "ghost/string/ghost_memcmp.h"
+#include "container/test_ghost_container_hash.t.h"
+
+static unsigned char test_hyperloglog_a[4096];
+static unsigned char test_hyperloglog_b[4096];
+static unsigned char test_hyperloglog_all[4096];
+
+static void test_hyperloglog_merge_counts(ghost_uint64_t a_count, ghost_uint64_t b_count) {
+    ghost_hyperloglog_t a;
+    ghost_hyperloglog_t b;
+    ghost_hyperloglog_t all;
+    ghost_uint64_t i;
+    ghost_hyperloglog_init(&a, test_hyperloglog_a, 12);
+    ghost_hyperloglog_init(&b, test_hyperloglog_b, 12);
+    ghost_hyperloglog_init(&all, test_hyperloglog_all, 12);
+    for (i = 0; i < a_count; ++i) {
+        ghost_hyperloglog_add(&a, test_container_hash(i));
+        ghost_hyperloglog_add(&all, test_container_hash(i));
+    }
+    for (i = 0; i < b_count; ++i) {
+        ghost_hyperloglog_add(&b, test_container_hash(i + 100000));
+        ghost_hyperloglog_add(&all, test_container_hash(i + 100000));
+    }
+    ghost_hyperloglog_merge(&a, &b);
+    mirror_check(ghost_hyperloglog_estimate(&a) == ghost_hyperloglog_estimate(&all));
+    ghost_hyperloglog_merge(&a, &a);
+    mirror_check(ghost_hyperloglog_estimate(&a) == ghost_hyperloglog_estimate(&all));
+}
+
+mirror() {
+    /* sparse and dense in all combinations */
+    test_hyperloglog_merge_counts(0, 0);
+    test_hyperloglog_merge_counts(10, 20);
+    test_hyperloglog_merge_counts(300, 300);
+    test_hyperloglog_merge_counts(10, 5000);
+    test_hyperloglog_merge_counts(5000, 10);
+    test_hyperloglog_merge_counts(5000, 5000);
+}
+#endif
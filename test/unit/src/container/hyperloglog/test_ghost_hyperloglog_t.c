@@ -0,0 +1,62 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "ghost/container/hyperloglog/ghost_hyperloglog_t.h"
+
+#ifndef ghost_has_ghost_hyperloglog_t
+    #error "ghost/container/hyperloglog/ghost_hyperloglog_t.h must define ghost_has_ghost_hyperloglog_t."
+#endif
+
+#include "test_common.h"
+
+#if ghost_has_ghost_hyperloglog_t
+#include "ghost/container/hyperloglog/ghost_hyperloglog_t.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_init.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_add.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_estimate.h"
+#include "ghost/container/hyperloglog/ghost_hyperloglog_merge.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+#include "container/test_ghost_container_hash.t.h"
+
+static unsigned char test_hyperloglog_threads[4][4096];
+static unsigned char test_hyperloglog_single[4096];
+
+mirror() {
+    /* Per-thread sketches merged together match a single sketch. */
+    ghost_hyperloglog_t threads[4];
+    ghost_hyperloglog_t single;
+    ghost_uint64_t i;
+    int t;
+    ghost_hyperloglog_init(&single, test_hyperloglog_single, 12);
+    for (t = 0; t < 4; ++t)
+        ghost_hyperloglog_init(&threads[t], test_hyperloglog_threads[t], 12);
+    for (i = 0; i < 50000; ++i) {
+        /* Threads see overlapping items. */
+        ghost_hyperloglog_add(&threads[i % 4], test_container_hash(i % 30000));
+        ghost_hyperloglog_add(&single, test_container_hash(i % 30000));
+    }
+    for (t = 1; t < 4; ++t)
+        ghost_hyperloglog_merge(&threads[0], &threads[t]);
+    mirror_check(ghost_hyperloglog_estimate(&threads[0]) == ghost_hyperloglog_estimate(&single));
+    mirror_check(ghost_hyperloglog_estimate(&single) > 30000 * 0.95);
+    mirror_check(ghost_hyperloglog_estimate(&single) < 30000 * 1.05);
+}
+#endif
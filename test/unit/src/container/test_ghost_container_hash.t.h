@@ -0,0 +1,42 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * The probabilistic containers (Bloom filter, count-min sketch and
+ * HyperLogLog) take 64-bit hashes. This provides test_container_hash() to
+ * turn an index into a well-mixed hash (SplitMix64) so that tests are
+ * deterministic.
+ */
+
+#ifndef TEST_GHOST_CONTAINER_HASH_T_H_INCLUDED
+#define TEST_GHOST_CONTAINER_HASH_T_H_INCLUDED
+
+#include "ghost/type/uint64_t/ghost_uint64_t.h"
+#include "ghost/type/uint64_t/ghost_uint64_c.h"
+
+static ghost_uint64_t test_container_hash(ghost_uint64_t i) {
+    i += GHOST_UINT64_C(0x9E3779B97F4A7C15);
+    i = (i ^ (i >> 30)) * GHOST_UINT64_C(0xBF58476D1CE4E5B9);
+    i = (i ^ (i >> 27)) * GHOST_UINT64_C(0x94D049BB133111EB);
+    return i ^ (i >> 31);
+}
+
+#endif
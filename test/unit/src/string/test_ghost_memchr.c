@@ -31,6 +31,9 @@
     #error "ghost_memchr must exist."
 #endif
 
+#include "ghost/language/ghost_null.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+
 mirror() {
     const char* s = "hello";
     mirror_check(ghost_memchr(s, 'h',  6) == s);
@@ -42,3 +45,32 @@ mirror() {
     mirror_check(ghost_memchr(s, '\000', 5) == ghost_null);
     mirror_check(ghost_memchr(s, 'X',  6) == ghost_null);
 }
+
+mirror() {
+    /* The character is converted to unsigned char. */
+    const char s[] = "a\377b\200";
+    mirror_check(ghost_memchr(s, 0xFF, 4) == s + 1);
+    mirror_check(ghost_memchr(s, -1, 4) == s + 1);
+    mirror_check(ghost_memchr(s, 0x180, 4) == s + 3);
+    mirror_check(ghost_memchr(s, 'b' + 0x100, 4) == s + 2);
+}
+
+mirror() {
+    /* Try all alignments and positions spanning several words. */
+    char buffer[48];
+    ghost_size_t offset;
+    ghost_size_t position;
+    ghost_size_t i;
+    for (i = 0; i < sizeof(buffer); ++i)
+        buffer[i] = 'x';
+    for (offset = 0; offset < 16; ++offset) {
+        ghost_size_t count = sizeof(buffer) - offset;
+        for (position = 0; position < count; ++position) {
+            buffer[offset + position] = '\351';
+            mirror_check(ghost_memchr(buffer + offset, 0xE9, count) == buffer + offset + position);
+            mirror_check(ghost_memchr(buffer + offset, 0xE9, position) == ghost_null);
+            mirror_check(ghost_memchr(buffer + offset, 'y', count) == ghost_null);
+            buffer[offset + position] = 'x';
+        }
+    }
+}
@@ -32,6 +32,7 @@
 #endif
 
 #include "ghost/language/ghost_null.h"
+#include "ghost/type/size_t/ghost_size_t.h"
 
 mirror() {
     const char* s = "hello";
@@ -41,3 +42,38 @@ mirror() {
     mirror_check(ghost_strchr(s, '\000') == s + 5);
     mirror_check(ghost_strchr(s, 'X')  == ghost_null);
 }
+
+mirror() {
+    /* The search continues past the first character. Characters with the
+     * high bit set are found when given as unsigned char or as char. */
+    const char* s = "ab\351cd";
+    mirror_check(ghost_strchr(s, 'd') == s + 4);
+    mirror_check(ghost_strchr(s, 0xE9) == s + 2);
+    mirror_check(ghost_strchr(s, '\351') == s + 2);
+    mirror_check(ghost_strchr(s, 'e') == ghost_null);
+}
+
+mirror() {
+    /* Try all alignments and positions spanning several words. */
+    char buffer[48];
+    ghost_size_t offset;
+    ghost_size_t length;
+    ghost_size_t position;
+    ghost_size_t i;
+    for (i = 0; i < sizeof(buffer); ++i)
+        buffer[i] = 'x';
+    for (offset = 0; offset < 16; ++offset) {
+        for (length = 0; offset + length < sizeof(buffer); ++length) {
+            char* s = buffer + offset;
+            s[length] = '\000';
+            mirror_check(ghost_strchr(s, 'y') == ghost_null);
+            mirror_check(ghost_strchr(s, '\000') == s + length);
+            for (position = 0; position < length; ++position) {
+                s[position] = 'y';
+                mirror_check(ghost_strchr(s, 'y') == s + position);
+                s[position] = 'x';
+            }
+            s[length] = 'x';
+        }
+    }
+}
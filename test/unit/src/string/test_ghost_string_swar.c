@@ -0,0 +1,156 @@
+/*
+ * MIT No Attribution
+ *
+ * Copyright (c) 2023 Fraser Heavy Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/*
+ * This tests the word-at-a-time fallbacks of ghost_strlen(), ghost_strnlen(),
+ * ghost_memchr() and ghost_strchr(). We disable the builtins and <string.h>
+ * so that Ghost defines its own functions.
+ */
+
+#define GHOST_STATIC_DEFS 1
+#define ghost_has_ghost_has_builtin 0
+#define GHOST_GCC 0
+#define ghost_has_ghost_string_h 0
+
+#include "ghost/string/ghost_strlen.h"
+#include "ghost/string/ghost_strnlen.h"
+#include "ghost/string/ghost_memchr.h"
+#include "ghost/string/ghost_strchr.h"
+
+#include "test_common.h"
+
+#if !ghost_has_ghost_strlen || !ghost_has_ghost_strnlen || !ghost_has_ghost_memchr || !ghost_has_ghost_strchr
+    #error "The string fallbacks must exist."
+#endif
+#if defined(ghost_strlen) || defined(ghost_strnlen) || defined(ghost_memchr) || defined(ghost_strchr)
+    #error "The string functions must be Ghost's fallbacks, not macros."
+#endif
+
+#include "ghost/impl/string/ghost_impl_swar.h"
+#include "ghost/language/ghost_null.h"
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+
+#define TEST_SWAR_BUFFER_SIZE 80
+
+/*
+ * Fills the buffer with bytes that come close to tripping the zero-byte test
+ * when XORed with c: c^0x01, c^0x80, c^0xFF and c^0x7F. Any of these that
+ * would be zero are replaced with a space so the buffer has no terminators.
+ */
+static void test_swar_fill(char* buffer, int c) {
+    static const unsigned char flips[] = {0x01, 0x80, 0xFF, 0x7F};
+    ghost_size_t i;
+    for (i = 0; i < TEST_SWAR_BUFFER_SIZE; ++i) {
+        int byte = (c ^ flips[i % sizeof(flips)]) & 0xFF;
+        buffer[i] = ghost_static_cast(char, byte == 0 ? ' ' : byte);
+    }
+}
+
+mirror() {
+    #if GHOST_IMPL_SWAR
+    mirror_check(sizeof(ghost_impl_swar_t) > 1);
+    #endif
+    mirror_eq_z(0, ghost_strlen(""));
+    mirror_eq_z(5, ghost_strlen("hello"));
+    mirror_eq_z(3, ghost_strnlen("hello", 3));
+    mirror_check(ghost_memchr("hello", 'l', 5) != ghost_null);
+    mirror_check(ghost_strchr("hello", 'x') == ghost_null);
+}
+
+mirror() {
+    /* strlen() and strnlen() at all alignments, lengths and limits. The
+     * bytes around the terminator are 0x01, 0x80, 0xFF and 0x7F. */
+    char buffer[TEST_SWAR_BUFFER_SIZE];
+    ghost_size_t offset;
+    ghost_size_t length;
+    ghost_size_t limit;
+    for (offset = 0; offset < 16; ++offset) {
+        for (length = 0; offset + length < sizeof(buffer); ++length) {
+            const char* s = buffer + offset;
+            test_swar_fill(buffer, 0);
+            buffer[offset + length] = '\000';
+            mirror_eq_z(length, ghost_strlen(s));
+            for (limit = 0; limit < length + 10; ++limit)
+                mirror_eq_z(limit < length ? limit : length, ghost_strnlen(s, limit));
+        }
+    }
+}
+
+mirror() {
+    /* memchr() at all alignments, positions and counts with characters that
+     * have and don't have the high bit set, given as char, unsigned char and
+     * out-of-range ints. */
+    static const int chars[] = {'a', 0x01, 0x7F, 0x80, 0xE9, 0xFF};
+    char buffer[TEST_SWAR_BUFFER_SIZE];
+    ghost_size_t c;
+    ghost_size_t offset;
+    ghost_size_t position;
+    for (c = 0; c < sizeof(chars) / sizeof(*chars); ++c) {
+        int ch = chars[c];
+        test_swar_fill(buffer, ch);
+        for (offset = 0; offset < 16; ++offset) {
+            const char* s = buffer + offset;
+            ghost_size_t count = sizeof(buffer) - offset;
+            mirror_check(ghost_memchr(s, ch, count) == ghost_null);
+            for (position = 0; position < count; ++position) {
+                char saved = buffer[offset + position];
+                buffer[offset + position] = ghost_static_cast(char, ch);
+                mirror_check(ghost_memchr(s, ch, count) == s + position);
+                mirror_check(ghost_memchr(s, ch + 0x100, count) == s + position);
+                mirror_check(ghost_memchr(s, ch - 0x100, count) == s + position);
+                mirror_check(ghost_memchr(s, ch, position) == ghost_null);
+                mirror_check(ghost_memchr(s, ch, position + 1) == s + position);
+                buffer[offset + position] = saved;
+            }
+        }
+    }
+}
+
+mirror() {
+    /* strchr() at all alignments, lengths and positions, including finding
+     * the terminator and characters with the high bit set. */
+    static const int chars[] = {'a', 0x01, 0x7F, 0x80, 0xE9, 0xFF};
+    char buffer[TEST_SWAR_BUFFER_SIZE];
+    ghost_size_t c;
+    ghost_size_t offset;
+    ghost_size_t length;
+    ghost_size_t position;
+    for (c = 0; c < sizeof(chars) / sizeof(*chars); ++c) {
+        int ch = chars[c];
+        for (offset = 0; offset < 16; ++offset) {
+            for (length = 0; offset + length < sizeof(buffer); ++length) {
+                const char* s = buffer + offset;
+                test_swar_fill(buffer, ch);
+                buffer[offset + length] = '\000';
+                mirror_check(ghost_strchr(s, ch) == ghost_null);
+                mirror_check(ghost_strchr(s, '\000') == s + length);
+                for (position = 0; position < length; ++position) {
+                    char saved = buffer[offset + position];
+                    buffer[offset + position] = ghost_static_cast(char, ch);
+                    mirror_check(ghost_strchr(s, ch) == s + position);
+                    mirror_check(ghost_strchr(s, ghost_static_cast(char, ch)) == s + position);
+                    buffer[offset + position] = saved;
+                }
+            }
+        }
+    }
+}
@@ -31,6 +31,26 @@
     #error "ghost_strlen must exist."
 #endif
 
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+
+mirror() {
+    mirror_eq_z(0, ghost_strlen(""));
+    mirror_eq_z(5, ghost_strlen("hello"));
+}
+
 mirror() {
-    /* TODO */
+    /* Try all alignments and lengths spanning several words. */
+    char buffer[64];
+    ghost_size_t offset;
+    ghost_size_t length;
+    ghost_size_t i;
+    for (offset = 0; offset < 16; ++offset) {
+        for (length = 0; offset + length < sizeof(buffer); ++length) {
+            for (i = 0; i < sizeof(buffer); ++i)
+                buffer[i] = ghost_static_cast(char, 0x80 + i % 0x7F);
+            buffer[offset + length] = '\000';
+            mirror_eq_z(length, ghost_strlen(buffer + offset));
+        }
+    }
 }
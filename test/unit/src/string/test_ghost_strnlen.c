@@ -31,6 +31,33 @@
     #error "ghost_strnlen must exist."
 #endif
 
+#include "ghost/language/ghost_static_cast.h"
+#include "ghost/type/size_t/ghost_size_t.h"
+
+mirror() {
+    char empty[10] = "";
+    char hello[10] = "hello";
+    mirror_eq_z(0, ghost_strnlen(empty, 10));
+    mirror_eq_z(5, ghost_strnlen(hello, 10));
+    mirror_eq_z(5, ghost_strnlen(hello, 5));
+    mirror_eq_z(3, ghost_strnlen(hello, 3));
+    mirror_eq_z(0, ghost_strnlen(hello, 0));
+}
+
 mirror() {
-    /* TODO */
+    /* Try all alignments, lengths and limits spanning several words. */
+    char buffer[48];
+    ghost_size_t offset;
+    ghost_size_t length;
+    ghost_size_t limit;
+    ghost_size_t i;
+    for (offset = 0; offset < 16; ++offset) {
+        for (length = 0; offset + length < sizeof(buffer); ++length) {
+            for (i = 0; i < sizeof(buffer); ++i)
+                buffer[i] = ghost_static_cast(char, 0x80 + i % 0x7F);
+            buffer[offset + length] = '\000';
+            for (limit = 0; limit < length + 10; ++limit)
+                mirror_eq_z(limit < length ? limit : length, ghost_strnlen(buffer + offset, limit));
+        }
+    }
 }
@@ -0,0 +1,332 @@
+#!/usr/bin/env python
+
+# MIT No Attribution
+#
+# Copyright (c) 2023 Fraser Heavy Software
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+# Generates a header containing a minimal perfect hash table for a fixed set of
+# string keys.
+#
+# The input has one key per line. The output header contains the keys, a
+# table of seeds and a table of slots, and a lookup function that finds a key
+# with a single probe. There is no runtime initialization or allocation; all
+# tables are static const.
+#
+# See docs/perfect_hash.md.
+
+import sys, os
+import re
+import getopt
+
+def eprint(*args, **kwargs):
+    print(*args, file=sys.stderr, **kwargs)
+
+MASK64 = (1 << 64) - 1
+MASK32 = (1 << 32) - 1
+
+# The largest seed plus one. Seeds are stored as uint16_t.
+SEED_LIMIT = 1 << 16
+
+# The average number of keys per bucket to try, in order. More keys per bucket
+# makes a smaller seed table but takes longer to build. We fall back to smaller
+# buckets if we fail to find seeds for some bucket.
+BUCKET_LOADS = [4.0, 3.0, 2.0, 1.0, 0.5]
+
+
+# These must match ghost_fnv1a_u64() and ghost_perfect_hash() exactly.
+
+def fnv1a_u64(data):
+    h = 14695981039346656037
+    for b in data:
+        h = ((h ^ b) * 1099511628211) & MASK64
+    return h
+
+def mix(x):
+    x ^= x >> 33
+    x = (x * 0xff51afd7ed558ccd) & MASK64
+    x ^= x >> 33
+    x = (x * 0xc4ceb9fe1a85ec53) & MASK64
+    x ^= x >> 33
+    return x
+
+def bucket_of(mixed, bucket_count):
+    return ((mixed >> 32) * bucket_count) >> 32
+
+def slot_of(mixed, seed, key_count):
+    slot = mix(mixed ^ (((seed + 1) * 0x9E3779B97F4A7C15) & MASK64))
+    return ((slot & MASK32) * key_count) >> 32
+
+
+# We use "hash and displace" (CHD). Keys are split into buckets by hash. We
+# place the biggest buckets first, searching for a seed for each bucket that
+# puts all of its keys in distinct free slots. Late buckets are small so they
+# still fit once the table is nearly full.
+#
+# Returns (seeds, slots) where slots maps each slot to its key index, or None
+# if some bucket couldn't be placed.
+def build(mixed, bucket_count):
+    key_count = len(mixed)
+    buckets = [[] for i in range(bucket_count)]
+    for i in range(key_count):
+        buckets[bucket_of(mixed[i], bucket_count)].append(i)
+    order = sorted(range(bucket_count), key=lambda b: -len(buckets[b]))
+
+    seeds = [0] * bucket_count
+    slots = [None] * key_count
+    for b in order:
+        keys = buckets[b]
+        if len(keys) == 0:
+            break
+        for seed in range(SEED_LIMIT):
+            chosen = set()
+            for k in keys:
+                slot = slot_of(mixed[k], seed, key_count)
+                if slots[slot] is not None or slot in chosen:
+                    break
+                chosen.add(slot)
+            else:
+                break
+        else:
+            return None
+        seeds[b] = seed
+        for k in keys:
+            slots[slot_of(mixed[k], seed, key_count)] = k
+
+    return seeds, slots
+
+def c_string(key):
+    s = '"'
+    for b in key:
+        c = chr(b)
+        if c in '"\\?':
+            # ? is escaped to avoid trigraphs.
+            s += "\\" + c
+        elif 0x20 <= b < 0x7F:
+            s += c
+        else:
+            # Octal escapes end after three digits so the next character can't
+            # be mistaken for part of the escape.
+            s += "\\%03o" % b
+    return s + '"'
+
+def uint_type(maximum):
+    for bits in 8, 16, 32:
+        if maximum < (1 << bits):
+            return "ghost_uint%i_t" % bits, "ghost/type/uint%i_t/ghost_uint%i_t.h" % (bits, bits)
+    raise Exception("Value too large: " + str(maximum))
+
+def write_array(outfile, declaration, values, width=76):
+    outfile.write(declaration + " = {\n")
+    line = "   "
+    for value in values:
+        item = " " + str(value) + ","
+        if len(line) + len(item) > width:
+            outfile.write(line + "\n")
+            line = "   "
+        line += item
+    outfile.write(line + "\n};\n\n")
+
+def identifier(key, prefix):
+    name = re.sub("[^A-Za-z0-9]", "_", key.decode("utf-8", "replace")).upper()
+    return prefix.upper() + "_" + name
+
+def write_output(output_filename, input_filename, prefix, keys, seeds, slots, emit_enum):
+    key_count = len(keys)
+    bucket_count = len(seeds)
+    upper = prefix.upper()
+
+    length_type, length_include = uint_type(max(len(k) for k in keys))
+    slot_type, slot_include = uint_type(key_count - 1)
+    includes = sorted(set([
+        "ghost/algorithm/fnv1a/ghost_fnv1a_u64.h",
+        "ghost/algorithm/perfect_hash/ghost_perfect_hash.h",
+        "ghost/language/ghost_inline_opt.h",
+        "ghost/language/ghost_maybe_unused.h",
+        "ghost/string/ghost_memcmp.h",
+        "ghost/type/size_t/ghost_size_t.h",
+        "ghost/type/uint16_t/ghost_uint16_t.h",
+        length_include,
+        slot_include,
+        ]))
+
+    source = "stdin" if input_filename == "-" else os.path.basename(input_filename)
+
+    with open(output_filename, "w") as outfile:
+        outfile.write("/*\n")
+        outfile.write(" * Generated by Ghost's tools/perfect_hash.py from " +
+                source + ". Do not edit.\n")
+        outfile.write(" */\n\n")
+
+        include_guard = upper + "_H_INCLUDED"
+        outfile.write("#ifndef " + include_guard + "\n")
+        outfile.write("#define " + include_guard + "\n\n")
+        for include in includes:
+            outfile.write('#include "' + include + '"\n')
+        outfile.write("\n")
+
+        outfile.write("#define " + upper + "_COUNT " + str(key_count) + "\n")
+        outfile.write("#define " + upper + "_BUCKET_COUNT " + str(bucket_count) + "\n\n")
+
+        if emit_enum:
+            outfile.write("enum {\n")
+            # No trailing comma; C89 doesn't allow it in enums.
+            outfile.write(",\n".join("    " + identifier(keys[i], prefix) + " = " + str(i)
+                    for i in range(key_count)))
+            outfile.write("\n};\n\n")
+
+        outfile.write("/* The keys in input order. */\n")
+        outfile.write("ghost_maybe_unused static const char* const " + prefix + "_keys[" + upper + "_COUNT] = {\n")
+        for key in keys:
+            outfile.write("    " + c_string(key) + ",\n")
+        outfile.write("};\n\n")
+
+        write_array(outfile, "ghost_maybe_unused static const " + length_type + " " +
+                prefix + "_lengths[" + upper + "_COUNT]", [len(k) for k in keys])
+        write_array(outfile, "ghost_maybe_unused static const ghost_uint16_t " +
+                prefix + "_seeds[" + upper + "_BUCKET_COUNT]", seeds)
+        write_array(outfile, "ghost_maybe_unused static const " + slot_type + " " +
+                prefix + "_slots[" + upper + "_COUNT]", slots)
+
+        outfile.write("""\
+/**
+ * Returns the index of the given key in %(prefix)s_keys[].
+ *
+ * Returns %(upper)s_COUNT if it is not one of the keys.
+ */
+ghost_maybe_unused static ghost_inline_opt
+ghost_size_t %(prefix)s_find(const char* key, ghost_size_t length) {
+    ghost_size_t index = %(prefix)s_slots[ghost_perfect_hash(ghost_fnv1a_u64(key, length),
+            %(prefix)s_seeds, %(upper)s_BUCKET_COUNT, %(upper)s_COUNT)];
+    if (%(prefix)s_lengths[index] != length || ghost_memcmp(%(prefix)s_keys[index], key, length) != 0)
+        return %(upper)s_COUNT;
+    return index;
+}
+
+#endif
+""" % {"prefix": prefix, "upper": upper})
+
+    print("Wrote " + output_filename)
+
+def read_keys(input_filename):
+    if input_filename == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(input_filename, "rb") as infile:
+            data = infile.read()
+    keys = []
+    for line in data.split(b"\n"):
+        if line.endswith(b"\r"):
+            line = line[:-1]
+        if len(line) > 0:
+            keys.append(line)
+    return keys
+
+def usage():
+    eprint("""
+This script generates a header with a minimal perfect hash table for a fixed
+set of keys. Each non-empty line of the input is a key.
+
+The header defines <prefix>_find() to look up a key and <prefix>_keys[] to get
+it back by index, along with the tables they use. The header requires Ghost.
+""")
+    eprint("Usage: " + sys.argv[0] + " -i <input> -o <output> -p <prefix> [-e]")
+    eprint()
+    eprint("    -i <input>    Input filename, one key per line, or - for stdin")
+    eprint("    -o <output>   Output filename")
+    eprint("    -p <prefix>   Prefix for all generated identifiers")
+    eprint("    -e            Also generate an enum of key indices")
+
+def go():
+    optlist, rest = getopt.getopt(sys.argv[1:], "h?i:o:p:e", ["help"])
+    if len(rest) > 0:
+        eprint("Unrecognized option: " + rest[0])
+        usage()
+        return 1
+
+    input_filename = None
+    output_filename = None
+    prefix = None
+    emit_enum = False
+
+    for opt in optlist:
+        if opt[0] in ["-h", "-?", "--help"]:
+           usage()
+           return 0
+
+        if opt[0] == "-i":
+            input_filename = opt[1]
+
+        if opt[0] == "-o":
+            output_filename = opt[1]
+
+        if opt[0] == "-p":
+            prefix = opt[1]
+
+        if opt[0] == "-e":
+            emit_enum = True
+
+    if input_filename is None or output_filename is None or prefix is None:
+        usage()
+        return 1
+
+    keys = read_keys(input_filename)
+    if len(keys) == 0:
+        eprint("No keys in " + ("stdin" if input_filename == "-" else input_filename))
+        return 1
+    if len(keys) > MASK32:
+        eprint("Too many keys")
+        return 1
+
+    # Two keys with the same hash can never be separated.
+    hashes = {}
+    for key in keys:
+        h = fnv1a_u64(key)
+        if h in hashes:
+            if hashes[h] == key:
+                eprint("Duplicate key: " + repr(key))
+            else:
+                eprint("Keys have the same hash: " + repr(hashes[h]) + " " + repr(key))
+            return 1
+        hashes[h] = key
+
+    if emit_enum:
+        names = set()
+        for key in keys:
+            name = identifier(key, prefix)
+            if name in names:
+                eprint("Keys have the same enum identifier: " + name)
+                return 1
+            names.add(name)
+
+    mixed = [mix(fnv1a_u64(key)) for key in keys]
+    for load in BUCKET_LOADS:
+        bucket_count = min(max(1, int(len(keys) / load + 0.5)), 1 << 32)
+        result = build(mixed, bucket_count)
+        if result is not None:
+            break
+        eprint("Failed to place keys with " + str(bucket_count) + " buckets, retrying")
+    else:
+        eprint("Failed to generate a perfect hash")
+        return 1
+
+    seeds, slots = result
+    write_output(output_filename, input_filename, prefix, keys, seeds, slots, emit_enum)
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(go())